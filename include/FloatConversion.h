@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace PythonCoreNative::RunTime::Parser
+{
+    /* Conversions between doubles and decimal text, for float literals as well as for
+       float() and repr() at run time. Parsing reads up to 19 significant digits into an
+       integer and scales it with a 128-bit power of five as Eisel and Lemire do; when
+       digits beyond those could change the result it falls back to strtod. Formatting
+       finds the shortest digits that read back to the same double with Ryu. The power
+       tables are computed exactly the first time either is used. */
+    class FloatConversion
+    {
+        public:
+            /* Python float syntax with an optional sign, underscores between digits, and
+               inf, infinity and nan in any case. False when the text is not a float. */
+            static bool Parse(std::wstring_view text, double &result);
+
+            /* Shortest digits of a finite double above zero, the value is the digits times
+               10**exponent. Returns the number of digits, at most 17. */
+            static unsigned int Shortest(double value, char digits[17], int &exponent);
+
+            /* The text Python's repr gives. */
+            static std::wstring Repr(double value);
+    };
+}
@@ -11,6 +11,9 @@ namespace PythonCoreNative::RunTime::Parser
         public:
             LexicalError(unsigned int position, std::shared_ptr<std::wstring> msg);
 
+            unsigned int GetPosition();
+            std::shared_ptr<std::wstring> GetMessage();
+
         protected:
             unsigned int mPosition;
             std::shared_ptr<std::wstring> mMsg;
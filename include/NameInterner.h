@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace PythonCoreNative::RunTime::Parser
+{
+    /* Hands out one shared text per distinct name, so repeated identifiers across the
+       files parsed by one worker share storage. Texts are const, as every token with the
+       name holds the same one. Not thread safe, keep one per thread. */
+    class NameInterner
+    {
+        public:
+            NameInterner();
+
+            std::shared_ptr<const std::wstring> Intern(const std::wstring &text);
+            std::size_t Count();
+
+        protected:
+            std::unordered_map<std::wstring, std::shared_ptr<const std::wstring>> mNames;
+    };
+}
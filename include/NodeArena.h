@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace PythonCoreNative::RunTime::Parser
+{
+    /* Bump allocator for the nodes of the trees one worker parses. Memory comes in
+       chunks aligned to their size, each counting the objects still alive in it, so a
+       chunk is freed with its last object and trees may outlive the arena. Allocation
+       is not thread safe, keep one arena per thread, objects may be released anywhere. */
+    class NodeArena
+    {
+        public:
+            static constexpr std::size_t ChunkSize = 64 * 1024;
+
+            NodeArena();
+            ~NodeArena();
+
+            NodeArena(const NodeArena &) = delete;
+            NodeArena &operator=(const NodeArena &) = delete;
+
+            void *Allocate(std::size_t size);
+            static void Release(void *pointer, std::size_t size);
+
+            /* Chunks taken since the arena was made. */
+            std::size_t ChunkCount();
+
+            template <typename T>
+            class Allocator
+            {
+                public:
+                    using value_type = T;
+
+                    Allocator(NodeArena *arena) : mArena(arena) {}
+
+                    template <typename U>
+                    Allocator(const Allocator<U> &other) : mArena(other.mArena) {}
+
+                    T *allocate(std::size_t count)
+                    {
+                        static_assert(alignof(T) <= alignof(std::max_align_t));
+                        return static_cast<T *>(mArena->Allocate(count * sizeof(T)));
+                    }
+
+                    void deallocate(T *pointer, std::size_t count)
+                    {
+                        NodeArena::Release(pointer, count * sizeof(T));
+                    }
+
+                    template <typename U>
+                    bool operator==(const Allocator<U> &other) const { return mArena == other.mArena; }
+
+                    template <typename U>
+                    bool operator!=(const Allocator<U> &other) const { return mArena != other.mArena; }
+
+                    NodeArena *mArena;
+            };
+
+        protected:
+            struct Chunk
+            {
+                std::atomic<std::size_t> mLive;
+            };
+
+            static void Retire(Chunk *chunk);
+
+            Chunk *mChunk;
+            std::size_t mUsed;
+            std::size_t mChunks;
+    };
+}
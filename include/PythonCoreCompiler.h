@@ -0,0 +1,34 @@
+#pragma once
+
+#include <PythonCoreParser.h>
+#include <compiler/CodeObject.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Compiler
+{
+    /* Compiles a file input tree into register based bytecode. Locals live in the
+       registers the symbol table assigned, so operands are read in place instead of
+       being pushed and popped. Constructs the compiler does not handle yet, such as
+       try, with, import, generators and star arguments, are reported as SyntaxError at
+       their position. Operands are 8 bits, so a function, class body or module can use
+       at most 256 registers for its locals and temporaries together, more is a
+       SyntaxError at the start of the function. */
+    class PythonCoreCompiler
+    {
+        public:
+            /* The source the tree was parsed from, for the line tables. */
+            PythonCoreCompiler(std::shared_ptr<std::wstring> source);
+
+            std::shared_ptr<CodeObject> CompileFileInput(std::shared_ptr<Parser::AST::FileInputNode> root);
+
+            /* Parses the source as file input and compiles it. */
+            static std::shared_ptr<CodeObject> CompileSource(std::shared_ptr<std::wstring> source);
+
+        protected:
+            std::shared_ptr<std::wstring> mSource;
+            std::vector<unsigned int> mLineStarts;
+    };
+}
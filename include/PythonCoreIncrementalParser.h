@@ -0,0 +1,81 @@
+#pragma once
+
+#include <PythonCoreParser.h>
+#include <ast/FileInputNode.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Parser
+{
+    /* mOldLength characters at mStart were replaced by mNewLength characters. */
+    struct TextEdit
+    {
+        unsigned int mStart;
+        unsigned int mOldLength;
+        unsigned int mNewLength;
+    };
+
+    /* Every node and token of one file level statement, owned by the tree, so the
+       statement is shifted with a linear scan instead of a walk. */
+    struct StatementSpans
+    {
+        std::vector<AST::Node *> mNodes;
+        std::vector<Token *> mTokens;
+    };
+
+    /* A parsed file together with the end boundary of every file level statement.
+       Statements reused after an edit are not moved by Reparse, each keeps the distance
+       it still has to move and is shifted when it is asked for, so an edit costs the
+       statements it reparses rather than the whole file. Asking for the root shifts
+       every statement still pending. Not safe to use from several threads. */
+    class ParsedFile
+    {
+        public:
+            ParsedFile( std::shared_ptr<std::wstring> source,
+                        std::shared_ptr<AST::FileInputNode> root,
+                        std::vector<unsigned int> boundaries,
+                        std::vector<StatementSpans> spans,
+                        std::vector<int> pending,
+                        unsigned int reusedStatements );
+
+            std::shared_ptr<std::wstring> GetSource();
+            /* Null once the file was given to Reparse. */
+            std::shared_ptr<AST::FileInputNode> GetRoot();
+            std::shared_ptr<AST::StatementNode> GetStatement(unsigned int index);
+            const std::vector<unsigned int> & GetBoundaries();
+            unsigned int GetReusedStatements();
+
+        protected:
+            void Settle(unsigned int index);
+
+            std::shared_ptr<std::wstring> mSource;
+            std::shared_ptr<AST::FileInputNode> mRoot;
+            std::vector<unsigned int> mBoundaries;
+            std::vector<StatementSpans> mSpans;
+            std::vector<int> mPending;
+            unsigned int mReusedStatements;
+
+            friend class PythonCoreIncrementalParser;
+    };
+
+    /* Reparse keeps every file level statement outside the edited region, shifting the
+       ones after it, and parses only the edited statements plus one on each side. When
+       the new statements do not end exactly where the old ones did, the edit changed the
+       file structure and the whole file is parsed again.
+       Reused subtrees are moved, not copied, so Reparse takes them from the previous
+       ParsedFile, whose root is null afterwards. A reparse that fails leaves it intact. */
+    class PythonCoreIncrementalParser
+    {
+        public:
+            PythonCoreIncrementalParser(unsigned int tabSize = 4, unsigned int maxDepth = PythonCoreParser::DefaultMaxDepth);
+
+            std::shared_ptr<ParsedFile> Parse(std::shared_ptr<std::wstring> source);
+            std::shared_ptr<ParsedFile> Reparse(std::shared_ptr<ParsedFile> previous, const TextEdit &edit, std::shared_ptr<std::wstring> source);
+
+        protected:
+            unsigned int mTabSize;
+            unsigned int mMaxDepth;
+    };
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <PythonCoreParser.h>
+#include <ast/MappedCompactTree.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace PythonCoreNative::RunTime::Parser
+{
+    struct ParseCacheOptions
+    {
+        std::uint64_t mMaxBytes = 1ull << 30;
+        unsigned int mTabSize = 4;
+        unsigned int mMaxDepth = PythonCoreParser::DefaultMaxDepth;
+    };
+
+    /* File input parses stored as MappedCompactTree files in a directory, named by a hash
+       of the source and of everything that changes the tree: parser version, tokenizer
+       revision, format version and options. A hit is only used when the stored source
+       equals the source asked for, so a hash collision costs a parse, never a wrong tree.
+       Entries are published by rename and never modified, so any number of processes
+       may share the directory. Hits refresh the file time, and once the directory grows
+       past mMaxBytes the least recently used entries are removed. Safe to use from
+       several threads. */
+    class PythonCoreParseCache
+    {
+        public:
+            /* Bump when a parser change alters the trees it builds or which sources it
+               accepts. Version 2 parses relative imports and charges brackets and suites
+               DeepLevel nesting levels. Tokenizer changes are keyed by
+               PythonCoreTokenizer::Revision instead. */
+            static constexpr std::uint32_t ParserVersion = 2;
+
+            PythonCoreParseCache(   const std::string &directory,
+                                    const ParseCacheOptions &options = ParseCacheOptions());
+
+            /* Tree of the source as file input. Parse errors are thrown as by
+               ParseFileInput and nothing is stored. When the entry can not be written the
+               tree is still returned, backed by memory. */
+            std::shared_ptr<AST::MappedCompactTree> Parse(std::shared_ptr<std::wstring> source);
+
+            /* Removes the least recently used entries until the directory fits mMaxBytes,
+               and temporary files left behind by writers that died. */
+            void Evict();
+
+            std::string GetEntryPath(const std::wstring &source);
+            std::uint64_t GetHits();
+            std::uint64_t GetMisses();
+            std::uint64_t GetBytes();
+
+        protected:
+            std::string mDirectory;
+            ParseCacheOptions mOptions;
+            std::atomic<std::uint64_t> mHits;
+            std::atomic<std::uint64_t> mMisses;
+            std::atomic<std::uint64_t> mBytes;     /* directory size as last scanned, kept by stores */
+            std::mutex mEvictLock;
+    };
+}
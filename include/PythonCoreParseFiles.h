@@ -0,0 +1,48 @@
+#pragma once
+
+#include <PythonCoreParser.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Parser
+{
+    struct ParseFilesOptions
+    {
+        unsigned int mThreads = 0;      /* 0 uses one worker per hardware thread */
+        unsigned int mTabSize = 4;
+        unsigned int mMaxDepth = PythonCoreParser::DefaultMaxDepth;
+        bool mPatternMemo = true;
+        bool mLazyFunctionBodies = false;
+        bool mErrorRecovery = false;
+    };
+
+    /* One parsed file. On failure mRoot is null and mError holds the lexer, parser or
+       io message, mErrorPosition the offset in the decoded source. With error recovery
+       only io errors fail, parse errors are listed in mDiagnostics. */
+    struct ParseFileResult
+    {
+        std::string mPath;
+        std::shared_ptr<std::wstring> mSource;
+        std::shared_ptr<AST::StatementNode> mRoot;
+        std::shared_ptr<std::wstring> mError;
+        unsigned int mErrorPosition = 0;
+        std::vector<std::shared_ptr<SyntaxError>> mDiagnostics;
+        unsigned int mWorker = 0;
+    };
+
+    /* Parses every file as file input on a work stealing pool, largest files first.
+       Each worker allocates the nodes of its trees from its own NodeArena.
+       The callback runs on the worker threads but never on two at once, in completion
+       order. Each call owns its pool, so calls on separate threads do not interfere.
+       An exception thrown by the callback stops the pool and is rethrown here. */
+    void ParseFiles(    const std::vector<std::string> &paths,
+                        const ParseFilesOptions &options,
+                        std::function<void(ParseFileResult &)> callback );
+
+    /* UTF-8 to code points, an initial byte order mark is dropped and malformed
+       sequences become U+FFFD. */
+    void DecodeUtf8(const std::string &bytes, std::wstring &text);
+}
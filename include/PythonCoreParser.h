@@ -2,6 +2,7 @@
 
 #include <PythonCoreTokenizer.h>
 #include <SyntaxError.h>
+#include <NodeArena.h>
 
 #include <ast/ExpressionNode.h>
 #include <ast/StatementNode.h>
@@ -78,6 +79,7 @@
 #include <ast/IfStatementNode.h>
 #include <ast/ElifStatementNode.h>
 #include <ast/ElseStatementNode.h>
+#include <ast/ErrorStatementNode.h>
 #include <ast/WhileStatementNode.h>
 #include <ast/ForStatementNode.h>
 #include <ast/WithStatementNode.h>
@@ -169,35 +171,62 @@
 
 
 #include <memory>
+#include <unordered_map>
 
 namespace PythonCoreNative::RunTime::Parser
 {
     class PythonCoreParser
     {
         public:
-            PythonCoreParser(std::shared_ptr<PythonCoreTokenizer> lexer);
+            /* Depth is counted in units. A bracket, trailer or suite level costs DeepLevel
+               of them, as the descent it starts takes about 1.4 KB of native stack, the
+               other guarded levels one. The default limit keeps a parse within about
+               150 KB of stack, so it fails with SyntaxError on a 256 KB thread stack. */
+            static const unsigned int DefaultMaxDepth = 200;
+            static const unsigned int DeepLevel = 2;
+
+            PythonCoreParser(std::shared_ptr<PythonCoreTokenizer> lexer, unsigned int maxDepth = DefaultMaxDepth);
 
             std::shared_ptr<AST::TypeNode> ParseFuncTypeInput();
             std::shared_ptr<AST::StatementNode> ParseSingleInput();
             std::shared_ptr<AST::StatementNode> ParseFileInput();
             std::shared_ptr<AST::StatementNode> ParseEvalInput();
 
+            /* File level statements from the current token up to the first token starting at
+               or after end. The full start of the token following each statement is recorded
+               in boundaries, so the statements partition the source they were parsed from. */
+            void ParseFileInputStatements(  unsigned int end,
+                                            std::shared_ptr<std::vector<std::shared_ptr<AST::StatementNode>>> nodes,
+                                            std::shared_ptr<std::vector<std::shared_ptr<Token>>> newlines,
+                                            std::vector<unsigned int> *boundaries );
+
+            /* Caches pattern rule results per token inside 'match' statements, on by default. */
+            void SetPatternMemo(bool enabled);
+
+            /* Skims indented function bodies for their extent and defers parsing them to the
+               first FuncDefStatementNode::GetNext, off by default. Token errors and unbalanced
+               brackets are still raised here, syntax errors inside a body only on access. */
+            void SetLazyFunctionBodies(bool enabled);
+
+            /* Off by default. When on, a statement that fails to parse is recorded in the
+               diagnostics and its tokens, up to the next Newline, the Dedent closing its block
+               or a statement keyword, become an ErrorStatementNode, so ParseFileInput always
+               returns a FileInputNode. A lexical error ends the file, it is recorded with a
+               null symbol. Lazily parsed function bodies do not recover. */
+            void SetErrorRecovery(bool enabled);
+            const std::vector<std::shared_ptr<SyntaxError>> & GetDiagnostics();
+
+            /* Nodes are allocated from the arena when one is set, lazily parsed function
+               bodies excepted, as they may be parsed on another thread. */
+            void SetArena(std::shared_ptr<NodeArena> arena);
+
 
         protected:
             std::shared_ptr<AST::ExpressionNode> ParseAtom();
             std::shared_ptr<AST::ExpressionNode> ParseAtomExpr();
-            std::shared_ptr<AST::ExpressionNode> ParsePower();
-            std::shared_ptr<AST::ExpressionNode> ParseFactor();
-            std::shared_ptr<AST::ExpressionNode> ParseTerm();
-            std::shared_ptr<AST::ExpressionNode> ParseArith();
-            std::shared_ptr<AST::ExpressionNode> ParseShift();
-            std::shared_ptr<AST::ExpressionNode> ParseAndExpr();
-            std::shared_ptr<AST::ExpressionNode> ParseXorExpr();
+            std::shared_ptr<AST::ExpressionNode> ParseBinary(unsigned int minPower);
             std::shared_ptr<AST::ExpressionNode> ParseOrExpr();
             std::shared_ptr<AST::ExpressionNode> ParseStarExpr();
-            std::shared_ptr<AST::ExpressionNode> ParseComparison();
-            std::shared_ptr<AST::ExpressionNode> ParseNotTest();
-            std::shared_ptr<AST::ExpressionNode> ParseAndTest();
             std::shared_ptr<AST::ExpressionNode> ParseOrTest();
             std::shared_ptr<AST::ExpressionNode> ParseLambda(bool isCond);
             std::shared_ptr<AST::ExpressionNode> ParseTestNoCond();
@@ -243,6 +272,7 @@ namespace PythonCoreNative::RunTime::Parser
             std::shared_ptr<AST::StatementNode> ParseFuncDef();
             std::shared_ptr<AST::StatementNode> ParseParameter();
             std::shared_ptr<AST::StatementNode> ParseFuncBodySuite();
+            void SkipFuncBodySuite();
             std::shared_ptr<AST::StatementNode> ParseTypedArgsList();
             std::shared_ptr<AST::StatementNode> ParseTypedAssign();
             std::shared_ptr<AST::StatementNode> ParseTFPDef();
@@ -250,6 +280,7 @@ namespace PythonCoreNative::RunTime::Parser
             std::shared_ptr<AST::StatementNode> ParseSuite();
             std::shared_ptr<AST::StatementNode> ParseAsync();
             std::shared_ptr<AST::StatementNode> ParseStmt();
+            std::shared_ptr<AST::StatementNode> ParseStmtOrError();
             std::shared_ptr<AST::StatementNode> ParseSimpleStmt();
             std::shared_ptr<AST::StatementNode> ParseSmallStmt();
             std::shared_ptr<AST::StatementNode> ParseExpr();
@@ -309,10 +340,67 @@ namespace PythonCoreNative::RunTime::Parser
             std::shared_ptr<AST::StatementNode> ParsePositionalPattern();
             std::shared_ptr<AST::StatementNode> ParseKeywordPatterns();
             std::shared_ptr<AST::StatementNode> ParseKeywordPattern();
+            bool IsKeywordPatternStart();
+
+        protected:
+            /* Counts one level of bracket, suite, lambda or pattern nesting for as long as it
+               lives, weight units deep, and raises SyntaxError once the parser's limit would
+               be passed. */
+            class NestingGuard
+            {
+                public:
+                    NestingGuard(PythonCoreParser *parser, unsigned int weight = 1);
+                    ~NestingGuard();
+
+                protected:
+                    PythonCoreParser *mParser;
+                    unsigned int mWeight;
+            };
+
+            void CheckNesting(unsigned int extra);
+
+        protected:
+            /* Packrat memo for the pattern rules that are tried and rewound. Key is the
+               rule and the token index it started at, the entry holds either the parsed node
+               and the token index after it, or the error it raised. */
+            enum class PatternRule : unsigned int
+            {
+                ClosedPattern, OpenSequencePattern, MaybeeSequencePattern, ClassPattern
+            };
+
+            struct PatternMemoEntry
+            {
+                std::shared_ptr<AST::StatementNode> mNode;
+                std::shared_ptr<SyntaxError> mError;
+                unsigned int mEndToken;
+            };
+
+            std::shared_ptr<AST::StatementNode> ParseMemoized(PatternRule rule, std::shared_ptr<AST::StatementNode> (PythonCoreParser::*parse)());
+
+            std::shared_ptr<AST::ExpressionNode> MakeBinaryNode(    unsigned int startPos, unsigned int endPos,
+                                                                    std::shared_ptr<AST::ExpressionNode> left,
+                                                                    std::shared_ptr<Token> symbol,
+                                                                    std::shared_ptr<Token> symbol2,
+                                                                    std::shared_ptr<AST::ExpressionNode> right );
+
+            template <typename T, typename... Args>
+            std::shared_ptr<T> MakeNode(Args&&... args)
+            {
+                if (mArena == nullptr) return std::make_shared<T>(std::forward<Args>(args)...);
+                return std::allocate_shared<T>(NodeArena::Allocator<T>(mArena.get()), std::forward<Args>(args)...);
+            }
 
         protected:
             std::shared_ptr<PythonCoreTokenizer> mLexer;
+            std::shared_ptr<NodeArena> mArena;
             unsigned int mFlowLevel;
             unsigned int mFuncLevel;
+            unsigned int mMaxDepth;
+            unsigned int mDepth;
+            bool mUsePatternMemo;
+            bool mLazyFunctionBodies;
+            bool mErrorRecovery;
+            std::vector<std::shared_ptr<SyntaxError>> mDiagnostics;
+            std::unordered_map<unsigned long long, PatternMemoEntry> mPatternMemo;
     };
 }
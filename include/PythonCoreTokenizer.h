@@ -3,12 +3,14 @@
 #include <Token.h>
 #include <SourceBuffer.h>
 #include <LexicalError.h>
+#include <NameInterner.h>
 
 #include <memory>
 #include <map>
 #include <string>
 #include <sstream>
 #include <stack>
+#include <vector>
 
 namespace PythonCoreNative::RunTime::Parser
 {
@@ -16,15 +18,46 @@ namespace PythonCoreNative::RunTime::Parser
     {
 
         public:
+            /* Bump when a change alters the tokens or trivia scanned from some source.
+               Revision 2 escapes quotes in strings, keeps vertical tab and per token
+               whitespace trivia, and scans '..' as two dots. */
+            static constexpr std::uint32_t Revision = 2;
+
             PythonCoreTokenizer(unsigned int tabSize, std::shared_ptr<SourceBuffer> sourceBuffer);
 
+            /* Replays tokens scanned before, with the source position after each, starting
+               at the first. Advancing past the last token keeps it as current. */
+            PythonCoreTokenizer(std::vector<std::shared_ptr<Token>> tokens, std::vector<unsigned int> positions);
+
             std::shared_ptr<Token> CurSymbol();
             unsigned int Position();
             void Advance();
-            void UnWindTokenStream(unsigned int pos);
+
+            /* Tokens scanned are kept, so the parser can rewind to an earlier token and
+               replay the stream without scanning the source again. Indexes count from the
+               first token of the source. */
+            unsigned int TokenIndex();
+            void Rewind(unsigned int tokenIndex);
+
+            /* Drops the tokens before tokenIndex, which can not be rewound to after. The
+               parser releases them after every file level statement, so the buffer holds
+               one statement's tokens instead of the whole file's. */
+            void Release(unsigned int tokenIndex);
+
+            /* Tokenizer replaying the tokens first to last, both already scanned. */
+            std::shared_ptr<PythonCoreTokenizer> Replay(unsigned int first, unsigned int last);
+
+            /* Name texts are taken from the interner when one is set. */
+            void SetInterner(std::shared_ptr<NameInterner> interner);
 
         protected:
+            void ScanToken();
+
             std::shared_ptr<Token> mCurSymbol;
+            std::vector<std::shared_ptr<Token>> mTokens;
+            std::vector<unsigned int> mTokenPositions;
+            unsigned int mFirstToken;
+            unsigned int mNextToken;
 
             const static inline std::map<std::wstring, TokenKind> mReservedKeywords
                 {
@@ -66,6 +99,7 @@ namespace PythonCoreNative::RunTime::Parser
                 };
 
             std::shared_ptr<SourceBuffer> mSourceBuffer;
+            std::shared_ptr<NameInterner> mInterner;
             unsigned int mPosition;
             bool mAtBOL;
             bool mIsBlankLine;
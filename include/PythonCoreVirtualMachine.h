@@ -0,0 +1,175 @@
+#pragma once
+
+#include <vm/Value.h>
+#include <vm/Object.h>
+#include <vm/ExecutionError.h>
+#include <compiler/CodeObject.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::VM
+{
+    /* Interpreter for the register code of the compiler. Frames are windows of one
+       contiguous register stack: a call places the arguments right after the function
+       register, and the callee frame starts on the first argument so nothing is copied.
+       Python calls run in the same dispatch loop without recursing in C++. Objects are
+       collected by mark and sweep at calls and loop back edges, the only places where
+       every live value sits in a register. Errors leave as ExecutionError. */
+    class VirtualMachine
+    {
+        public:
+            static constexpr unsigned int MaxFrames = 1000;
+            static constexpr std::size_t StackSize = 1 << 18;
+
+            /* Hits and misses of the inline cache of one instruction. */
+            struct CacheStatistics
+            {
+                std::wstring mFunction;
+                unsigned int mLine;
+                Compiler::OpCode mOp;
+                std::wstring mName;
+                std::uint64_t mHits;
+                std::uint64_t mMisses;
+            };
+
+            VirtualMachine();
+            ~VirtualMachine();
+
+            /* Runs module code in the globals of this machine. */
+            void Run(std::shared_ptr<Compiler::CodeObject> code);
+            /* Parses, compiles and runs file input. */
+            void RunSource(std::shared_ptr<std::wstring> source);
+
+            void SetOutput(std::wostream *output);
+            std::wostream & GetOutput();
+            /* Undefined when the module has no such global. */
+            Value GetGlobal(const std::wstring &name);
+
+            /* Calls a value from native code, used by builtins. */
+            Value Call(Value callable, const std::vector<Value> &args);
+
+            template <typename T, typename... Args>
+            T * New(Args&&... args)
+            {
+                auto object = new T(std::forward<Args>(args)...);
+                object->mNext = mObjects;
+                mObjects = object;
+                mObjectCount++;
+                return object;
+            }
+
+            Value NewString(std::wstring text);
+            /* Characters of width bytes each, see StringObject. */
+            Value NewString(std::string data, unsigned int width);
+            /* One character string, shared for the first 256 characters. */
+            Value Character(std::uint32_t character);
+            /* Inline when it fits, boxed otherwise. */
+            Value NewInteger(std::int64_t value);
+            /* A plain integer when it fits 64 bits. */
+            Value NewInteger(BigInteger value);
+            /* One string object per distinct text, kept for the life of the machine. */
+            Value Intern(const std::wstring &text);
+
+            bool IsTrue(Value value);
+            std::wstring Str(Value value);
+            std::wstring Repr(Value value);
+            std::wstring TypeName(Value value);
+
+            [[noreturn]] static void Throw(const wchar_t *type, std::wstring message);
+
+            Value Binary(Compiler::OpCode op, Value a, Value b);
+            Value Unary(Compiler::OpCode op, Value a);
+            Value Compare(Compiler::OpCode op, Value a, Value b);
+            bool Contains(Value container, Value item);
+            Value GetItem(Value object, Value key);
+            void SetItem(Value object, Value key, Value value);
+            void DeleteItem(Value object, Value key);
+            Value GetAttr(Value object, Value name);
+            void SetAttr(Value object, Value name, Value value);
+            void DeleteAttr(Value object, Value name);
+            Value GetIter(Value object);
+            /* False when the iterator is exhausted. */
+            bool Next(Value iterator, Value &item);
+            std::int64_t Length(Value object);
+
+            /* Of the code units alive, in no particular order. */
+            std::vector<CacheStatistics> GetCacheStatistics();
+
+            std::size_t GetObjectCount();
+            std::size_t GetCollectionCount();
+            void Collect();
+
+        protected:
+            struct Frame
+            {
+                CodeUnitObject *mCode;
+                const Compiler::Instruction *mPc;
+                Value *mRegisters;
+                DictObject *mNamespace;         /* class bodies */
+                InstanceObject *mInstance;      /* __init__ frames return the instance */
+            };
+
+            Value Execute(unsigned int entry);
+
+            CodeUnitObject * Materialize(std::shared_ptr<Compiler::CodeObject> code);
+            Value ConstantValue(const Compiler::Constant &constant);
+
+            /* Sets up the frame of a Python call whose arguments start at args. */
+            void PushFrame(FunctionObject *function, Value *args, unsigned int count, TupleObject *keywords);
+            void BindArguments(FunctionObject *function, Value *args, unsigned int count, TupleObject *keywords);
+            /* Calls anything but a Python function, the result goes to base[0]. False
+               when a frame was pushed for the dispatch loop to run instead. */
+            bool CallOther(Value *base, unsigned int count, TupleObject *keywords);
+            Value * StackTop();
+
+            void InstallBuiltins();
+            ClassObject * BuiltinClass(const wchar_t *name, ClassObject *base);
+            Value MakeClass(const std::wstring &name, FunctionObject *body, Value *bases, unsigned int count);
+            Value Instantiate(ClassObject *type, Value *args, unsigned int count);
+            /* Instance whose dict starts at the empty shape. */
+            InstanceObject * NewInstance(ClassObject *type);
+            [[noreturn]] void Raise(Value exception);
+            /* Attributes a class pattern asks of the subject, None when it is not an instance. */
+            Value MatchClass(Value type, Value subject, unsigned int count, TupleObject *names);
+
+            /* GetAttr and SetAttr through the inline cache of the instruction. */
+            Value GetAttr(Value object, Value name, InlineCache &cache);
+            void SetAttr(Value object, Value name, Value value, InlineCache &cache);
+
+            void Mark(Value value);
+            void Mark(Object *object);
+            void CollectIfNeeded();
+
+            std::unique_ptr<Value[]> mStack;
+            std::unique_ptr<Frame[]> mFrames;
+            unsigned int mFrameCount;
+
+            DictObject *mGlobals;
+            DictObject *mBuiltins;
+            DictObject *mListMethods;
+            DictObject *mDictMethods;
+            DictObject *mStringMethods;
+            ClassObject *mObjectClass;
+            std::unique_ptr<Shape> mRootShape;
+            /* Changes when a class is made or a class attribute set or deleted. */
+            std::uint64_t mClassEpoch;
+            std::unordered_map<std::wstring, StringObject *> mInterned;
+            Value mCharacters[256];
+            std::vector<Object *> mGray;
+            /* Containers whose repr is being built, innermost last. */
+            std::vector<Object *> mRepresenting;
+
+            Object *mObjects;
+            std::size_t mObjectCount;
+            std::size_t mThreshold;
+            std::size_t mCollections;
+
+            std::wostream *mOutput;
+
+            friend class Builtins;
+    };
+}
@@ -13,6 +13,10 @@ namespace PythonCoreNative::RunTime::Parser
         public:
             SyntaxError(unsigned int position, std::shared_ptr<Token> curSymbol, std::shared_ptr<std::wstring> msg);
 
+            unsigned int GetPosition();
+            std::shared_ptr<Token> GetSymbol();
+            std::shared_ptr<std::wstring> GetMessage();
+
         protected:
             unsigned int mPosition;
             std::shared_ptr<Token> mSymbol;
@@ -24,6 +24,12 @@ namespace PythonCoreNative::RunTime::Parser
             unsigned int GetTokenEndPosition();
             std::shared_ptr<std::vector<std::shared_ptr<Trivia>>> GetTriviaList();
 
+            /* Start of the leading trivia, or of the token itself when there is none. */
+            unsigned int GetFullStartPosition();
+
+            /* Moves the token and its trivia by delta characters. */
+            void Shift(int delta);
+
         protected:
             TokenKind mKind;
             unsigned int mTokenStartPosition;
@@ -37,7 +43,7 @@ namespace PythonCoreNative::RunTime::Parser
         public:
             NameToken(  unsigned int startPosition, 
                         unsigned int endPosition, 
-                        std::shared_ptr<std::wstring> text,
+                        std::shared_ptr<const std::wstring> text,
                         std::shared_ptr<std::vector<std::shared_ptr<Trivia>>> triviaList);
 
             bool IsCaseSoftKeyword();   /* 'case' */
@@ -45,10 +51,10 @@ namespace PythonCoreNative::RunTime::Parser
             bool IsWildCardPattern();    /* '_' */
             bool IsNotWildCardPrefixed();   /* ! _Name */
 
-            std::shared_ptr<std::wstring> GetText();
+            std::shared_ptr<const std::wstring> GetText();
 
         protected:
-            std::shared_ptr<std::wstring> mText;
+            std::shared_ptr<const std::wstring> mText;
     };
 
     class NumberToken  : public Token
@@ -80,18 +86,21 @@ namespace PythonCoreNative::RunTime::Parser
                             bool isRaw,
                             bool isUnicode,
                             bool isFormated,
+                            bool isBytes,
                             std::shared_ptr<std::vector<std::shared_ptr<Trivia>>> triviaList);
 
             std::shared_ptr<std::wstring> GetText();
             bool IsRaw();
             bool IsUnicode();
             bool IsFormated();
+            bool IsBytes();
 
         protected:
             std::shared_ptr<std::wstring> mText;
             bool mIsRaw;
             bool mIsUnicode;
             bool mIsFormated;
+            bool mIsBytes;
     };
 
     class TypeCommentToken : public Token
@@ -7,17 +7,27 @@
 
 namespace PythonCoreNative::RunTime::Parser
 {
+    enum class TriviaKind
+    {
+        NewLine,
+        LineContinuation,
+        WhiteSpace,
+        Comment
+    };
 
     class Trivia
     {
         public:
-            Trivia(unsigned int startPosition, unsigned int endPosition);
+            Trivia(unsigned int startPosition, unsigned int endPosition, TriviaKind kind);
             unsigned int GetStartPosition();
             unsigned int GetEndPosition();
+            TriviaKind GetKind();
+            void Shift(int delta);
 
         protected:
             unsigned int mTriviaStartPosition;
             unsigned int mTriviaEndPosition;
+            TriviaKind mKind;
 
     };
 
@@ -47,6 +57,7 @@ namespace PythonCoreNative::RunTime::Parser
     {
         public:
             WhiteSpaceTrivia(unsigned int startPos, unsigned int endPosition, wchar_t ch);
+            wchar_t GetSpaceChar();
 
         protected:
             wchar_t mSpaceChar;
@@ -0,0 +1,76 @@
+
+#pragma once
+
+#include <ast/Node.h>
+#include <Token.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    /* Fixed size node header. Span is stored as token indices, so the source
+       positions and the node's own tokens are recovered from the token table. */
+    struct CompactNode
+    {
+        NodeKind mKind;
+        unsigned short mFlags;
+        unsigned int mFirstToken;
+        unsigned int mLastToken;    /* mFirstToken - 1 when node holds no tokens */
+        unsigned int mFirstChild;
+        unsigned int mNextSibling;
+    };
+
+    /* Token record. Text and trivia are not copied, they are sliced out of the
+       source buffer when asked for. */
+    struct CompactToken
+    {
+        TokenKind mKind;
+        unsigned int mStart;
+        unsigned int mEnd;
+    };
+
+    class CompactTree
+    {
+        public:
+            static constexpr unsigned int NoIndex = 0xffffffff;
+
+            CompactTree(std::shared_ptr<std::wstring> source);
+
+            static std::shared_ptr<CompactTree> FromNode(std::shared_ptr<Node> root, std::shared_ptr<std::wstring> source);
+
+            /* Builder, nodes must be opened in pre-order and closed in post-order. */
+            unsigned int OpenNode(NodeKind kind);
+            unsigned int AddToken(TokenKind kind, unsigned int start, unsigned int end);
+            void CloseNode(unsigned int index);
+
+            unsigned int Root();
+            unsigned int NodeCount();
+            unsigned int TokenCount();
+
+            const CompactNode & GetNode(unsigned int index);
+            const CompactToken & GetToken(unsigned int index);
+            unsigned int GetFirstChild(unsigned int index);
+            unsigned int GetNextSibling(unsigned int index);
+            unsigned int GetChildCount(unsigned int index);
+            unsigned int GetStart(unsigned int index);
+            unsigned int GetEnd(unsigned int index);
+            std::wstring GetTokenText(unsigned int index);
+            std::shared_ptr<std::wstring> GetSource();
+
+            std::size_t MemoryUsage();
+            std::size_t SourceMemoryUsage();
+
+        protected:
+            std::vector<CompactNode> mNodes;
+            std::vector<CompactToken> mTokens;
+            std::vector<unsigned int> mOpenNodes;
+            std::vector<unsigned int> mLastChild;
+            std::shared_ptr<std::wstring> mSource;
+            std::size_t mSourceMemoryUsage;
+
+            friend class CompactTreeWriter;
+            friend class MappedCompactTree;
+    };
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <ast/Node.h>
+#include <Token.h>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    enum class FoldedKind : unsigned int
+    {
+        None,
+        Bool,
+        Integer,
+        Float,
+        String
+    };
+
+    /* Value of a constant expression. Strings are the string tokens they are made of, in
+       order, so a folded string is still made of literals of the source. */
+    struct FoldedValue
+    {
+        FoldedKind mKind;
+        std::int64_t mInteger;      /* also 0 or 1 for Bool */
+        double mReal;
+        std::vector<std::shared_ptr<StringToken>> mTokens;
+        std::size_t mLength;        /* characters between the quotes, at least the decoded length */
+    };
+
+    /* Folds constant subexpressions of a tree: arithmetic, bitwise and unary operators
+       over number literals, 'not', string concatenation and repetition, and 'and', 'or'
+       and conditional expressions whose deciding operand is constant. The tree is not
+       changed, each folded expression maps to a literal node over its own span, or to
+       the operand a constant condition selects. Operations that would raise, overflow 64
+       bits or build strings beyond MaxStringLength are left for run time, as CPython
+       does with its size limits. */
+    class ConstantFolder
+    {
+        public:
+            static constexpr std::size_t MaxStringLength = 4096;
+            static constexpr std::size_t MaxStringTokens = 256;
+
+            static std::shared_ptr<ConstantFolder> Fold(std::shared_ptr<Node> root);
+
+            /* Replacement of the node, the node itself when it did not fold. */
+            std::shared_ptr<Node> Resolve(std::shared_ptr<Node> node);
+            /* Null when the expression is not constant. */
+            const FoldedValue * GetValue(Node *node);
+            /* False when the truth of the expression is only known at run time. */
+            bool GetTruth(Node *node, bool &truth);
+
+            std::size_t GetFoldedCount();
+
+        protected:
+            std::unordered_map<Node *, std::shared_ptr<Node>> mFolded;
+            std::unordered_map<Node *, FoldedValue> mValues;
+
+            friend class ConstantFolderWalker;
+    };
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <ast/StatementNode.h>
+#include <Token.h>
+
+#include <memory>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    /* Tokens skipped by the error recovering parser in place of a statement. */
+    class ErrorStatementNode : public StatementNode
+    {
+        public:
+            ErrorStatementNode(  
+                            unsigned int start, unsigned int end,
+                            std::shared_ptr<std::vector<std::shared_ptr<Token>>> nodes
+                        );
+
+            std::shared_ptr<std::vector<std::shared_ptr<Token>>> GetNodes();
+
+        protected:
+            std::shared_ptr<std::vector<std::shared_ptr<Token>>> mNodes;
+    };
+}
@@ -8,7 +8,7 @@ namespace PythonCoreNative::RunTime::Parser::AST
     class ExpressionNode : public Node
     {
         public:
-            ExpressionNode(unsigned int start, unsigned int end);
+            ExpressionNode(unsigned int start, unsigned int end, NodeKind kind);
 
         public:
             bool isExpressionNode() { return true; };
@@ -4,7 +4,10 @@
 #include <ast/ExpressionNode.h>
 #include <Token.h>
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace PythonCoreNative::RunTime::Parser::AST
@@ -24,6 +27,30 @@ namespace PythonCoreNative::RunTime::Parser::AST
                             std::shared_ptr<StatementNode> next
                         );
 
+            /* Lazy body, parsed by the thunk on the first GetNext. Threads forcing it at
+               once wait for the one parse, a thunk that throws is run again next time. */
+            FuncDefStatementNode(  
+                            unsigned int start, unsigned int end, 
+                            std::shared_ptr<Token> op1,
+                            std::shared_ptr<Token> op2,
+                            std::shared_ptr<StatementNode> left,
+                            std::shared_ptr<Token> op3,
+                            std::shared_ptr<ExpressionNode> right,
+                            std::shared_ptr<Token> op4,
+                            std::shared_ptr<Token> op5,
+                            std::function<std::shared_ptr<StatementNode>()> nextThunk
+                        );
+
+            std::shared_ptr<Token> GetOperator1();
+            std::shared_ptr<Token> GetOperator2();
+            std::shared_ptr<StatementNode> GetLeft();
+            std::shared_ptr<Token> GetOperator3();
+            std::shared_ptr<ExpressionNode> GetRight();
+            std::shared_ptr<Token> GetOperator4();
+            std::shared_ptr<Token> GetOperator5();
+            std::shared_ptr<StatementNode> GetNext();
+            bool IsNextParsed();
+
         protected:
             std::shared_ptr<Token> mOp1;
             std::shared_ptr<Token> mOp2;
@@ -33,5 +60,8 @@ namespace PythonCoreNative::RunTime::Parser::AST
             std::shared_ptr<Token> mOp4;
             std::shared_ptr<Token> mOp5;
             std::shared_ptr<StatementNode> mNext;
+            std::function<std::shared_ptr<StatementNode>()> mNextThunk;
+            std::once_flag mNextOnce;
+            std::atomic<bool> mNextParsed;
     };
 }
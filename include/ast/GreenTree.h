@@ -0,0 +1,135 @@
+
+#pragma once
+
+#include <ast/CompactTree.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    /* Token with the source text in front of it, so the texts of all tokens in order
+       are the source. Immutable and without position, shared freely. */
+    class GreenToken
+    {
+        public:
+            GreenToken(TokenKind kind, std::wstring fullText, unsigned int leadingWidth);
+
+            TokenKind GetKind() const;
+            unsigned int GetWidth() const;
+            unsigned int GetLeadingWidth() const;
+            const std::wstring & GetFullText() const;
+            std::wstring_view GetText() const;
+
+        protected:
+            TokenKind mKind;
+            unsigned int mLeadingWidth;
+            std::wstring mFullText;
+    };
+
+    class GreenNode;
+
+    struct GreenChild
+    {
+        std::shared_ptr<const GreenNode> mNode;
+        std::shared_ptr<const GreenToken> mToken;
+
+        unsigned int GetWidth() const;
+    };
+
+    /* Node kind, width and children with their offsets from the node's start. Never
+       changes after construction, edits build new nodes along the path to the root and
+       share everything else, so versions of a tree can live side by side and be read
+       from any thread. */
+    class GreenNode
+    {
+        public:
+            GreenNode(NodeKind kind, std::vector<GreenChild> children);
+
+            /* Identical tokens of the tree share one GreenToken. */
+            static std::shared_ptr<const GreenNode> FromCompactTree(CompactTree &tree);
+
+            NodeKind GetKind() const;
+            unsigned int GetWidth() const;
+            unsigned int GetChildCount() const;
+            const GreenChild & GetChild(unsigned int index) const;
+            unsigned int GetChildOffset(unsigned int index) const;
+
+            /* Copy with one child replaced. */
+            std::shared_ptr<const GreenNode> ReplaceChild(unsigned int index, GreenChild child) const;
+
+            /* Appends the full text, trivia included. */
+            void WriteTo(std::wstring &text) const;
+
+        protected:
+            NodeKind mKind;
+            unsigned int mWidth;
+            std::vector<GreenChild> mChildren;
+            std::vector<unsigned int> mOffsets;
+    };
+
+    class RedNode;
+
+    /* Token seen through its parent facade, with its absolute position. */
+    class RedToken
+    {
+        public:
+            RedToken(std::shared_ptr<const GreenToken> green, std::shared_ptr<RedNode> parent, unsigned int index, unsigned int position);
+
+            std::shared_ptr<const GreenToken> GetGreen();
+            std::shared_ptr<RedNode> GetParent();
+            unsigned int GetIndexInParent();
+            /* No green token, only the position and parent are meaningful. */
+            bool IsMissing();
+            TokenKind GetKind();
+            unsigned int GetFullStart();
+            unsigned int GetStart();
+            unsigned int GetEnd();
+            std::wstring_view GetText();
+
+        protected:
+            std::shared_ptr<const GreenToken> mGreen;
+            std::shared_ptr<RedNode> mParent;
+            unsigned int mIndex;
+            unsigned int mPosition;
+    };
+
+    /* Facade over a green node adding its absolute position and parent. Facades are
+       made on navigation and not kept, asking for a child twice gives two facades over
+       the same green node. */
+    class RedNode : public std::enable_shared_from_this<RedNode>
+    {
+        public:
+            RedNode(std::shared_ptr<const GreenNode> green, std::shared_ptr<RedNode> parent, unsigned int index, unsigned int position);
+
+            static std::shared_ptr<RedNode> CreateRoot(std::shared_ptr<const GreenNode> green);
+
+            std::shared_ptr<const GreenNode> GetGreen();
+            std::shared_ptr<RedNode> GetParent();
+            unsigned int GetIndexInParent();
+            NodeKind GetKind();
+            unsigned int GetFullStart();
+            unsigned int GetFullEnd();
+
+            unsigned int GetChildCount();
+            bool IsToken(unsigned int index);
+            std::shared_ptr<RedNode> GetChildNode(unsigned int index);     /* null for a token */
+            RedToken GetChildToken(unsigned int index);
+
+            /* Token whose full text holds the position, searched downwards from here. When
+               the search ends on a node without children the token has no green token,
+               see IsMissing, and its parent is that node. */
+            RedToken FindToken(unsigned int position);
+
+            /* Root of a new tree where this node is replaced, sharing every other node. */
+            std::shared_ptr<RedNode> ReplaceWith(std::shared_ptr<const GreenNode> green);
+
+        protected:
+            std::shared_ptr<const GreenNode> mGreen;
+            std::shared_ptr<RedNode> mParent;
+            unsigned int mIndex;
+            unsigned int mPosition;
+    };
+}
@@ -19,6 +19,9 @@ namespace PythonCoreNative::RunTime::Parser::AST
                             std::shared_ptr<ExpressionNode> right
                         );
 
+            std::shared_ptr<Token> GetOperator();
+            std::shared_ptr<ExpressionNode> GetRight();
+
         protected:
             std::shared_ptr<Token> mOp1;
             std::shared_ptr<ExpressionNode> mRight;
@@ -22,6 +22,13 @@ namespace PythonCoreNative::RunTime::Parser::AST
                             std::shared_ptr<StatementNode> next
                         );
 
+            std::shared_ptr<Token> GetOperator1();
+            std::shared_ptr<ExpressionNode> GetLeft();
+            std::shared_ptr<Token> GetOperator2();
+            std::shared_ptr<StatementNode> GetRight();
+            std::shared_ptr<std::vector<std::shared_ptr<StatementNode>>> GetNodes();
+            std::shared_ptr<StatementNode> GetNext();
+
         protected:
             std::shared_ptr<Token> mOp1;
             std::shared_ptr<ExpressionNode> mLeft;
@@ -17,6 +17,10 @@ namespace PythonCoreNative::RunTime::Parser::AST
                             std::shared_ptr<Token> op3
                         );
 
+            std::shared_ptr<Token> GetOperator1();
+            std::shared_ptr<Token> GetOperator2();
+            std::shared_ptr<Token> GetOperator3();
+
         protected:
             std::shared_ptr<Token> mOp1;
             std::shared_ptr<Token> mOp2;
@@ -22,6 +22,14 @@ namespace PythonCoreNative::RunTime::Parser::AST
                             std::shared_ptr<Token> op4
                         );
 
+            std::shared_ptr<Token> GetOperator1();
+            std::shared_ptr<std::vector<std::shared_ptr<Token>>> GetDots();
+            std::shared_ptr<StatementNode> GetLeft();
+            std::shared_ptr<Token> GetOperator2();
+            std::shared_ptr<Token> GetOperator3();
+            std::shared_ptr<StatementNode> GetRight();
+            std::shared_ptr<Token> GetOperator4();
+
         protected:
             std::shared_ptr<Token> mOp1;
             std::shared_ptr<std::vector<std::shared_ptr<Token>>> mDots;
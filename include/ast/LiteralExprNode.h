@@ -20,6 +20,9 @@ namespace PythonCoreNative::RunTime::Parser::AST
                             std::shared_ptr<StatementNode> mRight
                         );
 
+            std::shared_ptr<Token> GetOperator();
+            std::shared_ptr<StatementNode> GetRight();
+
             TokenKind LiteralExprType();
 
         protected:
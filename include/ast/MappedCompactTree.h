@@ -0,0 +1,106 @@
+
+#pragma once
+
+#include <ast/CompactTree.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    enum class CompactLiteralKind : unsigned int
+    {
+        Text,           /* not decoded, e.g. integers wider than 64 bits */
+        Integer,
+        Real,
+        Imaginary
+    };
+
+    /* Decoded value of a Number token. */
+    struct CompactLiteral
+    {
+        CompactLiteralKind mKind;
+        unsigned int mToken;
+        std::int64_t mInteger;
+        double mReal;
+    };
+
+    /* Read only view of a CompactTree saved with Write. The file is mapped as is, every
+       accessor reads straight from the mapping, so opening costs the same for any size.
+       Sections are addressed by offsets from the file start and all counts are fixed
+       width, the format is checked against the version, byte order and record sizes of
+       the reading build. */
+    class MappedCompactTree
+    {
+        public:
+            static constexpr unsigned int NoIndex = CompactTree::NoIndex;
+            static constexpr std::uint32_t Version = 1;
+
+            ~MappedCompactTree();
+
+            /* File image of the tree, names are interned and Number tokens decoded. */
+            static std::string Serialize(CompactTree &tree);
+
+            /* Serialized into a temporary file of its own that is renamed over path, so
+               readers and concurrent writers never see a partial file. Returns false when
+               the file could not be written. */
+            static bool Write(CompactTree &tree, const std::string &path);
+            static bool Write(const std::string &bytes, const std::string &path);
+
+            /* Null when the file is missing, truncated or from an other format version. */
+            static std::shared_ptr<MappedCompactTree> Open(const std::string &path);
+
+            /* Same view over an image held in memory. */
+            static std::shared_ptr<MappedCompactTree> FromBytes(std::string bytes);
+
+            unsigned int Root();
+            unsigned int NodeCount();
+            unsigned int TokenCount();
+            unsigned int NameCount();
+            unsigned int LiteralCount();
+
+            const CompactNode & GetNode(unsigned int index);
+            const CompactToken & GetToken(unsigned int index);
+            unsigned int GetFirstChild(unsigned int index);
+            unsigned int GetNextSibling(unsigned int index);
+            unsigned int GetChildCount(unsigned int index);
+            unsigned int GetStart(unsigned int index);
+            unsigned int GetEnd(unsigned int index);
+            std::wstring_view GetTokenText(unsigned int index);
+
+            /* Name index of a Name token, NoIndex for other tokens. */
+            unsigned int GetTokenName(unsigned int index);
+            std::wstring_view GetName(unsigned int name);
+
+            /* Decoded literal of a Number token, null for other tokens. */
+            const CompactLiteral * GetTokenLiteral(unsigned int index);
+            const CompactLiteral & GetLiteral(unsigned int literal);
+
+            std::wstring_view GetSource();
+
+        protected:
+            MappedCompactTree();
+
+            struct Header;
+
+            bool Attach(const char *base, std::size_t size);
+
+            void *mMapping;
+            std::size_t mMappingSize;
+            std::string mBytes;
+            const CompactNode *mNodes;
+            const CompactToken *mTokens;
+            const std::uint32_t *mValues;
+            const std::uint32_t *mNameOffsets;
+            const wchar_t *mNameChars;
+            const CompactLiteral *mLiterals;
+            const wchar_t *mSource;
+            std::uint32_t mNodeCount;
+            std::uint32_t mTokenCount;
+            std::uint32_t mNameCount;
+            std::uint32_t mLiteralCount;
+            std::uint32_t mSourceLength;
+    };
+}
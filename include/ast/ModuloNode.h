@@ -19,6 +19,10 @@ namespace PythonCoreNative::RunTime::Parser::AST
                             std::shared_ptr<ExpressionNode> right
                         );
 
+            std::shared_ptr<ExpressionNode> GetLeft();
+            std::shared_ptr<Token> GetOperator();
+            std::shared_ptr<ExpressionNode> GetRight();
+
         protected:
             std::shared_ptr<ExpressionNode> mLeft;
             std::shared_ptr<Token> mOp1;
@@ -1,16 +1,27 @@
 
 #pragma once
 
+#include <ast/NodeKind.h>
+
 namespace PythonCoreNative::RunTime::Parser::AST
 {
     class Node
     {
         protected:
-            Node(unsigned int start, unsigned int end);
+            Node(unsigned int start, unsigned int end, NodeKind kind);
+
+        public:
+            NodeKind GetKind();
+            unsigned int GetStart();
+            unsigned int GetEnd();
+
+            /* Moves the node by delta characters, used when a subtree is reused after an edit. */
+            void Shift(int delta);
 
         protected:
             unsigned int mColStart;
             unsigned int mColEnd;
+            NodeKind mKind;
     };
 
 }
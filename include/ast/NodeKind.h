@@ -0,0 +1,167 @@
+
+#pragma once
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    /* One tag per concrete node class, stored in every node so trees can be
+       walked and flattened with a switch instead of probing class types. */
+    enum class NodeKind : unsigned short
+    {
+        AndTest,
+        AnnAssignStatement,
+        ArgsList,
+        Argument,
+        AsPattern,
+        AssertStatement,
+        AssignStatement,
+        AsyncStatement,
+        AtomDictionary,
+        AtomElipsis,
+        AtomExpr,
+        AtomFalse,
+        AtomList,
+        AtomName,
+        AtomNone,
+        AtomNumber,
+        AtomSet,
+        AtomString,
+        AtomTrue,
+        AtomTuple,
+        BitAndAssignStatement,
+        BitAnd,
+        BitOrAssignStatement,
+        BitOr,
+        BitXorAssignStatement,
+        BitXor,
+        BreakStatement,
+        Call,
+        CapturePattern,
+        CaseStatement,
+        ClassPattern,
+        ClassStatement,
+        CompFor,
+        CompIf,
+        CompareEqual,
+        CompareGreaterEqual,
+        CompareGreater,
+        CompareIn,
+        CompareIs,
+        CompareIsNot,
+        CompareLessEqual,
+        CompareLess,
+        CompareNotEqual,
+        CompareNotIn,
+        ComplexNumber,
+        ContinueStatement,
+        DecoratedStatement,
+        DecoratorStatement,
+        DecoratorsStatement,
+        DelStatement,
+        DictionaryContainer,
+        DictionaryEntry,
+        DictionaryKWEntry,
+        DivAssignStatement,
+        Div,
+        DotName,
+        DottedAsNameStatement,
+        DottedAsNamesStatement,
+        DottedNameStatement,
+        DoubleStarPattern,
+        ElifStatement,
+        ElseStatement,
+        ErrorStatement,
+        EvalInput,
+        ExceptClause,
+        Except,
+        ExprList,
+        FileInput,
+        FloorDivAssignStatement,
+        FloorDiv,
+        ForStatement,
+        FuncBodySuiteStatement,
+        FuncDefStatement,
+        FuncType,
+        GlobalStatement,
+        GroupPattern,
+        Guard,
+        IfStatement,
+        ImportAsNameStatement,
+        ImportAsNamesStatement,
+        ImportFromStatement,
+        ImportStatement,
+        Index,
+        ItemsPattern,
+        KeyValuePattern,
+        KeywordPattern,
+        KeywordPatterns,
+        Lambda,
+        LiteralExpr,
+        LiteralPattern,
+        MappingPattern,
+        MatchStatement,
+        MatriceAssignStatement,
+        Matrice,
+        MaybeeStarSequencePattern,
+        MinusAssignStatement,
+        Minus,
+        ModuloAssignStatement,
+        Modulo,
+        MulAssignStatement,
+        Mul,
+        NamedExpr,
+        NonlocalStatement,
+        NotTest,
+        OpenSequencePattern,
+        OrPattern,
+        OrTest,
+        ParameterStatement,
+        PassStatement,
+        PlusAssignStatement,
+        Plus,
+        PositionalPatterns,
+        PowerAssignStatement,
+        Power,
+        RaiseStatement,
+        ReturnStatement,
+        SequencePattern,
+        SetContainer,
+        ShiftLeftAssignStatement,
+        ShiftLeft,
+        ShiftRightAssignStatement,
+        ShiftRight,
+        SignedNumber,
+        SimpleStatement,
+        SingleInput,
+        StarExpr,
+        StarNamedExpression,
+        StarPattern,
+        SubjectExpr,
+        SubscriptList,
+        Subscript,
+        SuiteStatement,
+        SyncCompFor,
+        TFPDefAssignStatement,
+        TFPDefStatement,
+        TestListComp,
+        TestList,
+        TestListStarExprListStatement,
+        Test,
+        TryStatement,
+        TypeInput,
+        TypeList,
+        TypedArgsListStatement,
+        UnaryBitInvert,
+        UnaryMinus,
+        UnaryPlus,
+        VFPDefAssignExpression,
+        ValuePattern,
+        VarArgsListExpression,
+        WhileStatement,
+        WildCardPattern,
+        WithItemStatement,
+        WithStatement,
+        YieldExpr,
+        YieldFrom,
+        YieldStatement
+    };
+}
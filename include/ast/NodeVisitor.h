@@ -0,0 +1,1710 @@
+
+#pragma once
+
+#include <PythonCoreParser.h>
+
+#include <memory>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    /* Calls fn with the result of every child accessor of node, in source order of the
+       members. Results are passed as returned, so fn sees the concrete node and token
+       types, vectors of them, and null pointers for optional parts. Function bodies not
+       parsed yet are parsed unless forceBodies is false, then they are passed as null. */
+    template <typename Fn>
+    void ForEachChild(std::shared_ptr<Node> node, Fn &&fn, bool forceBodies = true)
+    {
+        switch (node->GetKind())
+        {
+            case NodeKind::AndTest:
+                {
+                    auto n = std::static_pointer_cast<AndTestNode>(node);
+                    fn(n->GetLeftNode());
+                    fn(n->GetOperator());
+                    fn(n->GetRightNode());
+                }
+                break;
+            case NodeKind::AnnAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<AnnAssignStatementNode>(node);
+                    fn(n->GetLeftNode());
+                    fn(n->GetOperator1());
+                    fn(n->GetRightNode());
+                    fn(n->GetOperator2());
+                    fn(n->GetNextNode());
+                }
+                break;
+            case NodeKind::ArgsList:
+                {
+                    auto n = std::static_pointer_cast<ArgsListNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::Argument:
+                {
+                    auto n = std::static_pointer_cast<ArgumentNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::AsPattern:
+                {
+                    auto n = std::static_pointer_cast<AsPatternNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::AssertStatement:
+                {
+                    auto n = std::static_pointer_cast<AssertStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::AssignStatement:
+                {
+                    auto n = std::static_pointer_cast<AssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperators());
+                    fn(n->GetRightNodes());
+                    fn(n->GetOperator2());
+                }
+                break;
+            case NodeKind::AsyncStatement:
+                {
+                    auto n = std::static_pointer_cast<AsyncStatementNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::AtomDictionary:
+                {
+                    auto n = std::static_pointer_cast<AtomDictionaryNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetRight());
+                    fn(n->GetOperator2());
+                }
+                break;
+            case NodeKind::AtomElipsis:
+                {
+                    auto n = std::static_pointer_cast<AtomElipsisNode>(node);
+                    fn(n->GetOperator());
+                }
+                break;
+            case NodeKind::AtomExpr:
+                {
+                    auto n = std::static_pointer_cast<AtomExprNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetLeft());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::AtomFalse:
+                {
+                    auto n = std::static_pointer_cast<AtomFalseNode>(node);
+                    fn(n->GetOperator());
+                }
+                break;
+            case NodeKind::AtomList:
+                {
+                    auto n = std::static_pointer_cast<AtomListNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetRight());
+                    fn(n->GetOperator2());
+                }
+                break;
+            case NodeKind::AtomName:
+                {
+                    auto n = std::static_pointer_cast<AtomNameNode>(node);
+                    fn(n->GetNameText());
+                }
+                break;
+            case NodeKind::AtomNone:
+                {
+                    auto n = std::static_pointer_cast<AtomNoneNode>(node);
+                    fn(n->GetOperator());
+                }
+                break;
+            case NodeKind::AtomNumber:
+                {
+                    auto n = std::static_pointer_cast<AtomNumberNode>(node);
+                    fn(n->GetNumberText());
+                }
+                break;
+            case NodeKind::AtomSet:
+                {
+                    auto n = std::static_pointer_cast<AtomSetNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetRight());
+                    fn(n->GetOperator2());
+                }
+                break;
+            case NodeKind::AtomString:
+                {
+                    auto n = std::static_pointer_cast<AtomStringNode>(node);
+                    fn(n->GetStringNodes());
+                }
+                break;
+            case NodeKind::AtomTrue:
+                {
+                    auto n = std::static_pointer_cast<AtomTrueNode>(node);
+                    fn(n->GetOperator());
+                }
+                break;
+            case NodeKind::AtomTuple:
+                {
+                    auto n = std::static_pointer_cast<AtomTupleNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetRight());
+                    fn(n->GetOperator2());
+                }
+                break;
+            case NodeKind::BitAndAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<BitAndAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::BitAnd:
+                {
+                    auto n = std::static_pointer_cast<BitAndNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::BitOrAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<BitOrAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::BitOr:
+                {
+                    auto n = std::static_pointer_cast<BitOrNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::BitXorAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<BitXorAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::BitXor:
+                {
+                    auto n = std::static_pointer_cast<BitXorNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::BreakStatement:
+                {
+                    auto n = std::static_pointer_cast<BreakStatementNode>(node);
+                    fn(n->GetOperator());
+                }
+                break;
+            case NodeKind::Call:
+                {
+                    auto n = std::static_pointer_cast<CallNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetRight());
+                    fn(n->GetOperator2());
+                }
+                break;
+            case NodeKind::CapturePattern:
+                {
+                    auto n = std::static_pointer_cast<CapturePatternNode>(node);
+                    fn(n->GetOperator());
+                }
+                break;
+            case NodeKind::CaseStatement:
+                {
+                    auto n = std::static_pointer_cast<CaseStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetRight());
+                    fn(n->GetOperator2());
+                    fn(n->GetNext());
+                }
+                break;
+            case NodeKind::ClassPattern:
+                {
+                    auto n = std::static_pointer_cast<ClassPatternNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetDots());
+                    fn(n->GetOpenCurly());
+                    fn(n->GetPositionals());
+                    fn(n->GetFirstComma());
+                    fn(n->GetKeywords());
+                    fn(n->GetSecondComma());
+                    fn(n->GetCloseCurly());
+                }
+                break;
+            case NodeKind::ClassStatement:
+                {
+                    auto n = std::static_pointer_cast<ClassStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetOperators3());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator4());
+                    fn(n->GetOperator5());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::CompFor:
+                {
+                    auto n = std::static_pointer_cast<CompForNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::CompIf:
+                {
+                    auto n = std::static_pointer_cast<CompIfNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                    fn(n->GetNext());
+                }
+                break;
+            case NodeKind::CompareEqual:
+                {
+                    auto n = std::static_pointer_cast<CompareEqualNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::CompareGreaterEqual:
+                {
+                    auto n = std::static_pointer_cast<CompareGreaterEqualNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::CompareGreater:
+                {
+                    auto n = std::static_pointer_cast<CompareGreaterNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::CompareIn:
+                {
+                    auto n = std::static_pointer_cast<CompareInNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::CompareIs:
+                {
+                    auto n = std::static_pointer_cast<CompareIsNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::CompareIsNot:
+                {
+                    auto n = std::static_pointer_cast<CompareIsNotNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::CompareLessEqual:
+                {
+                    auto n = std::static_pointer_cast<CompareLessEqualNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::CompareLess:
+                {
+                    auto n = std::static_pointer_cast<CompareLessNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::CompareNotEqual:
+                {
+                    auto n = std::static_pointer_cast<CompareNotEqualNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::CompareNotIn:
+                {
+                    auto n = std::static_pointer_cast<CompareNotInNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ComplexNumber:
+                {
+                    auto n = std::static_pointer_cast<ComplexNumberNode>(node);
+                    fn(n->GetRealSign());
+                    fn(n->GetReal());
+                    fn(n->GetImaginarySign());
+                    fn(n->GetImaginary());
+                }
+                break;
+            case NodeKind::ContinueStatement:
+                {
+                    auto n = std::static_pointer_cast<ContinueStatementNode>(node);
+                    fn(n->GetOperator());
+                }
+                break;
+            case NodeKind::DecoratedStatement:
+                {
+                    auto n = std::static_pointer_cast<DecoratedStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::DecoratorStatement:
+                {
+                    auto n = std::static_pointer_cast<DecoratorStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                    fn(n->GetOperator3());
+                    fn(n->GetOperator4());
+                }
+                break;
+            case NodeKind::DecoratorsStatement:
+                {
+                    auto n = std::static_pointer_cast<DecoratorsStatementNode>(node);
+                    fn(n->GetNodes());
+                }
+                break;
+            case NodeKind::DelStatement:
+                {
+                    auto n = std::static_pointer_cast<DelStatementNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::DictionaryContainer:
+                {
+                    auto n = std::static_pointer_cast<DictionaryContainerNode>(node);
+                    fn(n->GetEntries());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::DictionaryEntry:
+                {
+                    auto n = std::static_pointer_cast<DictionaryEntryNode>(node);
+                    fn(n->GetKey());
+                    fn(n->GetOperator());
+                    fn(n->GetValue());
+                }
+                break;
+            case NodeKind::DictionaryKWEntry:
+                {
+                    auto n = std::static_pointer_cast<DictionaryKWEntryNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetValue());
+                }
+                break;
+            case NodeKind::DivAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<DivAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::Div:
+                {
+                    auto n = std::static_pointer_cast<DivNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::DotName:
+                {
+                    auto n = std::static_pointer_cast<DotNameNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                }
+                break;
+            case NodeKind::DottedAsNameStatement:
+                {
+                    auto n = std::static_pointer_cast<DottedAsNameStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetOperator2());
+                }
+                break;
+            case NodeKind::DottedAsNamesStatement:
+                {
+                    auto n = std::static_pointer_cast<DottedAsNamesStatementNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::DottedNameStatement:
+                {
+                    auto n = std::static_pointer_cast<DottedNameStatementNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::DoubleStarPattern:
+                {
+                    auto n = std::static_pointer_cast<DoubleStarPatternNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ElifStatement:
+                {
+                    auto n = std::static_pointer_cast<ElifStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ElseStatement:
+                {
+                    auto n = std::static_pointer_cast<ElseStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ErrorStatement:
+                {
+                    auto n = std::static_pointer_cast<ErrorStatementNode>(node);
+                    fn(n->GetNodes());
+                }
+                break;
+            case NodeKind::EvalInput:
+                {
+                    auto n = std::static_pointer_cast<EvalInputNode>(node);
+                    fn(n->GetNewlines());
+                    fn(n->GetRight());
+                    fn(n->GetEof());
+                }
+                break;
+            case NodeKind::ExceptClause:
+                {
+                    auto n = std::static_pointer_cast<ExceptClauseNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetOperator3());
+                }
+                break;
+            case NodeKind::Except:
+                {
+                    auto n = std::static_pointer_cast<ExceptNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ExprList:
+                {
+                    auto n = std::static_pointer_cast<ExprListNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::FileInput:
+                {
+                    auto n = std::static_pointer_cast<FileInputNode>(node);
+                    fn(n->GetNewlines());
+                    fn(n->GetNodes());
+                    fn(n->GetEof());
+                }
+                break;
+            case NodeKind::FloorDivAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<FloorDivAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::FloorDiv:
+                {
+                    auto n = std::static_pointer_cast<FloorDivNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ForStatement:
+                {
+                    auto n = std::static_pointer_cast<ForStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                    fn(n->GetOperator3());
+                    fn(n->GetOperator4());
+                    fn(n->GetNext());
+                    fn(n->GetExtra());
+                }
+                break;
+            case NodeKind::FuncBodySuiteStatement:
+                {
+                    auto n = std::static_pointer_cast<FuncBodySuiteStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetOperator3());
+                    fn(n->GetOperator4());
+                    fn(n->GetNodes());
+                    fn(n->GetNewlines());
+                    fn(n->GetOperator5());
+                }
+                break;
+            case NodeKind::FuncDefStatement:
+                {
+                    auto n = std::static_pointer_cast<FuncDefStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator3());
+                    fn(n->GetRight());
+                    fn(n->GetOperator4());
+                    fn(n->GetOperator5());
+                    fn(forceBodies || n->IsNextParsed() ? n->GetNext() : nullptr);
+                }
+                break;
+            case NodeKind::FuncType:
+                {
+                    auto n = std::static_pointer_cast<FuncTypeNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetOperator3());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::GlobalStatement:
+                {
+                    auto n = std::static_pointer_cast<GlobalStatementNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::GroupPattern:
+                {
+                    auto n = std::static_pointer_cast<GroupPatternNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetRight());
+                    fn(n->GetOperator2());
+                }
+                break;
+            case NodeKind::Guard:
+                {
+                    auto n = std::static_pointer_cast<GuardNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::IfStatement:
+                {
+                    auto n = std::static_pointer_cast<IfStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                    fn(n->GetNodes());
+                    fn(n->GetNext());
+                }
+                break;
+            case NodeKind::ImportAsNameStatement:
+                {
+                    auto n = std::static_pointer_cast<ImportAsNameStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetOperator3());
+                }
+                break;
+            case NodeKind::ImportAsNamesStatement:
+                {
+                    auto n = std::static_pointer_cast<ImportAsNamesStatementNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::ImportFromStatement:
+                {
+                    auto n = std::static_pointer_cast<ImportFromStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetDots());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetOperator3());
+                    fn(n->GetRight());
+                    fn(n->GetOperator4());
+                }
+                break;
+            case NodeKind::ImportStatement:
+                {
+                    auto n = std::static_pointer_cast<ImportStatementNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::Index:
+                {
+                    auto n = std::static_pointer_cast<IndexNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetRight());
+                    fn(n->GetOperator2());
+                }
+                break;
+            case NodeKind::ItemsPattern:
+                {
+                    auto n = std::static_pointer_cast<ItemsPatternNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::KeyValuePattern:
+                {
+                    auto n = std::static_pointer_cast<KeyValuePatternNode>(node);
+                    fn(n->GetKey());
+                    fn(n->GetOperator());
+                    fn(n->GetValue());
+                }
+                break;
+            case NodeKind::KeywordPattern:
+                {
+                    auto n = std::static_pointer_cast<KeywordPatternNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::KeywordPatterns:
+                {
+                    auto n = std::static_pointer_cast<KeywordPatternsNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::Lambda:
+                {
+                    auto n = std::static_pointer_cast<LambdaNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::LiteralExpr:
+                {
+                    auto n = std::static_pointer_cast<LiteralExprNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::LiteralPattern:
+                {
+                    auto n = std::static_pointer_cast<LiteralPatternNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::MappingPattern:
+                {
+                    auto n = std::static_pointer_cast<MappingPatternNode>(node);
+                    fn(n->GetOpenCurly());
+                    fn(n->GetItems());
+                    fn(n->GetFirstComma());
+                    fn(n->GetDoubleStar());
+                    fn(n->GetSecondComma());
+                    fn(n->GetCloseCurly());
+                }
+                break;
+            case NodeKind::MatchStatement:
+                {
+                    auto n = std::static_pointer_cast<MatchStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetOperator3());
+                    fn(n->GetOperator4());
+                    fn(n->GetNodes());
+                    fn(n->GetOperator5());
+                }
+                break;
+            case NodeKind::MatriceAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<MatriceAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::Matrice:
+                {
+                    auto n = std::static_pointer_cast<MatriceNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::MaybeeStarSequencePattern:
+                {
+                    auto n = std::static_pointer_cast<MaybeeStarSequencePatternNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::MinusAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<MinusAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::Minus:
+                {
+                    auto n = std::static_pointer_cast<MinusNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ModuloAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<ModuloAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::Modulo:
+                {
+                    auto n = std::static_pointer_cast<ModuloNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::MulAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<MulAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::Mul:
+                {
+                    auto n = std::static_pointer_cast<MulNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::NamedExpr:
+                {
+                    auto n = std::static_pointer_cast<NamedExprNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::NonlocalStatement:
+                {
+                    auto n = std::static_pointer_cast<NonlocalStatementNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::NotTest:
+                {
+                    auto n = std::static_pointer_cast<NotTestNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::OpenSequencePattern:
+                {
+                    auto n = std::static_pointer_cast<OpenSequencePatternNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::OrPattern:
+                {
+                    auto n = std::static_pointer_cast<OrPatternNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::OrTest:
+                {
+                    auto n = std::static_pointer_cast<OrTestNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ParameterStatement:
+                {
+                    auto n = std::static_pointer_cast<ParameterStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetRight());
+                    fn(n->GetOperator2());
+                }
+                break;
+            case NodeKind::PassStatement:
+                {
+                    auto n = std::static_pointer_cast<PassStatementNode>(node);
+                    fn(n->GetOperator());
+                }
+                break;
+            case NodeKind::PlusAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<PlusAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::Plus:
+                {
+                    auto n = std::static_pointer_cast<PlusNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::PositionalPatterns:
+                {
+                    auto n = std::static_pointer_cast<PositionalPatternsNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::PowerAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<PowerAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::Power:
+                {
+                    auto n = std::static_pointer_cast<PowerNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::RaiseStatement:
+                {
+                    auto n = std::static_pointer_cast<RaiseStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ReturnStatement:
+                {
+                    auto n = std::static_pointer_cast<ReturnStatementNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::SequencePattern:
+                {
+                    auto n = std::static_pointer_cast<SequencePatternNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetRight());
+                    fn(n->GetOperator2());
+                }
+                break;
+            case NodeKind::SetContainer:
+                {
+                    auto n = std::static_pointer_cast<SetContainerNode>(node);
+                    fn(n->GetEntries());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::ShiftLeftAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<ShiftLeftAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ShiftLeft:
+                {
+                    auto n = std::static_pointer_cast<ShiftLeftNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ShiftRightAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<ShiftRightAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ShiftRight:
+                {
+                    auto n = std::static_pointer_cast<ShiftRightNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::SignedNumber:
+                {
+                    auto n = std::static_pointer_cast<SignedNumberNode>(node);
+                    fn(n->GetSign());
+                    fn(n->GetNumber());
+                }
+                break;
+            case NodeKind::SimpleStatement:
+                {
+                    auto n = std::static_pointer_cast<SimpleStatementNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                    fn(n->GetOperator());
+                }
+                break;
+            case NodeKind::SingleInput:
+                {
+                    auto n = std::static_pointer_cast<SingleInputNode>(node);
+                    fn(n->GetNewline());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::StarExpr:
+                {
+                    auto n = std::static_pointer_cast<StarExprNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::StarNamedExpression:
+                {
+                    auto n = std::static_pointer_cast<StarNamedExpressionNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::StarPattern:
+                {
+                    auto n = std::static_pointer_cast<StarPatternNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::SubjectExpr:
+                {
+                    auto n = std::static_pointer_cast<SubjectExprNode>(node);
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::SubscriptList:
+                {
+                    auto n = std::static_pointer_cast<SubscriptListNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::Subscript:
+                {
+                    auto n = std::static_pointer_cast<SubscriptNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator1());
+                    fn(n->GetRight());
+                    fn(n->GetOperator2());
+                    fn(n->GetNext());
+                }
+                break;
+            case NodeKind::SuiteStatement:
+                {
+                    auto n = std::static_pointer_cast<SuiteStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetNodes());
+                    fn(n->GetNewlines());
+                    fn(n->GetOperator3());
+                }
+                break;
+            case NodeKind::SyncCompFor:
+                {
+                    auto n = std::static_pointer_cast<SyncCompForNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                    fn(n->GetNext());
+                }
+                break;
+            case NodeKind::TFPDefAssignStatement:
+                {
+                    auto n = std::static_pointer_cast<TFPDefAssignStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::TFPDefStatement:
+                {
+                    auto n = std::static_pointer_cast<TFPDefStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::TestListComp:
+                {
+                    auto n = std::static_pointer_cast<TestListCompNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::TestList:
+                {
+                    auto n = std::static_pointer_cast<TestListNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::TestListStarExprListStatement:
+                {
+                    auto n = std::static_pointer_cast<TestListStarExprListStatementNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                }
+                break;
+            case NodeKind::Test:
+                {
+                    auto n = std::static_pointer_cast<TestNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator1());
+                    fn(n->GetRight());
+                    fn(n->GetOperator2());
+                    fn(n->GetNext());
+                }
+                break;
+            case NodeKind::TryStatement:
+                {
+                    auto n = std::static_pointer_cast<TryStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetLeft());
+                    fn(n->GetExceptNodes());
+                    fn(n->GetElseNode());
+                    fn(n->GetOperator3());
+                    fn(n->GetOperator4());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::TypeInput:
+                {
+                    auto n = std::static_pointer_cast<TypeInputNode>(node);
+                    fn(n->GetNewlines());
+                    fn(n->GetRight());
+                    fn(n->GetEof());
+                }
+                break;
+            case NodeKind::TypeList:
+                {
+                    auto n = std::static_pointer_cast<TypeListNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                    fn(n->GetMul());
+                    fn(n->GetMulNode());
+                    fn(n->GetPower());
+                    fn(n->GetPowerNode());
+                }
+                break;
+            case NodeKind::TypedArgsListStatement:
+                {
+                    auto n = std::static_pointer_cast<TypedArgsListStatementNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                    fn(n->GetSlash());
+                    fn(n->GetMul());
+                    fn(n->GetMulNode());
+                    fn(n->GetPower());
+                    fn(n->GetPowerNode());
+                    fn(n->GetTypeComment());
+                }
+                break;
+            case NodeKind::UnaryBitInvert:
+                {
+                    auto n = std::static_pointer_cast<UnaryBitInvertNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::UnaryMinus:
+                {
+                    auto n = std::static_pointer_cast<UnaryMinusNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::UnaryPlus:
+                {
+                    auto n = std::static_pointer_cast<UnaryPlusNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::VFPDefAssignExpression:
+                {
+                    auto n = std::static_pointer_cast<VFPDefAssignExpressionNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::ValuePattern:
+                {
+                    auto n = std::static_pointer_cast<ValuePatternNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetDots());
+                }
+                break;
+            case NodeKind::VarArgsListExpression:
+                {
+                    auto n = std::static_pointer_cast<VarArgsListExpressionNode>(node);
+                    fn(n->GetNodes());
+                    fn(n->GetSeparators());
+                    fn(n->GetSlash());
+                    fn(n->GetMul());
+                    fn(n->GetMulNode());
+                    fn(n->GetPower());
+                    fn(n->GetPowerNode());
+                }
+                break;
+            case NodeKind::WhileStatement:
+                {
+                    auto n = std::static_pointer_cast<WhileStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetLeft());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                    fn(n->GetNext());
+                }
+                break;
+            case NodeKind::WildCardPattern:
+                {
+                    auto n = std::static_pointer_cast<WildCardPatternNode>(node);
+                    fn(n->GetOperator());
+                }
+                break;
+            case NodeKind::WithItemStatement:
+                {
+                    auto n = std::static_pointer_cast<WithItemStatementNode>(node);
+                    fn(n->GetLeft());
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::WithStatement:
+                {
+                    auto n = std::static_pointer_cast<WithStatementNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOpenParenthesis());
+                    fn(n->GetWithItems());
+                    fn(n->GetSeparators());
+                    fn(n->GetCloseParenthesis());
+                    fn(n->GetOperator2());
+                    fn(n->GetOperator3());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::YieldExpr:
+                {
+                    auto n = std::static_pointer_cast<YieldExprNode>(node);
+                    fn(n->GetOperator());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::YieldFrom:
+                {
+                    auto n = std::static_pointer_cast<YieldFromNode>(node);
+                    fn(n->GetOperator1());
+                    fn(n->GetOperator2());
+                    fn(n->GetRight());
+                }
+                break;
+            case NodeKind::YieldStatement:
+                {
+                    auto n = std::static_pointer_cast<YieldStatementNode>(node);
+                    fn(n->GetRight());
+                }
+                break;
+        }
+    }
+
+    /* Switch dispatched visitor. Derived overrides the Visit<Kind> members it cares about,
+       every other kind ends up in VisitDefault, which Derived may also replace with its own
+       template to handle all concrete classes at once. No virtual calls are involved. */
+    template <typename Derived, typename Result = void>
+    class NodeVisitor
+    {
+        public:
+            Result Visit(std::shared_ptr<Node> node)
+            {
+                auto self = static_cast<Derived *>(this);
+
+                switch (node->GetKind())
+                {
+                    case NodeKind::AndTest: return self->VisitAndTest(std::static_pointer_cast<AndTestNode>(node));
+                    case NodeKind::AnnAssignStatement: return self->VisitAnnAssignStatement(std::static_pointer_cast<AnnAssignStatementNode>(node));
+                    case NodeKind::ArgsList: return self->VisitArgsList(std::static_pointer_cast<ArgsListNode>(node));
+                    case NodeKind::Argument: return self->VisitArgument(std::static_pointer_cast<ArgumentNode>(node));
+                    case NodeKind::AsPattern: return self->VisitAsPattern(std::static_pointer_cast<AsPatternNode>(node));
+                    case NodeKind::AssertStatement: return self->VisitAssertStatement(std::static_pointer_cast<AssertStatementNode>(node));
+                    case NodeKind::AssignStatement: return self->VisitAssignStatement(std::static_pointer_cast<AssignStatementNode>(node));
+                    case NodeKind::AsyncStatement: return self->VisitAsyncStatement(std::static_pointer_cast<AsyncStatementNode>(node));
+                    case NodeKind::AtomDictionary: return self->VisitAtomDictionary(std::static_pointer_cast<AtomDictionaryNode>(node));
+                    case NodeKind::AtomElipsis: return self->VisitAtomElipsis(std::static_pointer_cast<AtomElipsisNode>(node));
+                    case NodeKind::AtomExpr: return self->VisitAtomExpr(std::static_pointer_cast<AtomExprNode>(node));
+                    case NodeKind::AtomFalse: return self->VisitAtomFalse(std::static_pointer_cast<AtomFalseNode>(node));
+                    case NodeKind::AtomList: return self->VisitAtomList(std::static_pointer_cast<AtomListNode>(node));
+                    case NodeKind::AtomName: return self->VisitAtomName(std::static_pointer_cast<AtomNameNode>(node));
+                    case NodeKind::AtomNone: return self->VisitAtomNone(std::static_pointer_cast<AtomNoneNode>(node));
+                    case NodeKind::AtomNumber: return self->VisitAtomNumber(std::static_pointer_cast<AtomNumberNode>(node));
+                    case NodeKind::AtomSet: return self->VisitAtomSet(std::static_pointer_cast<AtomSetNode>(node));
+                    case NodeKind::AtomString: return self->VisitAtomString(std::static_pointer_cast<AtomStringNode>(node));
+                    case NodeKind::AtomTrue: return self->VisitAtomTrue(std::static_pointer_cast<AtomTrueNode>(node));
+                    case NodeKind::AtomTuple: return self->VisitAtomTuple(std::static_pointer_cast<AtomTupleNode>(node));
+                    case NodeKind::BitAndAssignStatement: return self->VisitBitAndAssignStatement(std::static_pointer_cast<BitAndAssignStatementNode>(node));
+                    case NodeKind::BitAnd: return self->VisitBitAnd(std::static_pointer_cast<BitAndNode>(node));
+                    case NodeKind::BitOrAssignStatement: return self->VisitBitOrAssignStatement(std::static_pointer_cast<BitOrAssignStatementNode>(node));
+                    case NodeKind::BitOr: return self->VisitBitOr(std::static_pointer_cast<BitOrNode>(node));
+                    case NodeKind::BitXorAssignStatement: return self->VisitBitXorAssignStatement(std::static_pointer_cast<BitXorAssignStatementNode>(node));
+                    case NodeKind::BitXor: return self->VisitBitXor(std::static_pointer_cast<BitXorNode>(node));
+                    case NodeKind::BreakStatement: return self->VisitBreakStatement(std::static_pointer_cast<BreakStatementNode>(node));
+                    case NodeKind::Call: return self->VisitCall(std::static_pointer_cast<CallNode>(node));
+                    case NodeKind::CapturePattern: return self->VisitCapturePattern(std::static_pointer_cast<CapturePatternNode>(node));
+                    case NodeKind::CaseStatement: return self->VisitCaseStatement(std::static_pointer_cast<CaseStatementNode>(node));
+                    case NodeKind::ClassPattern: return self->VisitClassPattern(std::static_pointer_cast<ClassPatternNode>(node));
+                    case NodeKind::ClassStatement: return self->VisitClassStatement(std::static_pointer_cast<ClassStatementNode>(node));
+                    case NodeKind::CompFor: return self->VisitCompFor(std::static_pointer_cast<CompForNode>(node));
+                    case NodeKind::CompIf: return self->VisitCompIf(std::static_pointer_cast<CompIfNode>(node));
+                    case NodeKind::CompareEqual: return self->VisitCompareEqual(std::static_pointer_cast<CompareEqualNode>(node));
+                    case NodeKind::CompareGreaterEqual: return self->VisitCompareGreaterEqual(std::static_pointer_cast<CompareGreaterEqualNode>(node));
+                    case NodeKind::CompareGreater: return self->VisitCompareGreater(std::static_pointer_cast<CompareGreaterNode>(node));
+                    case NodeKind::CompareIn: return self->VisitCompareIn(std::static_pointer_cast<CompareInNode>(node));
+                    case NodeKind::CompareIs: return self->VisitCompareIs(std::static_pointer_cast<CompareIsNode>(node));
+                    case NodeKind::CompareIsNot: return self->VisitCompareIsNot(std::static_pointer_cast<CompareIsNotNode>(node));
+                    case NodeKind::CompareLessEqual: return self->VisitCompareLessEqual(std::static_pointer_cast<CompareLessEqualNode>(node));
+                    case NodeKind::CompareLess: return self->VisitCompareLess(std::static_pointer_cast<CompareLessNode>(node));
+                    case NodeKind::CompareNotEqual: return self->VisitCompareNotEqual(std::static_pointer_cast<CompareNotEqualNode>(node));
+                    case NodeKind::CompareNotIn: return self->VisitCompareNotIn(std::static_pointer_cast<CompareNotInNode>(node));
+                    case NodeKind::ComplexNumber: return self->VisitComplexNumber(std::static_pointer_cast<ComplexNumberNode>(node));
+                    case NodeKind::ContinueStatement: return self->VisitContinueStatement(std::static_pointer_cast<ContinueStatementNode>(node));
+                    case NodeKind::DecoratedStatement: return self->VisitDecoratedStatement(std::static_pointer_cast<DecoratedStatementNode>(node));
+                    case NodeKind::DecoratorStatement: return self->VisitDecoratorStatement(std::static_pointer_cast<DecoratorStatementNode>(node));
+                    case NodeKind::DecoratorsStatement: return self->VisitDecoratorsStatement(std::static_pointer_cast<DecoratorsStatementNode>(node));
+                    case NodeKind::DelStatement: return self->VisitDelStatement(std::static_pointer_cast<DelStatementNode>(node));
+                    case NodeKind::DictionaryContainer: return self->VisitDictionaryContainer(std::static_pointer_cast<DictionaryContainerNode>(node));
+                    case NodeKind::DictionaryEntry: return self->VisitDictionaryEntry(std::static_pointer_cast<DictionaryEntryNode>(node));
+                    case NodeKind::DictionaryKWEntry: return self->VisitDictionaryKWEntry(std::static_pointer_cast<DictionaryKWEntryNode>(node));
+                    case NodeKind::DivAssignStatement: return self->VisitDivAssignStatement(std::static_pointer_cast<DivAssignStatementNode>(node));
+                    case NodeKind::Div: return self->VisitDiv(std::static_pointer_cast<DivNode>(node));
+                    case NodeKind::DotName: return self->VisitDotName(std::static_pointer_cast<DotNameNode>(node));
+                    case NodeKind::DottedAsNameStatement: return self->VisitDottedAsNameStatement(std::static_pointer_cast<DottedAsNameStatementNode>(node));
+                    case NodeKind::DottedAsNamesStatement: return self->VisitDottedAsNamesStatement(std::static_pointer_cast<DottedAsNamesStatementNode>(node));
+                    case NodeKind::DottedNameStatement: return self->VisitDottedNameStatement(std::static_pointer_cast<DottedNameStatementNode>(node));
+                    case NodeKind::DoubleStarPattern: return self->VisitDoubleStarPattern(std::static_pointer_cast<DoubleStarPatternNode>(node));
+                    case NodeKind::ElifStatement: return self->VisitElifStatement(std::static_pointer_cast<ElifStatementNode>(node));
+                    case NodeKind::ElseStatement: return self->VisitElseStatement(std::static_pointer_cast<ElseStatementNode>(node));
+                    case NodeKind::ErrorStatement: return self->VisitErrorStatement(std::static_pointer_cast<ErrorStatementNode>(node));
+                    case NodeKind::EvalInput: return self->VisitEvalInput(std::static_pointer_cast<EvalInputNode>(node));
+                    case NodeKind::ExceptClause: return self->VisitExceptClause(std::static_pointer_cast<ExceptClauseNode>(node));
+                    case NodeKind::Except: return self->VisitExcept(std::static_pointer_cast<ExceptNode>(node));
+                    case NodeKind::ExprList: return self->VisitExprList(std::static_pointer_cast<ExprListNode>(node));
+                    case NodeKind::FileInput: return self->VisitFileInput(std::static_pointer_cast<FileInputNode>(node));
+                    case NodeKind::FloorDivAssignStatement: return self->VisitFloorDivAssignStatement(std::static_pointer_cast<FloorDivAssignStatementNode>(node));
+                    case NodeKind::FloorDiv: return self->VisitFloorDiv(std::static_pointer_cast<FloorDivNode>(node));
+                    case NodeKind::ForStatement: return self->VisitForStatement(std::static_pointer_cast<ForStatementNode>(node));
+                    case NodeKind::FuncBodySuiteStatement: return self->VisitFuncBodySuiteStatement(std::static_pointer_cast<FuncBodySuiteStatementNode>(node));
+                    case NodeKind::FuncDefStatement: return self->VisitFuncDefStatement(std::static_pointer_cast<FuncDefStatementNode>(node));
+                    case NodeKind::FuncType: return self->VisitFuncType(std::static_pointer_cast<FuncTypeNode>(node));
+                    case NodeKind::GlobalStatement: return self->VisitGlobalStatement(std::static_pointer_cast<GlobalStatementNode>(node));
+                    case NodeKind::GroupPattern: return self->VisitGroupPattern(std::static_pointer_cast<GroupPatternNode>(node));
+                    case NodeKind::Guard: return self->VisitGuard(std::static_pointer_cast<GuardNode>(node));
+                    case NodeKind::IfStatement: return self->VisitIfStatement(std::static_pointer_cast<IfStatementNode>(node));
+                    case NodeKind::ImportAsNameStatement: return self->VisitImportAsNameStatement(std::static_pointer_cast<ImportAsNameStatementNode>(node));
+                    case NodeKind::ImportAsNamesStatement: return self->VisitImportAsNamesStatement(std::static_pointer_cast<ImportAsNamesStatementNode>(node));
+                    case NodeKind::ImportFromStatement: return self->VisitImportFromStatement(std::static_pointer_cast<ImportFromStatementNode>(node));
+                    case NodeKind::ImportStatement: return self->VisitImportStatement(std::static_pointer_cast<ImportStatementNode>(node));
+                    case NodeKind::Index: return self->VisitIndex(std::static_pointer_cast<IndexNode>(node));
+                    case NodeKind::ItemsPattern: return self->VisitItemsPattern(std::static_pointer_cast<ItemsPatternNode>(node));
+                    case NodeKind::KeyValuePattern: return self->VisitKeyValuePattern(std::static_pointer_cast<KeyValuePatternNode>(node));
+                    case NodeKind::KeywordPattern: return self->VisitKeywordPattern(std::static_pointer_cast<KeywordPatternNode>(node));
+                    case NodeKind::KeywordPatterns: return self->VisitKeywordPatterns(std::static_pointer_cast<KeywordPatternsNode>(node));
+                    case NodeKind::Lambda: return self->VisitLambda(std::static_pointer_cast<LambdaNode>(node));
+                    case NodeKind::LiteralExpr: return self->VisitLiteralExpr(std::static_pointer_cast<LiteralExprNode>(node));
+                    case NodeKind::LiteralPattern: return self->VisitLiteralPattern(std::static_pointer_cast<LiteralPatternNode>(node));
+                    case NodeKind::MappingPattern: return self->VisitMappingPattern(std::static_pointer_cast<MappingPatternNode>(node));
+                    case NodeKind::MatchStatement: return self->VisitMatchStatement(std::static_pointer_cast<MatchStatementNode>(node));
+                    case NodeKind::MatriceAssignStatement: return self->VisitMatriceAssignStatement(std::static_pointer_cast<MatriceAssignStatementNode>(node));
+                    case NodeKind::Matrice: return self->VisitMatrice(std::static_pointer_cast<MatriceNode>(node));
+                    case NodeKind::MaybeeStarSequencePattern: return self->VisitMaybeeStarSequencePattern(std::static_pointer_cast<MaybeeStarSequencePatternNode>(node));
+                    case NodeKind::MinusAssignStatement: return self->VisitMinusAssignStatement(std::static_pointer_cast<MinusAssignStatementNode>(node));
+                    case NodeKind::Minus: return self->VisitMinus(std::static_pointer_cast<MinusNode>(node));
+                    case NodeKind::ModuloAssignStatement: return self->VisitModuloAssignStatement(std::static_pointer_cast<ModuloAssignStatementNode>(node));
+                    case NodeKind::Modulo: return self->VisitModulo(std::static_pointer_cast<ModuloNode>(node));
+                    case NodeKind::MulAssignStatement: return self->VisitMulAssignStatement(std::static_pointer_cast<MulAssignStatementNode>(node));
+                    case NodeKind::Mul: return self->VisitMul(std::static_pointer_cast<MulNode>(node));
+                    case NodeKind::NamedExpr: return self->VisitNamedExpr(std::static_pointer_cast<NamedExprNode>(node));
+                    case NodeKind::NonlocalStatement: return self->VisitNonlocalStatement(std::static_pointer_cast<NonlocalStatementNode>(node));
+                    case NodeKind::NotTest: return self->VisitNotTest(std::static_pointer_cast<NotTestNode>(node));
+                    case NodeKind::OpenSequencePattern: return self->VisitOpenSequencePattern(std::static_pointer_cast<OpenSequencePatternNode>(node));
+                    case NodeKind::OrPattern: return self->VisitOrPattern(std::static_pointer_cast<OrPatternNode>(node));
+                    case NodeKind::OrTest: return self->VisitOrTest(std::static_pointer_cast<OrTestNode>(node));
+                    case NodeKind::ParameterStatement: return self->VisitParameterStatement(std::static_pointer_cast<ParameterStatementNode>(node));
+                    case NodeKind::PassStatement: return self->VisitPassStatement(std::static_pointer_cast<PassStatementNode>(node));
+                    case NodeKind::PlusAssignStatement: return self->VisitPlusAssignStatement(std::static_pointer_cast<PlusAssignStatementNode>(node));
+                    case NodeKind::Plus: return self->VisitPlus(std::static_pointer_cast<PlusNode>(node));
+                    case NodeKind::PositionalPatterns: return self->VisitPositionalPatterns(std::static_pointer_cast<PositionalPatternsNode>(node));
+                    case NodeKind::PowerAssignStatement: return self->VisitPowerAssignStatement(std::static_pointer_cast<PowerAssignStatementNode>(node));
+                    case NodeKind::Power: return self->VisitPower(std::static_pointer_cast<PowerNode>(node));
+                    case NodeKind::RaiseStatement: return self->VisitRaiseStatement(std::static_pointer_cast<RaiseStatementNode>(node));
+                    case NodeKind::ReturnStatement: return self->VisitReturnStatement(std::static_pointer_cast<ReturnStatementNode>(node));
+                    case NodeKind::SequencePattern: return self->VisitSequencePattern(std::static_pointer_cast<SequencePatternNode>(node));
+                    case NodeKind::SetContainer: return self->VisitSetContainer(std::static_pointer_cast<SetContainerNode>(node));
+                    case NodeKind::ShiftLeftAssignStatement: return self->VisitShiftLeftAssignStatement(std::static_pointer_cast<ShiftLeftAssignStatementNode>(node));
+                    case NodeKind::ShiftLeft: return self->VisitShiftLeft(std::static_pointer_cast<ShiftLeftNode>(node));
+                    case NodeKind::ShiftRightAssignStatement: return self->VisitShiftRightAssignStatement(std::static_pointer_cast<ShiftRightAssignStatementNode>(node));
+                    case NodeKind::ShiftRight: return self->VisitShiftRight(std::static_pointer_cast<ShiftRightNode>(node));
+                    case NodeKind::SignedNumber: return self->VisitSignedNumber(std::static_pointer_cast<SignedNumberNode>(node));
+                    case NodeKind::SimpleStatement: return self->VisitSimpleStatement(std::static_pointer_cast<SimpleStatementNode>(node));
+                    case NodeKind::SingleInput: return self->VisitSingleInput(std::static_pointer_cast<SingleInputNode>(node));
+                    case NodeKind::StarExpr: return self->VisitStarExpr(std::static_pointer_cast<StarExprNode>(node));
+                    case NodeKind::StarNamedExpression: return self->VisitStarNamedExpression(std::static_pointer_cast<StarNamedExpressionNode>(node));
+                    case NodeKind::StarPattern: return self->VisitStarPattern(std::static_pointer_cast<StarPatternNode>(node));
+                    case NodeKind::SubjectExpr: return self->VisitSubjectExpr(std::static_pointer_cast<SubjectExprNode>(node));
+                    case NodeKind::SubscriptList: return self->VisitSubscriptList(std::static_pointer_cast<SubscriptListNode>(node));
+                    case NodeKind::Subscript: return self->VisitSubscript(std::static_pointer_cast<SubscriptNode>(node));
+                    case NodeKind::SuiteStatement: return self->VisitSuiteStatement(std::static_pointer_cast<SuiteStatementNode>(node));
+                    case NodeKind::SyncCompFor: return self->VisitSyncCompFor(std::static_pointer_cast<SyncCompForNode>(node));
+                    case NodeKind::TFPDefAssignStatement: return self->VisitTFPDefAssignStatement(std::static_pointer_cast<TFPDefAssignStatementNode>(node));
+                    case NodeKind::TFPDefStatement: return self->VisitTFPDefStatement(std::static_pointer_cast<TFPDefStatementNode>(node));
+                    case NodeKind::TestListComp: return self->VisitTestListComp(std::static_pointer_cast<TestListCompNode>(node));
+                    case NodeKind::TestList: return self->VisitTestList(std::static_pointer_cast<TestListNode>(node));
+                    case NodeKind::TestListStarExprListStatement: return self->VisitTestListStarExprListStatement(std::static_pointer_cast<TestListStarExprListStatementNode>(node));
+                    case NodeKind::Test: return self->VisitTest(std::static_pointer_cast<TestNode>(node));
+                    case NodeKind::TryStatement: return self->VisitTryStatement(std::static_pointer_cast<TryStatementNode>(node));
+                    case NodeKind::TypeInput: return self->VisitTypeInput(std::static_pointer_cast<TypeInputNode>(node));
+                    case NodeKind::TypeList: return self->VisitTypeList(std::static_pointer_cast<TypeListNode>(node));
+                    case NodeKind::TypedArgsListStatement: return self->VisitTypedArgsListStatement(std::static_pointer_cast<TypedArgsListStatementNode>(node));
+                    case NodeKind::UnaryBitInvert: return self->VisitUnaryBitInvert(std::static_pointer_cast<UnaryBitInvertNode>(node));
+                    case NodeKind::UnaryMinus: return self->VisitUnaryMinus(std::static_pointer_cast<UnaryMinusNode>(node));
+                    case NodeKind::UnaryPlus: return self->VisitUnaryPlus(std::static_pointer_cast<UnaryPlusNode>(node));
+                    case NodeKind::VFPDefAssignExpression: return self->VisitVFPDefAssignExpression(std::static_pointer_cast<VFPDefAssignExpressionNode>(node));
+                    case NodeKind::ValuePattern: return self->VisitValuePattern(std::static_pointer_cast<ValuePatternNode>(node));
+                    case NodeKind::VarArgsListExpression: return self->VisitVarArgsListExpression(std::static_pointer_cast<VarArgsListExpressionNode>(node));
+                    case NodeKind::WhileStatement: return self->VisitWhileStatement(std::static_pointer_cast<WhileStatementNode>(node));
+                    case NodeKind::WildCardPattern: return self->VisitWildCardPattern(std::static_pointer_cast<WildCardPatternNode>(node));
+                    case NodeKind::WithItemStatement: return self->VisitWithItemStatement(std::static_pointer_cast<WithItemStatementNode>(node));
+                    case NodeKind::WithStatement: return self->VisitWithStatement(std::static_pointer_cast<WithStatementNode>(node));
+                    case NodeKind::YieldExpr: return self->VisitYieldExpr(std::static_pointer_cast<YieldExprNode>(node));
+                    case NodeKind::YieldFrom: return self->VisitYieldFrom(std::static_pointer_cast<YieldFromNode>(node));
+                    case NodeKind::YieldStatement: return self->VisitYieldStatement(std::static_pointer_cast<YieldStatementNode>(node));
+                }
+
+                return Result();
+            }
+
+            template <typename T>
+            Result VisitDefault(std::shared_ptr<T> node)
+            {
+                return Result();
+            }
+
+            Result VisitAndTest(std::shared_ptr<AndTestNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAnnAssignStatement(std::shared_ptr<AnnAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitArgsList(std::shared_ptr<ArgsListNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitArgument(std::shared_ptr<ArgumentNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAsPattern(std::shared_ptr<AsPatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAssertStatement(std::shared_ptr<AssertStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAssignStatement(std::shared_ptr<AssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAsyncStatement(std::shared_ptr<AsyncStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAtomDictionary(std::shared_ptr<AtomDictionaryNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAtomElipsis(std::shared_ptr<AtomElipsisNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAtomExpr(std::shared_ptr<AtomExprNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAtomFalse(std::shared_ptr<AtomFalseNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAtomList(std::shared_ptr<AtomListNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAtomName(std::shared_ptr<AtomNameNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAtomNone(std::shared_ptr<AtomNoneNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAtomNumber(std::shared_ptr<AtomNumberNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAtomSet(std::shared_ptr<AtomSetNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAtomString(std::shared_ptr<AtomStringNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAtomTrue(std::shared_ptr<AtomTrueNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitAtomTuple(std::shared_ptr<AtomTupleNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitBitAndAssignStatement(std::shared_ptr<BitAndAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitBitAnd(std::shared_ptr<BitAndNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitBitOrAssignStatement(std::shared_ptr<BitOrAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitBitOr(std::shared_ptr<BitOrNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitBitXorAssignStatement(std::shared_ptr<BitXorAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitBitXor(std::shared_ptr<BitXorNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitBreakStatement(std::shared_ptr<BreakStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCall(std::shared_ptr<CallNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCapturePattern(std::shared_ptr<CapturePatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCaseStatement(std::shared_ptr<CaseStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitClassPattern(std::shared_ptr<ClassPatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitClassStatement(std::shared_ptr<ClassStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCompFor(std::shared_ptr<CompForNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCompIf(std::shared_ptr<CompIfNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCompareEqual(std::shared_ptr<CompareEqualNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCompareGreaterEqual(std::shared_ptr<CompareGreaterEqualNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCompareGreater(std::shared_ptr<CompareGreaterNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCompareIn(std::shared_ptr<CompareInNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCompareIs(std::shared_ptr<CompareIsNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCompareIsNot(std::shared_ptr<CompareIsNotNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCompareLessEqual(std::shared_ptr<CompareLessEqualNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCompareLess(std::shared_ptr<CompareLessNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCompareNotEqual(std::shared_ptr<CompareNotEqualNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitCompareNotIn(std::shared_ptr<CompareNotInNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitComplexNumber(std::shared_ptr<ComplexNumberNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitContinueStatement(std::shared_ptr<ContinueStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDecoratedStatement(std::shared_ptr<DecoratedStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDecoratorStatement(std::shared_ptr<DecoratorStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDecoratorsStatement(std::shared_ptr<DecoratorsStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDelStatement(std::shared_ptr<DelStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDictionaryContainer(std::shared_ptr<DictionaryContainerNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDictionaryEntry(std::shared_ptr<DictionaryEntryNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDictionaryKWEntry(std::shared_ptr<DictionaryKWEntryNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDivAssignStatement(std::shared_ptr<DivAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDiv(std::shared_ptr<DivNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDotName(std::shared_ptr<DotNameNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDottedAsNameStatement(std::shared_ptr<DottedAsNameStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDottedAsNamesStatement(std::shared_ptr<DottedAsNamesStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDottedNameStatement(std::shared_ptr<DottedNameStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitDoubleStarPattern(std::shared_ptr<DoubleStarPatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitElifStatement(std::shared_ptr<ElifStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitElseStatement(std::shared_ptr<ElseStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitErrorStatement(std::shared_ptr<ErrorStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitEvalInput(std::shared_ptr<EvalInputNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitExceptClause(std::shared_ptr<ExceptClauseNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitExcept(std::shared_ptr<ExceptNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitExprList(std::shared_ptr<ExprListNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitFileInput(std::shared_ptr<FileInputNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitFloorDivAssignStatement(std::shared_ptr<FloorDivAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitFloorDiv(std::shared_ptr<FloorDivNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitForStatement(std::shared_ptr<ForStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitFuncBodySuiteStatement(std::shared_ptr<FuncBodySuiteStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitFuncDefStatement(std::shared_ptr<FuncDefStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitFuncType(std::shared_ptr<FuncTypeNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitGlobalStatement(std::shared_ptr<GlobalStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitGroupPattern(std::shared_ptr<GroupPatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitGuard(std::shared_ptr<GuardNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitIfStatement(std::shared_ptr<IfStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitImportAsNameStatement(std::shared_ptr<ImportAsNameStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitImportAsNamesStatement(std::shared_ptr<ImportAsNamesStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitImportFromStatement(std::shared_ptr<ImportFromStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitImportStatement(std::shared_ptr<ImportStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitIndex(std::shared_ptr<IndexNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitItemsPattern(std::shared_ptr<ItemsPatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitKeyValuePattern(std::shared_ptr<KeyValuePatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitKeywordPattern(std::shared_ptr<KeywordPatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitKeywordPatterns(std::shared_ptr<KeywordPatternsNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitLambda(std::shared_ptr<LambdaNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitLiteralExpr(std::shared_ptr<LiteralExprNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitLiteralPattern(std::shared_ptr<LiteralPatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitMappingPattern(std::shared_ptr<MappingPatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitMatchStatement(std::shared_ptr<MatchStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitMatriceAssignStatement(std::shared_ptr<MatriceAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitMatrice(std::shared_ptr<MatriceNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitMaybeeStarSequencePattern(std::shared_ptr<MaybeeStarSequencePatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitMinusAssignStatement(std::shared_ptr<MinusAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitMinus(std::shared_ptr<MinusNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitModuloAssignStatement(std::shared_ptr<ModuloAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitModulo(std::shared_ptr<ModuloNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitMulAssignStatement(std::shared_ptr<MulAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitMul(std::shared_ptr<MulNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitNamedExpr(std::shared_ptr<NamedExprNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitNonlocalStatement(std::shared_ptr<NonlocalStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitNotTest(std::shared_ptr<NotTestNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitOpenSequencePattern(std::shared_ptr<OpenSequencePatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitOrPattern(std::shared_ptr<OrPatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitOrTest(std::shared_ptr<OrTestNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitParameterStatement(std::shared_ptr<ParameterStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitPassStatement(std::shared_ptr<PassStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitPlusAssignStatement(std::shared_ptr<PlusAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitPlus(std::shared_ptr<PlusNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitPositionalPatterns(std::shared_ptr<PositionalPatternsNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitPowerAssignStatement(std::shared_ptr<PowerAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitPower(std::shared_ptr<PowerNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitRaiseStatement(std::shared_ptr<RaiseStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitReturnStatement(std::shared_ptr<ReturnStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitSequencePattern(std::shared_ptr<SequencePatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitSetContainer(std::shared_ptr<SetContainerNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitShiftLeftAssignStatement(std::shared_ptr<ShiftLeftAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitShiftLeft(std::shared_ptr<ShiftLeftNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitShiftRightAssignStatement(std::shared_ptr<ShiftRightAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitShiftRight(std::shared_ptr<ShiftRightNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitSignedNumber(std::shared_ptr<SignedNumberNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitSimpleStatement(std::shared_ptr<SimpleStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitSingleInput(std::shared_ptr<SingleInputNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitStarExpr(std::shared_ptr<StarExprNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitStarNamedExpression(std::shared_ptr<StarNamedExpressionNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitStarPattern(std::shared_ptr<StarPatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitSubjectExpr(std::shared_ptr<SubjectExprNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitSubscriptList(std::shared_ptr<SubscriptListNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitSubscript(std::shared_ptr<SubscriptNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitSuiteStatement(std::shared_ptr<SuiteStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitSyncCompFor(std::shared_ptr<SyncCompForNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitTFPDefAssignStatement(std::shared_ptr<TFPDefAssignStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitTFPDefStatement(std::shared_ptr<TFPDefStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitTestListComp(std::shared_ptr<TestListCompNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitTestList(std::shared_ptr<TestListNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitTestListStarExprListStatement(std::shared_ptr<TestListStarExprListStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitTest(std::shared_ptr<TestNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitTryStatement(std::shared_ptr<TryStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitTypeInput(std::shared_ptr<TypeInputNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitTypeList(std::shared_ptr<TypeListNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitTypedArgsListStatement(std::shared_ptr<TypedArgsListStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitUnaryBitInvert(std::shared_ptr<UnaryBitInvertNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitUnaryMinus(std::shared_ptr<UnaryMinusNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitUnaryPlus(std::shared_ptr<UnaryPlusNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitVFPDefAssignExpression(std::shared_ptr<VFPDefAssignExpressionNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitValuePattern(std::shared_ptr<ValuePatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitVarArgsListExpression(std::shared_ptr<VarArgsListExpressionNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitWhileStatement(std::shared_ptr<WhileStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitWildCardPattern(std::shared_ptr<WildCardPatternNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitWithItemStatement(std::shared_ptr<WithItemStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitWithStatement(std::shared_ptr<WithStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitYieldExpr(std::shared_ptr<YieldExprNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitYieldFrom(std::shared_ptr<YieldFromNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+            Result VisitYieldStatement(std::shared_ptr<YieldStatementNode> node) { return static_cast<Derived *>(this)->VisitDefault(node); }
+    };
+
+    /* Depth first traversal on an explicit stack, so deep trees do not recurse natively.
+       Derived may provide Enter (pre-order, return false to skip the children), Leave
+       (post-order) and VisitToken (called for tokens between Enter and Leave). Lazy
+       function bodies are parsed as they are met unless ForcesBodies returns false. */
+    template <typename Derived>
+    class NodeWalker
+    {
+        public:
+            void Walk(std::shared_ptr<Node> root)
+            {
+                if (root == nullptr) return;
+
+                auto self = static_cast<Derived *>(this);
+                std::vector<Frame> stack;
+
+                if (!self->Enter(root))
+                {
+                    self->Leave(root);
+                    return;
+                }
+                auto force = self->ForcesBodies();
+                stack.push_back( { root, Children(root, force), 0 } );
+
+                while (!stack.empty())
+                {
+                    auto &frame = stack.back();
+
+                    if (frame.mIndex == frame.mChildren.size())
+                    {
+                        auto node = frame.mNode;
+                        stack.pop_back();
+                        self->Leave(node);
+                        continue;
+                    }
+
+                    auto child = frame.mChildren[frame.mIndex++];
+
+                    if (child.mToken != nullptr) self->VisitToken(child.mToken);
+                    else if (self->Enter(child.mNode)) stack.push_back( { child.mNode, Children(child.mNode, force), 0 } );
+                    else self->Leave(child.mNode);
+                }
+            }
+
+            bool Enter(std::shared_ptr<Node> node) { return true; }
+            void Leave(std::shared_ptr<Node> node) {}
+            void VisitToken(std::shared_ptr<Token> token) {}
+            bool ForcesBodies() { return true; }
+
+        protected:
+            struct Child
+            {
+                std::shared_ptr<Node> mNode;
+                std::shared_ptr<Token> mToken;
+            };
+
+            struct Frame
+            {
+                std::shared_ptr<Node> mNode;
+                std::vector<Child> mChildren;
+                std::size_t mIndex;
+            };
+
+            static void Add(std::vector<Child> &children, std::shared_ptr<Node> node)
+            {
+                if (node != nullptr) children.push_back( { node, nullptr } );
+            }
+
+            static void Add(std::vector<Child> &children, std::shared_ptr<Token> token)
+            {
+                if (token != nullptr) children.push_back( { nullptr, token } );
+            }
+
+            template <typename T>
+            static void Add(std::vector<Child> &children, std::shared_ptr<std::vector<std::shared_ptr<T>>> nodes)
+            {
+                if (nodes == nullptr) return;
+                for (auto &element : *nodes) Add(children, element);
+            }
+
+            static std::vector<Child> Children(std::shared_ptr<Node> node, bool forceBodies)
+            {
+                std::vector<Child> children;
+                ForEachChild(node, [&children](auto child) { Add(children, child); }, forceBodies);
+                return children;
+            }
+    };
+}
@@ -18,6 +18,10 @@ namespace PythonCoreNative::RunTime::Parser::AST
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> separators
                         );
 
+            std::shared_ptr<Token> GetOperator();
+            std::shared_ptr<std::vector<std::shared_ptr<NameToken>>> GetNodes();
+            std::shared_ptr<std::vector<std::shared_ptr<Token>>> GetSeparators();
+
         protected:
             std::shared_ptr<Token> mOp1;
             std::shared_ptr<std::vector<std::shared_ptr<NameToken>>> mNodes;
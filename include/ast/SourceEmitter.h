@@ -0,0 +1,78 @@
+#pragma once
+
+#include <ast/GreenTree.h>
+#include <ast/Node.h>
+#include <Token.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    /* Writes the text of a tree back into a buffer owned by the caller, every token with
+       its leading trivia and the text between tokens, so an unmodified tree gives its
+       source exactly. Text is copied straight from the source each subtree was parsed
+       from, nothing is built up in between. The sink is called with the buffer whenever
+       it fills and on Flush, writes longer than the buffer go to the sink directly. */
+    class SourceEmitter
+    {
+        public:
+            using Sink = std::function<void(const wchar_t *text, std::size_t length)>;
+
+            SourceEmitter(wchar_t *buffer, std::size_t capacity, Sink sink);
+
+            /* Node is written as replacement, a subtree of a parse of source, from the
+               replacement's leading trivia on. A null replacement removes the node with
+               its leading trivia. The span of node is taken here from its own subtree,
+               replaced nodes are then found by position in the trees emitted, so they all
+               belong to one source. Replacements are written as parsed. */
+            void Replace(std::shared_ptr<Node> node, std::shared_ptr<Node> replacement, std::shared_ptr<std::wstring> source);
+
+            /* Tree parsed from source, from the first token's leading trivia to the end
+               of the last token. */
+            void Emit(std::shared_ptr<Node> root, std::shared_ptr<std::wstring> source);
+
+            /* Green trees carry their text, edited versions included. */
+            void Emit(std::shared_ptr<const GreenNode> root);
+
+            /* Hands the rest of the buffer to the sink, returns the characters emitted. */
+            std::size_t Flush();
+
+        protected:
+            /* Span of a tree or of a replaced node, from the first token's leading
+               trivia to the end of the last token. */
+            struct Span
+            {
+                unsigned int mFullStart;
+                unsigned int mEnd;
+            };
+
+            struct Replacement
+            {
+                std::shared_ptr<Node> mNode;
+                std::shared_ptr<Node> mReplacement;
+                std::shared_ptr<std::wstring> mSource;
+                Span mSpan;
+            };
+
+            void Write(const wchar_t *text, std::size_t length);
+            void Copy(const std::wstring &source, Span span, bool replace);
+
+            static Span SpanOf(std::shared_ptr<Node> root);
+
+            wchar_t *mBuffer;
+            std::size_t mCapacity;
+            std::size_t mUsed;
+            std::size_t mLength;
+            Sink mSink;
+            std::unordered_map<Node *, Replacement> mReplacements;
+
+            /* Replacements by start, ordered again by Emit after a Replace. */
+            std::vector<const Replacement *> mPieces;
+            bool mSorted;
+    };
+}
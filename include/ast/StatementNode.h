@@ -7,7 +7,7 @@ namespace PythonCoreNative::RunTime::Parser::AST
     class StatementNode : public Node
     {
         protected:
-            StatementNode(unsigned int start, unsigned int end);
+            StatementNode(unsigned int start, unsigned int end, NodeKind kind);
 
         public:
             bool isExpressionNode() { return false; };
@@ -0,0 +1,97 @@
+
+#pragma once
+
+#include <ast/Node.h>
+#include <Token.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    /* Hash of node kinds, token kinds and token texts, positions are ignored. With trivia
+       the whitespace, comments and line breaks around tokens are hashed as well. Hashes
+       are kept per node keyed by address, GetHash is only meaningful while the tree
+       hashed last at that address is alive. */
+    class StructuralHasher
+    {
+        public:
+            StructuralHasher(bool includeTrivia = false);
+
+            /* Hashes every node of the subtree, returns the root's hash. */
+            std::uint64_t Hash(std::shared_ptr<Node> root);
+            std::uint64_t HashToken(std::shared_ptr<Token> token);
+
+            /* Zero for nodes not hashed yet. */
+            std::uint64_t GetHash(Node *node);
+
+        protected:
+            bool mIncludeTrivia;
+            std::unordered_map<Node *, std::uint64_t> mHashes;
+
+            friend class StructuralHashWalker;
+    };
+
+    /* Subtree header in a HashConsStore. */
+    struct HashConsEntry
+    {
+        NodeKind mKind;
+        unsigned int mFirstChild;
+        unsigned int mChildCount;
+    };
+
+    struct HashConsToken
+    {
+        /* Prefixes of string tokens. */
+        static constexpr unsigned int Raw = 1, Unicode = 2, Formatted = 4, Bytes = 8;
+
+        TokenKind mKind;
+        unsigned int mText;
+        unsigned int mFlags;
+    };
+
+    /* Keeps one entry per distinct subtree, with children referring to entries and to
+       interned tokens, so two subtrees interned into the same store are structurally
+       equal exactly when their ids are. Positions and trivia are not kept, trees of any
+       number of files can be interned into one store. */
+    class HashConsStore
+    {
+        public:
+            static constexpr unsigned int TokenBit = 0x80000000;
+            static constexpr unsigned int ListBit = 0x40000000;    /* list of the low bits' count follows */
+            static constexpr unsigned int NoChild = 0xffffffff;    /* absent optional child */
+
+            HashConsStore();
+
+            /* Id of the subtree. When ids is given, the id of every node in it is stored. */
+            unsigned int Intern(std::shared_ptr<Node> root, std::unordered_map<Node *, unsigned int> *ids = nullptr);
+
+            unsigned int NodeCount();
+            unsigned int TokenCount();
+            unsigned int TextCount();
+
+            const HashConsEntry & GetNode(unsigned int id);
+            unsigned int GetChild(unsigned int id, unsigned int index);
+            const HashConsToken & GetToken(unsigned int id);
+            const std::wstring & GetText(unsigned int text);
+
+            std::size_t MemoryUsage();
+
+        protected:
+            unsigned int InternToken(std::shared_ptr<Token> token);
+            unsigned int InternNode(NodeKind kind, const std::vector<unsigned int> &children);
+
+            std::vector<HashConsEntry> mNodes;
+            std::vector<unsigned int> mChildren;
+            std::vector<HashConsToken> mTokens;
+            std::vector<std::wstring> mTexts;
+            std::unordered_multimap<std::uint64_t, unsigned int> mNodeIndex;
+            std::unordered_map<std::uint64_t, unsigned int> mTokenIndex;
+            std::unordered_map<std::wstring, unsigned int> mTextIndex;
+
+            friend class HashConsWalker;
+    };
+}
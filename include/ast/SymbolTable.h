@@ -0,0 +1,125 @@
+#pragma once
+
+#include <ast/Node.h>
+#include <Token.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    class AtomNameNode;
+    class FileInputNode;
+
+    enum class ScopeKind : unsigned int
+    {
+        Module,
+        Function,
+        Class,
+        Lambda,
+        Comprehension
+    };
+
+    enum class SymbolKind : unsigned int
+    {
+        Local,          /* fast local of a function, name in the namespace of a class */
+        Cell,           /* local captured by a nested scope */
+        Free,           /* captured from an enclosing function */
+        Global          /* module names, global declarations and unresolved names */
+    };
+
+    struct Symbol
+    {
+        static constexpr unsigned int NoSlot = 0xffffffff;
+
+        static constexpr unsigned int Bound = 1;
+        static constexpr unsigned int Used = 2;
+        static constexpr unsigned int Parameter = 4;
+        static constexpr unsigned int DeclaredGlobal = 8;
+        static constexpr unsigned int DeclaredNonlocal = 16;
+        static constexpr unsigned int FreeInClass = 32;    /* class local also passed on to methods */
+
+        std::wstring mName;
+        SymbolKind mKind;
+        unsigned int mFlags;
+        unsigned int mSlot;
+    };
+
+    /* Names of one scope with their slots. Functions, lambdas and comprehensions lay
+       out their frame as parameters, with the star parameters after the keyword only
+       ones as CPython does, then other locals, cells that are not parameters, and
+       frees; a parameter captured by a nested scope keeps its slot and holds a cell
+       there. Class locals live in the class namespace and have no slot, only their
+       frees do. Globals are numbered across the module. */
+    class Scope
+    {
+        public:
+            Scope(ScopeKind kind, std::shared_ptr<Node> node, Scope *parent);
+
+            ScopeKind GetKind();
+            std::shared_ptr<Node> GetNode();
+            Scope * GetParent();
+            const std::vector<Scope *> & GetChildren();
+
+            unsigned int SymbolCount();
+            Symbol & GetSymbol(unsigned int index);
+            /* Symbol::NoSlot when the name is not used in this scope. */
+            unsigned int Find(const std::wstring &name);
+
+            unsigned int ParameterCount();
+            unsigned int SlotCount();
+
+        protected:
+            unsigned int Add(const std::wstring &name);
+
+            ScopeKind mKind;
+            std::shared_ptr<Node> mNode;
+            Scope *mParent;
+            std::vector<Scope *> mChildren;
+            std::vector<Symbol> mSymbols;
+            std::unordered_map<std::wstring, unsigned int> mIndex;
+            std::vector<unsigned int> mParameters;
+            unsigned int mSlotCount;
+
+            friend class SymbolTable;
+            friend class SymbolTableBuilder;
+    };
+
+    /* Scopes of a file and the symbol every name occurrence refers to, built in time
+       linear in the tree. Conflicting global and nonlocal declarations are reported as
+       SyntaxError. Keyword names in calls and patterns, attribute names and import
+       paths are not variables and have no symbol. */
+    class SymbolTable
+    {
+        public:
+            static std::shared_ptr<SymbolTable> Build(std::shared_ptr<FileInputNode> root);
+
+            Scope * GetModule();
+            /* Scope opened by a function, class, lambda or comprehension node. */
+            Scope * GetScope(Node *node);
+
+            /* Null for names that are not variables. */
+            Symbol * Resolve(NameToken *name);
+            Symbol * Resolve(AtomNameNode *name);
+            Scope * GetScopeOf(NameToken *name);
+
+            unsigned int GlobalCount();
+            const std::wstring & GetGlobalName(unsigned int slot);
+
+        protected:
+            struct Reference
+            {
+                Scope *mScope;
+                unsigned int mSymbol;
+            };
+
+            std::vector<std::unique_ptr<Scope>> mScopes;
+            std::unordered_map<Node *, Scope *> mScopeOf;
+            std::unordered_map<NameToken *, Reference> mReferences;
+            std::vector<std::wstring> mGlobals;
+
+            friend class SymbolTableBuilder;
+    };
+}
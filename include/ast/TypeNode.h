@@ -7,7 +7,7 @@ namespace PythonCoreNative::RunTime::Parser::AST
     class TypeNode : public Node
     {
         protected:
-            TypeNode(unsigned int start, unsigned int end);
+            TypeNode(unsigned int start, unsigned int end, NodeKind kind);
 
         public:
             bool isExpressionNode() { return false; };
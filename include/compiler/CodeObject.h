@@ -0,0 +1,112 @@
+#pragma once
+
+#include <compiler/OpCode.h>
+#include <ast/SymbolTable.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Compiler
+{
+    class CodeObject;
+
+    enum class ConstantKind : unsigned int
+    {
+        None,
+        True,
+        False,
+        Ellipsis,
+        Integer,
+        BigInteger,     /* digits in mText, does not fit 64 bits */
+        Float,
+        Imaginary,
+        String,
+        Tuple,
+        Code
+    };
+
+    /* Entry of a constant pool. */
+    struct Constant
+    {
+        ConstantKind mKind = ConstantKind::None;
+        std::int64_t mInteger = 0;
+        double mReal = 0.0;
+        std::wstring mText;
+        std::vector<Constant> mItems;
+        std::shared_ptr<CodeObject> mCode;
+
+        /* Same kind and value, floats compared by bits and code by identity. */
+        bool operator==(const Constant &other) const;
+    };
+
+    /* Compiled body of a module, function, class, lambda or comprehension. Registers
+       start with the slots the symbol table assigned to the scope, comprehensions have
+       their iterator argument in register 0 ahead of them, temporaries follow.
+       Parameters arrive in the first registers, a function copies the cells it captures
+       into the registers from GetFreeSlot on, and wraps the registers of GetCellSlots in
+       fresh cells when a frame starts. */
+    class CodeObject
+    {
+        public:
+            static constexpr unsigned int VarArgs = 1;
+            static constexpr unsigned int VarKeywords = 2;
+
+            CodeObject(std::wstring name, Parser::AST::ScopeKind kind);
+
+            const std::wstring & GetName();
+            Parser::AST::ScopeKind GetKind();
+
+            unsigned int GetArgCount();         /* positional parameters */
+            unsigned int GetKwOnlyCount();
+            unsigned int GetFlags();
+            /* Names of the parameters in register order, star parameters last. */
+            const std::vector<std::wstring> & GetParameterNames();
+            /* Parameters that have a default, in the order MakeFunction passes them. */
+            const std::vector<unsigned int> & GetDefaultParameters();
+
+            unsigned int GetRegisterCount();
+            const std::vector<unsigned int> & GetCellSlots();
+            /* Register of the creating frame for each captured cell. */
+            const std::vector<unsigned int> & GetFreeSources();
+            unsigned int GetFreeSlot();
+
+            const std::vector<Instruction> & GetInstructions();
+            const std::vector<Constant> & GetConstants();
+            const std::vector<std::wstring> & GetNames();
+
+            unsigned int GetFirstLine();
+            /* Source line of the instruction at pc, 0 when unknown. */
+            unsigned int GetLine(unsigned int pc);
+
+            /* One instruction per line, followed by the code objects in the constant pool. */
+            std::wstring Disassemble();
+
+        protected:
+            /* Line table entries are the pc and line deltas from the previous entry,
+               unsigned and zig zag encoded varints. */
+            void AddLine(unsigned int pc, unsigned int line);
+
+            std::wstring mName;
+            Parser::AST::ScopeKind mKind;
+            unsigned int mArgCount;
+            unsigned int mKwOnlyCount;
+            unsigned int mFlags;
+            std::vector<std::wstring> mParameterNames;
+            std::vector<unsigned int> mDefaultParameters;
+            unsigned int mRegisterCount;
+            std::vector<unsigned int> mCellSlots;
+            std::vector<unsigned int> mFreeSources;
+            unsigned int mFreeSlot;
+            std::vector<Instruction> mInstructions;
+            std::vector<Constant> mConstants;
+            std::vector<std::wstring> mNames;
+            unsigned int mFirstLine;
+            unsigned int mLastPc;
+            unsigned int mLastLine;
+            std::vector<std::uint8_t> mLineTable;
+
+            friend class CodeGenerator;
+    };
+}
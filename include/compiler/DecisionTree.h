@@ -0,0 +1,125 @@
+#pragma once
+
+#include <ast/Node.h>
+#include <Token.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    class MatchStatementNode;
+    class CaseStatementNode;
+}
+
+namespace PythonCoreNative::RunTime::Compiler
+{
+    enum class AccessKind : unsigned int
+    {
+        Subject,
+        Length,         /* len(parent) */
+        Item,           /* parent[mIndex], negative indexes count from the end */
+        Slice,          /* list(parent[mIndex : len(parent) - mCount]) */
+        Key,            /* parent[mNode], missing keys fail the load */
+        Rest,           /* copy of the parent dict without the keys in mKeys */
+        Attributes      /* attributes the class pattern mNode asks of the parent, fails when not an instance */
+    };
+
+    /* Value reached from the subject, loaded once into a register of its own. */
+    struct MatchAccess
+    {
+        AccessKind mKind;
+        unsigned int mParent;
+        std::int64_t mIndex;
+        std::int64_t mCount;
+        std::shared_ptr<Parser::AST::Node> mNode;
+        std::vector<std::shared_ptr<Parser::AST::Node>> mKeys;
+    };
+
+    enum class MatchTestKind : unsigned int
+    {
+        Load,           /* of mAccess */
+        IsSequence,
+        IsMapping,
+        LengthEqual,    /* mAccess is the length */
+        LengthAtLeast,
+        Equal,          /* == the literal or value pattern mValue */
+        Is              /* is the None, True or False literal mValue */
+    };
+
+    struct MatchTest
+    {
+        MatchTestKind mKind;
+        unsigned int mAccess;
+        std::int64_t mCount;
+        std::shared_ptr<Parser::AST::Node> mValue;
+        std::wstring mLiteral;      /* identity of mValue, tests of one access and one value are one test */
+    };
+
+    /* One alternative of a case, or patterns expanded: the tests that must pass in
+       order, then the names to bind. */
+    struct MatchRow
+    {
+        unsigned int mCase;
+        std::vector<unsigned int> mTests;
+        std::vector<std::pair<std::shared_ptr<Parser::NameToken>, unsigned int>> mBindings;
+    };
+
+    enum class DecisionKind : unsigned int
+    {
+        Test,
+        Match,
+        Fail
+    };
+
+    /* Test nodes continue at mOnTrue or mOnFalse, loads that can not fail have no
+       mOnFalse, and mRow is the row the test was taken from. Match nodes bind the
+       names of mRow and run its case; with a guard mOnFalse is where a false guard
+       continues. */
+    struct DecisionNode
+    {
+        DecisionKind mKind;
+        unsigned int mTest;
+        unsigned int mRow;
+        DecisionNode *mOnTrue;
+        DecisionNode *mOnFalse;
+    };
+
+    /* All cases of a match statement lowered into one decision graph. Patterns become
+       rows of primitive tests over accesses of the subject, or patterns one row per
+       alternative, and the graph always tests the next undecided test of the first row
+       that can still match, so tests run in the order sequential matching runs them.
+       Outcomes are remembered along each path: a type, length, key or class test a
+       later case repeats is not run again, and tests it decides, such as a different
+       length or another literal of the same kind, are skipped. Subgraphs that only
+       differ in outcomes the remaining rows do not look at are shared. A guard that is
+       false continues with the rows of the later cases, never another alternative of
+       its own case. */
+    class DecisionTree
+    {
+        public:
+            static constexpr std::size_t MaxRows = 256;
+            static constexpr std::size_t MaxNodes = 1 << 14;
+
+            static std::shared_ptr<DecisionTree> Build(std::shared_ptr<Parser::AST::MatchStatementNode> node);
+
+            const std::vector<std::shared_ptr<Parser::AST::CaseStatementNode>> & GetCases();
+            const std::vector<MatchAccess> & GetAccesses();
+            const std::vector<MatchTest> & GetTests();
+            const std::vector<MatchRow> & GetRows();
+            DecisionNode * GetRoot();
+            std::size_t GetNodeCount();
+
+        protected:
+            std::vector<std::shared_ptr<Parser::AST::CaseStatementNode>> mCases;
+            std::vector<MatchAccess> mAccesses;
+            std::vector<MatchTest> mTests;
+            std::vector<MatchRow> mRows;
+            std::vector<std::unique_ptr<DecisionNode>> mNodes;
+            DecisionNode *mRoot;
+
+            friend class DecisionTreeBuilder;
+    };
+}
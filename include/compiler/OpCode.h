@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstdint>
+
+namespace PythonCoreNative::RunTime::Compiler
+{
+    /* Instructions are 32 bit words: the opcode in the low byte, then the operands A, B
+       and C of one byte each. Bx joins B and C into an unsigned 16 bit operand, sBx is Bx
+       biased by 32767 and sAx the 24 bits above the opcode biased by 8388607. R is a
+       register of the frame, K the constant pool and N the name table of the code
+       object. Opcodes marked "+ W" are followed by one more word. Jump offsets count from
+       the instruction after the jump, including its W word. */
+    enum class OpCode : std::uint8_t
+    {
+        Nop,
+        Move,               /* A B      R[A] = R[B] */
+        LoadConst,          /* A Bx     R[A] = K[Bx] */
+        LoadInt,            /* A sBx    R[A] = sBx */
+        LoadNone,           /* A        R[A] = None */
+        LoadTrue,           /* A        R[A] = True */
+        LoadFalse,          /* A        R[A] = False */
+        LoadGlobal,         /* A Bx     R[A] = globals or builtins [N[Bx]] */
+        StoreGlobal,        /* A Bx     globals[N[Bx]] = R[A] */
+        DeleteGlobal,       /* Bx       del globals[N[Bx]] */
+        LoadName,           /* A Bx     R[A] = class namespace, globals or builtins [N[Bx]] */
+        StoreName,          /* A Bx     namespace[N[Bx]] = R[A] */
+        DeleteName,         /* Bx       del namespace[N[Bx]] */
+        LoadCell,           /* A B      R[A] = contents of cell R[B] */
+        StoreCell,          /* A B      contents of cell R[A] = R[B] */
+        DeleteFast,         /* A        R[A] unbound */
+        DeleteCell,         /* A        contents of cell R[A] unbound */
+        GetAttr,            /* A B + W  R[A] = R[B].N[W] */
+        SetAttr,            /* A B + W  R[A].N[W] = R[B] */
+        DeleteAttr,         /* A + W    del R[A].N[W] */
+        GetItem,            /* A B C    R[A] = R[B][R[C]] */
+        SetItem,            /* A B C    R[A][R[B]] = R[C] */
+        DeleteItem,         /* A B      del R[A][R[B]] */
+        BuildTuple,         /* A B C    R[A] = (R[B], .. R[B+C-1]) */
+        BuildList,          /* A B C    R[A] = [R[B], .. R[B+C-1]] */
+        BuildSet,           /* A B C    R[A] = {R[B], .. R[B+C-1]} */
+        BuildDict,          /* A B C    R[A] = {R[B]: R[B+1], ..}, C pairs */
+        BuildSlice,         /* A B C    R[A] = slice(R[B], R[B+1]) or with step R[B+2] when C is 3 */
+        ListAppend,         /* A B      R[A].append(R[B]) */
+        SetAdd,             /* A B      R[A].add(R[B]) */
+        ListExtend,         /* A B C    R[A].extend((R[B], .. R[B+C-1])) */
+        SetUpdate,          /* A B C    R[A].update((R[B], .. R[B+C-1])) */
+        DictUpdate,         /* A B C    R[A].update({R[B]: R[B+1], ..}), C pairs */
+        ListToTuple,        /* A B      R[A] = tuple(R[B]) */
+        Unpack,             /* A B C    R[A], .. R[A+C-1] = R[B] */
+
+        Add,                /* A B C    R[A] = R[B] op R[C] */
+        Subtract,
+        Multiply,
+        MatrixMultiply,
+        TrueDivide,
+        FloorDivide,
+        Modulo,
+        Power,
+        ShiftLeft,
+        ShiftRight,
+        BitAnd,
+        BitOr,
+        BitXor,
+
+        InPlaceAdd,         /* A B C    R[A] = R[B] op= R[C], same order as above */
+        InPlaceSubtract,
+        InPlaceMultiply,
+        InPlaceMatrixMultiply,
+        InPlaceTrueDivide,
+        InPlaceFloorDivide,
+        InPlaceModulo,
+        InPlacePower,
+        InPlaceShiftLeft,
+        InPlaceShiftRight,
+        InPlaceBitAnd,
+        InPlaceBitOr,
+        InPlaceBitXor,
+
+        Negative,           /* A B      R[A] = op R[B] */
+        Positive,
+        Invert,
+        Not,
+
+        Less,               /* A B C    R[A] = R[B] op R[C] */
+        LessEqual,
+        Equal,
+        NotEqual,
+        Greater,
+        GreaterEqual,
+        In,
+        NotIn,
+        Is,
+        IsNot,
+
+        Jump,               /* sAx      pc += sAx */
+        JumpIfTrue,         /* A sBx    if R[A]: pc += sBx */
+        JumpIfFalse,        /* A sBx    if not R[A]: pc += sBx */
+        GetIter,            /* A B      R[A] = iter(R[B]) */
+        ForIter,            /* A B + W  R[A] = next(R[B]), when exhausted pc += W */
+
+        Call,               /* A B      R[A] = R[A](R[A+1], .. R[A+B]) */
+        CallKw,             /* A B C + W  as Call with C keyword arguments after the B positional ones, named by the tuple K[W] */
+        Return,             /* A        return R[A] */
+        ReturnNone,         /*          return None */
+        MakeFunction,       /* A B C + W  R[A] = function of code K[W], defaults R[B], .. R[B+C-1] */
+        MakeClass,          /* A B C + W  R[A] = class N[W] with body function R[B] and bases R[B+1], .. R[B+C] */
+        Raise,              /* A        raise R[A] */
+
+        MatchSequence,      /* A B      R[A] = R[B] is a list or tuple */
+        MatchMapping,       /* A B      R[A] = R[B] is a dict */
+        GetLength,          /* A B      R[A] = len(R[B]) */
+        GetKey,             /* A B C + W  R[A] = R[B][R[C]], when the key is missing pc += W */
+        MatchClass,         /* A B C + W  R[A] = tuple of the attributes of R[B] matched by class R[A], C positional then those named by the tuple K[W], None when R[B] is not an instance */
+        SliceList,          /* A B C + W  R[A] = list(R[B][C : len(R[B]) - W]) */
+        CopyDictWithout,    /* A B C    R[A] = copy of dict R[B] without the keys in the tuple R[C] */
+
+        Count
+    };
+
+    using Instruction = std::uint32_t;
+
+    constexpr unsigned int MaxRegister = 0xff;
+    /* Elements of a display held in registers at once, longer displays are extended in chunks. */
+    constexpr unsigned int DisplayChunk = 32;
+    constexpr unsigned int MaxBx = 0xffff;
+    constexpr int BiasBx = 0x7fff;
+    constexpr int BiasAx = 0x7fffff;
+
+    constexpr Instruction MakeABC(OpCode op, unsigned int a, unsigned int b = 0, unsigned int c = 0)
+    {
+        return static_cast<Instruction>(op) | (a << 8) | (b << 16) | (c << 24);
+    }
+
+    constexpr Instruction MakeABx(OpCode op, unsigned int a, unsigned int bx)
+    {
+        return static_cast<Instruction>(op) | (a << 8) | (bx << 16);
+    }
+
+    constexpr Instruction MakeAsBx(OpCode op, unsigned int a, int sbx)
+    {
+        return MakeABx(op, a, static_cast<unsigned int>(sbx + BiasBx));
+    }
+
+    constexpr Instruction MakesAx(OpCode op, int sax)
+    {
+        return static_cast<Instruction>(op) | (static_cast<unsigned int>(sax + BiasAx) << 8);
+    }
+
+    constexpr OpCode GetOpCode(Instruction i)   { return static_cast<OpCode>(i & 0xff); }
+    constexpr unsigned int GetA(Instruction i)  { return (i >> 8) & 0xff; }
+    constexpr unsigned int GetB(Instruction i)  { return (i >> 16) & 0xff; }
+    constexpr unsigned int GetC(Instruction i)  { return i >> 24; }
+    constexpr unsigned int GetBx(Instruction i) { return i >> 16; }
+    constexpr int GetsBx(Instruction i)         { return static_cast<int>(i >> 16) - BiasBx; }
+    constexpr int GetsAx(Instruction i)         { return static_cast<int>(i >> 8) - BiasAx; }
+
+    const wchar_t * GetOpCodeName(OpCode op);
+
+    /* True for the opcodes followed by a W word. */
+    bool HasExtraWord(OpCode op);
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::VM
+{
+    /* Integer of any size, the sign apart from the magnitude, which is held in 32-bit
+       digits with the least significant first and no leading zero digits, zero has none.
+       Products of operands of KaratsubaThreshold digits and more split in Karatsuba
+       fashion. Conversion to and from decimal beyond ConversionThreshold digits divides
+       the number in halves at a power of the base, so the cost follows multiplication
+       instead of growing with the square of the length; the power of two bases only
+       move bits. The virtual machine keeps integers that fit 64 bits in values and only
+       the ones beyond in a BigInteger. */
+    class BigInteger
+    {
+        public:
+            static constexpr std::size_t KaratsubaThreshold = 40;
+            static constexpr std::size_t ConversionThreshold = 64;
+
+            BigInteger() : mNegative(false) {}
+            BigInteger(std::int64_t value);
+
+            /* Integral part of a finite double. */
+            static BigInteger FromDouble(double value);
+            /* Digits in base 2 to 36, or of a literal with its 0x, 0o or 0b prefix when the
+               base is 0, with an optional sign and underscores between digits. False when
+               the text is not such a number. */
+            static bool Parse(std::wstring_view text, unsigned int base, BigInteger &result);
+
+            /* Base 2, 8, 10 or 16, with no prefix. */
+            std::wstring ToString(unsigned int base = 10) const;
+
+            bool IsZero() const                     { return mDigits.empty(); }
+            bool IsNegative() const                 { return mNegative; }
+            std::size_t BitLength() const;
+            bool FitsInt64() const;
+            /* Only when it fits. */
+            std::int64_t ToInt64() const;
+            /* Rounded to nearest even, false when beyond the range of doubles. */
+            bool ToDouble(double &result) const;
+
+            int Compare(const BigInteger &other) const;
+            /* Exact against a double that is not a NaN. */
+            int Compare(double other) const;
+            /* Hash of the double it equals when there is one, see ValueHash. */
+            std::size_t Hash() const;
+
+            BigInteger operator-() const;
+            BigInteger operator~() const;
+            BigInteger operator+(const BigInteger &other) const;
+            BigInteger operator-(const BigInteger &other) const;
+            BigInteger operator*(const BigInteger &other) const;
+            BigInteger operator&(const BigInteger &other) const;
+            BigInteger operator|(const BigInteger &other) const;
+            BigInteger operator^(const BigInteger &other) const;
+            BigInteger operator<<(std::size_t shift) const;
+            /* Rounds to negative infinity as Python does. */
+            BigInteger operator>>(std::size_t shift) const;
+
+            /* Floor division with the remainder taking the sign of the divisor, which is not zero. */
+            static void DivMod(const BigInteger &a, const BigInteger &b, BigInteger &quotient, BigInteger &remainder);
+            /* Correctly rounded quotient, false when it is beyond the range of doubles. */
+            static bool TrueDivide(const BigInteger &a, const BigInteger &b, double &result);
+            static BigInteger Power(BigInteger base, std::uint64_t exponent);
+
+        protected:
+            using Digits = std::vector<std::uint32_t>;
+
+            BigInteger(Digits digits, bool negative);
+
+            /* Two's complement in count digits, count is past the highest digit. */
+            Digits Complement(std::size_t count) const;
+            static BigInteger FromComplement(Digits digits);
+
+            Digits mDigits;
+            bool mNegative;
+    };
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <exception>
+#include <string>
+#include <memory>
+
+namespace PythonCoreNative::RunTime::VM
+{
+    /* Python exception that left the interpreter, with the name of its class and the
+       source line of the instruction that raised it. */
+    class ExecutionError : public std::exception
+    {
+        public:
+            ExecutionError(std::shared_ptr<std::wstring> type, std::shared_ptr<std::wstring> msg);
+
+            std::shared_ptr<std::wstring> GetType();
+            std::shared_ptr<std::wstring> GetMessage();
+            unsigned int GetLine();
+            void SetLine(unsigned int line);
+
+        protected:
+            std::shared_ptr<std::wstring> mType;
+            std::shared_ptr<std::wstring> mMsg;
+            unsigned int mLine;
+    };
+}
@@ -0,0 +1,376 @@
+#pragma once
+
+#include <vm/Value.h>
+#include <vm/BigInteger.h>
+#include <compiler/CodeObject.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace PythonCoreNative::RunTime::VM
+{
+    class VirtualMachine;
+    class ClassObject;
+
+    enum class ObjectKind : std::uint8_t
+    {
+        String,
+        Tuple,
+        List,
+        Dict,
+        Set,
+        Range,
+        Iterator,
+        Slice,
+        Cell,
+        Code,
+        Function,
+        Builtin,
+        BoundMethod,
+        Class,
+        Instance,
+        Integer,        /* box of an integer beyond the inline range */
+        BigInteger      /* integer beyond 64 bits */
+    };
+
+    /* Header of every collected object. Objects are chained for the sweep and carry
+       the mark of the current collection. */
+    class Object
+    {
+        public:
+            Object(ObjectKind kind) : mKind(kind), mMarked(false), mNext(nullptr) {}
+            virtual ~Object() = default;
+
+            ObjectKind mKind;
+            bool mMarked;
+            Object *mNext;
+    };
+
+    /* Python equality and hashing of values used as keys, 1, 1.0 and True are the same key. */
+    struct ValueHash
+    {
+        std::size_t operator()(const Value &value) const;
+    };
+
+    struct ValueEqual
+    {
+        bool operator()(const Value &a, const Value &b) const;
+    };
+
+    class IntegerObject : public Object
+    {
+        public:
+            IntegerObject(std::int64_t value) : Object(ObjectKind::Integer), mValue(value) {}
+
+            std::int64_t mValue;
+    };
+
+    /* Only holds integers that do not fit 64 bits, the virtual machine makes smaller
+       results plain integers again, see VirtualMachine::NewInteger. */
+    class BigIntegerObject : public Object
+    {
+        public:
+            BigIntegerObject(BigInteger value) : Object(ObjectKind::BigInteger), mValue(std::move(value)) {}
+
+            BigInteger mValue;
+    };
+
+    /* Characters stored in one, two or four bytes each, the narrowest that holds the
+       largest of them as in PEP 393, so equal strings have equal bytes and any character
+       is found in constant time. The hash is computed on first use and kept. */
+    class StringObject : public Object
+    {
+        public:
+            static constexpr std::size_t NotFound = ~std::size_t(0);
+
+            StringObject(std::wstring_view text);
+            /* Characters of width bytes each, stored narrower when they all fit. */
+            StringObject(std::string data, unsigned int width);
+
+            std::size_t Length() const              { return mLength; }
+            unsigned int Width() const              { return mWidth; }
+            bool IsAscii() const                    { return mAscii; }
+            const char * Data() const               { return mData.data(); }
+
+            std::uint32_t At(std::size_t index) const
+            {
+                switch (mWidth)
+                {
+                    case 1:     return static_cast<std::uint8_t>(mData[index]);
+                    case 2:     return reinterpret_cast<const char16_t *>(mData.data())[index];
+                    default:    return reinterpret_cast<const char32_t *>(mData.data())[index];
+                }
+            }
+
+            /* Bytes of length characters from start, at the given width, which is no narrower than ours. */
+            std::string Bytes(std::size_t start, std::size_t length, unsigned int width) const;
+            std::wstring Text() const;
+            std::size_t Hash();
+            bool Equals(const StringObject *other) const { return mWidth == other->mWidth && mData == other->mData; }
+            int Compare(const StringObject *other) const;
+            /* First place of needle at or after start. */
+            std::size_t Find(const StringObject *needle, std::size_t start = 0) const;
+
+            bool mInterned;
+
+        protected:
+            std::string mData;
+            std::size_t mLength;
+            std::size_t mHash;
+            unsigned char mWidth;
+            bool mAscii;
+            bool mHashed;
+    };
+
+    /* Key order of a dict that only ever had interned string keys added, shared by every
+       dict that added the same keys in the same order, so the shape tells where a key
+       sits and that a key is absent. Shapes are never freed, nor are the interned keys
+       their transitions hold. */
+    class Shape
+    {
+        public:
+            Shape() : mCount(0) {}
+
+            /* Shape after adding the key, made on first use. */
+            Shape * Add(Object *key);
+
+            std::size_t mCount;
+
+        protected:
+            std::unordered_map<Object *, std::unique_ptr<Shape>> mTransitions;
+    };
+
+    class TupleObject : public Object
+    {
+        public:
+            TupleObject(std::vector<Value> items) : Object(ObjectKind::Tuple), mItems(std::move(items)) {}
+
+            std::vector<Value> mItems;
+    };
+
+    class ListObject : public Object
+    {
+        public:
+            ListObject(std::vector<Value> items) : Object(ObjectKind::List), mItems(std::move(items)) {}
+
+            std::vector<Value> mItems;
+    };
+
+    /* Insertion ordered table, entries stay in order and deleted ones are left as holes
+       until the table is compacted. Sets are dicts whose values are unused. */
+    /* Entries in insertion order, as in CPython, indexed by a table of one control byte
+       and one entry number per slot. Control bytes are empty, deleted or the low 7 bits
+       of the hash, and a lookup compares the 16 bytes of a group at once, so only slots
+       whose bits match are looked at and a group with an empty byte ends the probe.
+       Interned strings carry their hash and only equal themselves. */
+    class DictObject : public Object
+    {
+        public:
+            struct Entry
+            {
+                Value mKey;
+                Value mValue;
+                bool mLive;
+                std::size_t mHash;
+            };
+
+            static constexpr std::size_t GroupSize = 16;
+
+            DictObject(ObjectKind kind = ObjectKind::Dict) : Object(kind), mVersion(0), mShape(nullptr) {}
+
+            /* Null when the key is missing. */
+            Value * Find(Value key);
+            /* Place of the key in mEntries, false when missing. */
+            bool FindIndex(Value key, std::size_t &index);
+            void Insert(Value key, Value value);
+            bool Erase(Value key);
+            std::size_t Size();
+
+            std::vector<Entry> mEntries;
+            /* Changes when a key is added or removed, entries keep their place otherwise. */
+            std::uint64_t mVersion;
+            /* Null unless the dict started with a shape and only had interned keys added. */
+            Shape *mShape;
+
+        protected:
+            static constexpr std::uint8_t Empty = 0x80;
+            static constexpr std::uint8_t Deleted = 0xfe;
+            static constexpr std::size_t Missing = ~std::size_t(0);
+
+            /* Slot of the key in the table, Missing when it is not there. */
+            std::size_t Probe(Value key, std::size_t hash);
+            /* Drops the holes of mEntries and indexes them again in a table of capacity slots. */
+            void Rebuild(std::size_t capacity);
+
+            std::unique_ptr<std::uint8_t[]> mControl;
+            std::unique_ptr<std::uint32_t[]> mSlots;
+            std::size_t mCapacity = 0;
+            std::size_t mCount = 0;
+            std::size_t mDeleted = 0;
+    };
+
+    class RangeObject : public Object
+    {
+        public:
+            RangeObject(std::int64_t start, std::int64_t stop, std::int64_t step)
+                : Object(ObjectKind::Range), mStart(start), mStop(stop), mStep(step) {}
+
+            std::int64_t Length();
+
+            std::int64_t mStart;
+            std::int64_t mStop;
+            std::int64_t mStep;
+    };
+
+    /* Iterator over a range, a sequence, a string or the keys of a dict or set. */
+    class IteratorObject : public Object
+    {
+        public:
+            IteratorObject(Value source, std::int64_t start, std::int64_t stop, std::int64_t step)
+                : Object(ObjectKind::Iterator), mSource(source), mCurrent(start), mStop(stop), mStep(step) {}
+
+            Value mSource;          /* None for ranges */
+            std::int64_t mCurrent;
+            std::int64_t mStop;
+            std::int64_t mStep;
+    };
+
+    class SliceObject : public Object
+    {
+        public:
+            SliceObject(Value start, Value stop, Value step)
+                : Object(ObjectKind::Slice), mStart(start), mStop(stop), mStep(step) {}
+
+            Value mStart;
+            Value mStop;
+            Value mStep;
+    };
+
+    class CellObject : public Object
+    {
+        public:
+            CellObject(Value value) : Object(ObjectKind::Cell), mValue(value) {}
+
+            Value mValue;
+    };
+
+    /* Compiled code with its constants and names turned into values once, and what a
+       call needs from the code object at hand. */
+    /* Guarded answer of an attribute site: a slot of instance dicts of one shape, or a
+       class attribute of instances of one shape and class, or of the class itself. */
+    struct AttributeEntry
+    {
+        enum class Kind : std::uint8_t
+        {
+            Slot,
+            Value,
+            Method          /* function bound to the instance */
+        };
+
+        Kind mKind;
+        Shape *mShape;              /* null for class objects */
+        ClassObject *mClass;
+        std::uint64_t mEpoch;       /* of the classes when the class attribute was found */
+        std::size_t mIndex;
+        Value mValue;
+    };
+
+    /* Cache of one LoadGlobal, GetAttr or SetAttr instruction. Attribute sites keep up to
+       Ways entries and replace them in turn, global sites the entry of the name while
+       neither globals nor builtins gained or lost a key. */
+    struct InlineCache
+    {
+        static constexpr unsigned int Ways = 4;
+
+        AttributeEntry mEntries[Ways];
+        unsigned int mCount = 0;
+        unsigned int mNext = 0;
+
+        std::uint64_t mGlobalsVersion = ~std::uint64_t(0);
+        std::uint64_t mBuiltinsVersion = ~std::uint64_t(0);
+        Value *mGlobal = nullptr;
+
+        std::uint64_t mHits = 0;
+        std::uint64_t mMisses = 0;
+    };
+
+    class CodeUnitObject : public Object
+    {
+        public:
+            CodeUnitObject(std::shared_ptr<Compiler::CodeObject> code) : Object(ObjectKind::Code), mCode(code) {}
+
+            std::shared_ptr<Compiler::CodeObject> mCode;
+            std::vector<Value> mConstants;
+            std::vector<Value> mNames;
+
+            const Compiler::Instruction *mInstructions = nullptr;
+            unsigned int mRegisterCount = 0;
+            unsigned int mArgCount = 0;
+            unsigned int mParameterCount = 0;
+            /* Positional parameters only, no cells or frees to set up. */
+            bool mIsSimple = false;
+
+            std::vector<InlineCache> mCaches;
+            std::vector<std::uint32_t> mCacheSlots;     /* cache of the instruction at each pc */
+    };
+
+    class FunctionObject : public Object
+    {
+        public:
+            FunctionObject(CodeUnitObject *code) : Object(ObjectKind::Function), mCode(code) {}
+
+            CodeUnitObject *mCode;
+            std::vector<Value> mDefaults;
+            std::vector<Value> mFreeCells;
+    };
+
+    using BuiltinFunction = Value (*)(VirtualMachine &vm, Value *args, unsigned int count);
+
+    class BuiltinObject : public Object
+    {
+        public:
+            BuiltinObject(const wchar_t *name, BuiltinFunction function)
+                : Object(ObjectKind::Builtin), mName(name), mFunction(function) {}
+
+            const wchar_t *mName;
+            BuiltinFunction mFunction;
+    };
+
+    class BoundMethodObject : public Object
+    {
+        public:
+            BoundMethodObject(Value self, Value function) : Object(ObjectKind::BoundMethod), mSelf(self), mFunction(function) {}
+
+            Value mSelf;
+            Value mFunction;
+    };
+
+    class ClassObject : public Object
+    {
+        public:
+            ClassObject(std::wstring name, DictObject *dict) : Object(ObjectKind::Class), mName(std::move(name)), mDict(dict), mIsException(false) {}
+
+            /* Class attribute along the method resolution order, null when missing. */
+            Value * Lookup(Value name);
+            bool IsSubclassOf(ClassObject *other);
+
+            std::wstring mName;
+            DictObject *mDict;
+            std::vector<ClassObject *> mBases;
+            std::vector<ClassObject *> mMro;
+            bool mIsException;
+    };
+
+    class InstanceObject : public Object
+    {
+        public:
+            InstanceObject(ClassObject *type, DictObject *dict) : Object(ObjectKind::Instance), mClass(type), mDict(dict) {}
+
+            ClassObject *mClass;
+            DictObject *mDict;
+    };
+}
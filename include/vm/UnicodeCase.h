@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace PythonCoreNative::RunTime::VM
+{
+    /* Case mappings of the Unicode character database, version 14 as in Python 3.11,
+       independent of the C locale. The one to one mappings are kept as ranges that share
+       a difference, every character or every second one, the few characters that map to
+       several apart. */
+    class UnicodeCase
+    {
+        public:
+            static std::uint32_t Upper(std::uint32_t c);
+            static std::uint32_t Lower(std::uint32_t c);
+
+            /* Text as str.upper() and str.lower() give it, 'ß' becomes 'SS' and a capital
+               sigma ending a word becomes 'ς'. */
+            static std::wstring Upper(std::wstring_view text);
+            static std::wstring Lower(std::wstring_view text);
+    };
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace PythonCoreNative::RunTime::VM
+{
+    class Object;
+
+    enum class ValueKind : std::uint8_t
+    {
+        Undefined,      /* unbound local or empty register */
+        None,
+        Bool,
+        Integer,
+        Float,
+        Object
+    };
+
+    /* Word of the register file, NaN boxed into 64 bits. Doubles are stored as they are,
+       with every NaN made the positive quiet one, so words at or above the negative
+       quiet NaN with a non zero tag in bits 48 to 50 are free for the other kinds: None,
+       booleans, integers of 48 bits and pointers held in the low 48 bits. Integers
+       beyond 48 bits are boxed, they are still of kind Integer and only the virtual
+       machine creates them, see VirtualMachine::NewInteger. */
+    class Value
+    {
+        public:
+            static constexpr std::int64_t MinInline = -(std::int64_t(1) << 47);
+            static constexpr std::int64_t MaxInline = (std::int64_t(1) << 47) - 1;
+
+            Value() : mBits(Tagged(TagUndefined, 0)) {}
+
+            static Value None()                     { return Value(Tagged(TagNone, 0)); }
+            static Value Bool(bool value)           { return Value(Tagged(TagBool, value)); }
+            /* Only for integers that fit inline. */
+            static Value Integer(std::int64_t value) { return Value(Tagged(TagInteger, static_cast<std::uint64_t>(value) & PayloadMask)); }
+            static Value Float(double value)
+            {
+                std::uint64_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                return Value(value != value ? CanonicalNaN : bits);
+            }
+            static Value FromObject(Object *object) { return Value(Tagged(TagObject, reinterpret_cast<std::uintptr_t>(object))); }
+            static Value Boxed(Object *box)         { return Value(Tagged(TagBoxed, reinterpret_cast<std::uintptr_t>(box))); }
+
+            static bool FitsInline(std::int64_t value) { return value >= MinInline && value <= MaxInline; }
+
+            ValueKind GetKind() const
+            {
+                if (IsFloat()) return ValueKind::Float;
+
+                switch (Tag())
+                {
+                    case TagNone:       return ValueKind::None;
+                    case TagBool:       return ValueKind::Bool;
+                    case TagInteger:
+                    case TagBoxed:      return ValueKind::Integer;
+                    case TagObject:     return ValueKind::Object;
+                    default:            return ValueKind::Undefined;
+                }
+            }
+
+            bool IsUndefined() const                { return mBits == Tagged(TagUndefined, 0); }
+            bool IsNone() const                     { return mBits == Tagged(TagNone, 0); }
+            bool IsBool() const                     { return (mBits >> 48) == (TagBase | TagBool); }
+            bool IsInteger() const                  { return IsSmallInteger() || IsBoxed(); }
+            bool IsSmallInteger() const             { return (mBits >> 48) == (TagBase | TagInteger); }
+            bool IsBoxed() const                    { return (mBits >> 48) == (TagBase | TagBoxed); }
+            bool IsFloat() const                    { return mBits < Tagged(1, 0); }
+            bool IsObject() const                   { return (mBits >> 48) == (TagBase | TagObject); }
+
+            bool AsBool() const                     { return (mBits & PayloadMask) != 0; }
+            std::int64_t AsInteger() const          { return IsBoxed() ? BoxedInteger() : AsSmallInteger(); }
+            std::int64_t AsSmallInteger() const     { return static_cast<std::int64_t>(mBits << 16) >> 16; }
+            double AsFloat() const
+            {
+                double value;
+                std::memcpy(&value, &mBits, sizeof(value));
+                return value;
+            }
+            /* Also the box of a large integer. */
+            Object * AsObject() const               { return reinterpret_cast<Object *>(static_cast<std::uintptr_t>(mBits & PayloadMask)); }
+
+            /* Same kind and same payload, what 'is' compares. Integers compare by value. */
+            bool IsIdentical(Value other) const
+            {
+                if (mBits == other.mBits) return true;
+                return IsInteger() && other.IsInteger() && AsInteger() == other.AsInteger();
+            }
+
+        protected:
+            static constexpr std::uint64_t TagBase = 0xfff8;
+            static constexpr std::uint64_t TagUndefined = 1;
+            static constexpr std::uint64_t TagNone = 2;
+            static constexpr std::uint64_t TagBool = 3;
+            static constexpr std::uint64_t TagInteger = 4;
+            static constexpr std::uint64_t TagObject = 5;
+            static constexpr std::uint64_t TagBoxed = 6;
+            static constexpr std::uint64_t PayloadMask = (std::uint64_t(1) << 48) - 1;
+            static constexpr std::uint64_t CanonicalNaN = 0x7ff8000000000000;
+
+            explicit Value(std::uint64_t bits) : mBits(bits) {}
+
+            static constexpr std::uint64_t Tagged(std::uint64_t tag, std::uint64_t payload) { return ((TagBase | tag) << 48) | payload; }
+
+            unsigned int Tag() const                { return static_cast<unsigned int>((mBits >> 48) & 7); }
+            std::int64_t BoxedInteger() const;
+
+            std::uint64_t mBits;
+    };
+
+    static_assert(sizeof(Value) == 8, "Values are one word!");
+}
@@ -0,0 +1,321 @@
+#include <compiler/CodeObject.h>
+
+#include <cstring>
+#include <sstream>
+
+using namespace PythonCoreNative::RunTime::Compiler;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static const wchar_t *OpCodeNames[] =
+{
+    L"Nop", L"Move", L"LoadConst", L"LoadInt", L"LoadNone", L"LoadTrue", L"LoadFalse",
+    L"LoadGlobal", L"StoreGlobal", L"DeleteGlobal", L"LoadName", L"StoreName", L"DeleteName",
+    L"LoadCell", L"StoreCell", L"DeleteFast", L"DeleteCell",
+    L"GetAttr", L"SetAttr", L"DeleteAttr", L"GetItem", L"SetItem", L"DeleteItem",
+    L"BuildTuple", L"BuildList", L"BuildSet", L"BuildDict", L"BuildSlice", L"ListAppend", L"SetAdd",
+    L"ListExtend", L"SetUpdate", L"DictUpdate", L"ListToTuple", L"Unpack",
+    L"Add", L"Subtract", L"Multiply", L"MatrixMultiply", L"TrueDivide", L"FloorDivide", L"Modulo",
+    L"Power", L"ShiftLeft", L"ShiftRight", L"BitAnd", L"BitOr", L"BitXor",
+    L"InPlaceAdd", L"InPlaceSubtract", L"InPlaceMultiply", L"InPlaceMatrixMultiply", L"InPlaceTrueDivide",
+    L"InPlaceFloorDivide", L"InPlaceModulo", L"InPlacePower", L"InPlaceShiftLeft", L"InPlaceShiftRight",
+    L"InPlaceBitAnd", L"InPlaceBitOr", L"InPlaceBitXor",
+    L"Negative", L"Positive", L"Invert", L"Not",
+    L"Less", L"LessEqual", L"Equal", L"NotEqual", L"Greater", L"GreaterEqual", L"In", L"NotIn", L"Is", L"IsNot",
+    L"Jump", L"JumpIfTrue", L"JumpIfFalse", L"GetIter", L"ForIter",
+    L"Call", L"CallKw", L"Return", L"ReturnNone", L"MakeFunction", L"MakeClass", L"Raise",
+    L"MatchSequence", L"MatchMapping", L"GetLength", L"GetKey", L"MatchClass", L"SliceList", L"CopyDictWithout"
+};
+
+static_assert(sizeof(OpCodeNames) / sizeof(OpCodeNames[0]) == static_cast<std::size_t>(OpCode::Count), "Name every opcode!");
+
+const wchar_t * PythonCoreNative::RunTime::Compiler::GetOpCodeName(OpCode op)
+{
+    return op < OpCode::Count ? OpCodeNames[static_cast<std::size_t>(op)] : L"?";
+}
+
+bool PythonCoreNative::RunTime::Compiler::HasExtraWord(OpCode op)
+{
+    switch (op)
+    {
+        case OpCode::GetAttr:
+        case OpCode::SetAttr:
+        case OpCode::DeleteAttr:
+        case OpCode::ForIter:
+        case OpCode::CallKw:
+        case OpCode::MakeFunction:
+        case OpCode::MakeClass:
+        case OpCode::GetKey:
+        case OpCode::MatchClass:
+        case OpCode::SliceList:
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+bool Constant::operator==(const Constant &other) const
+{
+    if (mKind != other.mKind) return false;
+
+    switch (mKind)
+    {
+        case ConstantKind::Integer:     return mInteger == other.mInteger;
+        case ConstantKind::Float:
+        case ConstantKind::Imaginary:   return std::memcmp(&mReal, &other.mReal, sizeof(double)) == 0;
+        case ConstantKind::BigInteger:
+        case ConstantKind::String:      return mText == other.mText;
+        case ConstantKind::Tuple:       return mItems == other.mItems;
+        case ConstantKind::Code:        return mCode == other.mCode;
+        default:                        return true;
+    }
+}
+
+
+CodeObject::CodeObject(std::wstring name, ScopeKind kind)
+{
+    mName = name;
+    mKind = kind;
+    mArgCount = 0;
+    mKwOnlyCount = 0;
+    mFlags = 0;
+    mRegisterCount = 0;
+    mFreeSlot = 0;
+    mFirstLine = 0;
+    mLastPc = 0;
+    mLastLine = 0;
+}
+
+const std::wstring & CodeObject::GetName()
+{
+    return mName;
+}
+
+ScopeKind CodeObject::GetKind()
+{
+    return mKind;
+}
+
+unsigned int CodeObject::GetArgCount()
+{
+    return mArgCount;
+}
+
+unsigned int CodeObject::GetKwOnlyCount()
+{
+    return mKwOnlyCount;
+}
+
+unsigned int CodeObject::GetFlags()
+{
+    return mFlags;
+}
+
+const std::vector<std::wstring> & CodeObject::GetParameterNames()
+{
+    return mParameterNames;
+}
+
+const std::vector<unsigned int> & CodeObject::GetDefaultParameters()
+{
+    return mDefaultParameters;
+}
+
+unsigned int CodeObject::GetRegisterCount()
+{
+    return mRegisterCount;
+}
+
+const std::vector<unsigned int> & CodeObject::GetCellSlots()
+{
+    return mCellSlots;
+}
+
+const std::vector<unsigned int> & CodeObject::GetFreeSources()
+{
+    return mFreeSources;
+}
+
+unsigned int CodeObject::GetFreeSlot()
+{
+    return mFreeSlot;
+}
+
+const std::vector<Instruction> & CodeObject::GetInstructions()
+{
+    return mInstructions;
+}
+
+const std::vector<Constant> & CodeObject::GetConstants()
+{
+    return mConstants;
+}
+
+const std::vector<std::wstring> & CodeObject::GetNames()
+{
+    return mNames;
+}
+
+unsigned int CodeObject::GetFirstLine()
+{
+    return mFirstLine;
+}
+
+static void WriteVarint(std::vector<std::uint8_t> &table, std::uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        table.push_back( static_cast<std::uint8_t>(value | 0x80) );
+        value >>= 7;
+    }
+
+    table.push_back( static_cast<std::uint8_t>(value) );
+}
+
+static std::uint32_t ReadVarint(const std::vector<std::uint8_t> &table, std::size_t &index)
+{
+    std::uint32_t value = 0;
+    unsigned int shift = 0;
+
+    while (index < table.size())
+    {
+        auto byte = table[index++];
+        value |= static_cast<std::uint32_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) break;
+        shift += 7;
+    }
+
+    return value;
+}
+
+void CodeObject::AddLine(unsigned int pc, unsigned int line)
+{
+    if (mLineTable.empty()) mFirstLine = line;
+    else if (line == mLastLine) return;
+
+    auto delta = static_cast<std::int32_t>(line) - static_cast<std::int32_t>(mLastLine);
+
+    WriteVarint( mLineTable, pc - mLastPc );
+    WriteVarint( mLineTable, (static_cast<std::uint32_t>(delta) << 1) ^ static_cast<std::uint32_t>(delta >> 31) );
+
+    mLastPc = pc;
+    mLastLine = line;
+}
+
+unsigned int CodeObject::GetLine(unsigned int pc)
+{
+    std::size_t index = 0;
+    unsigned int entryPc = 0, line = 0;
+
+    while (index < mLineTable.size())
+    {
+        auto nextPc = entryPc + ReadVarint(mLineTable, index);
+        auto zigzag = ReadVarint(mLineTable, index);
+
+        if (nextPc > pc) break;
+
+        entryPc = nextPc;
+        line += static_cast<unsigned int>( static_cast<std::int32_t>(zigzag >> 1) ^ -static_cast<std::int32_t>(zigzag & 1) );
+    }
+
+    return line;
+}
+
+static void WriteConstant(std::wostringstream &out, const Constant &constant)
+{
+    switch (constant.mKind)
+    {
+        case ConstantKind::None:        out << L"None"; break;
+        case ConstantKind::True:        out << L"True"; break;
+        case ConstantKind::False:       out << L"False"; break;
+        case ConstantKind::Ellipsis:    out << L"..."; break;
+        case ConstantKind::Integer:     out << constant.mInteger; break;
+        case ConstantKind::BigInteger:  out << constant.mText; break;
+        case ConstantKind::Float:       out << constant.mReal; break;
+        case ConstantKind::Imaginary:   out << constant.mReal << L"j"; break;
+        case ConstantKind::String:      out << L"'" << constant.mText << L"'"; break;
+        case ConstantKind::Code:        out << L"<code " << constant.mCode->GetName() << L">"; break;
+        case ConstantKind::Tuple:
+            out << L"(";
+            for (std::size_t i = 0; i < constant.mItems.size(); i++)
+            {
+                if (i > 0) out << L", ";
+                WriteConstant(out, constant.mItems[i]);
+            }
+            out << (constant.mItems.size() == 1 ? L",)" : L")");
+            break;
+    }
+}
+
+std::wstring CodeObject::Disassemble()
+{
+    std::wostringstream out;
+
+    out << L"code " << mName << L" registers " << mRegisterCount << L"\n";
+
+    for (unsigned int pc = 0; pc < mInstructions.size(); pc++)
+    {
+        auto instruction = mInstructions[pc];
+        auto op = GetOpCode(instruction);
+
+        out << pc << L"\t" << GetOpCodeName(op);
+
+        switch (op)
+        {
+            case OpCode::LoadConst:
+                out << L" r" << GetA(instruction) << L" ";
+                WriteConstant(out, mConstants[GetBx(instruction)]);
+                break;
+            case OpCode::LoadInt:
+                out << L" r" << GetA(instruction) << L" " << GetsBx(instruction);
+                break;
+            case OpCode::LoadGlobal:
+            case OpCode::StoreGlobal:
+            case OpCode::LoadName:
+            case OpCode::StoreName:
+                out << L" r" << GetA(instruction) << L" " << mNames[GetBx(instruction)];
+                break;
+            case OpCode::DeleteGlobal:
+            case OpCode::DeleteName:
+                out << L" " << mNames[GetBx(instruction)];
+                break;
+            case OpCode::Jump:
+                out << L" " << pc + 1 + GetsAx(instruction);
+                break;
+            case OpCode::JumpIfTrue:
+            case OpCode::JumpIfFalse:
+                out << L" r" << GetA(instruction) << L" " << pc + 1 + GetsBx(instruction);
+                break;
+            case OpCode::ReturnNone:
+            case OpCode::Nop:
+                break;
+            default:
+                out << L" r" << GetA(instruction) << L" " << GetB(instruction) << L" " << GetC(instruction);
+                break;
+        }
+
+        if (HasExtraWord(op))
+        {
+            auto word = mInstructions[++pc];
+
+            switch (op)
+            {
+                case OpCode::ForIter:
+                case OpCode::GetKey:        out << L" -> " << pc + 1 + static_cast<std::int32_t>(word); break;
+                case OpCode::CallKw:
+                case OpCode::MakeFunction:
+                case OpCode::MatchClass:    out << L" "; WriteConstant(out, mConstants[word]); break;
+                case OpCode::SliceList:     out << L" " << word; break;
+                default:                    out << L" " << mNames[word]; break;
+            }
+        }
+
+        out << L"\n";
+    }
+
+    for (auto &constant : mConstants)
+        if (constant.mKind == ConstantKind::Code) out << L"\n" << constant.mCode->Disassemble();
+
+    return out.str();
+}
@@ -0,0 +1,646 @@
+#include <compiler/DecisionTree.h>
+#include <PythonCoreParser.h>
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+
+using namespace PythonCoreNative::RunTime::Compiler;
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<SyntaxError> Error(std::shared_ptr<Node> node, const wchar_t *message)
+{
+    return std::make_shared<SyntaxError>(node->GetStart(), nullptr, std::make_shared<std::wstring>(message));
+}
+
+/* Identity of a literal or value pattern. Plain strings and decimal integers get an
+   "s:" or "i:" prefix, two of them of one kind with different identities differ. */
+static std::wstring Identity(std::shared_ptr<Node> node)
+{
+    if (node->GetKind() == NodeKind::ValuePattern)
+    {
+        std::wstring dotted = L"v:";
+
+        for (auto &name : *std::static_pointer_cast<ValuePatternNode>(node)->GetNodes())
+            dotted += *name->GetText() + L".";
+
+        return dotted;
+    }
+
+    std::shared_ptr<Token> token;
+    std::shared_ptr<StatementNode> number;
+
+    if (node->GetKind() == NodeKind::LiteralPattern)
+    {
+        auto n = std::static_pointer_cast<LiteralPatternNode>(node);
+        token = n->GetOperator();
+        number = n->GetRight();
+    }
+    else
+    {
+        auto n = std::static_pointer_cast<LiteralExprNode>(node);
+        token = n->GetOperator();
+        number = n->GetRight();
+    }
+
+    if (token != nullptr)
+    {
+        switch (token->GetSymbolKind())
+        {
+            case TokenKind::PyNone:     return L"None";
+            case TokenKind::PyTrue:     return L"True";
+            case TokenKind::PyFalse:    return L"False";
+            default:                    break;
+        }
+
+        auto string = std::static_pointer_cast<StringToken>(token);
+        if (string->IsFormated()) throw Error(node, L"Formatted strings are not allowed in patterns!");
+        if (string->IsBytes()) throw Error(node, L"Bytes literals are not supported by the compiler!");
+
+        /* The text is the content and its closing quotes, an empty string has no text. */
+        auto &text = *string->GetText();
+        auto span = string->GetTokenEndPosition() - string->GetTokenStartPosition();
+        auto content = text.substr(0, 2 * text.size() > span ? 2 * text.size() - span : 0);
+
+        return (content.find(L'\\') == std::wstring::npos ? L"s:" : L"e:") + content;
+    }
+
+    if (number->GetKind() == NodeKind::ComplexNumber)
+    {
+        auto n = std::static_pointer_cast<ComplexNumberNode>(number);
+        return L"c:" + std::wstring(n->GetRealSign() != nullptr ? L"-" : L"") + *n->GetReal()->GetText() +
+                (n->GetImaginarySign()->GetSymbolKind() == TokenKind::PyMinus ? L"-" : L"+") + *n->GetImaginary()->GetText();
+    }
+
+    auto n = std::static_pointer_cast<SignedNumberNode>(number);
+    auto &text = *n->GetNumber()->GetText();
+    auto negative = n->GetSign() != nullptr && text != L"0";
+
+    if (!n->GetNumber()->IsRealNumber() && !n->GetNumber()->IsImaginaryNumber() &&
+        std::all_of(text.begin(), text.end(), [](wchar_t ch) { return ch >= L'0' && ch <= L'9'; }))
+        return (negative ? L"i:-" : L"i:") + text;
+
+    return (negative ? L"n:-" : L"n:") + text;
+}
+
+static bool IsComparable(const std::wstring &identity, const std::wstring &other)
+{
+    return identity.size() > 1 && other.size() > 1 && identity[1] == L':' && other[1] == L':' &&
+            identity[0] == other[0] && (identity[0] == L's' || identity[0] == L'i');
+}
+
+
+namespace PythonCoreNative::RunTime::Compiler
+{
+    class DecisionTreeBuilder
+    {
+        public:
+            DecisionTreeBuilder(DecisionTree &tree) : mTree(tree), mFail(nullptr) {}
+
+            void Build(std::shared_ptr<MatchStatementNode> node)
+            {
+                Access(AccessKind::Subject, 0, 0, 0, nullptr, {}, L"");
+
+                auto &cases = *node->GetNodes();
+
+                for (std::size_t i = 0; i < cases.size(); i++)
+                {
+                    auto n = std::static_pointer_cast<CaseStatementNode>(cases[i]);
+                    auto alternatives = Pattern(n->GetLeft(), 0);
+
+                    for (auto &alternative : alternatives)
+                    {
+                        /* A capture or wildcard that always matches hides the cases after it. */
+                        if (alternative.mTests.empty() && n->GetRight() == nullptr && i + 1 < cases.size())
+                            throw Error(n, L"Irrefutable case pattern makes remaining cases unreachable!");
+
+                        mTree.mRows.push_back( { static_cast<unsigned int>(i), alternative.mTests, alternative.mBindings } );
+                    }
+
+                    mTree.mCases.push_back(n);
+                }
+
+                mTree.mRoot = Decide(0, std::vector<bool>(cases.size(), false), {});
+            }
+
+        protected:
+            using Facts = std::map<unsigned int, bool>;
+
+            struct Alternative
+            {
+                std::vector<unsigned int> mTests;
+                std::vector<std::pair<std::shared_ptr<NameToken>, unsigned int>> mBindings;
+            };
+
+            using Alternatives = std::vector<Alternative>;
+
+            /* Patterns */
+
+            unsigned int Access(AccessKind kind, unsigned int parent, std::int64_t index, std::int64_t count,
+                                std::shared_ptr<Node> node, std::vector<std::shared_ptr<Node>> keys, const std::wstring &identity)
+            {
+                auto key = std::to_wstring(static_cast<unsigned int>(kind)) + L"/" + std::to_wstring(parent) + L"/" +
+                            std::to_wstring(index) + L"/" + std::to_wstring(count) + L"/" + identity;
+                auto it = mAccessIndex.emplace(key, static_cast<unsigned int>(mTree.mAccesses.size()));
+
+                if (it.second) mTree.mAccesses.push_back( { kind, parent, index, count, node, std::move(keys) } );
+                return it.first->second;
+            }
+
+            unsigned int Test(MatchTestKind kind, unsigned int access, std::int64_t count = 0, std::shared_ptr<Node> value = nullptr)
+            {
+                auto identity = value != nullptr ? Identity(value) : std::wstring();
+                auto key = std::to_wstring(static_cast<unsigned int>(kind)) + L"/" + std::to_wstring(access) + L"/" +
+                            std::to_wstring(count) + L"/" + identity;
+                auto it = mTestIndex.emplace(key, static_cast<unsigned int>(mTree.mTests.size()));
+
+                if (it.second) mTree.mTests.push_back( { kind, access, count, value, identity } );
+                return it.first->second;
+            }
+
+            static Alternatives Only(std::vector<unsigned int> tests)
+            {
+                return { { std::move(tests), {} } };
+            }
+
+            /* Every alternative of the first followed by every one of the second. */
+            static Alternatives Then(std::shared_ptr<Node> node, const Alternatives &first, const Alternatives &second)
+            {
+                if (first.size() * second.size() > DecisionTree::MaxRows) throw Error(node, L"Too many alternatives in pattern!");
+
+                Alternatives result;
+
+                for (auto &a : first)
+                    for (auto &b : second)
+                    {
+                        auto combined = a;
+                        combined.mTests.insert(combined.mTests.end(), b.mTests.begin(), b.mTests.end());
+                        combined.mBindings.insert(combined.mBindings.end(), b.mBindings.begin(), b.mBindings.end());
+                        result.push_back(std::move(combined));
+                    }
+
+                return result;
+            }
+
+            static Alternatives Bind(Alternatives alternatives, std::shared_ptr<Token> name, unsigned int access)
+            {
+                for (auto &alternative : alternatives)
+                    alternative.mBindings.push_back( { std::static_pointer_cast<NameToken>(name), access } );
+
+                return alternatives;
+            }
+
+            static std::vector<std::wstring> Names(const Alternative &alternative)
+            {
+                std::vector<std::wstring> names;
+                for (auto &binding : alternative.mBindings) names.push_back(*binding.first->GetText());
+
+                std::sort(names.begin(), names.end());
+                return names;
+            }
+
+            static bool IsWildCard(std::shared_ptr<Node> node)
+            {
+                while (node->GetKind() == NodeKind::GroupPattern) node = std::static_pointer_cast<GroupPatternNode>(node)->GetRight();
+                return node->GetKind() == NodeKind::WildCardPattern;
+            }
+
+            Alternatives Pattern(std::shared_ptr<Node> node, unsigned int access)
+            {
+                switch (node->GetKind())
+                {
+                    case NodeKind::WildCardPattern:
+                        return Only({});
+
+                    case NodeKind::CapturePattern:
+                        return Bind(Only({}), std::static_pointer_cast<CapturePatternNode>(node)->GetOperator(), access);
+
+                    case NodeKind::AsPattern:
+                        {
+                            auto n = std::static_pointer_cast<AsPatternNode>(node);
+                            return Bind(Pattern(n->GetLeft(), access), std::static_pointer_cast<CapturePatternNode>(n->GetRight())->GetOperator(), access);
+                        }
+
+                    case NodeKind::GroupPattern:
+                        return Pattern(std::static_pointer_cast<GroupPatternNode>(node)->GetRight(), access);
+
+                    case NodeKind::OrPattern:
+                        {
+                            Alternatives result;
+
+                            for (auto &alternative : *std::static_pointer_cast<OrPatternNode>(node)->GetNodes())
+                            {
+                                auto more = Pattern(alternative, access);
+
+                                for (auto &row : more)
+                                    if (!result.empty() && Names(row) != Names(result.front()))
+                                        throw Error(alternative, L"Alternative patterns bind different names!");
+
+                                if (result.size() + more.size() > DecisionTree::MaxRows) throw Error(node, L"Too many alternatives in pattern!");
+                                result.insert(result.end(), more.begin(), more.end());
+                            }
+
+                            return result;
+                        }
+
+                    case NodeKind::LiteralPattern:
+                        {
+                            auto token = std::static_pointer_cast<LiteralPatternNode>(node)->GetOperator();
+                            auto kind = token != nullptr && token->GetSymbolKind() != TokenKind::String ? MatchTestKind::Is : MatchTestKind::Equal;
+
+                            return Only({ Test(kind, access, 0, node) });
+                        }
+
+                    case NodeKind::ValuePattern:
+                        return Only({ Test(MatchTestKind::Equal, access, 0, node) });
+
+                    case NodeKind::SequencePattern:
+                        {
+                            auto right = std::static_pointer_cast<SequencePatternNode>(node)->GetRight();
+
+                            if (right == nullptr) return Sequence(node, {}, access);
+                            if (right->GetKind() == NodeKind::MaybeeStarSequencePattern)
+                                return Sequence(node, *std::static_pointer_cast<MaybeeStarSequencePatternNode>(right)->GetNodes(), access);
+                            if (right->GetKind() == NodeKind::OpenSequencePattern)
+                                return Sequence(node, *std::static_pointer_cast<OpenSequencePatternNode>(right)->GetNodes(), access);
+
+                            return Sequence(node, { right }, access);
+                        }
+
+                    case NodeKind::OpenSequencePattern:
+                        return Sequence(node, *std::static_pointer_cast<OpenSequencePatternNode>(node)->GetNodes(), access);
+
+                    case NodeKind::MappingPattern:
+                        return Mapping(std::static_pointer_cast<MappingPatternNode>(node), access);
+
+                    case NodeKind::ClassPattern:
+                        return Class(std::static_pointer_cast<ClassPatternNode>(node), access);
+
+                    default:
+                        throw Error(node, L"Pattern is not supported by the compiler!");
+                }
+            }
+
+            Alternatives Sequence(std::shared_ptr<Node> node, const std::vector<std::shared_ptr<StatementNode>> &elements, unsigned int access)
+            {
+                auto count = static_cast<std::int64_t>(elements.size());
+                std::int64_t star = -1;
+
+                for (std::int64_t i = 0; i < count; i++)
+                    if (elements[i]->GetKind() == NodeKind::StarPattern)
+                    {
+                        if (star >= 0) throw Error(elements[i], L"Multiple starred names in sequence pattern!");
+                        star = i;
+                    }
+
+                std::vector<unsigned int> tests { Test(MatchTestKind::IsSequence, access) };
+                auto length = Access(AccessKind::Length, access, 0, 0, nullptr, {}, L"");
+
+                if (star < 0 || count > 1)
+                {
+                    tests.push_back( Test(MatchTestKind::Load, length) );
+                    tests.push_back( star < 0 ? Test(MatchTestKind::LengthEqual, length, count) : Test(MatchTestKind::LengthAtLeast, length, count - 1) );
+                }
+
+                auto result = Only(tests);
+
+                for (std::int64_t i = 0; i < count; i++)
+                {
+                    if (i == star)
+                    {
+                        auto capture = std::static_pointer_cast<StarPatternNode>(elements[i])->GetRight();
+                        if (capture->GetKind() != NodeKind::CapturePattern) continue;
+
+                        auto slice = Access(AccessKind::Slice, access, star, count - 1 - star, nullptr, {}, L"");
+                        result = Bind(Then(node, result, Only({ Test(MatchTestKind::Load, slice) })),
+                                      std::static_pointer_cast<CapturePatternNode>(capture)->GetOperator(), slice);
+                        continue;
+                    }
+
+                    if (IsWildCard(elements[i])) continue;
+
+                    /* Elements after a star are indexed from the end. */
+                    auto item = Access(AccessKind::Item, access, star >= 0 && i > star ? i - count : i, 0, nullptr, {}, L"");
+                    result = Then(node, Then(node, result, Only({ Test(MatchTestKind::Load, item) })), Pattern(elements[i], item));
+                }
+
+                return result;
+            }
+
+            Alternatives Mapping(std::shared_ptr<MappingPatternNode> node, unsigned int access)
+            {
+                std::vector<std::shared_ptr<KeyValuePatternNode>> items;
+                std::vector<std::shared_ptr<Node>> keys;
+                std::vector<std::wstring> seen;
+
+                if (node->GetItems() != nullptr)
+                    for (auto &item : *std::static_pointer_cast<ItemsPatternNode>(node->GetItems())->GetNodes())
+                    {
+                        auto n = std::static_pointer_cast<KeyValuePatternNode>(item);
+                        auto identity = Identity(n->GetKey());
+
+                        if (identity[0] != L'v' && std::find(seen.begin(), seen.end(), identity) != seen.end())
+                            throw Error(n->GetKey(), L"Mapping pattern checks duplicate key!");
+
+                        seen.push_back(identity);
+                        items.push_back(n);
+                        keys.push_back(n->GetKey());
+                    }
+
+                /* All keys are looked up before any value is matched, as CPython does. */
+                std::vector<unsigned int> tests { Test(MatchTestKind::IsMapping, access) };
+                std::vector<unsigned int> values;
+
+                for (std::size_t i = 0; i < items.size(); i++)
+                {
+                    values.push_back( Access(AccessKind::Key, access, 0, 0, keys[i], {}, seen[i]) );
+                    tests.push_back( Test(MatchTestKind::Load, values.back()) );
+                }
+
+                auto result = Only(tests);
+
+                for (std::size_t i = 0; i < items.size(); i++)
+                    if (!IsWildCard(items[i]->GetValue())) result = Then(node, result, Pattern(items[i]->GetValue(), values[i]));
+
+                if (node->GetDoubleStar() != nullptr)
+                {
+                    std::wstring identity;
+                    for (auto &key : seen) identity += key + L",";
+
+                    auto rest = Access(AccessKind::Rest, access, 0, 0, nullptr, keys, identity);
+                    auto capture = std::static_pointer_cast<DoubleStarPatternNode>(node->GetDoubleStar())->GetRight();
+
+                    result = Bind(Then(node, result, Only({ Test(MatchTestKind::Load, rest) })),
+                                  std::static_pointer_cast<CapturePatternNode>(capture)->GetOperator(), rest);
+                }
+
+                return result;
+            }
+
+            Alternatives Class(std::shared_ptr<ClassPatternNode> node, unsigned int access)
+            {
+                std::vector<std::shared_ptr<StatementNode>> patterns;
+                std::vector<std::wstring> names;
+                std::wstring identity;
+
+                for (auto &name : *node->GetNodes()) identity += *name->GetText() + L".";
+
+                if (node->GetPositionals() != nullptr)
+                    for (auto &pattern : *std::static_pointer_cast<PositionalPatternsNode>(node->GetPositionals())->GetNodes())
+                        patterns.push_back(pattern);
+
+                identity += L"/" + std::to_wstring(patterns.size());
+
+                if (node->GetKeywords() != nullptr)
+                    for (auto &keyword : *std::static_pointer_cast<KeywordPatternsNode>(node->GetKeywords())->GetNodes())
+                    {
+                        auto n = std::static_pointer_cast<KeywordPatternNode>(keyword);
+                        auto name = *n->GetOperator1()->GetText();
+
+                        if (std::find(names.begin(), names.end(), name) != names.end())
+                            throw Error(keyword, L"Attribute name repeated in class pattern!");
+
+                        names.push_back(name);
+                        patterns.push_back(n->GetRight());
+                        identity += L"/" + name;
+                    }
+
+                auto attributes = Access(AccessKind::Attributes, access, 0, 0, node, {}, identity);
+                auto result = Only({ Test(MatchTestKind::Load, attributes) });
+
+                for (std::size_t i = 0; i < patterns.size(); i++)
+                {
+                    if (IsWildCard(patterns[i])) continue;
+
+                    auto item = Access(AccessKind::Item, attributes, static_cast<std::int64_t>(i), 0, nullptr, {}, L"");
+                    result = Then(node, Then(node, result, Only({ Test(MatchTestKind::Load, item) })), Pattern(patterns[i], item));
+                }
+
+                return result;
+            }
+
+            /* Decisions */
+
+            static bool CanFail(const MatchTest &test, const std::vector<MatchAccess> &accesses)
+            {
+                if (test.mKind != MatchTestKind::Load) return true;
+
+                auto kind = accesses[test.mAccess].mKind;
+                return kind == AccessKind::Key || kind == AccessKind::Attributes;
+            }
+
+            /* Outcome of a test implied by the facts about the same access. */
+            bool Known(unsigned int index, const Facts &facts, bool &outcome)
+            {
+                auto found = facts.find(index);
+
+                if (found != facts.end())
+                {
+                    outcome = found->second;
+                    return true;
+                }
+
+                auto &test = mTree.mTests[index];
+
+                for (auto &fact : facts)
+                {
+                    auto &other = mTree.mTests[fact.first];
+                    if (other.mAccess != test.mAccess) continue;
+
+                    auto both = [&](MatchTestKind a, MatchTestKind b) { return test.mKind == a && other.mKind == b; };
+
+                    /* Lists and tuples are never dicts. */
+                    if (fact.second && (both(MatchTestKind::IsSequence, MatchTestKind::IsMapping) || both(MatchTestKind::IsMapping, MatchTestKind::IsSequence)))
+                    {
+                        outcome = false;
+                        return true;
+                    }
+
+                    if ((test.mKind == MatchTestKind::LengthEqual || test.mKind == MatchTestKind::LengthAtLeast) &&
+                        (other.mKind == MatchTestKind::LengthEqual || other.mKind == MatchTestKind::LengthAtLeast))
+                    {
+                        auto n = test.mCount, m = other.mCount;
+                        auto equal = test.mKind == MatchTestKind::LengthEqual;
+
+                        if (other.mKind == MatchTestKind::LengthEqual && fact.second)
+                        {
+                            outcome = equal ? n == m : m >= n;
+                            return true;
+                        }
+
+                        if (other.mKind == MatchTestKind::LengthAtLeast && fact.second && (equal ? n < m : n <= m))
+                        {
+                            outcome = !equal;
+                            return true;
+                        }
+
+                        if (other.mKind == MatchTestKind::LengthAtLeast && !fact.second && n >= m)
+                        {
+                            outcome = false;
+                            return true;
+                        }
+                    }
+
+                    if (!fact.second) continue;
+
+                    /* A value equal to one literal is not another of the same kind, and None is only None. */
+                    if ((both(MatchTestKind::Equal, MatchTestKind::Equal) && IsComparable(test.mLiteral, other.mLiteral)) ||
+                        both(MatchTestKind::Is, MatchTestKind::Is) ||
+                        (both(MatchTestKind::Is, MatchTestKind::Equal) && test.mLiteral == L"None" && IsComparable(other.mLiteral, other.mLiteral)) ||
+                        (both(MatchTestKind::Equal, MatchTestKind::Is) && other.mLiteral == L"None" && IsComparable(test.mLiteral, test.mLiteral)))
+                    {
+                        outcome = false;
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            /* The first live row, the cases excluded after it and the facts about the
+               accesses the live rows look at decide the rest of the graph. */
+            std::wstring MemoKey(std::size_t first, const std::vector<bool> &excluded, const Facts &facts)
+            {
+                std::vector<bool> used(mTree.mAccesses.size(), false);
+
+                for (auto r = first; r < mTree.mRows.size(); r++)
+                {
+                    auto &row = mTree.mRows[r];
+                    if (excluded[row.mCase]) continue;
+
+                    for (auto test : row.mTests) used[mTree.mTests[test].mAccess] = true;
+                }
+
+                auto key = std::to_wstring(first) + L":";
+
+                for (auto c = mTree.mRows[first].mCase; c < excluded.size(); c++) key += excluded[c] ? L'x' : L'.';
+                for (auto &fact : facts)
+                    if (used[mTree.mTests[fact.first].mAccess])
+                        key += L":" + std::to_wstring(fact.first) + (fact.second ? L"+" : L"-");
+
+                return key;
+            }
+
+            DecisionNode * NewNode(DecisionKind kind, unsigned int test, unsigned int row)
+            {
+                if (mTree.mNodes.size() >= DecisionTree::MaxNodes)
+                    throw Error(mTree.mCases.front(), L"Match statement is too complex!");
+
+                mTree.mNodes.push_back( std::make_unique<DecisionNode>( DecisionNode { kind, test, row, nullptr, nullptr } ) );
+                return mTree.mNodes.back().get();
+            }
+
+            DecisionNode * Decide(std::size_t first, const std::vector<bool> &excluded, const Facts &facts)
+            {
+                for (auto r = first; r < mTree.mRows.size(); r++)
+                {
+                    auto &row = mTree.mRows[r];
+                    if (excluded[row.mCase]) continue;
+
+                    bool failed = false, outcome;
+                    std::size_t next = 0;
+
+                    while (next < row.mTests.size() && Known(row.mTests[next], facts, outcome))
+                    {
+                        if (!outcome)
+                        {
+                            failed = true;
+                            break;
+                        }
+                        next++;
+                    }
+
+                    if (failed) continue;
+
+                    auto key = MemoKey(r, excluded, facts);
+                    auto memo = mMemo.find(key);
+                    if (memo != mMemo.end()) return memo->second;
+
+                    DecisionNode *node;
+
+                    if (next == row.mTests.size())
+                    {
+                        node = NewNode(DecisionKind::Match, 0, static_cast<unsigned int>(r));
+
+                        if (mTree.mCases[row.mCase]->GetRight() != nullptr)
+                        {
+                            auto rest = excluded;
+                            rest[row.mCase] = true;
+                            node->mOnFalse = Decide(r + 1, rest, facts);
+                        }
+                    }
+                    else
+                    {
+                        auto test = row.mTests[next];
+                        node = NewNode(DecisionKind::Test, test, static_cast<unsigned int>(r));
+
+                        auto passed = facts;
+                        passed[test] = true;
+                        node->mOnTrue = Decide(r, excluded, passed);
+
+                        if (CanFail(mTree.mTests[test], mTree.mAccesses))
+                        {
+                            auto failing = facts;
+                            failing[test] = false;
+                            node->mOnFalse = Decide(r, excluded, failing);
+                        }
+                    }
+
+                    mMemo.emplace(key, node);
+                    return node;
+                }
+
+                if (mFail == nullptr) mFail = NewNode(DecisionKind::Fail, 0, 0);
+                return mFail;
+            }
+
+            DecisionTree &mTree;
+            DecisionNode *mFail;
+            std::unordered_map<std::wstring, unsigned int> mAccessIndex;
+            std::unordered_map<std::wstring, unsigned int> mTestIndex;
+            std::unordered_map<std::wstring, DecisionNode *> mMemo;
+    };
+}
+
+
+std::shared_ptr<DecisionTree> DecisionTree::Build(std::shared_ptr<MatchStatementNode> node)
+{
+    auto tree = std::make_shared<DecisionTree>();
+
+    DecisionTreeBuilder builder(*tree);
+    builder.Build(node);
+
+    return tree;
+}
+
+const std::vector<std::shared_ptr<CaseStatementNode>> & DecisionTree::GetCases()
+{
+    return mCases;
+}
+
+const std::vector<MatchAccess> & DecisionTree::GetAccesses()
+{
+    return mAccesses;
+}
+
+const std::vector<MatchTest> & DecisionTree::GetTests()
+{
+    return mTests;
+}
+
+const std::vector<MatchRow> & DecisionTree::GetRows()
+{
+    return mRows;
+}
+
+DecisionNode * DecisionTree::GetRoot()
+{
+    return mRoot;
+}
+
+std::size_t DecisionTree::GetNodeCount()
+{
+    return mNodes.size();
+}
@@ -0,0 +1,2493 @@
+#include <PythonCoreCompiler.h>
+#include <FloatConversion.h>
+#include <ast/SymbolTable.h>
+#include <ast/ConstantFolder.h>
+#include <compiler/DecisionTree.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cwctype>
+#include <limits>
+#include <map>
+#include <unordered_map>
+
+using namespace PythonCoreNative::RunTime::Compiler;
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+namespace PythonCoreNative::RunTime::Compiler
+{
+    /* Walks the tree once per code object. Every unit keeps its registers as a stack:
+       the symbol table slots at the bottom, temporaries above them released in the
+       order they were taken. Expressions are compiled into a given register, or into
+       whatever register already holds them when that is a local. */
+    class CodeGenerator
+    {
+        public:
+            CodeGenerator(std::shared_ptr<std::wstring> source, const std::vector<unsigned int> &lineStarts,
+                          std::shared_ptr<SymbolTable> table, std::shared_ptr<ConstantFolder> folder)
+                : mSource(source), mLineStarts(lineStarts), mTable(table), mFolder(folder), mUnit(nullptr) {}
+
+            std::shared_ptr<CodeObject> Module(std::shared_ptr<FileInputNode> root)
+            {
+                Unit unit(root, std::make_shared<CodeObject>(L"<module>", ScopeKind::Module), mTable->GetModule(), 0);
+                Enter(unit);
+
+                for (auto &statement : *root->GetNodes()) Statement(statement);
+
+                Emit( MakeABC(OpCode::ReturnNone, 0) );
+
+                return Leave();
+            }
+
+        protected:
+            struct Loop
+            {
+                unsigned int mContinue;
+                std::vector<unsigned int> mBreaks;
+            };
+
+            struct Unit
+            {
+                Unit(std::shared_ptr<Node> node, std::shared_ptr<CodeObject> code, Scope *scope, unsigned int base)
+                    : mNode(node), mCode(code), mScope(scope), mBase(base), mLine(0)
+                {
+                    mNextRegister = base + scope->SlotCount();
+                }
+
+                /* Function, class, comprehension or file compiled, errors of the unit as
+                   a whole are reported at it. */
+                std::shared_ptr<Node> mNode;
+                std::shared_ptr<CodeObject> mCode;
+                Scope *mScope;
+                unsigned int mBase;
+                unsigned int mNextRegister;
+                unsigned int mLine;
+                std::vector<Loop> mLoops;
+                std::unordered_map<std::wstring, unsigned int> mNameIndex;
+                Unit *mOuter;
+            };
+
+            static std::shared_ptr<SyntaxError> Error(std::shared_ptr<Node> node, const wchar_t *message)
+            {
+                return std::make_shared<SyntaxError>(node->GetStart(), nullptr, std::make_shared<std::wstring>(message));
+            }
+
+            /* Units */
+
+            void Enter(Unit &unit)
+            {
+                if (unit.mNextRegister > MaxRegister + 1) throw Error(unit.mNode, L"Too many registers needed in function!");
+
+                unit.mOuter = mUnit;
+                unit.mCode->mRegisterCount = unit.mNextRegister;
+                mUnit = &unit;
+            }
+
+            std::shared_ptr<CodeObject> Leave()
+            {
+                auto code = mUnit->mCode;
+                mUnit = mUnit->mOuter;
+                return code;
+            }
+
+            bool InFunction()
+            {
+                auto kind = mUnit->mScope->GetKind();
+                return kind == ScopeKind::Function || kind == ScopeKind::Lambda || kind == ScopeKind::Comprehension;
+            }
+
+            unsigned int Register()
+            {
+                if (mUnit->mNextRegister > MaxRegister)
+                    throw Error(mUnit->mNode, L"Too many registers needed in function!");
+
+                auto reg = mUnit->mNextRegister++;
+                mUnit->mCode->mRegisterCount = std::max(mUnit->mCode->mRegisterCount, mUnit->mNextRegister);
+                return reg;
+            }
+
+            unsigned int Mark()
+            {
+                return mUnit->mNextRegister;
+            }
+
+            void Release(unsigned int mark)
+            {
+                mUnit->mNextRegister = mark;
+            }
+
+            bool IsTemporary(unsigned int reg)
+            {
+                return reg >= mUnit->mBase + mUnit->mScope->SlotCount();
+            }
+
+            /* Emission */
+
+            unsigned int Here()
+            {
+                return static_cast<unsigned int>(mUnit->mCode->mInstructions.size());
+            }
+
+            unsigned int Emit(Instruction instruction)
+            {
+                mUnit->mCode->mInstructions.push_back(instruction);
+                return Here() - 1;
+            }
+
+            unsigned int Emit(Instruction instruction, std::uint32_t word)
+            {
+                auto pc = Emit(instruction);
+                Emit(word);
+                return pc;
+            }
+
+            void EmitMove(unsigned int dest, unsigned int source)
+            {
+                if (dest != source) Emit( MakeABC(OpCode::Move, dest, source) );
+            }
+
+            unsigned int EmitJump(OpCode op, unsigned int reg = 0)
+            {
+                return Emit( op == OpCode::Jump ? MakesAx(op, 0) : MakeAsBx(op, reg, 0) );
+            }
+
+            void PatchJump(unsigned int pc, unsigned int target)
+            {
+                auto &instructions = mUnit->mCode->mInstructions;
+                auto op = GetOpCode(instructions[pc]);
+
+                if (op == OpCode::ForIter || op == OpCode::GetKey)
+                {
+                    instructions[pc + 1] = static_cast<std::uint32_t>( static_cast<int>(target) - static_cast<int>(pc + 2) );
+                    return;
+                }
+
+                auto offset = static_cast<int>(target) - static_cast<int>(pc + 1);
+
+                if (op == OpCode::Jump)
+                {
+                    if (offset < -BiasAx || offset > BiasAx)
+                        throw std::make_shared<SyntaxError>(0, nullptr, std::make_shared<std::wstring>(L"Jump too far in function!"));
+
+                    instructions[pc] = MakesAx(op, offset);
+                    return;
+                }
+
+                if (offset < -BiasBx || offset > BiasBx)
+                    throw std::make_shared<SyntaxError>(0, nullptr, std::make_shared<std::wstring>(L"Conditional jump too far in function!"));
+
+                instructions[pc] = MakeAsBx(op, GetA(instructions[pc]), offset);
+            }
+
+            void Patch(const std::vector<unsigned int> &jumps, unsigned int target)
+            {
+                for (auto pc : jumps) PatchJump(pc, target);
+            }
+
+            void JumpTo(unsigned int target)
+            {
+                PatchJump( EmitJump(OpCode::Jump), target );
+            }
+
+            unsigned int Name(const std::wstring &name)
+            {
+                auto it = mUnit->mNameIndex.emplace(name, static_cast<unsigned int>(mUnit->mCode->mNames.size()));
+
+                if (it.second)
+                {
+                    if (it.first->second > MaxBx)
+                        throw std::make_shared<SyntaxError>(0, nullptr, std::make_shared<std::wstring>(L"Too many names in code object!"));
+                    mUnit->mCode->mNames.push_back(name);
+                }
+
+                return it.first->second;
+            }
+
+            unsigned int AddConstant(const Constant &constant)
+            {
+                auto &constants = mUnit->mCode->mConstants;
+                auto it = std::find(constants.begin(), constants.end(), constant);
+
+                if (it != constants.end()) return static_cast<unsigned int>(it - constants.begin());
+
+                if (constants.size() > MaxBx)
+                    throw std::make_shared<SyntaxError>(0, nullptr, std::make_shared<std::wstring>(L"Too many constants in code object!"));
+
+                constants.push_back(constant);
+                return static_cast<unsigned int>(constants.size() - 1);
+            }
+
+            void LoadConstant(const Constant &constant, unsigned int dest)
+            {
+                switch (constant.mKind)
+                {
+                    case ConstantKind::None:    Emit( MakeABC(OpCode::LoadNone, dest) ); return;
+                    case ConstantKind::True:    Emit( MakeABC(OpCode::LoadTrue, dest) ); return;
+                    case ConstantKind::False:   Emit( MakeABC(OpCode::LoadFalse, dest) ); return;
+                    case ConstantKind::Integer:
+                        if (constant.mInteger >= -BiasBx && constant.mInteger <= BiasBx + 1)
+                        {
+                            Emit( MakeAsBx(OpCode::LoadInt, dest, static_cast<int>(constant.mInteger)) );
+                            return;
+                        }
+                        break;
+                    default:
+                        break;
+                }
+
+                Emit( MakeABx(OpCode::LoadConst, dest, AddConstant(constant)) );
+            }
+
+            /* Lines */
+
+            unsigned int LineOf(unsigned int position)
+            {
+                auto &text = *mSource;
+
+                /* Node starts may sit on the trivia before their first token. */
+                while (position < text.size())
+                {
+                    if (text[position] == L'#')
+                        while (position < text.size() && text[position] != L'\n') position++;
+                    else if (std::iswspace(text[position]) || text[position] == L'\\') position++;
+                    else break;
+                }
+
+                return static_cast<unsigned int>( std::upper_bound(mLineStarts.begin(), mLineStarts.end(), position) - mLineStarts.begin() );
+            }
+
+            void MarkLine(std::shared_ptr<Node> node)
+            {
+                auto line = LineOf(node->GetStart());
+
+                if (line != mUnit->mLine)
+                {
+                    mUnit->mCode->AddLine(Here(), line);
+                    mUnit->mLine = line;
+                }
+            }
+
+            /* Literals */
+
+            static Constant NumberConstant(std::shared_ptr<NumberToken> token)
+            {
+                Constant constant;
+                std::wstring text;
+
+                for (auto ch : *token->GetText()) if (ch != L'_') text.push_back(ch);
+
+                /* Folded literals may be negative. */
+                bool negative = !text.empty() && text[0] == L'-';
+
+                if (token->IsImaginaryNumber())
+                {
+                    constant.mKind = ConstantKind::Imaginary;
+                    FloatConversion::Parse(std::wstring_view(text).substr(0, text.size() - 1), constant.mReal);
+                    return constant;
+                }
+
+                if (token->IsRealNumber())
+                {
+                    constant.mKind = ConstantKind::Float;
+                    FloatConversion::Parse(text, constant.mReal);
+                    return constant;
+                }
+
+                unsigned int base = 10;
+                std::size_t index = negative ? 1 : 0;
+
+                if (text.size() > index + 1 && text[index] == L'0')
+                {
+                    switch (text[index + 1])
+                    {
+                        case L'x': case L'X': base = 16; index += 2; break;
+                        case L'o': case L'O': base = 8; index += 2; break;
+                        case L'b': case L'B': base = 2; index += 2; break;
+                        default: break;
+                    }
+                }
+
+                std::uint64_t value = 0, limit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) + (negative ? 1 : 0);
+                constant.mKind = ConstantKind::Integer;
+
+                for (; index < text.size(); index++)
+                {
+                    auto ch = text[index];
+                    unsigned int digit = ch <= L'9' ? ch - L'0' : (ch | 0x20) - L'a' + 10;
+
+                    if (value > (limit - digit) / base)
+                    {
+                        constant.mKind = ConstantKind::BigInteger;
+                        constant.mText = text;
+                        return constant;
+                    }
+
+                    value = value * base + digit;
+                }
+
+                constant.mInteger = static_cast<std::int64_t>(negative ? 0 - value : value);
+                return constant;
+            }
+
+            static unsigned int HexValue(wchar_t ch)
+            {
+                if (ch >= L'0' && ch <= L'9') return ch - L'0';
+                if ((ch | 0x20) >= L'a' && (ch | 0x20) <= L'f') return (ch | 0x20) - L'a' + 10;
+                return 16;
+            }
+
+            /* Text of a string token without its quotes, escapes decoded. */
+            static std::wstring DecodeString(std::shared_ptr<StringToken> token)
+            {
+                auto &text = *token->GetText();
+                auto span = token->GetTokenEndPosition() - token->GetTokenStartPosition();
+
+                /* The text is the content and its closing quotes, an empty string has no text. */
+                auto end = 2 * text.size() > span ? 2 * text.size() - span : 0;
+
+                if (token->IsRaw()) return text.substr(0, end);
+
+                std::wstring result;
+                result.reserve(end);
+
+                for (std::size_t i = 0; i < end; i++)
+                {
+                    if (text[i] != L'\\' || i + 1 >= end)
+                    {
+                        result.push_back(text[i]);
+                        continue;
+                    }
+
+                    auto ch = text[++i];
+
+                    switch (ch)
+                    {
+                        case L'\n': break;
+                        case L'\r': if (i + 1 < end && text[i + 1] == L'\n') i++; break;
+                        case L'\\': result.push_back(L'\\'); break;
+                        case L'\'': result.push_back(L'\''); break;
+                        case L'"':  result.push_back(L'"'); break;
+                        case L'a':  result.push_back(L'\a'); break;
+                        case L'b':  result.push_back(L'\b'); break;
+                        case L'f':  result.push_back(L'\f'); break;
+                        case L'n':  result.push_back(L'\n'); break;
+                        case L'r':  result.push_back(L'\r'); break;
+                        case L't':  result.push_back(L'\t'); break;
+                        case L'v':  result.push_back(L'\v'); break;
+                        case L'x':
+                        case L'u':
+                        case L'U':
+                            {
+                                std::size_t digits = ch == L'x' ? 2 : ch == L'u' ? 4 : 8, count = 0;
+                                std::uint32_t value = 0;
+
+                                while (count < digits && i + 1 < end && HexValue(text[i + 1]) < 16)
+                                {
+                                    value = value * 16 + HexValue(text[++i]);
+                                    count++;
+                                }
+
+                                if (count == 0)
+                                {
+                                    result.push_back(L'\\');
+                                    result.push_back(ch);
+                                }
+                                else result.push_back(static_cast<wchar_t>(value));
+                            }
+                            break;
+                        default:
+                            if (ch >= L'0' && ch <= L'7')
+                            {
+                                std::uint32_t value = ch - L'0';
+                                for (int count = 1; count < 3 && i + 1 < end && text[i + 1] >= L'0' && text[i + 1] <= L'7'; count++)
+                                    value = value * 8 + (text[++i] - L'0');
+                                result.push_back(static_cast<wchar_t>(value));
+                            }
+                            else
+                            {
+                                result.push_back(L'\\');
+                                result.push_back(ch);
+                            }
+                            break;
+                    }
+                }
+
+                return result;
+            }
+
+            Constant StringConstant(std::shared_ptr<AtomStringNode> node)
+            {
+                Constant constant;
+                constant.mKind = ConstantKind::String;
+
+                for (auto &token : *node->GetStringNodes())
+                {
+                    if (token->IsFormated()) throw Error(node, L"Formatted strings are not supported by the compiler!");
+                    if (token->IsBytes()) throw Error(node, L"Bytes literals are not supported by the compiler!");
+                    constant.mText += DecodeString(token);
+                }
+
+                return constant;
+            }
+
+            /* Tree shapes */
+
+            template <typename T>
+            static std::shared_ptr<std::vector<std::shared_ptr<ExpressionNode>>> ListOf(std::shared_ptr<Node> node, std::size_t &separators)
+            {
+                auto list = std::static_pointer_cast<T>(node);
+                separators = list->GetSeparators()->size();
+                return list->GetNodes();
+            }
+
+            /* Elements of a comma separated list, null for other nodes. Lists of one
+               element without a comma are not sequences. */
+            static std::shared_ptr<std::vector<std::shared_ptr<ExpressionNode>>> Elements(std::shared_ptr<Node> node, bool &isSequence)
+            {
+                std::size_t separators = 0;
+                std::shared_ptr<std::vector<std::shared_ptr<ExpressionNode>>> nodes;
+
+                switch (node->GetKind())
+                {
+                    case NodeKind::TestListStarExprListStatement:   nodes = ListOf<TestListStarExprListStatementNode>(node, separators); break;
+                    case NodeKind::TestList:                        nodes = ListOf<TestListNode>(node, separators); break;
+                    case NodeKind::ExprList:                        nodes = ListOf<ExprListNode>(node, separators); break;
+                    case NodeKind::TestListComp:                    nodes = ListOf<TestListCompNode>(node, separators); break;
+                    default:                                        return nullptr;
+                }
+
+                isSequence = separators > 0 || nodes->size() != 1;
+                return nodes;
+            }
+
+            static std::shared_ptr<Node> Unwrap(std::shared_ptr<Node> node)
+            {
+                bool isSequence = false;
+                auto nodes = Elements(node, isSequence);
+                return nodes != nullptr && !isSequence ? nodes->front() : node;
+            }
+
+            static bool IsComprehension(std::shared_ptr<std::vector<std::shared_ptr<ExpressionNode>>> nodes)
+            {
+                return  nodes->size() == 2 &&
+                        (nodes->back()->GetKind() == NodeKind::CompFor || nodes->back()->GetKind() == NodeKind::SyncCompFor);
+            }
+
+            template <typename T>
+            static std::pair<std::shared_ptr<ExpressionNode>, std::shared_ptr<ExpressionNode>> Operands(std::shared_ptr<Node> node)
+            {
+                auto n = std::static_pointer_cast<T>(node);
+                return { n->GetLeft(), n->GetRight() };
+            }
+
+            /* AndTestNode names its operands differently. */
+            static std::pair<std::shared_ptr<ExpressionNode>, std::shared_ptr<ExpressionNode>> AndOperands(std::shared_ptr<Node> node)
+            {
+                auto n = std::static_pointer_cast<AndTestNode>(node);
+                return { n->GetLeftNode(), n->GetRightNode() };
+            }
+
+            template <typename T>
+            static std::pair<std::shared_ptr<Node>, std::shared_ptr<Node>> Targets(std::shared_ptr<Node> node)
+            {
+                auto n = std::static_pointer_cast<T>(node);
+                return { n->GetLeft(), n->GetRight() };
+            }
+
+            static bool BinaryOperator(std::shared_ptr<Node> node, OpCode &op, std::pair<std::shared_ptr<ExpressionNode>, std::shared_ptr<ExpressionNode>> &operands)
+            {
+                switch (node->GetKind())
+                {
+                    case NodeKind::Plus:        op = OpCode::Add; operands = Operands<PlusNode>(node); return true;
+                    case NodeKind::Minus:       op = OpCode::Subtract; operands = Operands<MinusNode>(node); return true;
+                    case NodeKind::Mul:         op = OpCode::Multiply; operands = Operands<MulNode>(node); return true;
+                    case NodeKind::Matrice:     op = OpCode::MatrixMultiply; operands = Operands<MatriceNode>(node); return true;
+                    case NodeKind::Div:         op = OpCode::TrueDivide; operands = Operands<DivNode>(node); return true;
+                    case NodeKind::FloorDiv:    op = OpCode::FloorDivide; operands = Operands<FloorDivNode>(node); return true;
+                    case NodeKind::Modulo:      op = OpCode::Modulo; operands = Operands<ModuloNode>(node); return true;
+                    case NodeKind::Power:       op = OpCode::Power; operands = Operands<PowerNode>(node); return true;
+                    case NodeKind::ShiftLeft:   op = OpCode::ShiftLeft; operands = Operands<ShiftLeftNode>(node); return true;
+                    case NodeKind::ShiftRight:  op = OpCode::ShiftRight; operands = Operands<ShiftRightNode>(node); return true;
+                    case NodeKind::BitAnd:      op = OpCode::BitAnd; operands = Operands<BitAndNode>(node); return true;
+                    case NodeKind::BitOr:       op = OpCode::BitOr; operands = Operands<BitOrNode>(node); return true;
+                    case NodeKind::BitXor:      op = OpCode::BitXor; operands = Operands<BitXorNode>(node); return true;
+                    default:                    return false;
+                }
+            }
+
+            static bool CompareOperator(std::shared_ptr<Node> node, OpCode &op, std::pair<std::shared_ptr<ExpressionNode>, std::shared_ptr<ExpressionNode>> &operands)
+            {
+                switch (node->GetKind())
+                {
+                    case NodeKind::CompareLess:         op = OpCode::Less; operands = Operands<CompareLessNode>(node); return true;
+                    case NodeKind::CompareLessEqual:    op = OpCode::LessEqual; operands = Operands<CompareLessEqualNode>(node); return true;
+                    case NodeKind::CompareEqual:        op = OpCode::Equal; operands = Operands<CompareEqualNode>(node); return true;
+                    case NodeKind::CompareNotEqual:     op = OpCode::NotEqual; operands = Operands<CompareNotEqualNode>(node); return true;
+                    case NodeKind::CompareGreater:      op = OpCode::Greater; operands = Operands<CompareGreaterNode>(node); return true;
+                    case NodeKind::CompareGreaterEqual: op = OpCode::GreaterEqual; operands = Operands<CompareGreaterEqualNode>(node); return true;
+                    case NodeKind::CompareIn:           op = OpCode::In; operands = Operands<CompareInNode>(node); return true;
+                    case NodeKind::CompareNotIn:        op = OpCode::NotIn; operands = Operands<CompareNotInNode>(node); return true;
+                    case NodeKind::CompareIs:           op = OpCode::Is; operands = Operands<CompareIsNode>(node); return true;
+                    case NodeKind::CompareIsNot:        op = OpCode::IsNot; operands = Operands<CompareIsNotNode>(node); return true;
+                    default:                            return false;
+                }
+            }
+
+            static bool AugmentedOperator(std::shared_ptr<Node> node, OpCode &op, std::pair<std::shared_ptr<Node>, std::shared_ptr<Node>> &operands)
+            {
+                switch (node->GetKind())
+                {
+                    case NodeKind::PlusAssignStatement:         op = OpCode::InPlaceAdd; operands = Targets<PlusAssignStatementNode>(node); return true;
+                    case NodeKind::MinusAssignStatement:        op = OpCode::InPlaceSubtract; operands = Targets<MinusAssignStatementNode>(node); return true;
+                    case NodeKind::MulAssignStatement:          op = OpCode::InPlaceMultiply; operands = Targets<MulAssignStatementNode>(node); return true;
+                    case NodeKind::MatriceAssignStatement:      op = OpCode::InPlaceMatrixMultiply; operands = Targets<MatriceAssignStatementNode>(node); return true;
+                    case NodeKind::DivAssignStatement:          op = OpCode::InPlaceTrueDivide; operands = Targets<DivAssignStatementNode>(node); return true;
+                    case NodeKind::FloorDivAssignStatement:     op = OpCode::InPlaceFloorDivide; operands = Targets<FloorDivAssignStatementNode>(node); return true;
+                    case NodeKind::ModuloAssignStatement:       op = OpCode::InPlaceModulo; operands = Targets<ModuloAssignStatementNode>(node); return true;
+                    case NodeKind::PowerAssignStatement:        op = OpCode::InPlacePower; operands = Targets<PowerAssignStatementNode>(node); return true;
+                    case NodeKind::ShiftLeftAssignStatement:    op = OpCode::InPlaceShiftLeft; operands = Targets<ShiftLeftAssignStatementNode>(node); return true;
+                    case NodeKind::ShiftRightAssignStatement:   op = OpCode::InPlaceShiftRight; operands = Targets<ShiftRightAssignStatementNode>(node); return true;
+                    case NodeKind::BitAndAssignStatement:       op = OpCode::InPlaceBitAnd; operands = Targets<BitAndAssignStatementNode>(node); return true;
+                    case NodeKind::BitOrAssignStatement:        op = OpCode::InPlaceBitOr; operands = Targets<BitOrAssignStatementNode>(node); return true;
+                    case NodeKind::BitXorAssignStatement:       op = OpCode::InPlaceBitXor; operands = Targets<BitXorAssignStatementNode>(node); return true;
+                    default:                                    return false;
+                }
+            }
+
+            /* Names */
+
+            Symbol * Resolve(std::shared_ptr<NameToken> name)
+            {
+                return mTable->Resolve(name.get());
+            }
+
+            unsigned int Slot(Symbol *symbol)
+            {
+                return mUnit->mBase + symbol->mSlot;
+            }
+
+            bool IsClassBody()
+            {
+                return mUnit->mScope->GetKind() == ScopeKind::Class;
+            }
+
+            /* Register of a fast local, or none. */
+            bool LocalRegister(std::shared_ptr<Node> node, unsigned int &reg)
+            {
+                if (node->GetKind() != NodeKind::AtomName || IsClassBody()) return false;
+
+                auto symbol = Resolve( std::static_pointer_cast<AtomNameNode>(node)->GetNameText() );
+                if (symbol->mKind != SymbolKind::Local || symbol->mSlot == Symbol::NoSlot) return false;
+
+                reg = Slot(symbol);
+                return true;
+            }
+
+            void LoadName(std::shared_ptr<NameToken> name, unsigned int dest)
+            {
+                auto symbol = Resolve(name);
+
+                switch (symbol->mKind)
+                {
+                    case SymbolKind::Global:
+                        if (IsClassBody() && !(symbol->mFlags & Symbol::DeclaredGlobal))
+                            Emit( MakeABx(OpCode::LoadName, dest, Name(symbol->mName)) );
+                        else Emit( MakeABx(OpCode::LoadGlobal, dest, Name(symbol->mName)) );
+                        break;
+                    case SymbolKind::Local:
+                        if (IsClassBody()) Emit( MakeABx(OpCode::LoadName, dest, Name(symbol->mName)) );
+                        else EmitMove(dest, Slot(symbol));
+                        break;
+                    default:
+                        Emit( MakeABC(OpCode::LoadCell, dest, Slot(symbol)) );
+                        break;
+                }
+            }
+
+            void StoreName(std::shared_ptr<NameToken> name, unsigned int source)
+            {
+                auto symbol = Resolve(name);
+
+                switch (symbol->mKind)
+                {
+                    case SymbolKind::Global:
+                        Emit( MakeABx(OpCode::StoreGlobal, source, Name(symbol->mName)) );
+                        break;
+                    case SymbolKind::Local:
+                        if (IsClassBody()) Emit( MakeABx(OpCode::StoreName, source, Name(symbol->mName)) );
+                        else EmitMove(Slot(symbol), source);
+                        break;
+                    default:
+                        Emit( MakeABC(OpCode::StoreCell, Slot(symbol), source) );
+                        break;
+                }
+            }
+
+            void DeleteName(std::shared_ptr<NameToken> name)
+            {
+                auto symbol = Resolve(name);
+
+                switch (symbol->mKind)
+                {
+                    case SymbolKind::Global:
+                        Emit( MakeABx(OpCode::DeleteGlobal, 0, Name(symbol->mName)) );
+                        break;
+                    case SymbolKind::Local:
+                        if (IsClassBody()) Emit( MakeABx(OpCode::DeleteName, 0, Name(symbol->mName)) );
+                        else Emit( MakeABC(OpCode::DeleteFast, Slot(symbol)) );
+                        break;
+                    default:
+                        Emit( MakeABC(OpCode::DeleteCell, Slot(symbol)) );
+                        break;
+                }
+            }
+
+            /* Expressions */
+
+            /* Register holding the value, a local's own register when it is one. */
+            unsigned int Value(std::shared_ptr<Node> node)
+            {
+                node = mFolder->Resolve(node);
+
+                unsigned int reg;
+                if (LocalRegister(Unwrap(node), reg)) return reg;
+
+                reg = Register();
+                ValueTo(node, reg);
+                return reg;
+            }
+
+            /* False for expressions that write their destination before reading all of
+               their operands, those must not target a local they read. */
+            static bool WritesDestinationLast(std::shared_ptr<Node> node)
+            {
+                switch (node->GetKind())
+                {
+                    case NodeKind::AndTest:
+                    case NodeKind::OrTest:
+                    case NodeKind::Test:
+                    case NodeKind::NamedExpr:
+                        return false;
+                    default:
+                        {
+                            OpCode op;
+                            std::pair<std::shared_ptr<ExpressionNode>, std::shared_ptr<ExpressionNode>> operands;
+                            if (CompareOperator(node, op, operands)) return !CompareOperator(operands.first, op, operands);
+                        }
+                        return true;
+                }
+            }
+
+            void ValueTo(std::shared_ptr<Node> node, unsigned int dest)
+            {
+                node = mFolder->Resolve(node);
+
+                OpCode op;
+                std::pair<std::shared_ptr<ExpressionNode>, std::shared_ptr<ExpressionNode>> operands;
+
+                if (BinaryOperator(node, op, operands))
+                {
+                    auto mark = Mark();
+
+                    if (IsTemporary(dest) && dest + 1 == mark)
+                    {
+                        Chain(node, dest);
+                        return;
+                    }
+
+                    auto left = Value(operands.first);
+                    auto right = Value(operands.second);
+                    Emit( MakeABC(op, dest, left, right) );
+                    Release(mark);
+                    return;
+                }
+
+                if (CompareOperator(node, op, operands))
+                {
+                    Compare(node, dest);
+                    return;
+                }
+
+                switch (node->GetKind())
+                {
+                    case NodeKind::AtomName:
+                        LoadName(std::static_pointer_cast<AtomNameNode>(node)->GetNameText(), dest);
+                        break;
+
+                    case NodeKind::AtomNumber:
+                        LoadConstant(NumberConstant(std::static_pointer_cast<AtomNumberNode>(node)->GetNumberText()), dest);
+                        break;
+
+                    case NodeKind::AtomString:
+                        LoadConstant(StringConstant(std::static_pointer_cast<AtomStringNode>(node)), dest);
+                        break;
+
+                    case NodeKind::AtomTrue:    Emit( MakeABC(OpCode::LoadTrue, dest) ); break;
+                    case NodeKind::AtomFalse:   Emit( MakeABC(OpCode::LoadFalse, dest) ); break;
+                    case NodeKind::AtomNone:    Emit( MakeABC(OpCode::LoadNone, dest) ); break;
+
+                    case NodeKind::AtomElipsis:
+                        {
+                            Constant constant;
+                            constant.mKind = ConstantKind::Ellipsis;
+                            LoadConstant(constant, dest);
+                        }
+                        break;
+
+                    case NodeKind::AtomTuple:
+                        {
+                            auto right = std::static_pointer_cast<AtomTupleNode>(node)->GetRight();
+                            if (right == nullptr) Build(OpCode::BuildTuple, nullptr, dest, node);
+                            else Sequence(right, OpCode::BuildTuple, dest);
+                        }
+                        break;
+
+                    case NodeKind::AtomList:
+                        {
+                            auto right = std::static_pointer_cast<AtomListNode>(node)->GetRight();
+                            Sequence(right, OpCode::BuildList, dest, node);
+                        }
+                        break;
+
+                    case NodeKind::AtomDictionary:
+                        Dictionary(std::static_pointer_cast<AtomDictionaryNode>(node)->GetRight(), dest, node);
+                        break;
+
+                    case NodeKind::AtomSet:
+                        Dictionary(std::static_pointer_cast<AtomSetNode>(node)->GetRight(), dest, node);
+                        break;
+
+                    case NodeKind::TestListStarExprListStatement:
+                    case NodeKind::TestList:
+                    case NodeKind::ExprList:
+                    case NodeKind::TestListComp:
+                        Sequence(node, OpCode::BuildTuple, dest);
+                        break;
+
+                    case NodeKind::UnaryMinus:
+                        Unary(OpCode::Negative, std::static_pointer_cast<UnaryMinusNode>(node)->GetRight(), dest);
+                        break;
+
+                    case NodeKind::UnaryPlus:
+                        Unary(OpCode::Positive, std::static_pointer_cast<UnaryPlusNode>(node)->GetRight(), dest);
+                        break;
+
+                    case NodeKind::UnaryBitInvert:
+                        Unary(OpCode::Invert, std::static_pointer_cast<UnaryBitInvertNode>(node)->GetRight(), dest);
+                        break;
+
+                    case NodeKind::NotTest:
+                        Unary(OpCode::Not, std::static_pointer_cast<NotTestNode>(node)->GetRight(), dest);
+                        break;
+
+                    case NodeKind::AndTest:
+                    case NodeKind::OrTest:
+                        {
+                            auto isAnd = node->GetKind() == NodeKind::AndTest;
+                            operands = isAnd ? AndOperands(node) : Operands<OrTestNode>(node);
+
+                            ValueTo(operands.first, dest);
+                            auto jump = EmitJump(isAnd ? OpCode::JumpIfFalse : OpCode::JumpIfTrue, dest);
+                            ValueTo(operands.second, dest);
+                            PatchJump(jump, Here());
+                        }
+                        break;
+
+                    case NodeKind::Test:
+                        {
+                            auto n = std::static_pointer_cast<TestNode>(node);
+                            auto otherwise = Condition(n->GetRight(), false);
+
+                            ValueTo(n->GetLeft(), dest);
+                            auto end = EmitJump(OpCode::Jump);
+                            Patch(otherwise, Here());
+                            ValueTo(n->GetNext(), dest);
+                            PatchJump(end, Here());
+                        }
+                        break;
+
+                    case NodeKind::NamedExpr:
+                        {
+                            auto n = std::static_pointer_cast<NamedExprNode>(node);
+                            ValueTo(n->GetRight(), dest);
+                            Store(n->GetLeft(), dest);
+                        }
+                        break;
+
+                    case NodeKind::AtomExpr:
+                        Trailers(std::static_pointer_cast<AtomExprNode>(node), dest);
+                        break;
+
+                    case NodeKind::Lambda:
+                        Lambda(std::static_pointer_cast<LambdaNode>(node), dest);
+                        break;
+
+                    default:
+                        throw Error(node, L"Expression is not supported by the compiler!");
+                }
+            }
+
+            /* Left operands of a chain such as 'a + b + c' accumulate in the destination when
+               it is the top temporary, so the chain needs the same registers however long it
+               is and is compiled without recursing along it. */
+            void Chain(std::shared_ptr<Node> node, unsigned int dest)
+            {
+                std::vector<std::pair<OpCode, std::shared_ptr<ExpressionNode>>> rights;
+                OpCode op;
+                std::pair<std::shared_ptr<ExpressionNode>, std::shared_ptr<ExpressionNode>> operands;
+
+                while (BinaryOperator(node, op, operands))
+                {
+                    rights.emplace_back(op, operands.second);
+                    node = mFolder->Resolve(operands.first);
+                }
+
+                unsigned int left;
+
+                if (!LocalRegister(Unwrap(node), left))
+                {
+                    ValueTo(node, dest);
+                    left = dest;
+                }
+
+                for (auto right = rights.rbegin(); right != rights.rend(); ++right)
+                {
+                    auto mark = Mark();
+                    Emit( MakeABC(right->first, dest, left, Value(right->second)) );
+                    Release(mark);
+                    left = dest;
+                }
+            }
+
+            void Unary(OpCode op, std::shared_ptr<Node> operand, unsigned int dest)
+            {
+                auto mark = Mark();
+                Emit( MakeABC(op, dest, Value(operand)) );
+                Release(mark);
+            }
+
+            /* 'a < b < c' parses as '(a < b) < c', the operands of a chain are evaluated
+               once and the chain stops at the first false comparison. */
+            void Compare(std::shared_ptr<Node> node, unsigned int dest)
+            {
+                std::vector<std::shared_ptr<ExpressionNode>> values;
+                std::vector<OpCode> ops;
+                std::pair<std::shared_ptr<ExpressionNode>, std::shared_ptr<ExpressionNode>> operands;
+                OpCode op;
+
+                while (CompareOperator(node, op, operands))
+                {
+                    ops.push_back(op);
+                    values.push_back(operands.second);
+                    node = operands.first;
+                }
+
+                values.push_back(std::static_pointer_cast<ExpressionNode>(node));
+                std::reverse(values.begin(), values.end());
+                std::reverse(ops.begin(), ops.end());
+
+                auto mark = Mark();
+                std::vector<unsigned int> exits;
+                auto left = Value(values[0]);
+
+                for (std::size_t i = 0; i < ops.size(); i++)
+                {
+                    auto right = Value(values[i + 1]);
+                    Emit( MakeABC(ops[i], dest, left, right) );
+                    if (i + 1 < ops.size()) exits.push_back( EmitJump(OpCode::JumpIfFalse, dest) );
+                    left = right;
+                }
+
+                Patch(exits, Here());
+                Release(mark);
+            }
+
+            /* Jumps taken when the condition has the given truth, to be patched. */
+            std::vector<unsigned int> Condition(std::shared_ptr<Node> node, bool jumpIfTrue)
+            {
+                node = mFolder->Resolve(node);
+
+                /* A constant condition always or never jumps, without testing. */
+                bool truth;
+                if (mFolder->GetTruth(node.get(), truth))
+                {
+                    if (truth == jumpIfTrue) return { EmitJump(OpCode::Jump) };
+                    return {};
+                }
+
+                switch (node->GetKind())
+                {
+                    case NodeKind::NotTest:
+                        return Condition(std::static_pointer_cast<NotTestNode>(node)->GetRight(), !jumpIfTrue);
+
+                    case NodeKind::AndTest:
+                    case NodeKind::OrTest:
+                        {
+                            auto isAnd = node->GetKind() == NodeKind::AndTest;
+                            auto operands = isAnd ? AndOperands(node) : Operands<OrTestNode>(node);
+
+                            /* 'a and b' is false when either is, 'a or b' true when either is. */
+                            if (isAnd != jumpIfTrue)
+                            {
+                                auto jumps = Condition(operands.first, jumpIfTrue);
+                                auto more = Condition(operands.second, jumpIfTrue);
+                                jumps.insert(jumps.end(), more.begin(), more.end());
+                                return jumps;
+                            }
+
+                            auto skip = Condition(operands.first, !jumpIfTrue);
+                            auto jumps = Condition(operands.second, jumpIfTrue);
+                            Patch(skip, Here());
+                            return jumps;
+                        }
+
+                    default:
+                        {
+                            auto mark = Mark();
+                            auto jump = EmitJump(jumpIfTrue ? OpCode::JumpIfTrue : OpCode::JumpIfFalse, Value(node));
+                            Release(mark);
+                            return { jump };
+                        }
+                }
+            }
+
+            /* Elements from begin to end evaluated into consecutive registers from the returned one. */
+            unsigned int Consecutive(const std::vector<std::shared_ptr<ExpressionNode>> &nodes, std::size_t begin = 0, std::size_t end = SIZE_MAX)
+            {
+                auto first = Mark();
+
+                for (auto index = begin; index < std::min(end, nodes.size()); index++)
+                {
+                    auto &element = nodes[index];
+
+                    if (element->GetKind() == NodeKind::StarExpr)
+                        throw Error(element, L"Star expressions are not supported by the compiler!");
+
+                    ValueTo(element, Register());
+                }
+
+                return first;
+            }
+
+            /* Displays longer than DisplayChunk start from their first chunk and are extended
+               a chunk at a time, tuples are built as lists and converted at the end. The
+               display is assembled in a temporary so that a local it replaces stays readable
+               by the elements. */
+            void Build(OpCode op, const std::vector<std::shared_ptr<ExpressionNode>> *nodes, unsigned int dest, std::shared_ptr<Node> node)
+            {
+                auto count = nodes == nullptr ? 0 : nodes->size();
+                auto mark = Mark();
+
+                if (count <= DisplayChunk)
+                {
+                    auto first = nodes == nullptr ? 0 : Consecutive(*nodes);
+                    Emit( MakeABC(op, dest, count == 0 ? 0 : first, static_cast<unsigned int>(count)) );
+                    Release(mark);
+                    return;
+                }
+
+                auto target = IsTemporary(dest) ? dest : Register();
+                auto chunkMark = Mark();
+                auto build = op == OpCode::BuildTuple ? OpCode::BuildList : op;
+                auto extend = op == OpCode::BuildSet ? OpCode::SetUpdate : OpCode::ListExtend;
+
+                for (std::size_t begin = 0; begin < count; begin += DisplayChunk)
+                {
+                    auto size = static_cast<unsigned int>( std::min<std::size_t>(DisplayChunk, count - begin) );
+                    auto first = Consecutive(*nodes, begin, begin + size);
+
+                    Emit( MakeABC(begin == 0 ? build : extend, target, first, size) );
+                    Release(chunkMark);
+                }
+
+                if (op == OpCode::BuildTuple) Emit( MakeABC(OpCode::ListToTuple, dest, target) );
+                else if (target != dest) Emit( MakeABC(OpCode::Move, dest, target) );
+
+                Release(mark);
+            }
+
+            /* Tuple or list display, comprehension or a parenthesized expression. */
+            void Sequence(std::shared_ptr<Node> node, OpCode op, unsigned int dest, std::shared_ptr<Node> atom = nullptr)
+            {
+                if (node == nullptr)
+                {
+                    Build(op, nullptr, dest, atom);
+                    return;
+                }
+
+                bool isSequence = false;
+                auto nodes = Elements(node, isSequence);
+
+                if (nodes != nullptr && IsComprehension(nodes))
+                {
+                    if (op != OpCode::BuildList) throw Error(node, L"Generator expressions are not supported by the compiler!");
+                    Comprehension(OpCode::BuildList, nodes->front(), nodes->back(), dest);
+                    return;
+                }
+
+                if (nodes == nullptr || (!isSequence && op == OpCode::BuildTuple && atom == nullptr))
+                {
+                    if (op == OpCode::BuildTuple)
+                    {
+                        ValueTo(nodes == nullptr ? node : nodes->front(), dest);
+                        return;
+                    }
+
+                    std::vector<std::shared_ptr<ExpressionNode>> single { std::static_pointer_cast<ExpressionNode>(node) };
+                    Build(op, &single, dest, node);
+                    return;
+                }
+
+                if (!isSequence && op == OpCode::BuildTuple)
+                {
+                    ValueTo(nodes->front(), dest);
+                    return;
+                }
+
+                Build(op, nodes.get(), dest, node);
+            }
+
+            void Dictionary(std::shared_ptr<ExpressionNode> node, unsigned int dest, std::shared_ptr<Node> atom)
+            {
+                if (node == nullptr)
+                {
+                    Emit( MakeABC(OpCode::BuildDict, dest, 0, 0) );
+                    return;
+                }
+
+                if (node->GetKind() == NodeKind::SetContainer)
+                {
+                    auto entries = std::static_pointer_cast<SetContainerNode>(node)->GetEntries();
+
+                    if (IsComprehension(entries)) Comprehension(OpCode::BuildSet, entries->front(), entries->back(), dest);
+                    else Build(OpCode::BuildSet, entries.get(), dest, node);
+                    return;
+                }
+
+                if (node->GetKind() != NodeKind::DictionaryContainer)
+                {
+                    std::vector<std::shared_ptr<ExpressionNode>> single { node };
+                    Build(OpCode::BuildSet, &single, dest, atom);
+                    return;
+                }
+
+                auto entries = std::static_pointer_cast<DictionaryContainerNode>(node)->GetEntries();
+
+                if (IsComprehension(entries))
+                {
+                    Comprehension(OpCode::BuildDict, entries->front(), entries->back(), dest);
+                    return;
+                }
+
+                /* Chunked as the displays in Build. */
+                auto count = entries->size();
+                auto mark = Mark();
+                auto target = count <= DisplayChunk / 2 || IsTemporary(dest) ? dest : Register();
+                auto chunkMark = Mark();
+
+                for (std::size_t begin = 0; begin == 0 || begin < count; begin += DisplayChunk / 2)
+                {
+                    auto size = static_cast<unsigned int>( std::min<std::size_t>(DisplayChunk / 2, count - begin) );
+                    auto first = Mark();
+
+                    for (auto index = begin; index < begin + size; index++)
+                    {
+                        auto &entry = (*entries)[index];
+
+                        if (entry->GetKind() != NodeKind::DictionaryEntry)
+                            throw Error(entry, L"Dictionary unpacking is not supported by the compiler!");
+
+                        auto n = std::static_pointer_cast<DictionaryEntryNode>(entry);
+                        ValueTo(n->GetKey(), Register());
+                        ValueTo(n->GetValue(), Register());
+                    }
+
+                    Emit( MakeABC(begin == 0 ? OpCode::BuildDict : OpCode::DictUpdate, target, size == 0 ? 0 : first, size) );
+                    Release(chunkMark);
+                }
+
+                if (target != dest) Emit( MakeABC(OpCode::Move, dest, target) );
+                Release(mark);
+            }
+
+            /* Index of a subscription: an expression, a slice or a tuple of them. */
+            unsigned int Subscript(std::shared_ptr<ExpressionNode> node)
+            {
+                if (node->GetKind() == NodeKind::SubscriptList)
+                {
+                    auto nodes = std::static_pointer_cast<SubscriptListNode>(node)->GetNodes();
+                    auto reg = Register();
+                    auto mark = Mark();
+                    auto first = Mark();
+
+                    if (nodes->size() > MaxRegister) throw Error(node, L"Too many subscripts!");
+
+                    for (auto &element : *nodes)
+                    {
+                        auto target = Register();
+                        EmitMove(target, Subscript(element));
+                        Release(target + 1);
+                    }
+
+                    Emit( MakeABC(OpCode::BuildTuple, reg, first, static_cast<unsigned int>(nodes->size())) );
+                    Release(mark);
+                    return reg;
+                }
+
+                if (node->GetKind() != NodeKind::Subscript) return Value(node);
+
+                auto n = std::static_pointer_cast<SubscriptNode>(node);
+                if (n->GetOperator1() == nullptr) return Value(n->GetLeft());
+
+                auto reg = Register();
+                auto mark = Mark();
+                std::shared_ptr<ExpressionNode> parts[3] = { n->GetLeft(), n->GetRight(), n->GetNext() };
+                unsigned int count = n->GetOperator2() != nullptr && parts[2] != nullptr ? 3 : 2;
+                auto first = Mark();
+
+                for (unsigned int i = 0; i < count; i++)
+                {
+                    auto target = Register();
+                    if (parts[i] == nullptr) Emit( MakeABC(OpCode::LoadNone, target) );
+                    else ValueTo(parts[i], target);
+                }
+
+                Emit( MakeABC(OpCode::BuildSlice, reg, first, count) );
+                Release(mark);
+                return reg;
+            }
+
+            /* Arguments of a call go to the registers after the function, keyword
+               arguments last. */
+            void Call(std::shared_ptr<CallNode> call, unsigned int base)
+            {
+                std::vector<std::shared_ptr<ExpressionNode>> arguments;
+                auto right = call->GetRight();
+
+                if (right != nullptr)
+                {
+                    if (right->GetKind() == NodeKind::ArgsList)
+                        arguments = *std::static_pointer_cast<ArgsListNode>(right)->GetNodes();
+                    else arguments.push_back(right);
+                }
+
+                std::vector<std::shared_ptr<ExpressionNode>> positional;
+                std::vector<std::pair<std::shared_ptr<NameToken>, std::shared_ptr<ExpressionNode>>> keywords;
+
+                for (auto &argument : arguments)
+                {
+                    if (argument->GetKind() != NodeKind::Argument)
+                    {
+                        positional.push_back(argument);
+                        continue;
+                    }
+
+                    auto n = std::static_pointer_cast<ArgumentNode>(argument);
+                    auto op = n->GetOperator();
+
+                    if (op != nullptr && op->GetSymbolKind() == TokenKind::PyAssign && n->GetLeft()->GetKind() == NodeKind::AtomName)
+                        keywords.push_back( { std::static_pointer_cast<AtomNameNode>(n->GetLeft())->GetNameText(), n->GetRight() } );
+                    else if (op != nullptr && op->GetSymbolKind() == TokenKind::PyColonAssign)
+                        positional.push_back(argument);
+                    else if (op == nullptr && n->GetRight() != nullptr)
+                        throw Error(argument, L"Generator expressions are not supported by the compiler!");
+                    else throw Error(argument, L"Star arguments are not supported by the compiler!");
+                }
+
+                if (positional.size() > MaxRegister || keywords.size() > MaxRegister)
+                    throw Error(call, L"Too many arguments in call!");
+
+                for (auto &argument : positional)
+                {
+                    auto reg = Register();
+
+                    if (argument->GetKind() == NodeKind::Argument)
+                    {
+                        auto n = std::static_pointer_cast<ArgumentNode>(argument);
+                        ValueTo(n->GetRight(), reg);
+                        Store(n->GetLeft(), reg);
+                    }
+                    else ValueTo(argument, reg);
+                }
+
+                if (keywords.empty())
+                {
+                    Emit( MakeABC(OpCode::Call, base, static_cast<unsigned int>(positional.size())) );
+                    return;
+                }
+
+                Constant names;
+                names.mKind = ConstantKind::Tuple;
+
+                for (auto &keyword : keywords)
+                {
+                    Constant name;
+                    name.mKind = ConstantKind::String;
+                    name.mText = *keyword.first->GetText();
+                    names.mItems.push_back(name);
+
+                    ValueTo(keyword.second, Register());
+                }
+
+                Emit(   MakeABC(OpCode::CallKw, base, static_cast<unsigned int>(positional.size()), static_cast<unsigned int>(keywords.size())),
+                        AddConstant(names) );
+            }
+
+            /* Value of an atom with its trailers except the last 'skip' ones, in a register
+               that stays valid until the mark taken before. */
+            unsigned int Primary(std::shared_ptr<AtomExprNode> node, std::size_t skip, unsigned int dest, bool toDest)
+            {
+                if (node->GetOperator() != nullptr) throw Error(node, L"Await is not supported by the compiler!");
+
+                auto mark = Mark();
+                auto &trailers = *node->GetRight();
+                auto count = trailers.size() - skip;
+                unsigned int current;
+
+                if (count > 0 && trailers[0]->GetKind() == NodeKind::Call && !(count == 1 && toDest && IsTemporary(dest) && dest + 1 == Mark()))
+                {
+                    current = Register();
+                    ValueTo(node->GetLeft(), current);
+                }
+                else if (count > 0 && trailers[0]->GetKind() == NodeKind::Call)
+                {
+                    current = dest;
+                    ValueTo(node->GetLeft(), current);
+                }
+                else current = Value(node->GetLeft());
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    auto trailer = trailers[i];
+                    auto last = i + 1 == count && toDest;
+                    auto target = last ? dest : current >= mark && IsTemporary(current) ? current : Register();
+
+                    switch (trailer->GetKind())
+                    {
+                        case NodeKind::DotName:
+                            Emit(   MakeABC(OpCode::GetAttr, target, current),
+                                    Name( *std::static_pointer_cast<DotNameNode>(trailer)->GetOperator2()->GetText() ) );
+                            current = target;
+                            break;
+
+                        case NodeKind::Index:
+                            {
+                                auto keyMark = Mark();
+                                auto key = Subscript( std::static_pointer_cast<IndexNode>(trailer)->GetRight() );
+                                Emit( MakeABC(OpCode::GetItem, target, current, key) );
+                                Release(keyMark);
+                                current = target;
+                            }
+                            break;
+
+                        default:
+                            {
+                                /* The function must sit right below the arguments. */
+                                unsigned int base = current;
+
+                                if (!(IsTemporary(current) && current + 1 == Mark()))
+                                {
+                                    base = Register();
+                                    EmitMove(base, current);
+                                }
+
+                                auto callMark = Mark();
+                                Call(std::static_pointer_cast<CallNode>(trailer), base);
+                                Release(callMark);
+
+                                if (last) EmitMove(dest, base);
+                                current = last ? dest : base;
+                            }
+                            break;
+                    }
+                }
+
+                return current;
+            }
+
+            void Trailers(std::shared_ptr<AtomExprNode> node, unsigned int dest)
+            {
+                auto mark = Mark();
+                EmitMove(dest, Primary(node, 0, dest, true));
+                Release(mark);
+            }
+
+            /* Targets */
+
+            void Store(std::shared_ptr<Node> node, unsigned int source)
+            {
+                node = Unwrap(node);
+
+                switch (node->GetKind())
+                {
+                    case NodeKind::AtomName:
+                        StoreName(std::static_pointer_cast<AtomNameNode>(node)->GetNameText(), source);
+                        return;
+
+                    case NodeKind::AtomExpr:
+                        {
+                            auto n = std::static_pointer_cast<AtomExprNode>(node);
+                            auto trailer = n->GetRight()->back();
+                            auto mark = Mark();
+                            auto object = Primary(n, 1, 0, false);
+
+                            if (trailer->GetKind() == NodeKind::DotName)
+                                Emit(   MakeABC(OpCode::SetAttr, object, source),
+                                        Name( *std::static_pointer_cast<DotNameNode>(trailer)->GetOperator2()->GetText() ) );
+                            else if (trailer->GetKind() == NodeKind::Index)
+                                Emit( MakeABC(OpCode::SetItem, object, Subscript( std::static_pointer_cast<IndexNode>(trailer)->GetRight() ), source) );
+                            else throw Error(node, L"Can not assign to function call!");
+
+                            Release(mark);
+                        }
+                        return;
+
+                    case NodeKind::AtomTuple:
+                    case NodeKind::AtomList:
+                        {
+                            auto right = node->GetKind() == NodeKind::AtomTuple ?
+                                            std::static_pointer_cast<AtomTupleNode>(node)->GetRight() :
+                                            std::static_pointer_cast<AtomListNode>(node)->GetRight();
+
+                            if (right == nullptr) throw Error(node, L"Can not assign to empty display!");
+
+                            bool isSequence = false;
+                            auto nodes = Elements(right, isSequence);
+
+                            if (nodes == nullptr)
+                            {
+                                if (node->GetKind() == NodeKind::AtomTuple) Store(right, source);
+                                else Unpack(std::vector<std::shared_ptr<ExpressionNode>> { right }, source, node);
+                            }
+                            else Unpack(*nodes, source, node);
+                        }
+                        return;
+
+                    default:
+                        {
+                            bool isSequence = false;
+                            auto nodes = Elements(node, isSequence);
+                            if (nodes != nullptr) Unpack(*nodes, source, node);
+                            else throw Error(node, L"Can not assign to expression!");
+                        }
+                        return;
+                }
+            }
+
+            void Unpack(const std::vector<std::shared_ptr<ExpressionNode>> &targets, unsigned int source, std::shared_ptr<Node> node)
+            {
+                if (targets.size() > MaxRegister) throw Error(node, L"Too many targets in assignment!");
+
+                auto mark = Mark();
+                auto first = Mark();
+
+                for (auto &target : targets)
+                {
+                    if (target->GetKind() == NodeKind::StarExpr)
+                        throw Error(target, L"Starred assignment is not supported by the compiler!");
+                    Register();
+                }
+
+                Emit( MakeABC(OpCode::Unpack, first, source, static_cast<unsigned int>(targets.size())) );
+
+                for (std::size_t i = 0; i < targets.size(); i++)
+                    Store(targets[i], first + static_cast<unsigned int>(i));
+
+                Release(mark);
+            }
+
+            void Delete(std::shared_ptr<Node> node)
+            {
+                node = Unwrap(node);
+
+                switch (node->GetKind())
+                {
+                    case NodeKind::AtomName:
+                        DeleteName(std::static_pointer_cast<AtomNameNode>(node)->GetNameText());
+                        return;
+
+                    case NodeKind::AtomExpr:
+                        {
+                            auto n = std::static_pointer_cast<AtomExprNode>(node);
+                            auto trailer = n->GetRight()->back();
+                            auto mark = Mark();
+                            auto object = Primary(n, 1, 0, false);
+
+                            if (trailer->GetKind() == NodeKind::DotName)
+                                Emit(   MakeABC(OpCode::DeleteAttr, object),
+                                        Name( *std::static_pointer_cast<DotNameNode>(trailer)->GetOperator2()->GetText() ) );
+                            else if (trailer->GetKind() == NodeKind::Index)
+                                Emit( MakeABC(OpCode::DeleteItem, object, Subscript( std::static_pointer_cast<IndexNode>(trailer)->GetRight() )) );
+                            else throw Error(node, L"Can not delete function call!");
+
+                            Release(mark);
+                        }
+                        return;
+
+                    case NodeKind::AtomTuple:
+                    case NodeKind::AtomList:
+                        {
+                            auto right = node->GetKind() == NodeKind::AtomTuple ?
+                                            std::static_pointer_cast<AtomTupleNode>(node)->GetRight() :
+                                            std::static_pointer_cast<AtomListNode>(node)->GetRight();
+                            if (right != nullptr) Delete(right);
+                        }
+                        return;
+
+                    default:
+                        {
+                            bool isSequence = false;
+                            auto nodes = Elements(node, isSequence);
+                            if (nodes == nullptr) throw Error(node, L"Can not delete expression!");
+                            for (auto &target : *nodes) Delete(target);
+                        }
+                        return;
+                }
+            }
+
+            /* Functions */
+
+            /* Free variables of the unit's scope get the registers of the cells they
+               capture in the creating unit. */
+            void Captures(CodeObject &code, Scope *scope)
+            {
+                std::vector<Symbol *> frees;
+
+                for (unsigned int i = 0; i < scope->SymbolCount(); i++)
+                {
+                    auto &symbol = scope->GetSymbol(i);
+
+                    if (symbol.mKind == SymbolKind::Cell && symbol.mSlot != Symbol::NoSlot)
+                        code.mCellSlots.push_back(mUnit->mBase + symbol.mSlot);
+
+                    if (symbol.mKind == SymbolKind::Free || (symbol.mFlags & Symbol::FreeInClass)) frees.push_back(&symbol);
+                }
+
+                std::sort(frees.begin(), frees.end(), [](Symbol *a, Symbol *b) { return a->mSlot < b->mSlot; });
+                std::sort(code.mCellSlots.begin(), code.mCellSlots.end());
+
+                code.mFreeSlot = frees.empty() ? mUnit->mBase + scope->SlotCount() : mUnit->mBase + frees.front()->mSlot;
+
+                auto outer = mUnit->mOuter;
+
+                for (auto symbol : frees)
+                {
+                    auto index = outer->mScope->Find(symbol->mName);
+                    code.mFreeSources.push_back( outer->mBase + outer->mScope->GetSymbol(index).mSlot );
+                }
+            }
+
+            struct Parameter
+            {
+                std::shared_ptr<NameToken> mName;
+                std::shared_ptr<ExpressionNode> mDefault;
+            };
+
+            /* Parameters in register order: positional, keyword only, then the star ones. */
+            static void FunctionParameters(std::shared_ptr<FuncDefStatementNode> node, std::vector<Parameter> &parameters, unsigned int &argCount, unsigned int &flags)
+            {
+                auto list = std::static_pointer_cast<TypedArgsListStatementNode>(
+                                std::static_pointer_cast<ParameterStatementNode>(node->GetLeft())->GetRight() );
+
+                argCount = 0;
+                flags = 0;
+
+                if (list == nullptr) return;
+
+                auto mul = list->GetMul();
+
+                for (auto &element : *list->GetNodes())
+                {
+                    std::shared_ptr<StatementNode> def = element;
+                    std::shared_ptr<ExpressionNode> value = nullptr;
+
+                    if (element->GetKind() == NodeKind::TFPDefAssignStatement)
+                    {
+                        auto assign = std::static_pointer_cast<TFPDefAssignStatementNode>(element);
+                        def = assign->GetLeft();
+                        value = assign->GetRight();
+                    }
+
+                    auto name = std::static_pointer_cast<NameToken>( std::static_pointer_cast<TFPDefStatementNode>(def)->GetOperator1() );
+                    if (mul == nullptr || name->GetTokenStartPosition() < mul->GetTokenStartPosition()) argCount++;
+
+                    parameters.push_back( { name, value } );
+                }
+
+                if (list->GetMulNode() != nullptr)
+                {
+                    flags |= CodeObject::VarArgs;
+                    parameters.push_back( { std::static_pointer_cast<NameToken>( std::static_pointer_cast<TFPDefStatementNode>(list->GetMulNode())->GetOperator1() ), nullptr } );
+                }
+
+                if (list->GetPowerNode() != nullptr)
+                {
+                    flags |= CodeObject::VarKeywords;
+                    parameters.push_back( { std::static_pointer_cast<NameToken>( std::static_pointer_cast<TFPDefStatementNode>(list->GetPowerNode())->GetOperator1() ), nullptr } );
+                }
+            }
+
+            static void LambdaParameters(std::shared_ptr<LambdaNode> node, std::vector<Parameter> &parameters, unsigned int &argCount, unsigned int &flags)
+            {
+                auto list = std::static_pointer_cast<VarArgsListExpressionNode>(node->GetLeft());
+
+                argCount = 0;
+                flags = 0;
+
+                if (list == nullptr) return;
+
+                auto mul = list->GetMul();
+
+                for (auto &element : *list->GetNodes())
+                {
+                    auto def = std::static_pointer_cast<VFPDefAssignExpressionNode>(element);
+                    auto name = def->GetOperator1();
+                    if (mul == nullptr || name->GetTokenStartPosition() < mul->GetTokenStartPosition()) argCount++;
+                    parameters.push_back( { name, def->GetRight() } );
+                }
+
+                if (list->GetMulNode() != nullptr)
+                {
+                    flags |= CodeObject::VarArgs;
+                    parameters.push_back( { list->GetMulNode(), nullptr } );
+                }
+
+                if (list->GetPowerNode() != nullptr)
+                {
+                    flags |= CodeObject::VarKeywords;
+                    parameters.push_back( { list->GetPowerNode(), nullptr } );
+                }
+            }
+
+            /* Emits the function object for a compiled body into dest, defaults are
+               evaluated here in parameter order. */
+            template <typename Body>
+            void Function(std::shared_ptr<Node> node, std::wstring name, const std::vector<Parameter> &parameters, unsigned int argCount, unsigned int flags, unsigned int dest, Body body)
+            {
+                auto scope = mTable->GetScope(node.get());
+                auto code = std::make_shared<CodeObject>(name, scope->GetKind());
+
+                code->mArgCount = argCount;
+                code->mFlags = flags;
+                code->mKwOnlyCount = static_cast<unsigned int>(parameters.size()) - argCount
+                                        - ((flags & CodeObject::VarArgs) ? 1 : 0) - ((flags & CodeObject::VarKeywords) ? 1 : 0);
+
+                auto mark = Mark();
+                auto first = Mark();
+                std::vector<unsigned int> defaults;
+
+                for (unsigned int i = 0; i < parameters.size(); i++)
+                {
+                    code->mParameterNames.push_back( *parameters[i].mName->GetText() );
+
+                    if (parameters[i].mDefault != nullptr)
+                    {
+                        code->mDefaultParameters.push_back(i);
+                        ValueTo(parameters[i].mDefault, Register());
+                    }
+                }
+
+                if (code->mDefaultParameters.size() > MaxRegister) throw Error(node, L"Too many defaults in function!");
+
+                Unit unit(node, code, scope, 0);
+                Enter(unit);
+                Captures(*code, scope);
+                body();
+                Emit( MakeABC(OpCode::ReturnNone, 0) );
+                Leave();
+
+                Constant constant;
+                constant.mKind = ConstantKind::Code;
+                constant.mCode = code;
+
+                Emit(   MakeABC(OpCode::MakeFunction, dest, code->mDefaultParameters.empty() ? 0 : first, static_cast<unsigned int>(code->mDefaultParameters.size())),
+                        AddConstant(constant) );
+                Release(mark);
+            }
+
+            void FunctionDef(std::shared_ptr<FuncDefStatementNode> node, unsigned int dest)
+            {
+                std::vector<Parameter> parameters;
+                unsigned int argCount, flags;
+
+                FunctionParameters(node, parameters, argCount, flags);
+
+                Function(node, *std::static_pointer_cast<NameToken>(node->GetOperator2())->GetText(), parameters, argCount, flags, dest, [this, node]() {
+                    Statement(node->GetNext());
+                });
+            }
+
+            void Lambda(std::shared_ptr<LambdaNode> node, unsigned int dest)
+            {
+                std::vector<Parameter> parameters;
+                unsigned int argCount, flags;
+
+                LambdaParameters(node, parameters, argCount, flags);
+
+                Function(node, L"<lambda>", parameters, argCount, flags, dest, [this, node]() {
+                    MarkLine(node->GetRight());
+                    auto mark = Mark();
+                    Emit( MakeABC(OpCode::Return, Value(node->GetRight())) );
+                    Release(mark);
+                });
+            }
+
+            static std::shared_ptr<SyncCompForNode> SyncFor(std::shared_ptr<Node> node)
+            {
+                if (node->GetKind() == NodeKind::CompFor)
+                    throw std::make_shared<SyntaxError>(node->GetStart(), nullptr, std::make_shared<std::wstring>(L"Asynchronous comprehensions are not supported by the compiler!"));
+
+                return std::static_pointer_cast<SyncCompForNode>(node);
+            }
+
+            /* A comprehension is a function called with the iterator of its first
+               iterable, which is evaluated outside. */
+            void Comprehension(OpCode op, std::shared_ptr<ExpressionNode> element, std::shared_ptr<ExpressionNode> comp, unsigned int dest)
+            {
+                auto first = SyncFor(comp);
+                auto scope = mTable->GetScope(comp.get());
+                auto code = std::make_shared<CodeObject>(op == OpCode::BuildList ? L"<listcomp>" : op == OpCode::BuildSet ? L"<setcomp>" : L"<dictcomp>", ScopeKind::Comprehension);
+
+                code->mArgCount = 1;
+                code->mParameterNames.push_back(L".0");
+
+                auto mark = Mark();
+                auto base = IsTemporary(dest) && dest + 1 == Mark() ? dest : Register();
+                auto iterator = Register();
+
+                ValueTo(first->GetRight(), iterator);
+                Emit( MakeABC(OpCode::GetIter, iterator, iterator) );
+
+                Unit unit(comp, code, scope, 1);
+                Enter(unit);
+                Captures(*code, scope);
+                MarkLine(element);
+
+                auto result = Register();
+                Emit( MakeABC(op, result, 0, 0) );
+
+                struct Level
+                {
+                    unsigned int mTop;
+                    unsigned int mForIter;
+                };
+
+                std::vector<Level> levels;
+                unsigned int source = 0;
+                auto sync = first;
+
+                while (true)
+                {
+                    unsigned int item;
+                    auto direct = LocalRegister(Unwrap(sync->GetLeft()), item);
+                    if (!direct) item = Register();
+
+                    auto top = Here();
+
+                    levels.push_back( { top, Emit(MakeABC(OpCode::ForIter, item, source), 0) } );
+                    if (!direct) Store(sync->GetLeft(), item);
+
+                    std::shared_ptr<Node> next = sync->GetNext();
+
+                    while (next != nullptr && next->GetKind() == NodeKind::CompIf)
+                    {
+                        auto compIf = std::static_pointer_cast<CompIfNode>(next);
+                        Patch(Condition(compIf->GetRight(), false), top);
+                        next = compIf->GetNext();
+                    }
+
+                    if (next == nullptr) break;
+
+                    sync = SyncFor(next);
+                    source = Register();
+                    ValueTo(sync->GetRight(), source);
+                    Emit( MakeABC(OpCode::GetIter, source, source) );
+                }
+
+                auto elementMark = Mark();
+
+                if (op == OpCode::BuildDict)
+                {
+                    if (element->GetKind() != NodeKind::DictionaryEntry)
+                        throw Error(element, L"Dictionary unpacking is not supported by the compiler!");
+
+                    auto entry = std::static_pointer_cast<DictionaryEntryNode>(element);
+                    auto key = Register();
+                    ValueTo(entry->GetKey(), key);
+                    Emit( MakeABC(OpCode::SetItem, result, key, Value(entry->GetValue())) );
+                }
+                else Emit( MakeABC(op == OpCode::BuildList ? OpCode::ListAppend : OpCode::SetAdd, result, Value(element)) );
+
+                Release(elementMark);
+
+                for (auto level = levels.rbegin(); level != levels.rend(); level++)
+                {
+                    JumpTo(level->mTop);
+                    PatchJump(level->mForIter, Here());
+                }
+
+                Emit( MakeABC(OpCode::Return, result) );
+                Leave();
+
+                Constant constant;
+                constant.mKind = ConstantKind::Code;
+                constant.mCode = code;
+
+                Emit( MakeABC(OpCode::MakeFunction, base), AddConstant(constant) );
+                Emit( MakeABC(OpCode::Call, base, 1) );
+                EmitMove(dest, base);
+                Release(mark);
+            }
+
+            void ClassDef(std::shared_ptr<ClassStatementNode> node, unsigned int dest)
+            {
+                auto scope = mTable->GetScope(node.get());
+                auto name = *std::static_pointer_cast<NameToken>(node->GetOperator2())->GetText();
+                auto code = std::make_shared<CodeObject>(name, ScopeKind::Class);
+
+                auto mark = Mark();
+                auto base = Register();
+                std::vector<std::shared_ptr<ExpressionNode>> bases;
+                auto left = node->GetLeft();
+
+                if (left != nullptr)
+                {
+                    if (left->GetKind() == NodeKind::ArgsList) bases = *std::static_pointer_cast<ArgsListNode>(left)->GetNodes();
+                    else bases.push_back(left);
+                }
+
+                for (auto &element : bases)
+                    if (element->GetKind() == NodeKind::Argument)
+                        throw Error(element, L"Class keywords are not supported by the compiler!");
+
+                if (bases.size() > MaxRegister - 1) throw Error(node, L"Too many base classes!");
+
+                Consecutive(bases);
+
+                Unit unit(node, code, scope, 0);
+                Enter(unit);
+                Captures(*code, scope);
+                Statement(node->GetRight());
+                Emit( MakeABC(OpCode::ReturnNone, 0) );
+                Leave();
+
+                Constant constant;
+                constant.mKind = ConstantKind::Code;
+                constant.mCode = code;
+
+                Emit( MakeABC(OpCode::MakeFunction, base), AddConstant(constant) );
+                Emit( MakeABC(OpCode::MakeClass, dest, base, static_cast<unsigned int>(bases.size())), Name(name) );
+                Release(mark);
+            }
+
+            /* Statements */
+
+            void Statements(std::shared_ptr<std::vector<std::shared_ptr<StatementNode>>> nodes)
+            {
+                for (auto &statement : *nodes) Statement(statement);
+            }
+
+            void Statement(std::shared_ptr<Node> node)
+            {
+                if (node == nullptr) return;
+
+                auto mark = Mark();
+                OpCode op;
+                std::pair<std::shared_ptr<Node>, std::shared_ptr<Node>> augmented;
+
+                switch (node->GetKind())
+                {
+                    case NodeKind::SimpleStatement:
+                        Statements(std::static_pointer_cast<SimpleStatementNode>(node)->GetNodes());
+                        break;
+
+                    case NodeKind::SuiteStatement:
+                        Statements(std::static_pointer_cast<SuiteStatementNode>(node)->GetNodes());
+                        break;
+
+                    case NodeKind::FuncBodySuiteStatement:
+                        Statements(std::static_pointer_cast<FuncBodySuiteStatementNode>(node)->GetNodes());
+                        break;
+
+                    case NodeKind::PassStatement:
+                    case NodeKind::GlobalStatement:
+                    case NodeKind::NonlocalStatement:
+                        break;
+
+                    case NodeKind::AssignStatement:
+                        MarkLine(node);
+                        Assign(std::static_pointer_cast<AssignStatementNode>(node));
+                        break;
+
+                    case NodeKind::AnnAssignStatement:
+                        {
+                            /* Annotations are not evaluated. */
+                            MarkLine(node);
+                            auto n = std::static_pointer_cast<AnnAssignStatementNode>(node);
+                            if (n->GetNextNode() != nullptr) AssignTo(n->GetLeftNode(), n->GetNextNode());
+                        }
+                        break;
+
+                    case NodeKind::DelStatement:
+                        MarkLine(node);
+                        Delete(std::static_pointer_cast<DelStatementNode>(node)->GetRight());
+                        break;
+
+                    case NodeKind::ReturnStatement:
+                        {
+                            MarkLine(node);
+                            if (!InFunction()) throw Error(node, L"'return' outside function!");
+
+                            auto right = std::static_pointer_cast<ReturnStatementNode>(node)->GetRight();
+                            if (right == nullptr) Emit( MakeABC(OpCode::ReturnNone, 0) );
+                            else Emit( MakeABC(OpCode::Return, Value(right)) );
+                        }
+                        break;
+
+                    case NodeKind::BreakStatement:
+                        MarkLine(node);
+                        if (mUnit->mLoops.empty()) throw Error(node, L"'break' outside loop!");
+                        mUnit->mLoops.back().mBreaks.push_back( EmitJump(OpCode::Jump) );
+                        break;
+
+                    case NodeKind::ContinueStatement:
+                        MarkLine(node);
+                        if (mUnit->mLoops.empty()) throw Error(node, L"'continue' outside loop!");
+                        JumpTo(mUnit->mLoops.back().mContinue);
+                        break;
+
+                    case NodeKind::RaiseStatement:
+                        {
+                            MarkLine(node);
+                            auto n = std::static_pointer_cast<RaiseStatementNode>(node);
+                            if (n->GetLeft() == nullptr || n->GetRight() != nullptr)
+                                throw Error(node, L"Re-raising and exception chaining are not supported by the compiler!");
+                            Emit( MakeABC(OpCode::Raise, Value(n->GetLeft())) );
+                        }
+                        break;
+
+                    case NodeKind::AssertStatement:
+                        {
+                            MarkLine(node);
+                            auto n = std::static_pointer_cast<AssertStatementNode>(node);
+                            auto passed = Condition(n->GetLeft(), true);
+                            auto base = Register();
+
+                            Emit( MakeABx(OpCode::LoadGlobal, base, Name(L"AssertionError")) );
+
+                            if (n->GetRight() != nullptr)
+                            {
+                                ValueTo(n->GetRight(), Register());
+                                Emit( MakeABC(OpCode::Call, base, 1) );
+                            }
+
+                            Emit( MakeABC(OpCode::Raise, base) );
+                            Patch(passed, Here());
+                        }
+                        break;
+
+                    case NodeKind::IfStatement:
+                        If(std::static_pointer_cast<IfStatementNode>(node));
+                        break;
+
+                    case NodeKind::WhileStatement:
+                        While(std::static_pointer_cast<WhileStatementNode>(node));
+                        break;
+
+                    case NodeKind::ForStatement:
+                        For(std::static_pointer_cast<ForStatementNode>(node));
+                        break;
+
+                    case NodeKind::FuncDefStatement:
+                        {
+                            MarkLine(node);
+                            auto n = std::static_pointer_cast<FuncDefStatementNode>(node);
+                            auto reg = Register();
+                            FunctionDef(n, reg);
+                            StoreName(std::static_pointer_cast<NameToken>(n->GetOperator2()), reg);
+                        }
+                        break;
+
+                    case NodeKind::ClassStatement:
+                        {
+                            MarkLine(node);
+                            auto n = std::static_pointer_cast<ClassStatementNode>(node);
+                            auto reg = Register();
+                            ClassDef(n, reg);
+                            StoreName(std::static_pointer_cast<NameToken>(n->GetOperator2()), reg);
+                        }
+                        break;
+
+                    case NodeKind::DecoratedStatement:
+                        Decorated(std::static_pointer_cast<DecoratedStatementNode>(node));
+                        break;
+
+                    case NodeKind::MatchStatement:
+                        Match(std::static_pointer_cast<MatchStatementNode>(node));
+                        break;
+
+                    case NodeKind::TryStatement:
+                    case NodeKind::WithStatement:
+                    case NodeKind::ImportStatement:
+                    case NodeKind::ImportFromStatement:
+                    case NodeKind::AsyncStatement:
+                    case NodeKind::YieldStatement:
+                        throw Error(node, L"Statement is not supported by the compiler!");
+
+                    default:
+                        if (AugmentedOperator(node, op, augmented))
+                        {
+                            MarkLine(node);
+                            AugmentedAssign(op, augmented.first, augmented.second);
+                            break;
+                        }
+
+                        /* Expression statement */
+                        MarkLine(node);
+                        Value(node);
+                        break;
+                }
+
+                Release(mark);
+            }
+
+            void AssignTo(std::shared_ptr<Node> target, std::shared_ptr<Node> value)
+            {
+                unsigned int reg;
+
+                if (LocalRegister(Unwrap(target), reg) && WritesDestinationLast(Unwrap(value)))
+                {
+                    ValueTo(value, reg);
+                    return;
+                }
+
+                Store(target, Value(value));
+            }
+
+            void Assign(std::shared_ptr<AssignStatementNode> node)
+            {
+                auto &rights = *node->GetRightNodes();
+
+                if (rights.size() == 1)
+                {
+                    AssignTo(node->GetLeft(), rights.front());
+                    return;
+                }
+
+                auto value = Value(rights.back());
+
+                Store(node->GetLeft(), value);
+                for (std::size_t i = 0; i + 1 < rights.size(); i++) Store(rights[i], value);
+            }
+
+            void AugmentedAssign(OpCode op, std::shared_ptr<Node> target, std::shared_ptr<Node> value)
+            {
+                target = Unwrap(target);
+                unsigned int reg;
+
+                if (LocalRegister(target, reg))
+                {
+                    Emit( MakeABC(op, reg, reg, Value(value)) );
+                    return;
+                }
+
+                if (target->GetKind() == NodeKind::AtomName)
+                {
+                    auto name = std::static_pointer_cast<AtomNameNode>(target)->GetNameText();
+                    auto current = Register();
+                    LoadName(name, current);
+                    Emit( MakeABC(op, current, current, Value(value)) );
+                    StoreName(name, current);
+                    return;
+                }
+
+                if (target->GetKind() != NodeKind::AtomExpr) throw Error(target, L"Illegal target for augmented assignment!");
+
+                auto n = std::static_pointer_cast<AtomExprNode>(target);
+                auto trailer = n->GetRight()->back();
+                auto object = Primary(n, 1, 0, false);
+                auto current = Register();
+
+                if (trailer->GetKind() == NodeKind::DotName)
+                {
+                    auto name = Name( *std::static_pointer_cast<DotNameNode>(trailer)->GetOperator2()->GetText() );
+                    Emit( MakeABC(OpCode::GetAttr, current, object), name );
+                    Emit( MakeABC(op, current, current, Value(value)) );
+                    Emit( MakeABC(OpCode::SetAttr, object, current), name );
+                }
+                else if (trailer->GetKind() == NodeKind::Index)
+                {
+                    auto key = Subscript( std::static_pointer_cast<IndexNode>(trailer)->GetRight() );
+                    Emit( MakeABC(OpCode::GetItem, current, object, key) );
+                    Emit( MakeABC(op, current, current, Value(value)) );
+                    Emit( MakeABC(OpCode::SetItem, object, key, current) );
+                }
+                else throw Error(target, L"Illegal target for augmented assignment!");
+            }
+
+            void If(std::shared_ptr<IfStatementNode> node)
+            {
+                MarkLine(node);
+
+                std::vector<unsigned int> ends;
+                auto otherwise = Condition(node->GetLeft(), false);
+                auto elifs = node->GetNodes();
+
+                Statement(node->GetRight());
+
+                if (elifs != nullptr)
+                {
+                    for (auto &statement : *elifs)
+                    {
+                        auto elif = std::static_pointer_cast<ElifStatementNode>(statement);
+
+                        ends.push_back( EmitJump(OpCode::Jump) );
+                        Patch(otherwise, Here());
+
+                        MarkLine(elif);
+                        otherwise = Condition(elif->GetLeft(), false);
+                        Statement(elif->GetRight());
+                    }
+                }
+
+                if (node->GetNext() != nullptr)
+                {
+                    ends.push_back( EmitJump(OpCode::Jump) );
+                    Patch(otherwise, Here());
+                    Statement(std::static_pointer_cast<ElseStatementNode>(node->GetNext())->GetRight());
+                }
+                else Patch(otherwise, Here());
+
+                Patch(ends, Here());
+            }
+
+            void While(std::shared_ptr<WhileStatementNode> node)
+            {
+                MarkLine(node);
+
+                auto top = Here();
+                auto exit = Condition(node->GetLeft(), false);
+
+                mUnit->mLoops.push_back( { top, {} } );
+                Statement(node->GetRight());
+                JumpTo(top);
+
+                auto breaks = mUnit->mLoops.back().mBreaks;
+                mUnit->mLoops.pop_back();
+
+                Patch(exit, Here());
+                if (node->GetNext() != nullptr) Statement(std::static_pointer_cast<ElseStatementNode>(node->GetNext())->GetRight());
+                Patch(breaks, Here());
+            }
+
+            void For(std::shared_ptr<ForStatementNode> node)
+            {
+                MarkLine(node);
+
+                auto iterator = Register();
+                auto mark = Mark();
+                Emit( MakeABC(OpCode::GetIter, iterator, Value(node->GetRight())) );
+                Release(mark);
+
+                /* A single local target is the loop register itself. */
+                unsigned int item;
+                auto direct = LocalRegister(Unwrap(node->GetLeft()), item);
+                if (!direct) item = Register();
+
+                auto top = Here();
+                auto forIter = Emit( MakeABC(OpCode::ForIter, item, iterator), 0 );
+
+                if (!direct) Store(node->GetLeft(), item);
+
+                mUnit->mLoops.push_back( { top, {} } );
+                Statement(node->GetNext());
+                JumpTo(top);
+
+                auto breaks = mUnit->mLoops.back().mBreaks;
+                mUnit->mLoops.pop_back();
+
+                PatchJump(forIter, Here());
+                if (node->GetExtra() != nullptr) Statement(std::static_pointer_cast<ElseStatementNode>(node->GetExtra())->GetRight());
+                Patch(breaks, Here());
+            }
+
+            /* Match statements */
+
+            struct MatchState
+            {
+                std::shared_ptr<DecisionTree> mTree;
+                std::vector<unsigned int> mRegisters;                       /* of each access */
+                std::unordered_map<DecisionNode *, unsigned int> mLabels;   /* of the nodes emitted so far */
+                std::vector<unsigned int> mEnds;
+            };
+
+            /* All cases run as one decision graph over the subject, see DecisionTree. */
+            void Match(std::shared_ptr<MatchStatementNode> node)
+            {
+                MarkLine(node);
+
+                MatchState state;
+                state.mTree = DecisionTree::Build(node);
+
+                for (std::size_t k = 0; k < state.mTree->GetAccesses().size(); k++) state.mRegisters.push_back(Register());
+
+                ValueTo(std::static_pointer_cast<SubjectExprNode>(node->GetLeft())->GetRight(), state.mRegisters[0]);
+
+                Decision(state, state.mTree->GetRoot());
+                Patch(state.mEnds, Here());
+            }
+
+            void Decision(MatchState &state, DecisionNode *node)
+            {
+                std::vector<unsigned int> failed;
+
+                while (true)
+                {
+                    /* Failing jumps go straight past the statement. */
+                    if (node->mKind == DecisionKind::Fail && !failed.empty())
+                    {
+                        state.mEnds.insert(state.mEnds.end(), failed.begin(), failed.end());
+                        return;
+                    }
+
+                    auto label = state.mLabels.find(node);
+
+                    /* Shared nodes are emitted once. */
+                    if (label != state.mLabels.end())
+                    {
+                        if (failed.empty()) JumpTo(label->second);
+                        else Patch(failed, label->second);
+                        return;
+                    }
+
+                    Patch(failed, Here());
+                    state.mLabels.emplace(node, Here());
+
+                    auto &tree = *state.mTree;
+
+                    switch (node->mKind)
+                    {
+                        case DecisionKind::Fail:
+                            state.mEnds.push_back( EmitJump(OpCode::Jump) );
+                            return;
+
+                        case DecisionKind::Match:
+                            {
+                                auto &row = tree.GetRows()[node->mRow];
+                                auto n = tree.GetCases()[row.mCase];
+
+                                MarkLine(n);
+                                for (auto &binding : row.mBindings) StoreName(binding.first, state.mRegisters[binding.second]);
+
+                                if (n->GetRight() != nullptr)
+                                    failed = Condition(std::static_pointer_cast<GuardNode>(n->GetRight())->GetRight(), false);
+
+                                Statement(n->GetNext());
+                                state.mEnds.push_back( EmitJump(OpCode::Jump) );
+
+                                if (node->mOnFalse == nullptr) return;
+                                node = node->mOnFalse;
+                            }
+                            break;
+
+                        case DecisionKind::Test:
+                            MarkLine(tree.GetCases()[tree.GetRows()[node->mRow].mCase]);
+                            failed = PatternTest(state, tree.GetTests()[node->mTest]);
+
+                            if (node->mOnFalse == nullptr)
+                            {
+                                node = node->mOnTrue;
+                                break;
+                            }
+
+                            Decision(state, node->mOnTrue);
+                            node = node->mOnFalse;
+                            break;
+                    }
+                }
+            }
+
+            /* Emits a test of the decision graph, returns the jumps taken when it fails. */
+            std::vector<unsigned int> PatternTest(MatchState &state, const MatchTest &test)
+            {
+                auto &access = state.mTree->GetAccesses()[test.mAccess];
+                auto reg = state.mRegisters[test.mAccess];
+                auto parent = state.mRegisters[access.mParent];
+                auto mark = Mark();
+                std::vector<unsigned int> failed;
+
+                switch (test.mKind)
+                {
+                    case MatchTestKind::Load:
+                        switch (access.mKind)
+                        {
+                            case AccessKind::Length:
+                                Emit( MakeABC(OpCode::GetLength, reg, parent) );
+                                break;
+
+                            case AccessKind::Item:
+                                {
+                                    Constant index;
+                                    index.mKind = ConstantKind::Integer;
+                                    index.mInteger = access.mIndex;
+
+                                    auto temp = Register();
+                                    LoadConstant(index, temp);
+                                    Emit( MakeABC(OpCode::GetItem, reg, parent, temp) );
+                                }
+                                break;
+
+                            case AccessKind::Slice:
+                                if (access.mIndex > MaxRegister) throw Error(state.mTree->GetCases().front(), L"Too many patterns before starred name!");
+                                Emit( MakeABC(OpCode::SliceList, reg, parent, static_cast<unsigned int>(access.mIndex)), static_cast<std::uint32_t>(access.mCount) );
+                                break;
+
+                            case AccessKind::Key:
+                                {
+                                    auto key = Register();
+                                    PatternValue(access.mNode, key);
+                                    failed.push_back( Emit( MakeABC(OpCode::GetKey, reg, parent, key), 0 ) );
+                                }
+                                break;
+
+                            case AccessKind::Rest:
+                                {
+                                    auto first = Mark();
+                                    for (auto &key : access.mKeys) PatternValue(key, Register());
+
+                                    auto keys = Register();
+                                    Emit( MakeABC(OpCode::BuildTuple, keys, first, static_cast<unsigned int>(access.mKeys.size())) );
+                                    Emit( MakeABC(OpCode::CopyDictWithout, reg, parent, keys) );
+                                }
+                                break;
+
+                            case AccessKind::Attributes:
+                                {
+                                    auto n = std::static_pointer_cast<ClassPatternNode>(access.mNode);
+                                    unsigned int positionals = 0;
+
+                                    if (n->GetPositionals() != nullptr)
+                                        positionals = static_cast<unsigned int>(std::static_pointer_cast<PositionalPatternsNode>(n->GetPositionals())->GetNodes()->size());
+
+                                    if (positionals > MaxRegister) throw Error(n, L"Too many positional patterns in class pattern!");
+
+                                    Constant names;
+                                    names.mKind = ConstantKind::Tuple;
+
+                                    if (n->GetKeywords() != nullptr)
+                                        for (auto &keyword : *std::static_pointer_cast<KeywordPatternsNode>(n->GetKeywords())->GetNodes())
+                                        {
+                                            Constant name;
+                                            name.mKind = ConstantKind::String;
+                                            name.mText = *std::static_pointer_cast<KeywordPatternNode>(keyword)->GetOperator1()->GetText();
+                                            names.mItems.push_back(name);
+                                        }
+
+                                    DottedName(*n->GetNodes(), reg);
+                                    Emit( MakeABC(OpCode::MatchClass, reg, parent, positionals), AddConstant(names) );
+
+                                    auto none = Register();
+                                    Emit( MakeABC(OpCode::LoadNone, none) );
+                                    Emit( MakeABC(OpCode::Is, none, reg, none) );
+                                    failed.push_back( EmitJump(OpCode::JumpIfTrue, none) );
+                                }
+                                break;
+
+                            default:
+                                break;
+                        }
+                        break;
+
+                    case MatchTestKind::IsSequence:
+                    case MatchTestKind::IsMapping:
+                        {
+                            auto temp = Register();
+                            Emit( MakeABC(test.mKind == MatchTestKind::IsSequence ? OpCode::MatchSequence : OpCode::MatchMapping, temp, reg) );
+                            failed.push_back( EmitJump(OpCode::JumpIfFalse, temp) );
+                        }
+                        break;
+
+                    case MatchTestKind::LengthEqual:
+                    case MatchTestKind::LengthAtLeast:
+                        {
+                            Constant count;
+                            count.mKind = ConstantKind::Integer;
+                            count.mInteger = test.mCount;
+
+                            auto temp = Register();
+                            LoadConstant(count, temp);
+                            Emit( MakeABC(test.mKind == MatchTestKind::LengthEqual ? OpCode::Equal : OpCode::GreaterEqual, temp, reg, temp) );
+                            failed.push_back( EmitJump(OpCode::JumpIfFalse, temp) );
+                        }
+                        break;
+
+                    case MatchTestKind::Equal:
+                    case MatchTestKind::Is:
+                        {
+                            auto temp = Register();
+                            PatternValue(test.mValue, temp);
+                            Emit( MakeABC(test.mKind == MatchTestKind::Equal ? OpCode::Equal : OpCode::Is, temp, reg, temp) );
+                            failed.push_back( EmitJump(OpCode::JumpIfFalse, temp) );
+                        }
+                        break;
+                }
+
+                Release(mark);
+                return failed;
+            }
+
+            void DottedName(const std::vector<std::shared_ptr<NameToken>> &names, unsigned int dest)
+            {
+                LoadName(names.front(), dest);
+                for (std::size_t k = 1; k < names.size(); k++) Emit( MakeABC(OpCode::GetAttr, dest, dest), Name(*names[k]->GetText()) );
+            }
+
+            /* Value of a literal or value pattern, or of a mapping pattern key. */
+            void PatternValue(std::shared_ptr<Node> node, unsigned int dest)
+            {
+                if (node->GetKind() == NodeKind::ValuePattern)
+                {
+                    DottedName(*std::static_pointer_cast<ValuePatternNode>(node)->GetNodes(), dest);
+                    return;
+                }
+
+                /* String keys of mapping patterns parse as literal patterns too. */
+                auto token = node->GetKind() == NodeKind::LiteralPattern ? std::static_pointer_cast<LiteralPatternNode>(node)->GetOperator()
+                                                                         : std::static_pointer_cast<LiteralExprNode>(node)->GetOperator();
+                auto number = node->GetKind() == NodeKind::LiteralPattern ? std::static_pointer_cast<LiteralPatternNode>(node)->GetRight()
+                                                                          : std::static_pointer_cast<LiteralExprNode>(node)->GetRight();
+                Constant constant;
+
+                if (token != nullptr)
+                {
+                    switch (token->GetSymbolKind())
+                    {
+                        case TokenKind::PyNone:     constant.mKind = ConstantKind::None; break;
+                        case TokenKind::PyTrue:     constant.mKind = ConstantKind::True; break;
+                        case TokenKind::PyFalse:    constant.mKind = ConstantKind::False; break;
+                        default:
+                            constant.mKind = ConstantKind::String;
+                            constant.mText = DecodeString(std::static_pointer_cast<StringToken>(token));
+                            break;
+                    }
+                }
+                else if (number->GetKind() == NodeKind::SignedNumber)
+                {
+                    auto n = std::static_pointer_cast<SignedNumberNode>(number);
+                    auto literal = n->GetNumber();
+
+                    if (n->GetSign() != nullptr)
+                        literal = std::make_shared<NumberToken>(literal->GetTokenStartPosition(), literal->GetTokenEndPosition(),
+                                                                literal->IsImaginaryNumber(), literal->IsRealNumber(),
+                                                                std::make_shared<std::wstring>(L"-" + *literal->GetText()),
+                                                                std::make_shared<std::vector<std::shared_ptr<Trivia>>>());
+
+                    constant = NumberConstant(literal);
+                }
+                else throw Error(node, L"Complex literal patterns are not supported by the compiler!");
+
+                LoadConstant(constant, dest);
+            }
+
+            /* Decorators are evaluated before the definition and applied innermost first. */
+            void Decorated(std::shared_ptr<DecoratedStatementNode> node)
+            {
+                std::vector<std::shared_ptr<DecoratorStatementNode>> decorators;
+                auto left = node->GetLeft();
+
+                if (left->GetKind() == NodeKind::DecoratorsStatement)
+                    for (auto &element : *std::static_pointer_cast<DecoratorsStatementNode>(left)->GetNodes())
+                        decorators.push_back( std::static_pointer_cast<DecoratorStatementNode>(element) );
+                else decorators.push_back( std::static_pointer_cast<DecoratorStatementNode>(left) );
+
+                MarkLine(node);
+
+                std::vector<unsigned int> registers;
+
+                for (auto &decorator : decorators)
+                {
+                    auto reg = Register();
+                    auto names = std::static_pointer_cast<DottedNameStatementNode>(decorator->GetLeft())->GetNodes();
+
+                    LoadName(names->front(), reg);
+
+                    for (std::size_t i = 1; i < names->size(); i++)
+                        Emit( MakeABC(OpCode::GetAttr, reg, reg), Name(*(*names)[i]->GetText()) );
+
+                    if (decorator->GetOperator2() != nullptr)
+                    {
+                        auto call = std::make_shared<CallNode>(decorator->GetStart(), decorator->GetEnd(), decorator->GetOperator2(), decorator->GetRight(), decorator->GetOperator3());
+                        auto callMark = Mark();
+                        Call(call, reg);
+                        Release(callMark);
+                    }
+
+                    registers.push_back(reg);
+                }
+
+                auto value = Register();
+                auto definition = node->GetRight();
+                std::shared_ptr<NameToken> name;
+
+                if (definition->GetKind() == NodeKind::FuncDefStatement)
+                {
+                    auto n = std::static_pointer_cast<FuncDefStatementNode>(definition);
+                    FunctionDef(n, value);
+                    name = std::static_pointer_cast<NameToken>(n->GetOperator2());
+                }
+                else if (definition->GetKind() == NodeKind::ClassStatement)
+                {
+                    auto n = std::static_pointer_cast<ClassStatementNode>(definition);
+                    ClassDef(n, value);
+                    name = std::static_pointer_cast<NameToken>(n->GetOperator2());
+                }
+                else throw Error(definition, L"Statement is not supported by the compiler!");
+
+                for (auto reg = registers.rbegin(); reg != registers.rend(); reg++)
+                {
+                    auto base = Register();
+                    EmitMove(base, *reg);
+                    EmitMove(Register(), value);
+                    Emit( MakeABC(OpCode::Call, base, 1) );
+                    EmitMove(value, base);
+                    Release(base);
+                }
+
+                StoreName(name, value);
+            }
+
+            std::shared_ptr<std::wstring> mSource;
+            const std::vector<unsigned int> &mLineStarts;
+            std::shared_ptr<SymbolTable> mTable;
+            std::shared_ptr<ConstantFolder> mFolder;
+            Unit *mUnit;
+    };
+}
+
+
+PythonCoreCompiler::PythonCoreCompiler(std::shared_ptr<std::wstring> source)
+{
+    mSource = source;
+    mLineStarts.push_back(0);
+
+    for (unsigned int i = 0; i < source->size(); i++)
+        if ((*source)[i] == L'\n') mLineStarts.push_back(i + 1);
+}
+
+std::shared_ptr<CodeObject> PythonCoreCompiler::CompileFileInput(std::shared_ptr<FileInputNode> root)
+{
+    CodeGenerator generator(mSource, mLineStarts, SymbolTable::Build(root), ConstantFolder::Fold(root));
+    return generator.Module(root);
+}
+
+std::shared_ptr<CodeObject> PythonCoreCompiler::CompileSource(std::shared_ptr<std::wstring> source)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>(source);
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+
+    PythonCoreCompiler compiler(source);
+    return compiler.CompileFileInput( std::static_pointer_cast<FileInputNode>( parser->ParseFileInput() ) );
+}
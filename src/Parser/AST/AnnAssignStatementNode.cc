@@ -11,7 +11,7 @@ AnnAssignStatementNode::AnnAssignStatementNode(
                             std::shared_ptr<ExpressionNode> right,
                             std::shared_ptr<Token> op2,
                             std::shared_ptr<Node> next
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::AnnAssignStatement)
 {
     mLeft = left;
     mOp1 = op1;
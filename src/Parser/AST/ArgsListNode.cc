@@ -8,7 +8,7 @@ ArgsListNode::ArgsListNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<std::vector<std::shared_ptr<ExpressionNode>>> nodes,
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> separators
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::ArgsList)
 {
     mNodes = nodes;
     mSeparators = separators;
@@ -9,7 +9,7 @@ ArgumentNode::ArgumentNode(
                             std::shared_ptr<ExpressionNode> left,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::Argument)
 {
     mOp1 = op1;
     mLeft = left;
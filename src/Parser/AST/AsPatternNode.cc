@@ -9,7 +9,7 @@ AsPatternNode::AsPatternNode(
                             std::shared_ptr<StatementNode> left,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<StatementNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::AsPattern)
 {
     
     mLeft = left;
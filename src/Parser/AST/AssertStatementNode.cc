@@ -10,7 +10,7 @@ AssertStatementNode::AssertStatementNode(
                             std::shared_ptr<ExpressionNode> left,
                             std::shared_ptr<Token> op2,
                             std::shared_ptr<ExpressionNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::AssertStatement)
 {
     mOp1 = op1;
     mLeft = left;
@@ -10,7 +10,7 @@ AssignStatementNode::AssignStatementNode(
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> ops,
                             std::shared_ptr<std::vector<std::shared_ptr<Node>>> rightNodes,
                             std::shared_ptr<Token> op2
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::AssignStatement)
 {
     mLeft = left;
     mOps = ops;
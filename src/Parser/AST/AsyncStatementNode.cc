@@ -8,7 +8,7 @@ AsyncStatementNode::AsyncStatementNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<StatementNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::AsyncStatement)
 {
     mOp1 = op1;
     mRight = right;
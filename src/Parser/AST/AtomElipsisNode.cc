@@ -4,7 +4,7 @@
 using namespace PythonCoreNative::RunTime::Parser::AST;
 using namespace PythonCoreNative::RunTime::Parser;
 
-AtomElipsisNode::AtomElipsisNode(unsigned int start, unsigned int end, std::shared_ptr<Token> op1) : ExpressionNode(start, end)
+AtomElipsisNode::AtomElipsisNode(unsigned int start, unsigned int end, std::shared_ptr<Token> op1) : ExpressionNode(start, end, NodeKind::AtomElipsis)
 {
     mOp1 = op1;
 }
@@ -9,7 +9,7 @@ AtomExprNode::AtomExprNode(
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> left,
                             std::shared_ptr<std::vector<std::shared_ptr<ExpressionNode>>> right
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::AtomExpr)
 {
     mOp1 = op1;
     mLeft = left;
@@ -4,7 +4,7 @@
 using namespace PythonCoreNative::RunTime::Parser::AST;
 using namespace PythonCoreNative::RunTime::Parser;
 
-AtomFalseNode::AtomFalseNode(unsigned int start, unsigned int end, std::shared_ptr<Token> op1) : ExpressionNode(start, end)
+AtomFalseNode::AtomFalseNode(unsigned int start, unsigned int end, std::shared_ptr<Token> op1) : ExpressionNode(start, end, NodeKind::AtomFalse)
 {
     mOp1 = op1;
 }
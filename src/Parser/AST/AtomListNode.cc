@@ -9,7 +9,7 @@ AtomListNode::AtomListNode(
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right,
                             std::shared_ptr<Token> op2
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::AtomList)
 {
     mOp1 = op1;
     mRight = right;
@@ -4,7 +4,7 @@
 using namespace PythonCoreNative::RunTime::Parser::AST;
 using namespace PythonCoreNative::RunTime::Parser;
 
-AtomNameNode::AtomNameNode(unsigned int start, unsigned int end, std::shared_ptr<NameToken> op1) : ExpressionNode(start, end)
+AtomNameNode::AtomNameNode(unsigned int start, unsigned int end, std::shared_ptr<NameToken> op1) : ExpressionNode(start, end, NodeKind::AtomName)
 {
     mOp1 = op1;
 }
@@ -4,7 +4,7 @@
 using namespace PythonCoreNative::RunTime::Parser::AST;
 using namespace PythonCoreNative::RunTime::Parser;
 
-AtomNoneNode::AtomNoneNode(unsigned int start, unsigned int end, std::shared_ptr<Token> op1) : ExpressionNode(start, end)
+AtomNoneNode::AtomNoneNode(unsigned int start, unsigned int end, std::shared_ptr<Token> op1) : ExpressionNode(start, end, NodeKind::AtomNone)
 {
     mOp1 = op1;
 }
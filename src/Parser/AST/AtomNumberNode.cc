@@ -4,7 +4,7 @@
 using namespace PythonCoreNative::RunTime::Parser::AST;
 using namespace PythonCoreNative::RunTime::Parser;
 
-AtomNumberNode::AtomNumberNode(unsigned int start, unsigned int end, std::shared_ptr<NumberToken> op1) : ExpressionNode(start, end)
+AtomNumberNode::AtomNumberNode(unsigned int start, unsigned int end, std::shared_ptr<NumberToken> op1) : ExpressionNode(start, end, NodeKind::AtomNumber)
 {
     mOp1 = op1;
 }
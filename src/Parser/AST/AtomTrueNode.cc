@@ -4,7 +4,7 @@
 using namespace PythonCoreNative::RunTime::Parser::AST;
 using namespace PythonCoreNative::RunTime::Parser;
 
-AtomTrueNode::AtomTrueNode(unsigned int start, unsigned int end, std::shared_ptr<Token> op1) : ExpressionNode(start, end)
+AtomTrueNode::AtomTrueNode(unsigned int start, unsigned int end, std::shared_ptr<Token> op1) : ExpressionNode(start, end, NodeKind::AtomTrue)
 {
     mOp1 = op1;
 }
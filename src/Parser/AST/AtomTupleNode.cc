@@ -9,7 +9,7 @@ AtomTupleNode::AtomTupleNode(
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right,
                             std::shared_ptr<Token> op2
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::AtomTuple)
 {
     mOp1 = op1;
     mRight = right;
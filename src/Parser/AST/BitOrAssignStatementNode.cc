@@ -9,7 +9,7 @@ BitOrAssignStatementNode::BitOrAssignStatementNode(
                             std::shared_ptr<Node> left,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::BitOrAssignStatement)
 {
     mLeft = left;
     mOp1 = op1;
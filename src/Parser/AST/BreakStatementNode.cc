@@ -7,7 +7,7 @@ using namespace PythonCoreNative::RunTime::Parser;
 BreakStatementNode::BreakStatementNode(  
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<Token> op1
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::BreakStatement)
 {
     mOp1 = op1;
 }
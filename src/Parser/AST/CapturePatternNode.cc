@@ -7,7 +7,7 @@ using namespace PythonCoreNative::RunTime::Parser;
 CapturePatternNode::CapturePatternNode(  
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<NameToken> op1
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::CapturePattern)
 {
     
     mOp1 = op1;
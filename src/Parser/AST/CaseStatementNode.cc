@@ -11,7 +11,7 @@ CaseStatementNode::CaseStatementNode(
                             std::shared_ptr<StatementNode> right,
                             std::shared_ptr<Token> op2,
                             std::shared_ptr<StatementNode> next
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::CaseStatement)
 {
     mLeft = left;
     mOp1 = op1;
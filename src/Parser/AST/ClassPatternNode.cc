@@ -14,7 +14,7 @@ ClassPatternNode::ClassPatternNode(
                             std::shared_ptr<AST::StatementNode> keywords,
                             std::shared_ptr<Token> secondComma,
                             std::shared_ptr<Token> closeCurly
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::ClassPattern)
 {
     
     mNodes = nodes;
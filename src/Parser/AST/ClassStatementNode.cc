@@ -13,7 +13,7 @@ ClassStatementNode::ClassStatementNode(
                             std::shared_ptr<Token> op4,
                             std::shared_ptr<Token> op5,
                             std::shared_ptr<StatementNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::ClassStatement)
 {
     mOp1 = op1;
     mOp2 = op2;
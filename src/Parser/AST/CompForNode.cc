@@ -8,7 +8,7 @@ CompForNode::CompForNode(
                             unsigned int start, unsigned int end,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::CompFor)
 {
     mOp1 = op1;
     mRight = right;
@@ -9,7 +9,7 @@ CompIfNode::CompIfNode(
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right,
                             std::shared_ptr<ExpressionNode> next
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::CompIf)
 {
     mOp1 = op1;
     mRight = right;
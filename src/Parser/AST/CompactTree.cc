@@ -0,0 +1,347 @@
+
+#include <ast/CompactTree.h>
+#include <ast/NodeVisitor.h>
+
+#include <algorithm>
+#include <unordered_map>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+CompactTree::CompactTree(std::shared_ptr<std::wstring> source)
+{
+    mSource = source;
+    mSourceMemoryUsage = 0;
+}
+
+unsigned int CompactTree::OpenNode(NodeKind kind)
+{
+    auto index = static_cast<unsigned int>(mNodes.size());
+    auto tokens = static_cast<unsigned int>(mTokens.size());
+
+    mNodes.push_back( { kind, 0, tokens, tokens - 1, NoIndex, NoIndex } );
+    mLastChild.push_back(NoIndex);
+
+    if (!mOpenNodes.empty())
+    {
+        auto parent = mOpenNodes.back();
+        if (mLastChild[parent] == NoIndex) mNodes[parent].mFirstChild = index;
+        else mNodes[mLastChild[parent]].mNextSibling = index;
+        mLastChild[parent] = index;
+    }
+
+    mOpenNodes.push_back(index);
+    return index;
+}
+
+unsigned int CompactTree::AddToken(TokenKind kind, unsigned int start, unsigned int end)
+{
+    mTokens.push_back( { kind, start, end } );
+    return static_cast<unsigned int>(mTokens.size() - 1);
+}
+
+void CompactTree::CloseNode(unsigned int index)
+{
+    mNodes[index].mLastToken = static_cast<unsigned int>(mTokens.size()) - 1;
+    mOpenNodes.pop_back();
+
+    if (mOpenNodes.empty())
+    {
+        /* Builder state is only needed while nodes are still open. */
+        mLastChild.clear();
+        mLastChild.shrink_to_fit();
+    }
+}
+
+unsigned int CompactTree::Root()
+{
+    return mNodes.empty() ? NoIndex : 0;
+}
+
+unsigned int CompactTree::NodeCount()
+{
+    return static_cast<unsigned int>(mNodes.size());
+}
+
+unsigned int CompactTree::TokenCount()
+{
+    return static_cast<unsigned int>(mTokens.size());
+}
+
+const CompactNode & CompactTree::GetNode(unsigned int index)
+{
+    return mNodes[index];
+}
+
+const CompactToken & CompactTree::GetToken(unsigned int index)
+{
+    return mTokens[index];
+}
+
+unsigned int CompactTree::GetFirstChild(unsigned int index)
+{
+    return mNodes[index].mFirstChild;
+}
+
+unsigned int CompactTree::GetNextSibling(unsigned int index)
+{
+    return mNodes[index].mNextSibling;
+}
+
+unsigned int CompactTree::GetChildCount(unsigned int index)
+{
+    unsigned int count = 0;
+    for (auto child = mNodes[index].mFirstChild; child != NoIndex; child = mNodes[child].mNextSibling) count++;
+    return count;
+}
+
+unsigned int CompactTree::GetStart(unsigned int index)
+{
+    auto &node = mNodes[index];
+    if (node.mLastToken + 1 == node.mFirstToken) return 0;
+    return mTokens[node.mFirstToken].mStart;
+}
+
+unsigned int CompactTree::GetEnd(unsigned int index)
+{
+    auto &node = mNodes[index];
+    if (node.mLastToken + 1 == node.mFirstToken) return 0;
+    return mTokens[node.mLastToken].mEnd;
+}
+
+std::wstring CompactTree::GetTokenText(unsigned int index)
+{
+    auto &token = mTokens[index];
+    if (!mSource || token.mEnd > mSource->size() || token.mStart > token.mEnd) return std::wstring();
+    return mSource->substr(token.mStart, token.mEnd - token.mStart);
+}
+
+std::shared_ptr<std::wstring> CompactTree::GetSource()
+{
+    return mSource;
+}
+
+/* Token text is sliced out of the source, so the source counts as well even
+   when another owner shares it. */
+std::size_t CompactTree::MemoryUsage()
+{
+    return  sizeof(CompactTree) +
+            mNodes.capacity() * sizeof(CompactNode) +
+            mTokens.capacity() * sizeof(CompactToken) +
+            mOpenNodes.capacity() * sizeof(unsigned int) +
+            mLastChild.capacity() * sizeof(unsigned int) +
+            (mSource ? sizeof(std::wstring) + mSource->capacity() * sizeof(wchar_t) : 0);
+}
+
+/* Estimated heap footprint of the pointer based tree this was built from,
+   zero when built by hand. */
+std::size_t CompactTree::SourceMemoryUsage()
+{
+    return mSourceMemoryUsage;
+}
+
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    /* Walks a pointer based tree and emits it into a CompactTree. Children are
+       taken from the node accessors and ordered by their first source position,
+       so separators stored apart from the items they follow interleave again. Both
+       walks keep their own stack, long operator chains nest as deep as they are long. */
+    class CompactTreeWriter
+    {
+        public:
+            CompactTreeWriter(CompactTree &tree) : mTree(tree), mCounting(false) {}
+
+            void Write(std::shared_ptr<Node> root)
+            {
+                std::vector<Frame> stack;
+                Open(root, stack);
+
+                while (!stack.empty())
+                {
+                    auto &frame = stack.back();
+
+                    if (frame.mNext == frame.mChildren.size())
+                    {
+                        mTree.CloseNode(frame.mIndex);
+                        stack.pop_back();
+                        continue;
+                    }
+
+                    auto &child = frame.mChildren[frame.mNext++];
+
+                    if (child.mNode) Open(child.mNode, stack);
+                    else WriteToken(child.mToken);
+                }
+            }
+
+        protected:
+            static const std::size_t ControlBlockSize = 16;
+
+            struct Child
+            {
+                unsigned int mPosition;
+                std::shared_ptr<Node> mNode;
+                std::shared_ptr<Token> mToken;
+            };
+
+            /* Open node, its ordered children and the next of them to write. */
+            struct Frame
+            {
+                unsigned int mIndex;
+                std::vector<Child> mChildren;
+                std::size_t mNext;
+            };
+
+            void Open(std::shared_ptr<Node> node, std::vector<Frame> &stack)
+            {
+                std::vector<Child> children;
+                mCounting = true;
+                Collect(node, children);
+                mCounting = false;
+                Order(children);
+
+                auto index = mTree.OpenNode(node->GetKind());
+                stack.push_back( { index, std::move(children), 0 } );
+            }
+
+            void Add(std::vector<Child> &children, std::shared_ptr<Node> node)
+            {
+                if (node) children.push_back( { 0, node, nullptr } );
+            }
+
+            void Add(std::vector<Child> &children, std::shared_ptr<Token> token)
+            {
+                if (token) children.push_back( { token->GetTokenStartPosition(), nullptr, token } );
+            }
+
+            template <typename T>
+            void Add(std::vector<Child> &children, std::shared_ptr<std::vector<std::shared_ptr<T>>> nodes)
+            {
+                if (!nodes) return;
+                if (mCounting) mTree.mSourceMemoryUsage += sizeof(std::vector<std::shared_ptr<T>>) + ControlBlockSize + nodes->capacity() * sizeof(std::shared_ptr<T>);
+                for (auto &element : *nodes) Add(children, element);
+            }
+
+            void Order(std::vector<Child> &children)
+            {
+                for (auto &child : children)
+                    if (child.mNode) child.mPosition = FirstPosition(child.mNode);
+
+                std::stable_sort(children.begin(), children.end(),
+                    [](const Child &a, const Child &b) { return a.mPosition < b.mPosition; });
+            }
+
+            /* Smallest token position in the subtree, children first. */
+            unsigned int FirstPosition(std::shared_ptr<Node> node)
+            {
+                std::vector<std::pair<std::shared_ptr<Node>, bool>> stack { { node, false } };
+
+                while (!stack.empty())
+                {
+                    auto current = stack.back().first;
+
+                    if (mFirstPositions.count(current.get()) != 0)
+                    {
+                        stack.pop_back();
+                        continue;
+                    }
+
+                    std::vector<Child> children;
+                    Collect(current, children);
+
+                    if (!stack.back().second)
+                    {
+                        stack.back().second = true;
+                        for (auto &child : children)
+                            if (child.mNode && mFirstPositions.count(child.mNode.get()) == 0) stack.emplace_back(child.mNode, false);
+                        continue;
+                    }
+
+                    stack.pop_back();
+
+                    unsigned int position = CompactTree::NoIndex;
+                    for (auto &child : children)
+                    {
+                        auto childPosition = child.mNode ? mFirstPositions[child.mNode.get()] : child.mPosition;
+                        if (childPosition < position) position = childPosition;
+                    }
+
+                    mFirstPositions[current.get()] = position;
+                }
+
+                return mFirstPositions[node.get()];
+            }
+
+            void WriteToken(std::shared_ptr<Token> token)
+            {
+                mTree.AddToken(token->GetSymbolKind(), token->GetTokenStartPosition(), token->GetTokenEndPosition());
+
+                std::shared_ptr<const std::wstring> text;
+                switch (token->GetSymbolKind())
+                {
+                    case TokenKind::Name:
+                        text = std::static_pointer_cast<NameToken>(token)->GetText();
+                        mTree.mSourceMemoryUsage += sizeof(NameToken);
+                        break;
+                    case TokenKind::Number:
+                        text = std::static_pointer_cast<NumberToken>(token)->GetText();
+                        mTree.mSourceMemoryUsage += sizeof(NumberToken);
+                        break;
+                    case TokenKind::String:
+                        text = std::static_pointer_cast<StringToken>(token)->GetText();
+                        mTree.mSourceMemoryUsage += sizeof(StringToken);
+                        break;
+                    case TokenKind::TypeComment:
+                        text = std::static_pointer_cast<TypeCommentToken>(token)->GetTypeCommentText();
+                        mTree.mSourceMemoryUsage += sizeof(TypeCommentToken);
+                        break;
+                    default:
+                        mTree.mSourceMemoryUsage += sizeof(Token);
+                        break;
+                }
+                mTree.mSourceMemoryUsage += ControlBlockSize;
+
+                if (text) mTree.mSourceMemoryUsage += sizeof(std::wstring) + ControlBlockSize + text->capacity() * sizeof(wchar_t);
+
+                auto trivia = token->GetTriviaList();
+                if (trivia) mTree.mSourceMemoryUsage += sizeof(*trivia) + ControlBlockSize + trivia->capacity() * (sizeof(std::shared_ptr<Trivia>) + sizeof(Trivia) + ControlBlockSize);
+            }
+
+            void Collect(std::shared_ptr<Node> node, std::vector<Child> &children)
+            {
+                ForEachChild(node, [this, &children](auto child) { Add(children, child); });
+
+                if (mCounting) mTree.mSourceMemoryUsage += NodeSize().Visit(node) + ControlBlockSize;
+            }
+
+            class NodeSize : public NodeVisitor<NodeSize, std::size_t>
+            {
+                public:
+                    template <typename T>
+                    std::size_t VisitDefault(std::shared_ptr<T> node)
+                    {
+                        return sizeof(T);
+                    }
+            };
+
+            CompactTree &mTree;
+            bool mCounting;
+            std::unordered_map<Node *, unsigned int> mFirstPositions;
+    };
+}
+
+std::shared_ptr<CompactTree> CompactTree::FromNode(std::shared_ptr<Node> root, std::shared_ptr<std::wstring> source)
+{
+    auto tree = std::make_shared<CompactTree>(source);
+    if (root)
+    {
+        CompactTreeWriter writer(*tree);
+        writer.Write(root);
+        tree->mNodes.shrink_to_fit();
+        tree->mTokens.shrink_to_fit();
+        tree->mOpenNodes.shrink_to_fit();
+    }
+    return tree;
+}
@@ -9,7 +9,7 @@ CompareEqualNode::CompareEqualNode(
                             std::shared_ptr<ExpressionNode> left,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::CompareEqual)
 {
     mLeft = left;
     mOp1 = op1;
@@ -9,7 +9,7 @@ CompareGreaterEqualNode::CompareGreaterEqualNode(
                             std::shared_ptr<ExpressionNode> left,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::CompareGreaterEqual)
 {
     mLeft = left;
     mOp1 = op1;
@@ -9,7 +9,7 @@ CompareGreaterNode::CompareGreaterNode(
                             std::shared_ptr<ExpressionNode> left,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::CompareGreater)
 {
     mLeft = left;
     mOp1 = op1;
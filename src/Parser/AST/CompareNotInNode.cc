@@ -10,7 +10,7 @@ CompareNotInNode::CompareNotInNode(
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<Token> op2,
                             std::shared_ptr<ExpressionNode> right
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::CompareNotIn)
 {
     mLeft = left;
     mOp1 = op1;
@@ -10,7 +10,7 @@ ComplexNumberNode::ComplexNumberNode(
                             std::shared_ptr<NumberToken> real,
                             std::shared_ptr<Token> op2,
                             std::shared_ptr<NumberToken> imaginary
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::ComplexNumber)
 {
     
     mRealSign = op1;
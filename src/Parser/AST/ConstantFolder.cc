@@ -0,0 +1,565 @@
+#include <ast/ConstantFolder.h>
+#include <ast/NodeVisitor.h>
+#include <FloatConversion.h>
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+static bool IsInt(const FoldedValue &value)
+{
+    return value.mKind == FoldedKind::Integer || value.mKind == FoldedKind::Bool;
+}
+
+static bool IsNumber(const FoldedValue &value)
+{
+    return IsInt(value) || value.mKind == FoldedKind::Float;
+}
+
+static double ToDouble(const FoldedValue &value)
+{
+    return value.mKind == FoldedKind::Float ? value.mReal : static_cast<double>(value.mInteger);
+}
+
+static FoldedValue Make(FoldedKind kind, std::int64_t integer = 0, double real = 0.0)
+{
+    return { kind, integer, real, {}, 0 };
+}
+
+static FoldedValue Integer(std::int64_t value)     { return Make(FoldedKind::Integer, value); }
+static FoldedValue Float(double value)             { return Make(FoldedKind::Float, 0, value); }
+static FoldedValue Bool(bool value)                { return Make(FoldedKind::Bool, value ? 1 : 0); }
+
+/* Characters between the quotes. The token text holds them followed by the closing
+   quotes, as many characters as the prefix and opening quotes take, and is empty for
+   an empty string. */
+static std::size_t ContentLength(std::shared_ptr<StringToken> token)
+{
+    auto size = token->GetText()->size();
+    auto span = token->GetTokenEndPosition() - token->GetTokenStartPosition();
+
+    return 2 * size > span ? 2 * size - span : 0;
+}
+
+static bool Truth(const FoldedValue &value, bool &truth)
+{
+    switch (value.mKind)
+    {
+        case FoldedKind::None:      truth = false; return true;
+        case FoldedKind::Bool:
+        case FoldedKind::Integer:   truth = value.mInteger != 0; return true;
+        case FoldedKind::Float:     truth = value.mReal != 0.0; return true;
+        default:                    break;
+    }
+
+    if (value.mLength == 0)
+    {
+        truth = false;
+        return true;
+    }
+
+    /* Only line continuations decode to nothing, other characters always leave some. */
+    for (auto &token : value.mTokens)
+    {
+        auto &text = *token->GetText();
+        auto length = ContentLength(token);
+
+        for (std::size_t i = 0; i < length; i++)
+            if (text[i] != L'\\' && text[i] != L'\n' && text[i] != L'\r')
+            {
+                truth = true;
+                return true;
+            }
+    }
+
+    return false;
+}
+
+/* Python's float floor division and modulo, as CPython computes them. */
+static void FloatDivMod(double x, double y, double &quotient, double &remainder)
+{
+    auto mod = std::fmod(x, y);
+    auto div = (x - mod) / y;
+
+    if (mod != 0.0)
+    {
+        if ((y < 0) != (mod < 0))
+        {
+            mod += y;
+            div -= 1.0;
+        }
+    }
+    else mod = std::copysign(0.0, y);
+
+    if (div != 0.0)
+    {
+        quotient = std::floor(div);
+        if (div - quotient > 0.5) quotient += 1.0;
+    }
+    else quotient = std::copysign(0.0, x / y);
+
+    remainder = mod;
+}
+
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    /* Post-order, so the operands of an expression are folded when it is left. */
+    class ConstantFolderWalker : public NodeWalker<ConstantFolderWalker>
+    {
+        public:
+            ConstantFolderWalker(ConstantFolder &folder) : mFolder(folder) {}
+
+            void Leave(std::shared_ptr<Node> node)
+            {
+                switch (node->GetKind())
+                {
+                    case NodeKind::AtomNumber:
+                        Number(node, std::static_pointer_cast<AtomNumberNode>(node)->GetNumberText());
+                        break;
+
+                    case NodeKind::AtomString:
+                        String(node, *std::static_pointer_cast<AtomStringNode>(node)->GetStringNodes());
+                        break;
+
+                    case NodeKind::AtomTrue:    mFolder.mValues[node.get()] = Bool(true); break;
+                    case NodeKind::AtomFalse:   mFolder.mValues[node.get()] = Bool(false); break;
+                    case NodeKind::AtomNone:    mFolder.mValues[node.get()] = Make(FoldedKind::None); break;
+
+                    case NodeKind::AtomTuple:
+                        {
+                            /* A parenthesized expression holds it directly, tuples hold a list. */
+                            auto value = Value(std::static_pointer_cast<AtomTupleNode>(node)->GetRight());
+                            if (value != nullptr) Fold(node, *value);
+                        }
+                        break;
+
+                    case NodeKind::UnaryMinus:      Unary(node, std::static_pointer_cast<UnaryMinusNode>(node)->GetRight()); break;
+                    case NodeKind::UnaryPlus:       Unary(node, std::static_pointer_cast<UnaryPlusNode>(node)->GetRight()); break;
+                    case NodeKind::UnaryBitInvert:  Unary(node, std::static_pointer_cast<UnaryBitInvertNode>(node)->GetRight()); break;
+                    case NodeKind::NotTest:         Unary(node, std::static_pointer_cast<NotTestNode>(node)->GetRight()); break;
+
+                    case NodeKind::Plus:        Binary<PlusNode>(node); break;
+                    case NodeKind::Minus:       Binary<MinusNode>(node); break;
+                    case NodeKind::Mul:         Binary<MulNode>(node); break;
+                    case NodeKind::Div:         Binary<DivNode>(node); break;
+                    case NodeKind::FloorDiv:    Binary<FloorDivNode>(node); break;
+                    case NodeKind::Modulo:      Binary<ModuloNode>(node); break;
+                    case NodeKind::Power:       Binary<PowerNode>(node); break;
+                    case NodeKind::ShiftLeft:   Binary<ShiftLeftNode>(node); break;
+                    case NodeKind::ShiftRight:  Binary<ShiftRightNode>(node); break;
+                    case NodeKind::BitAnd:      Binary<BitAndNode>(node); break;
+                    case NodeKind::BitOr:       Binary<BitOrNode>(node); break;
+                    case NodeKind::BitXor:      Binary<BitXorNode>(node); break;
+
+                    case NodeKind::AndTest:
+                        {
+                            auto n = std::static_pointer_cast<AndTestNode>(node);
+                            Select(node, n->GetLeftNode(), false, n->GetRightNode());
+                        }
+                        break;
+
+                    case NodeKind::OrTest:
+                        {
+                            auto n = std::static_pointer_cast<OrTestNode>(node);
+                            Select(node, n->GetLeft(), true, n->GetRight());
+                        }
+                        break;
+
+                    case NodeKind::Test:
+                        {
+                            auto n = std::static_pointer_cast<TestNode>(node);
+                            bool truth;
+
+                            if (n->GetNext() != nullptr && mFolder.GetTruth(n->GetRight().get(), truth))
+                                Replace(node, truth ? n->GetLeft() : n->GetNext());
+                        }
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+
+        protected:
+            const FoldedValue * Value(std::shared_ptr<Node> node)
+            {
+                return node == nullptr ? nullptr : mFolder.GetValue(node.get());
+            }
+
+            /* The node becomes a literal of the value over its own span. */
+            void Fold(std::shared_ptr<Node> node, FoldedValue value)
+            {
+                /* Infinities and NaN have no literal, and a power that overflows raises at run time. */
+                if (value.mKind == FoldedKind::Float && !std::isfinite(value.mReal)) return;
+
+                auto literal = Literal(node->GetStart(), node->GetEnd(), value);
+
+                mFolder.mValues[literal.get()] = value;
+                mFolder.mValues[node.get()] = std::move(value);
+                mFolder.mFolded[node.get()] = literal;
+            }
+
+            /* The node evaluates to the operand, a literal over the span of the node when
+               the operand is constant. */
+            void Replace(std::shared_ptr<Node> node, std::shared_ptr<Node> operand)
+            {
+                auto value = Value(operand);
+
+                if (value != nullptr) Fold(node, *value);
+                else mFolder.mFolded[node.get()] = mFolder.Resolve(operand);
+            }
+
+            /* 'and' evaluates to its left operand when that is false, 'or' when it is true. */
+            void Select(std::shared_ptr<Node> node, std::shared_ptr<Node> left, bool stopsOn, std::shared_ptr<Node> right)
+            {
+                bool truth;
+                if (mFolder.GetTruth(left.get(), truth)) Replace(node, truth == stopsOn ? left : right);
+            }
+
+            static std::shared_ptr<std::vector<std::shared_ptr<Trivia>>> NoTrivia()
+            {
+                return std::make_shared<std::vector<std::shared_ptr<Trivia>>>();
+            }
+
+            static std::shared_ptr<ExpressionNode> Literal(unsigned int start, unsigned int end, const FoldedValue &value)
+            {
+                switch (value.mKind)
+                {
+                    case FoldedKind::None:
+                        return std::make_shared<AtomNoneNode>(start, end, std::make_shared<Token>(start, end, TokenKind::PyNone, NoTrivia()));
+
+                    case FoldedKind::Bool:
+                        if (value.mInteger != 0) return std::make_shared<AtomTrueNode>(start, end, std::make_shared<Token>(start, end, TokenKind::PyTrue, NoTrivia()));
+                        return std::make_shared<AtomFalseNode>(start, end, std::make_shared<Token>(start, end, TokenKind::PyFalse, NoTrivia()));
+
+                    case FoldedKind::Integer:
+                        return std::make_shared<AtomNumberNode>(start, end,
+                                    std::make_shared<NumberToken>(start, end, false, false, std::make_shared<std::wstring>(std::to_wstring(value.mInteger)), NoTrivia()));
+
+                    case FoldedKind::Float:
+                        return std::make_shared<AtomNumberNode>(start, end,
+                                    std::make_shared<NumberToken>(start, end, false, true, std::make_shared<std::wstring>(FloatConversion::Repr(value.mReal)), NoTrivia()));
+
+                    default:
+                        return std::make_shared<AtomStringNode>(start, end, std::make_shared<std::vector<std::shared_ptr<StringToken>>>(value.mTokens));
+                }
+            }
+
+            void Number(std::shared_ptr<Node> node, std::shared_ptr<NumberToken> token)
+            {
+                if (token->IsImaginaryNumber()) return;
+
+                std::wstring text;
+                for (auto ch : *token->GetText()) if (ch != L'_') text.push_back(ch);
+
+                if (token->IsRealNumber())
+                {
+                    double real = 0.0;
+                    FloatConversion::Parse(text, real);
+                    mFolder.mValues[node.get()] = Float(real);
+                    return;
+                }
+
+                unsigned int base = 10;
+                std::size_t index = 0;
+
+                if (text.size() > 1 && text[0] == L'0')
+                {
+                    switch (text[1])
+                    {
+                        case L'x': case L'X': base = 16; index = 2; break;
+                        case L'o': case L'O': base = 8; index = 2; break;
+                        case L'b': case L'B': base = 2; index = 2; break;
+                        default: break;
+                    }
+                }
+
+                std::uint64_t value = 0;
+
+                for (; index < text.size(); index++)
+                {
+                    auto ch = text[index];
+                    unsigned int digit = ch <= L'9' ? ch - L'0' : (ch | 0x20) - L'a' + 10;
+
+                    /* Beyond 64 bits the literal stays for the compiler to handle. */
+                    if (value > (static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) - digit) / base) return;
+
+                    value = value * base + digit;
+                }
+
+                mFolder.mValues[node.get()] = Integer( static_cast<std::int64_t>(value) );
+            }
+
+            void String(std::shared_ptr<Node> node, const std::vector<std::shared_ptr<StringToken>> &tokens)
+            {
+                FoldedValue value = Make(FoldedKind::String);
+
+                for (auto &token : tokens)
+                {
+                    if (token->IsFormated()) return;
+                    value.mLength += ContentLength(token);
+                }
+
+                value.mTokens = tokens;
+                mFolder.mValues[node.get()] = std::move(value);
+            }
+
+            void Unary(std::shared_ptr<Node> node, std::shared_ptr<Node> operand)
+            {
+                auto value = Value(operand);
+                if (value == nullptr) return;
+
+                switch (node->GetKind())
+                {
+                    case NodeKind::NotTest:
+                        {
+                            bool truth;
+                            if (Truth(*value, truth)) Fold(node, Bool(!truth));
+                        }
+                        break;
+
+                    case NodeKind::UnaryMinus:
+                        if (value->mKind == FoldedKind::Float) Fold(node, Float(-value->mReal));
+                        else if (IsInt(*value) && value->mInteger != std::numeric_limits<std::int64_t>::min()) Fold(node, Integer(-value->mInteger));
+                        break;
+
+                    case NodeKind::UnaryPlus:
+                        if (value->mKind == FoldedKind::Float) Fold(node, *value);
+                        else if (IsInt(*value)) Fold(node, Integer(value->mInteger));
+                        break;
+
+                    default:
+                        if (IsInt(*value)) Fold(node, Integer(~value->mInteger));
+                        break;
+                }
+            }
+
+            template <typename T>
+            void Binary(std::shared_ptr<Node> node)
+            {
+                auto n = std::static_pointer_cast<T>(node);
+                auto left = Value(n->GetLeft()), right = Value(n->GetRight());
+                FoldedValue result;
+
+                if (left != nullptr && right != nullptr && Compute(node->GetKind(), *left, *right, result)) Fold(node, std::move(result));
+            }
+
+            static bool Compute(NodeKind kind, const FoldedValue &a, const FoldedValue &b, FoldedValue &result)
+            {
+                if (a.mKind == FoldedKind::String || b.mKind == FoldedKind::String) return Text(kind, a, b, result);
+                if (!IsNumber(a) || !IsNumber(b)) return false;
+
+                if (a.mKind == FoldedKind::Float || b.mKind == FoldedKind::Float) return Real(kind, ToDouble(a), ToDouble(b), result);
+                return Whole(kind, a, b, result);
+            }
+
+            static bool Text(NodeKind kind, const FoldedValue &a, const FoldedValue &b, FoldedValue &result)
+            {
+                if (kind == NodeKind::Plus && a.mKind == FoldedKind::String && b.mKind == FoldedKind::String)
+                {
+                    if (a.mLength + b.mLength > ConstantFolder::MaxStringLength ||
+                        a.mTokens.size() + b.mTokens.size() > ConstantFolder::MaxStringTokens) return false;
+
+                    result = Make(FoldedKind::String);
+                    result.mTokens = a.mTokens;
+                    result.mTokens.insert(result.mTokens.end(), b.mTokens.begin(), b.mTokens.end());
+                    result.mLength = a.mLength + b.mLength;
+                    return true;
+                }
+
+                if (kind != NodeKind::Mul) return false;
+
+                auto &text = a.mKind == FoldedKind::String ? a : b;
+                auto &count = a.mKind == FoldedKind::String ? b : a;
+
+                if (!IsInt(count)) return false;
+
+                auto times = count.mInteger < 0 ? 0 : count.mInteger;
+
+                if (times > 0 && (text.mLength > ConstantFolder::MaxStringLength / times ||
+                                  text.mTokens.size() > ConstantFolder::MaxStringTokens / times)) return false;
+
+                result = Make(FoldedKind::String);
+                for (std::int64_t i = 0; i < times; i++) result.mTokens.insert(result.mTokens.end(), text.mTokens.begin(), text.mTokens.end());
+                result.mLength = text.mLength * static_cast<std::size_t>(times);
+                return true;
+            }
+
+            static bool Real(NodeKind kind, double x, double y, FoldedValue &result)
+            {
+                double quotient, remainder;
+
+                switch (kind)
+                {
+                    case NodeKind::Plus:    result = Float(x + y); return true;
+                    case NodeKind::Minus:   result = Float(x - y); return true;
+                    case NodeKind::Mul:     result = Float(x * y); return true;
+
+                    case NodeKind::Div:
+                        if (y == 0.0) return false;
+                        result = Float(x / y);
+                        return true;
+
+                    case NodeKind::FloorDiv:
+                    case NodeKind::Modulo:
+                        if (y == 0.0) return false;
+                        FloatDivMod(x, y, quotient, remainder);
+                        result = Float(kind == NodeKind::FloorDiv ? quotient : remainder);
+                        return true;
+
+                    case NodeKind::Power:
+                        {
+                            /* Zero to a negative power raises, a negative base to a fraction is complex. */
+                            if (x == 0.0 && y < 0.0) return false;
+                            if (x < 0.0 && std::isfinite(y) && y != std::floor(y)) return false;
+
+                            result = Float( std::pow(x, y) );
+                            return true;
+                        }
+
+                    default:
+                        return false;
+                }
+            }
+
+            static bool Whole(NodeKind kind, const FoldedValue &a, const FoldedValue &b, FoldedValue &result)
+            {
+                auto x = a.mInteger, y = b.mInteger;
+                std::int64_t r;
+
+                /* Integer true division is exact rounding, which doubles give below 2**53. */
+                constexpr std::int64_t Exact = std::int64_t(1) << 53;
+
+                switch (kind)
+                {
+                    case NodeKind::Plus:
+                        if (__builtin_add_overflow(x, y, &r)) return false;
+                        break;
+
+                    case NodeKind::Minus:
+                        if (__builtin_sub_overflow(x, y, &r)) return false;
+                        break;
+
+                    case NodeKind::Mul:
+                        if (__builtin_mul_overflow(x, y, &r)) return false;
+                        break;
+
+                    case NodeKind::Div:
+                        if (y == 0 || x > Exact || x < -Exact || y > Exact || y < -Exact) return false;
+                        result = Float( static_cast<double>(x) / static_cast<double>(y) );
+                        return true;
+
+                    case NodeKind::FloorDiv:
+                    case NodeKind::Modulo:
+                        {
+                            if (y == 0 || (x == std::numeric_limits<std::int64_t>::min() && y == -1)) return false;
+
+                            auto quotient = x / y, remainder = x % y;
+                            if (remainder != 0 && ((remainder < 0) != (y < 0)))
+                            {
+                                quotient--;
+                                remainder += y;
+                            }
+
+                            r = kind == NodeKind::FloorDiv ? quotient : remainder;
+                        }
+                        break;
+
+                    case NodeKind::Power:
+                        if (y < 0)
+                        {
+                            if (x == 0) return false;
+                            return Real(kind, static_cast<double>(x), static_cast<double>(y), result);
+                        }
+
+                        r = 1;
+
+                        while (y > 0)
+                        {
+                            if ((y & 1) && __builtin_mul_overflow(r, x, &r)) return false;
+                            y >>= 1;
+                            if (y > 0 && __builtin_mul_overflow(x, x, &x)) return false;
+                        }
+                        break;
+
+                    case NodeKind::ShiftLeft:
+                        if (y < 0) return false;
+                        if (x == 0) r = 0;
+                        else
+                        {
+                            if (y >= 63) return false;
+                            r = static_cast<std::int64_t>(static_cast<std::uint64_t>(x) << y);
+                            if ((r >> y) != x) return false;
+                        }
+                        break;
+
+                    case NodeKind::ShiftRight:
+                        if (y < 0) return false;
+                        r = y >= 63 ? (x < 0 ? -1 : 0) : x >> y;
+                        break;
+
+                    case NodeKind::BitAnd:
+                    case NodeKind::BitOr:
+                    case NodeKind::BitXor:
+                        r = kind == NodeKind::BitAnd ? (x & y) : kind == NodeKind::BitOr ? (x | y) : (x ^ y);
+
+                        /* Bits of two bools are a bool. */
+                        if (a.mKind == FoldedKind::Bool && b.mKind == FoldedKind::Bool)
+                        {
+                            result = Bool(r != 0);
+                            return true;
+                        }
+                        break;
+
+                    default:
+                        return false;
+                }
+
+                result = Integer(r);
+                return true;
+            }
+
+            ConstantFolder &mFolder;
+    };
+}
+
+
+std::shared_ptr<ConstantFolder> ConstantFolder::Fold(std::shared_ptr<Node> root)
+{
+    auto folder = std::make_shared<ConstantFolder>();
+
+    ConstantFolderWalker walker(*folder);
+    walker.Walk(root);
+
+    return folder;
+}
+
+std::shared_ptr<Node> ConstantFolder::Resolve(std::shared_ptr<Node> node)
+{
+    if (node == nullptr) return node;
+
+    auto it = mFolded.find(node.get());
+    return it == mFolded.end() ? node : it->second;
+}
+
+const FoldedValue * ConstantFolder::GetValue(Node *node)
+{
+    auto it = mValues.find(node);
+    return it == mValues.end() ? nullptr : &it->second;
+}
+
+bool ConstantFolder::GetTruth(Node *node, bool &truth)
+{
+    auto value = GetValue(node);
+    return value != nullptr && Truth(*value, truth);
+}
+
+std::size_t ConstantFolder::GetFoldedCount()
+{
+    return mFolded.size();
+}
@@ -7,7 +7,7 @@ using namespace PythonCoreNative::RunTime::Parser;
 ContinueStatementNode::ContinueStatementNode(  
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<Token> op1
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::ContinueStatement)
 {
     mOp1 = op1;
 }
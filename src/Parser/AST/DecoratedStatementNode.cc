@@ -7,7 +7,7 @@ DecoratedStatementNode::DecoratedStatementNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<StatementNode> left,
                             std::shared_ptr<StatementNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::DecoratedStatement)
 {
     mLeft = left;
     mRight = right;
@@ -12,7 +12,7 @@ DecoratorStatementNode::DecoratorStatementNode(
                             std::shared_ptr<ExpressionNode> right,
                             std::shared_ptr<Token> op3,
                             std::shared_ptr<Token> op4
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::DecoratorStatement)
 {
     mOp1 = op1;
     mOp2 = op2;
@@ -8,7 +8,7 @@ DelStatementNode::DelStatementNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::DelStatement)
 {
     mOp1 = op1;
     mRight = right;
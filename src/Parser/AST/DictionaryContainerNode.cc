@@ -8,7 +8,7 @@ DictionaryContainerNode::DictionaryContainerNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<std::vector<std::shared_ptr<ExpressionNode>>> entries,
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> separators
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::DictionaryContainer)
 {
     mEntries = entries;
     mSeparators = separators;
@@ -9,7 +9,7 @@ DictionaryEntryNode::DictionaryEntryNode(
                             std::shared_ptr<ExpressionNode> key,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> value
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::DictionaryEntry)
 {
     mOp1 = op1;
     mKey = key;
@@ -8,7 +8,7 @@ DictionaryKWEntryNode::DictionaryKWEntryNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> value
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::DictionaryKWEntry)
 {
     mOp1 = op1;
     mValue = value;
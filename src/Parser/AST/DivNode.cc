@@ -9,7 +9,7 @@ DivNode::DivNode(
                             std::shared_ptr<ExpressionNode> left,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::Div)
 {
     mOp1 = op1;
     mLeft = left;
@@ -8,7 +8,7 @@ DotNameNode::DotNameNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<NameToken> op2
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::DotName)
 {
     mOp1 = op1;
     mOp2 = op2;
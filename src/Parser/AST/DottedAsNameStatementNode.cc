@@ -9,7 +9,7 @@ DottedAsNameStatementNode::DottedAsNameStatementNode(
                             std::shared_ptr<StatementNode> left,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<NameToken> op2
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::DottedAsNameStatement)
 {
     mLeft = left;
     mOp1 = op1;
@@ -8,7 +8,7 @@ DottedAsNamesStatementNode::DottedAsNamesStatementNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<std::vector<std::shared_ptr<StatementNode>>> nodes,
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> separators
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::DottedAsNamesStatement)
 {
     mNodes = nodes;
     mSeparators = separators;
@@ -8,7 +8,7 @@ DottedNameStatementNode::DottedNameStatementNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<std::vector<std::shared_ptr<NameToken>>> nodes,
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> separators
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::DottedNameStatement)
 {
     mNodes = nodes;
     mSeparators = separators;
@@ -8,7 +8,7 @@ DoubleStarPatternNode::DoubleStarPatternNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<AST::StatementNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::DoubleStarPattern)
 {
     
     mOp1 = op1;
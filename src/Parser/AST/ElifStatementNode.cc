@@ -10,7 +10,7 @@ ElifStatementNode::ElifStatementNode(
                             std::shared_ptr<ExpressionNode> left,
                             std::shared_ptr<Token> op2,
                             std::shared_ptr<StatementNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::ElifStatement)
 {
     mOp1 = op1;
     mLeft = left;
@@ -9,7 +9,7 @@ ElseStatementNode::ElseStatementNode(
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<Token> op2,
                             std::shared_ptr<StatementNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::ElseStatement)
 {
     mOp1 = op1;
     mOp2 = op2;
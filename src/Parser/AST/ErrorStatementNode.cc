@@ -0,0 +1,18 @@
+
+#include <ast/ErrorStatementNode.h>
+
+using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
+
+ErrorStatementNode::ErrorStatementNode(  
+                            unsigned int start, unsigned int end,
+                            std::shared_ptr<std::vector<std::shared_ptr<Token>>> nodes
+                        ) : StatementNode(start, end, NodeKind::ErrorStatement)
+{
+    mNodes = nodes;
+}
+
+std::shared_ptr<std::vector<std::shared_ptr<Token>>> ErrorStatementNode::GetNodes()
+{
+    return mNodes;
+}
@@ -9,7 +9,7 @@ EvalInputNode::EvalInputNode(
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> newlines,
                             std::shared_ptr<ExpressionNode> right,
                             std::shared_ptr<Token> eof
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::EvalInput)
 {
     mNewlines = newlines;
     mRight = right;
@@ -10,7 +10,7 @@ ExceptClauseNode::ExceptClauseNode(
                             std::shared_ptr<ExpressionNode> left,
                             std::shared_ptr<Token> op2,
                             std::shared_ptr<NameToken> op3
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::ExceptClause)
 {
     mOp1 = op1;
     mOp2 = op2;
@@ -9,7 +9,7 @@ ExceptNode::ExceptNode(
                             std::shared_ptr<StatementNode> left,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<StatementNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::Except)
 {
     mOp1 = op1;
     mLeft = left;
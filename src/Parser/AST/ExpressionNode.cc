@@ -3,4 +3,4 @@
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
 
-ExpressionNode::ExpressionNode(unsigned int start, unsigned int end) : Node(start, end) {}
+ExpressionNode::ExpressionNode(unsigned int start, unsigned int end, NodeKind kind) : Node(start, end, kind) {}
@@ -9,7 +9,7 @@ FileInputNode::FileInputNode(
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> newlines,
                             std::shared_ptr<std::vector<std::shared_ptr<StatementNode>>> nodes,
                             std::shared_ptr<Token> eof
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::FileInput)
 {
     mNewlines = newlines;
     mNodes = nodes;
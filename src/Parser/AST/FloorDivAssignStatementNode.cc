@@ -9,7 +9,7 @@ FloorDivAssignStatementNode::FloorDivAssignStatementNode(
                             std::shared_ptr<Node> left,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::FloorDivAssignStatement)
 {
     mLeft = left;
     mOp1 = op1;
@@ -2,6 +2,7 @@
 #include <ast/ForStatementNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 ForStatementNode::ForStatementNode(  
                             unsigned int start, unsigned int end,
@@ -13,7 +14,7 @@ ForStatementNode::ForStatementNode(
                             std::shared_ptr<Token> op4,
                             std::shared_ptr<StatementNode> next,
                             std::shared_ptr<StatementNode> extra
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::ForStatement)
 {
     mOp1 = op1;
     mLeft = left;
@@ -24,3 +25,43 @@ ForStatementNode::ForStatementNode(
     mNext = next;
     mExtra = extra;
 }
+
+std::shared_ptr<Token> ForStatementNode::GetOperator1()
+{
+    return mOp1;
+}
+
+std::shared_ptr<ExpressionNode> ForStatementNode::GetLeft()
+{
+    return mLeft;
+}
+
+std::shared_ptr<Token> ForStatementNode::GetOperator2()
+{
+    return mOp2;
+}
+
+std::shared_ptr<ExpressionNode> ForStatementNode::GetRight()
+{
+    return mRight;
+}
+
+std::shared_ptr<Token> ForStatementNode::GetOperator3()
+{
+    return mOp3;
+}
+
+std::shared_ptr<Token> ForStatementNode::GetOperator4()
+{
+    return mOp4;
+}
+
+std::shared_ptr<StatementNode> ForStatementNode::GetNext()
+{
+    return mNext;
+}
+
+std::shared_ptr<StatementNode> ForStatementNode::GetExtra()
+{
+    return mExtra;
+}
@@ -2,6 +2,7 @@
 #include <ast/FuncDefStatementNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 FuncDefStatementNode::FuncDefStatementNode(  
                             unsigned int start, unsigned int end, 
@@ -13,7 +14,7 @@ FuncDefStatementNode::FuncDefStatementNode(
                             std::shared_ptr<Token> op4,
                             std::shared_ptr<Token> op5,
                             std::shared_ptr<StatementNode> next
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::FuncDefStatement)
 {
     mLeft = left;
     mRight = right;
@@ -23,4 +24,76 @@ FuncDefStatementNode::FuncDefStatementNode(
     mOp3 = op3;
     mOp4 = op4;
     mOp5 = op5;
+    mNextParsed = true;
+}
+
+FuncDefStatementNode::FuncDefStatementNode(  
+                            unsigned int start, unsigned int end, 
+                            std::shared_ptr<Token> op1,
+                            std::shared_ptr<Token> op2,
+                            std::shared_ptr<StatementNode> left,
+                            std::shared_ptr<Token> op3,
+                            std::shared_ptr<ExpressionNode> right,
+                            std::shared_ptr<Token> op4,
+                            std::shared_ptr<Token> op5,
+                            std::function<std::shared_ptr<StatementNode>()> nextThunk
+                        ) : FuncDefStatementNode(start, end, op1, op2, left, op3, right, op4, op5, std::shared_ptr<StatementNode>())
+{
+    mNextThunk = nextThunk;
+    mNextParsed = false;
+}
+
+std::shared_ptr<Token> FuncDefStatementNode::GetOperator1()
+{
+    return mOp1;
+}
+
+std::shared_ptr<Token> FuncDefStatementNode::GetOperator2()
+{
+    return mOp2;
+}
+
+std::shared_ptr<StatementNode> FuncDefStatementNode::GetLeft()
+{
+    return mLeft;
+}
+
+std::shared_ptr<Token> FuncDefStatementNode::GetOperator3()
+{
+    return mOp3;
+}
+
+std::shared_ptr<ExpressionNode> FuncDefStatementNode::GetRight()
+{
+    return mRight;
+}
+
+std::shared_ptr<Token> FuncDefStatementNode::GetOperator4()
+{
+    return mOp4;
+}
+
+std::shared_ptr<Token> FuncDefStatementNode::GetOperator5()
+{
+    return mOp5;
+}
+
+std::shared_ptr<StatementNode> FuncDefStatementNode::GetNext()
+{
+    if (!mNextParsed)
+    {
+        std::call_once(mNextOnce, [this]()
+        {
+            mNext = mNextThunk();
+            mNextThunk = nullptr;
+            mNextParsed = true;
+        });
+    }
+
+    return mNext;
+}
+
+bool FuncDefStatementNode::IsNextParsed()
+{
+    return mNextParsed;
 }
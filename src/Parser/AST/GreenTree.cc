@@ -0,0 +1,374 @@
+
+#include <ast/GreenTree.h>
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <utility>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+GreenToken::GreenToken(TokenKind kind, std::wstring fullText, unsigned int leadingWidth)
+{
+    mKind = kind;
+    mFullText = std::move(fullText);
+    mLeadingWidth = leadingWidth;
+}
+
+TokenKind GreenToken::GetKind() const
+{
+    return mKind;
+}
+
+unsigned int GreenToken::GetWidth() const
+{
+    return static_cast<unsigned int>(mFullText.size());
+}
+
+unsigned int GreenToken::GetLeadingWidth() const
+{
+    return mLeadingWidth;
+}
+
+const std::wstring & GreenToken::GetFullText() const
+{
+    return mFullText;
+}
+
+std::wstring_view GreenToken::GetText() const
+{
+    return std::wstring_view(mFullText).substr(mLeadingWidth);
+}
+
+
+unsigned int GreenChild::GetWidth() const
+{
+    return mNode != nullptr ? mNode->GetWidth() : mToken->GetWidth();
+}
+
+
+GreenNode::GreenNode(NodeKind kind, std::vector<GreenChild> children)
+{
+    mKind = kind;
+    mChildren = std::move(children);
+    mOffsets.reserve(mChildren.size());
+    mWidth = 0;
+
+    for (auto &child : mChildren)
+    {
+        mOffsets.push_back(mWidth);
+        mWidth += child.GetWidth();
+    }
+}
+
+namespace
+{
+    class GreenBuilder
+    {
+        public:
+            GreenBuilder(CompactTree &tree) : mTree(tree)
+            {
+                mSource = tree.GetSource();
+                mPosition = 0;
+            }
+
+            /* Children are stored in source order, the node's own tokens fill the gaps.
+               Runs on a stack of its own, long operator chains nest as deep as they are long. */
+            std::shared_ptr<const GreenNode> Build(unsigned int index)
+            {
+                std::vector<Frame> stack;
+                stack.push_back( { index, mTree.GetNode(index).mFirstChild, mTree.GetNode(index).mFirstToken, {} } );
+
+                while (true)
+                {
+                    auto &frame = stack.back();
+                    auto &node = mTree.GetNode(frame.mNode);
+
+                    if (frame.mChild != CompactTree::NoIndex)
+                    {
+                        auto child = frame.mChild;
+                        auto &childNode = mTree.GetNode(child);
+
+                        for (; frame.mToken < childNode.mFirstToken; frame.mToken++) frame.mChildren.push_back( { nullptr, MakeToken(frame.mToken) } );
+
+                        frame.mToken = childNode.mLastToken + 1;
+                        frame.mChild = mTree.GetNextSibling(child);
+                        stack.push_back( { child, childNode.mFirstChild, childNode.mFirstToken, {} } );
+                        continue;
+                    }
+
+                    for (; frame.mToken != node.mLastToken + 1; frame.mToken++) frame.mChildren.push_back( { nullptr, MakeToken(frame.mToken) } );
+
+                    auto green = std::make_shared<const GreenNode>(node.mKind, std::move(frame.mChildren));
+                    stack.pop_back();
+
+                    if (stack.empty()) return green;
+                    stack.back().mChildren.push_back( { std::move(green), nullptr } );
+                }
+            }
+
+        protected:
+            /* Node being built, its next child and the next of its own tokens. */
+            struct Frame
+            {
+                unsigned int mNode;
+                unsigned int mChild;
+                unsigned int mToken;
+                std::vector<GreenChild> mChildren;
+            };
+
+            /* Leading trivia is the text since the end of the previous token. Synthetic
+               tokens may overlap it and then get no trivia. */
+            std::shared_ptr<const GreenToken> MakeToken(unsigned int index)
+            {
+                auto &token = mTree.GetToken(index);
+                auto start = std::max(token.mStart, mPosition);
+                auto end = std::max(token.mEnd, start);
+                auto text = mSource->substr(mPosition, end - mPosition);
+                auto leading = start - mPosition;
+
+                mPosition = end;
+
+                auto &shared = mTokens[ { token.mKind, leading, text } ];
+                if (shared == nullptr) shared = std::make_shared<const GreenToken>(token.mKind, std::move(text), leading);
+
+                return shared;
+            }
+
+            CompactTree &mTree;
+            std::shared_ptr<std::wstring> mSource;
+            unsigned int mPosition;
+            std::map<std::tuple<TokenKind, unsigned int, std::wstring>, std::shared_ptr<const GreenToken>> mTokens;
+    };
+}
+
+std::shared_ptr<const GreenNode> GreenNode::FromCompactTree(CompactTree &tree)
+{
+    if (tree.Root() == CompactTree::NoIndex) return nullptr;
+
+    GreenBuilder builder(tree);
+    return builder.Build(tree.Root());
+}
+
+NodeKind GreenNode::GetKind() const
+{
+    return mKind;
+}
+
+unsigned int GreenNode::GetWidth() const
+{
+    return mWidth;
+}
+
+unsigned int GreenNode::GetChildCount() const
+{
+    return static_cast<unsigned int>(mChildren.size());
+}
+
+const GreenChild & GreenNode::GetChild(unsigned int index) const
+{
+    return mChildren[index];
+}
+
+unsigned int GreenNode::GetChildOffset(unsigned int index) const
+{
+    return mOffsets[index];
+}
+
+std::shared_ptr<const GreenNode> GreenNode::ReplaceChild(unsigned int index, GreenChild child) const
+{
+    auto children = mChildren;
+    children[index] = std::move(child);
+
+    return std::make_shared<const GreenNode>(mKind, std::move(children));
+}
+
+void GreenNode::WriteTo(std::wstring &text) const
+{
+    text.reserve(text.size() + mWidth);
+
+    std::vector<std::pair<const GreenNode *, unsigned int>> stack { { this, 0 } };
+
+    while (!stack.empty())
+    {
+        auto &top = stack.back();
+
+        if (top.second == top.first->mChildren.size())
+        {
+            stack.pop_back();
+            continue;
+        }
+
+        auto &child = top.first->mChildren[top.second++];
+
+        if (child.mNode != nullptr) stack.emplace_back(child.mNode.get(), 0);
+        else text += child.mToken->GetFullText();
+    }
+}
+
+
+RedToken::RedToken(std::shared_ptr<const GreenToken> green, std::shared_ptr<RedNode> parent, unsigned int index, unsigned int position)
+{
+    mGreen = green;
+    mParent = parent;
+    mIndex = index;
+    mPosition = position;
+}
+
+std::shared_ptr<const GreenToken> RedToken::GetGreen()
+{
+    return mGreen;
+}
+
+std::shared_ptr<RedNode> RedToken::GetParent()
+{
+    return mParent;
+}
+
+unsigned int RedToken::GetIndexInParent()
+{
+    return mIndex;
+}
+
+bool RedToken::IsMissing()
+{
+    return mGreen == nullptr;
+}
+
+TokenKind RedToken::GetKind()
+{
+    return mGreen->GetKind();
+}
+
+unsigned int RedToken::GetFullStart()
+{
+    return mPosition;
+}
+
+unsigned int RedToken::GetStart()
+{
+    return mPosition + mGreen->GetLeadingWidth();
+}
+
+unsigned int RedToken::GetEnd()
+{
+    return mPosition + mGreen->GetWidth();
+}
+
+std::wstring_view RedToken::GetText()
+{
+    return mGreen->GetText();
+}
+
+
+RedNode::RedNode(std::shared_ptr<const GreenNode> green, std::shared_ptr<RedNode> parent, unsigned int index, unsigned int position)
+{
+    mGreen = green;
+    mParent = parent;
+    mIndex = index;
+    mPosition = position;
+}
+
+std::shared_ptr<RedNode> RedNode::CreateRoot(std::shared_ptr<const GreenNode> green)
+{
+    return std::make_shared<RedNode>(green, nullptr, 0, 0);
+}
+
+std::shared_ptr<const GreenNode> RedNode::GetGreen()
+{
+    return mGreen;
+}
+
+std::shared_ptr<RedNode> RedNode::GetParent()
+{
+    return mParent;
+}
+
+unsigned int RedNode::GetIndexInParent()
+{
+    return mIndex;
+}
+
+NodeKind RedNode::GetKind()
+{
+    return mGreen->GetKind();
+}
+
+unsigned int RedNode::GetFullStart()
+{
+    return mPosition;
+}
+
+unsigned int RedNode::GetFullEnd()
+{
+    return mPosition + mGreen->GetWidth();
+}
+
+unsigned int RedNode::GetChildCount()
+{
+    return mGreen->GetChildCount();
+}
+
+bool RedNode::IsToken(unsigned int index)
+{
+    return mGreen->GetChild(index).mToken != nullptr;
+}
+
+std::shared_ptr<RedNode> RedNode::GetChildNode(unsigned int index)
+{
+    auto &child = mGreen->GetChild(index);
+    if (child.mNode == nullptr) return nullptr;
+
+    return std::make_shared<RedNode>(child.mNode, shared_from_this(), index, mPosition + mGreen->GetChildOffset(index));
+}
+
+RedToken RedNode::GetChildToken(unsigned int index)
+{
+    return RedToken(mGreen->GetChild(index).mToken, shared_from_this(), index, mPosition + mGreen->GetChildOffset(index));
+}
+
+RedToken RedNode::FindToken(unsigned int position)
+{
+    auto node = shared_from_this();
+
+    if (position >= GetFullEnd()) position = GetFullEnd() > mPosition ? GetFullEnd() - 1 : mPosition;
+    if (position < mPosition) position = mPosition;
+
+    while (true)
+    {
+        auto &green = node->mGreen;
+        unsigned int low = 0, high = green->GetChildCount();
+
+        /* Last child starting at or before the position, skipping empty children. */
+        while (high - low > 1)
+        {
+            auto middle = (low + high) / 2;
+            if (green->GetChildOffset(middle) <= position - node->mPosition) low = middle;
+            else high = middle;
+        }
+
+        /* A node without children holds no token to return. */
+        if (green->GetChildCount() == 0) return RedToken(nullptr, node, 0, node->mPosition);
+
+        while (low > 0 && green->GetChild(low).GetWidth() == 0) low--;
+
+        if (node->IsToken(low)) return node->GetChildToken(low);
+
+        node = node->GetChildNode(low);
+    }
+}
+
+std::shared_ptr<RedNode> RedNode::ReplaceWith(std::shared_ptr<const GreenNode> green)
+{
+    auto node = shared_from_this();
+
+    while (node->mParent != nullptr)
+    {
+        green = node->mParent->mGreen->ReplaceChild(node->mIndex, { green, nullptr });
+        node = node->mParent;
+    }
+
+    return CreateRoot(green);
+}
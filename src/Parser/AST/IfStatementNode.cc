@@ -2,6 +2,7 @@
 #include <ast/IfStatementNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 IfStatementNode::IfStatementNode(  
                             unsigned int start, unsigned int end,
@@ -11,7 +12,7 @@ IfStatementNode::IfStatementNode(
                             std::shared_ptr<StatementNode> right,
                             std::shared_ptr<std::vector<std::shared_ptr<StatementNode>>> nodes,
                             std::shared_ptr<StatementNode> next
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::IfStatement)
 {
     mOp1 = op1;
     mLeft = left;
@@ -20,3 +21,33 @@ IfStatementNode::IfStatementNode(
     mNodes = nodes;
     mNext = next;
 }
+
+std::shared_ptr<Token> IfStatementNode::GetOperator1()
+{
+    return mOp1;
+}
+
+std::shared_ptr<ExpressionNode> IfStatementNode::GetLeft()
+{
+    return mLeft;
+}
+
+std::shared_ptr<Token> IfStatementNode::GetOperator2()
+{
+    return mOp2;
+}
+
+std::shared_ptr<StatementNode> IfStatementNode::GetRight()
+{
+    return mRight;
+}
+
+std::shared_ptr<std::vector<std::shared_ptr<StatementNode>>> IfStatementNode::GetNodes()
+{
+    return mNodes;
+}
+
+std::shared_ptr<StatementNode> IfStatementNode::GetNext()
+{
+    return mNext;
+}
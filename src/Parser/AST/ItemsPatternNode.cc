@@ -2,15 +2,26 @@
 #include <ast/ItemsPatternNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 ItemsPatternNode::ItemsPatternNode(  
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<std::vector<std::shared_ptr<AST::StatementNode>>> nodes,
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> separators
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::ItemsPattern)
 {
     
     mNodes = nodes;
     mSeparators = separators;
 
 }
+
+std::shared_ptr<std::vector<std::shared_ptr<AST::StatementNode>>> ItemsPatternNode::GetNodes()
+{
+    return mNodes;
+}
+
+std::shared_ptr<std::vector<std::shared_ptr<Token>>> ItemsPatternNode::GetSeparators()
+{
+    return mSeparators;
+}
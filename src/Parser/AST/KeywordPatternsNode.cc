@@ -2,13 +2,24 @@
 #include <ast/KeywordPatternsNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 KeywordPatternsNode::KeywordPatternsNode(  
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<std::vector<std::shared_ptr<AST::StatementNode>>> nodes,
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> separators
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::KeywordPatterns)
 {
     mNodes = nodes;
     mSeparators = separators;
 }
+
+std::shared_ptr<std::vector<std::shared_ptr<AST::StatementNode>>> KeywordPatternsNode::GetNodes()
+{
+    return mNodes;
+}
+
+std::shared_ptr<std::vector<std::shared_ptr<Token>>> KeywordPatternsNode::GetSeparators()
+{
+    return mSeparators;
+}
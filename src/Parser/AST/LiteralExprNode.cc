@@ -8,7 +8,7 @@ LiteralExprNode::LiteralExprNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<StatementNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::LiteralExpr)
 {
     
     mOp1 = op1;
@@ -20,3 +20,13 @@ TokenKind LiteralExprNode::LiteralExprType()
 {
     return mOp1->GetSymbolKind();
 }
+
+std::shared_ptr<Token> LiteralExprNode::GetOperator()
+{
+    return mOp1;
+}
+
+std::shared_ptr<StatementNode> LiteralExprNode::GetRight()
+{
+    return mRight;
+}
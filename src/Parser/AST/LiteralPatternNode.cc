@@ -8,7 +8,7 @@ LiteralPatternNode::LiteralPatternNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<StatementNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::LiteralPattern)
 {
     
     mOp1 = op1;
@@ -20,3 +20,13 @@ TokenKind LiteralPatternNode::LiteralPatternType()
 {
     return mOp1->GetSymbolKind();
 }
+
+std::shared_ptr<Token> LiteralPatternNode::GetOperator()
+{
+    return mOp1;
+}
+
+std::shared_ptr<StatementNode> LiteralPatternNode::GetRight()
+{
+    return mRight;
+}
@@ -0,0 +1,433 @@
+#include <ast/MappedCompactTree.h>
+#include <FloatConversion.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <cwchar>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static const char Magic[8] = { 'P', 'Y', 'C', 'N', 'A', 'S', 'T', '\0' };
+static const std::uint32_t ByteOrder = 0x01020304;
+
+/* Sections follow the header in this order, each starting on an 8 byte boundary. */
+struct MappedCompactTree::Header
+{
+    char mMagic[8];
+    std::uint32_t mVersion;
+    std::uint32_t mByteOrder;
+    std::uint32_t mCharSize;
+    std::uint32_t mNodeSize;
+    std::uint32_t mTokenSize;
+    std::uint32_t mLiteralSize;
+    std::uint32_t mNodeCount;
+    std::uint32_t mTokenCount;
+    std::uint32_t mNameCount;
+    std::uint32_t mNameCharCount;
+    std::uint32_t mLiteralCount;
+    std::uint32_t mSourceLength;
+    std::uint64_t mNodes;
+    std::uint64_t mTokens;
+    std::uint64_t mValues;          /* per token, name index or literal index */
+    std::uint64_t mNameOffsets;     /* mNameCount + 1 offsets into the name characters */
+    std::uint64_t mNameChars;
+    std::uint64_t mLiterals;
+    std::uint64_t mSource;
+    std::uint64_t mFileSize;
+};
+
+static std::uint64_t Align(std::uint64_t offset)
+{
+    return (offset + 7) & ~static_cast<std::uint64_t>(7);
+}
+
+static CompactLiteral DecodeNumber(const std::wstring &text, unsigned int token)
+{
+    CompactLiteral literal { CompactLiteralKind::Text, token, 0, 0.0 };
+    std::wstring digits;
+
+    for (auto ch : text) if (ch != L'_') digits.push_back(ch);
+
+    if (digits.empty()) return literal;
+
+    auto imaginary = digits.back() == L'j' || digits.back() == L'J';
+    if (imaginary) digits.pop_back();
+
+    auto prefixed = digits.size() > 2 && digits[0] == L'0' && std::wcschr(L"xXoObB", digits[1]) != nullptr;
+    wchar_t *end = nullptr;
+
+    if (!imaginary && (prefixed || digits.find_first_of(L".eE") == std::wstring::npos))
+    {
+        auto base = !prefixed ? 10 : digits[1] == L'x' || digits[1] == L'X' ? 16 : digits[1] == L'o' || digits[1] == L'O' ? 8 : 2;
+
+        errno = 0;
+        auto value = std::wcstoull(digits.c_str() + (prefixed ? 2 : 0), &end, base);
+
+        if (errno == 0 && *end == L'\0' && value <= static_cast<unsigned long long>(std::numeric_limits<std::int64_t>::max()))
+        {
+            literal.mKind = CompactLiteralKind::Integer;
+            literal.mInteger = static_cast<std::int64_t>(value);
+        }
+
+        return literal;
+    }
+
+    /* Out of range reals become infinity or zero, as in Python. */
+    double value;
+
+    if (FloatConversion::Parse(digits, value))
+    {
+        literal.mKind = imaginary ? CompactLiteralKind::Imaginary : CompactLiteralKind::Real;
+        literal.mReal = value;
+    }
+
+    return literal;
+}
+
+std::string MappedCompactTree::Serialize(CompactTree &tree)
+{
+    auto tokenCount = tree.TokenCount();
+    std::vector<std::uint32_t> values(tokenCount, NoIndex);
+    std::vector<std::uint32_t> nameOffsets { 0 };
+    std::wstring nameChars;
+    std::vector<CompactLiteral> literals;
+    std::unordered_map<std::wstring, std::uint32_t> names;
+
+    for (unsigned int i = 0; i < tokenCount; i++)
+    {
+        switch (tree.mTokens[i].mKind)
+        {
+            case TokenKind::Name:
+                {
+                    auto text = tree.GetTokenText(i);
+                    auto it = names.emplace(text, static_cast<std::uint32_t>(names.size())).first;
+
+                    if (it->second + 1 == names.size())
+                    {
+                        nameChars += text;
+                        nameOffsets.push_back(static_cast<std::uint32_t>(nameChars.size()));
+                    }
+
+                    values[i] = it->second;
+                }
+                break;
+            case TokenKind::Number:
+                values[i] = static_cast<std::uint32_t>(literals.size());
+                literals.push_back( DecodeNumber(tree.GetTokenText(i), i) );
+                break;
+            default:
+                break;
+        }
+    }
+
+    auto sourceLength = tree.mSource ? tree.mSource->size() : 0;
+
+    Header header {};
+    std::memcpy(header.mMagic, Magic, sizeof(Magic));
+    header.mVersion = Version;
+    header.mByteOrder = ByteOrder;
+    header.mCharSize = sizeof(wchar_t);
+    header.mNodeSize = sizeof(CompactNode);
+    header.mTokenSize = sizeof(CompactToken);
+    header.mLiteralSize = sizeof(CompactLiteral);
+    header.mNodeCount = tree.NodeCount();
+    header.mTokenCount = tokenCount;
+    header.mNameCount = static_cast<std::uint32_t>(names.size());
+    header.mNameCharCount = static_cast<std::uint32_t>(nameChars.size());
+    header.mLiteralCount = static_cast<std::uint32_t>(literals.size());
+    header.mSourceLength = static_cast<std::uint32_t>(sourceLength);
+
+    header.mNodes = Align(sizeof(Header));
+    header.mTokens = Align(header.mNodes + header.mNodeCount * sizeof(CompactNode));
+    header.mValues = Align(header.mTokens + tokenCount * sizeof(CompactToken));
+    header.mNameOffsets = Align(header.mValues + tokenCount * sizeof(std::uint32_t));
+    header.mNameChars = Align(header.mNameOffsets + nameOffsets.size() * sizeof(std::uint32_t));
+    header.mLiterals = Align(header.mNameChars + nameChars.size() * sizeof(wchar_t));
+    header.mSource = Align(header.mLiterals + literals.size() * sizeof(CompactLiteral));
+    header.mFileSize = header.mSource + sourceLength * sizeof(wchar_t);
+
+    std::string bytes(header.mFileSize, '\0');
+
+    auto section = [&bytes](std::uint64_t offset, const void *data, std::size_t size)
+    {
+        if (size > 0) std::memcpy(&bytes[offset], data, size);
+    };
+
+    section(0, &header, sizeof(Header));
+    section(header.mNodes, tree.mNodes.data(), tree.mNodes.size() * sizeof(CompactNode));
+    section(header.mTokens, tree.mTokens.data(), tokenCount * sizeof(CompactToken));
+    section(header.mValues, values.data(), values.size() * sizeof(std::uint32_t));
+    section(header.mNameOffsets, nameOffsets.data(), nameOffsets.size() * sizeof(std::uint32_t));
+    section(header.mNameChars, nameChars.data(), nameChars.size() * sizeof(wchar_t));
+    section(header.mLiterals, literals.data(), literals.size() * sizeof(CompactLiteral));
+    section(header.mSource, sourceLength > 0 ? tree.mSource->data() : nullptr, sourceLength * sizeof(wchar_t));
+
+    return bytes;
+}
+
+bool MappedCompactTree::Write(CompactTree &tree, const std::string &path)
+{
+    return Write(Serialize(tree), path);
+}
+
+bool MappedCompactTree::Write(const std::string &bytes, const std::string &path)
+{
+    static std::atomic<unsigned int> counter(0);
+
+    auto temporary = path + "." + std::to_string(getpid()) + "." + std::to_string(counter++) + ".tmp";
+
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file) return false;
+
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        file.close();
+
+        if (!file)
+        {
+            std::filesystem::remove(temporary);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+
+    if (error) std::filesystem::remove(temporary, error);
+    return !error;
+}
+
+MappedCompactTree::MappedCompactTree()
+{
+    mMapping = nullptr;
+    mMappingSize = 0;
+}
+
+MappedCompactTree::~MappedCompactTree()
+{
+    if (mMapping != nullptr) munmap(mMapping, mMappingSize);
+}
+
+std::shared_ptr<MappedCompactTree> MappedCompactTree::Open(const std::string &path)
+{
+    auto fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return nullptr;
+
+    struct stat status;
+
+    if (fstat(fd, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(Header))
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    auto size = static_cast<std::size_t>(status.st_size);
+    auto mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED) return nullptr;
+
+    std::shared_ptr<MappedCompactTree> tree(new MappedCompactTree());
+    tree->mMapping = mapping;
+    tree->mMappingSize = size;
+
+    if (!tree->Attach(static_cast<const char *>(mapping), size)) return nullptr;
+
+    return tree;
+}
+
+std::shared_ptr<MappedCompactTree> MappedCompactTree::FromBytes(std::string bytes)
+{
+    std::shared_ptr<MappedCompactTree> tree(new MappedCompactTree());
+    tree->mBytes = std::move(bytes);
+
+    if (!tree->Attach(tree->mBytes.data(), tree->mBytes.size())) return nullptr;
+
+    return tree;
+}
+
+bool MappedCompactTree::Attach(const char *base, std::size_t size)
+{
+    if (size < sizeof(Header) || reinterpret_cast<std::uintptr_t>(base) % 8 != 0) return false;
+
+    auto header = reinterpret_cast<const Header *>(base);
+
+    if (    std::memcmp(header->mMagic, Magic, sizeof(Magic)) != 0 ||
+            header->mVersion != Version ||
+            header->mByteOrder != ByteOrder ||
+            header->mCharSize != sizeof(wchar_t) ||
+            header->mNodeSize != sizeof(CompactNode) ||
+            header->mTokenSize != sizeof(CompactToken) ||
+            header->mLiteralSize != sizeof(CompactLiteral) ||
+            header->mFileSize != size ) return false;
+
+    /* Bounds of every section, then every index inside them, so a corrupt or truncated
+       file is refused here and the accessors never read outside the mapping. */
+    auto fits = [size](std::uint64_t offset, std::uint64_t count, std::uint64_t recordSize)
+    {
+        return offset % 8 == 0 && offset <= size && count <= (size - offset) / recordSize;
+    };
+
+    if (    !fits(header->mNodes, header->mNodeCount, sizeof(CompactNode)) ||
+            !fits(header->mTokens, header->mTokenCount, sizeof(CompactToken)) ||
+            !fits(header->mValues, header->mTokenCount, sizeof(std::uint32_t)) ||
+            !fits(header->mNameOffsets, header->mNameCount + 1ull, sizeof(std::uint32_t)) ||
+            !fits(header->mNameChars, header->mNameCharCount, sizeof(wchar_t)) ||
+            !fits(header->mLiterals, header->mLiteralCount, sizeof(CompactLiteral)) ||
+            !fits(header->mSource, header->mSourceLength, sizeof(wchar_t)) ) return false;
+
+    mNodes = reinterpret_cast<const CompactNode *>(base + header->mNodes);
+    mTokens = reinterpret_cast<const CompactToken *>(base + header->mTokens);
+    mValues = reinterpret_cast<const std::uint32_t *>(base + header->mValues);
+    mNameOffsets = reinterpret_cast<const std::uint32_t *>(base + header->mNameOffsets);
+    mNameChars = reinterpret_cast<const wchar_t *>(base + header->mNameChars);
+    mLiterals = reinterpret_cast<const CompactLiteral *>(base + header->mLiterals);
+    mSource = reinterpret_cast<const wchar_t *>(base + header->mSource);
+    mNodeCount = header->mNodeCount;
+    mTokenCount = header->mTokenCount;
+    mNameCount = header->mNameCount;
+    mLiteralCount = header->mLiteralCount;
+    mSourceLength = header->mSourceLength;
+
+    for (std::uint32_t i = 0; i < mNameCount; i++)
+        if (mNameOffsets[i] > mNameOffsets[i + 1]) return false;
+
+    if (mNameOffsets[0] != 0 || mNameOffsets[mNameCount] > header->mNameCharCount) return false;
+
+    /* Nodes are stored in preorder, children and siblings always come later. */
+    for (std::uint32_t i = 0; i < mNodeCount; i++)
+    {
+        auto &node = mNodes[i];
+
+        if (node.mFirstChild != NoIndex && (node.mFirstChild <= i || node.mFirstChild >= mNodeCount)) return false;
+        if (node.mNextSibling != NoIndex && (node.mNextSibling <= i || node.mNextSibling >= mNodeCount)) return false;
+
+        auto empty = node.mLastToken + 1 == node.mFirstToken;
+        if (empty ? node.mFirstToken > mTokenCount : node.mFirstToken > node.mLastToken || node.mLastToken >= mTokenCount) return false;
+    }
+
+    for (std::uint32_t i = 0; i < mTokenCount; i++)
+    {
+        auto &token = mTokens[i];
+
+        if (token.mStart > token.mEnd || token.mEnd > mSourceLength) return false;
+        if (token.mKind == TokenKind::Name && mValues[i] >= mNameCount) return false;
+        if (token.mKind == TokenKind::Number && mValues[i] >= mLiteralCount) return false;
+    }
+
+    for (std::uint32_t i = 0; i < mLiteralCount; i++)
+        if (mLiterals[i].mToken >= mTokenCount) return false;
+
+    return true;
+}
+
+unsigned int MappedCompactTree::Root()
+{
+    return mNodeCount == 0 ? NoIndex : 0;
+}
+
+unsigned int MappedCompactTree::NodeCount()
+{
+    return mNodeCount;
+}
+
+unsigned int MappedCompactTree::TokenCount()
+{
+    return mTokenCount;
+}
+
+unsigned int MappedCompactTree::NameCount()
+{
+    return mNameCount;
+}
+
+unsigned int MappedCompactTree::LiteralCount()
+{
+    return mLiteralCount;
+}
+
+const CompactNode & MappedCompactTree::GetNode(unsigned int index)
+{
+    return mNodes[index];
+}
+
+const CompactToken & MappedCompactTree::GetToken(unsigned int index)
+{
+    return mTokens[index];
+}
+
+unsigned int MappedCompactTree::GetFirstChild(unsigned int index)
+{
+    return mNodes[index].mFirstChild;
+}
+
+unsigned int MappedCompactTree::GetNextSibling(unsigned int index)
+{
+    return mNodes[index].mNextSibling;
+}
+
+unsigned int MappedCompactTree::GetChildCount(unsigned int index)
+{
+    unsigned int count = 0;
+    for (auto child = mNodes[index].mFirstChild; child != NoIndex; child = mNodes[child].mNextSibling) count++;
+    return count;
+}
+
+unsigned int MappedCompactTree::GetStart(unsigned int index)
+{
+    auto &node = mNodes[index];
+    if (node.mLastToken + 1 == node.mFirstToken) return 0;
+    return mTokens[node.mFirstToken].mStart;
+}
+
+unsigned int MappedCompactTree::GetEnd(unsigned int index)
+{
+    auto &node = mNodes[index];
+    if (node.mLastToken + 1 == node.mFirstToken) return 0;
+    return mTokens[node.mLastToken].mEnd;
+}
+
+std::wstring_view MappedCompactTree::GetTokenText(unsigned int index)
+{
+    auto &token = mTokens[index];
+    if (token.mEnd > mSourceLength || token.mStart > token.mEnd) return std::wstring_view();
+    return std::wstring_view(mSource + token.mStart, token.mEnd - token.mStart);
+}
+
+unsigned int MappedCompactTree::GetTokenName(unsigned int index)
+{
+    return mTokens[index].mKind == TokenKind::Name ? mValues[index] : NoIndex;
+}
+
+std::wstring_view MappedCompactTree::GetName(unsigned int name)
+{
+    return std::wstring_view(mNameChars + mNameOffsets[name], mNameOffsets[name + 1] - mNameOffsets[name]);
+}
+
+const CompactLiteral * MappedCompactTree::GetTokenLiteral(unsigned int index)
+{
+    return mTokens[index].mKind == TokenKind::Number ? &mLiterals[mValues[index]] : nullptr;
+}
+
+const CompactLiteral & MappedCompactTree::GetLiteral(unsigned int literal)
+{
+    return mLiterals[literal];
+}
+
+std::wstring_view MappedCompactTree::GetSource()
+{
+    return std::wstring_view(mSource, mSourceLength);
+}
@@ -2,6 +2,7 @@
 #include <ast/MappingPatternNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 MappingPatternNode::MappingPatternNode(  
                             unsigned int start, unsigned int end, 
@@ -11,7 +12,7 @@ MappingPatternNode::MappingPatternNode(
                             std::shared_ptr<AST::StatementNode> doubleStar,
                             std::shared_ptr<Token> secondComma,
                             std::shared_ptr<Token> closeCurly
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::MappingPattern)
 {
     
     mOpenCurly = openCurly;
@@ -22,3 +23,33 @@ MappingPatternNode::MappingPatternNode(
     mCloseCurly = closeCurly;
 
 }
+
+std::shared_ptr<Token> MappingPatternNode::GetOpenCurly()
+{
+    return mOpenCurly;
+}
+
+std::shared_ptr<AST::StatementNode> MappingPatternNode::GetItems()
+{
+    return mItems;
+}
+
+std::shared_ptr<Token> MappingPatternNode::GetFirstComma()
+{
+    return mFirstComma;
+}
+
+std::shared_ptr<AST::StatementNode> MappingPatternNode::GetDoubleStar()
+{
+    return mDoubleStar;
+}
+
+std::shared_ptr<Token> MappingPatternNode::GetSecondComma()
+{
+    return mSecondComma;
+}
+
+std::shared_ptr<Token> MappingPatternNode::GetCloseCurly()
+{
+    return mCloseCurly;
+}
@@ -2,15 +2,31 @@
 #include <ast/MinusAssignStatementNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 MinusAssignStatementNode::MinusAssignStatementNode(  
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<Node> left,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<ExpressionNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::MinusAssignStatement)
 {
     mLeft = left;
     mOp1 = op1;
     mRight = right;
 }
+
+std::shared_ptr<Node> MinusAssignStatementNode::GetLeft()
+{
+    return mLeft;
+}
+
+std::shared_ptr<Token> MinusAssignStatementNode::GetOperator()
+{
+    return mOp1;
+}
+
+std::shared_ptr<ExpressionNode> MinusAssignStatementNode::GetRight()
+{
+    return mRight;
+}
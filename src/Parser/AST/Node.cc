@@ -3,7 +3,27 @@
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
 
-Node::Node(unsigned int start, unsigned int end)
+Node::Node(unsigned int start, unsigned int end, NodeKind kind)
 {
-    mColStart = start; mColEnd = end;
-}
\ No newline at end of file
+    mColStart = start; mColEnd = end; mKind = kind;
+}
+
+NodeKind Node::GetKind()
+{
+    return mKind;
+}
+
+unsigned int Node::GetStart()
+{
+    return mColStart;
+}
+
+unsigned int Node::GetEnd()
+{
+    return mColEnd;
+}
+
+void Node::Shift(int delta)
+{
+    mColStart += delta; mColEnd += delta;
+}
@@ -8,10 +8,20 @@ OrPatternNode::OrPatternNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<std::vector<std::shared_ptr<StatementNode>>> nodes,
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> separators
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::OrPattern)
 {
     
     mNodes = nodes;
     mSeparators = separators;
 
 }
+
+std::shared_ptr<std::vector<std::shared_ptr<StatementNode>>> OrPatternNode::GetNodes()
+{
+    return mNodes;
+}
+
+std::shared_ptr<std::vector<std::shared_ptr<Token>>> OrPatternNode::GetSeparators()
+{
+    return mSeparators;
+}
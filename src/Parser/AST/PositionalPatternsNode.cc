@@ -2,13 +2,24 @@
 #include <ast/PositionalPatternsNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 PositionalPatternsNode::PositionalPatternsNode(  
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<std::vector<std::shared_ptr<AST::StatementNode>>> nodes,
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> separators
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::PositionalPatterns)
 {
     mNodes = nodes;
     mSeparators = separators;
 }
+
+std::shared_ptr<std::vector<std::shared_ptr<AST::StatementNode>>> PositionalPatternsNode::GetNodes()
+{
+    return mNodes;
+}
+
+std::shared_ptr<std::vector<std::shared_ptr<Token>>> PositionalPatternsNode::GetSeparators()
+{
+    return mSeparators;
+}
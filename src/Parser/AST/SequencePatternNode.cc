@@ -2,13 +2,14 @@
 #include <ast/SequencePatternNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 SequencePatternNode::SequencePatternNode(  
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<AST::StatementNode> right,
                             std::shared_ptr<Token> op2
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::SequencePattern)
 {
     
     mOp1 = op1;
@@ -16,3 +17,18 @@ SequencePatternNode::SequencePatternNode(
     mOp2 = op2;
 
 }
+
+std::shared_ptr<Token> SequencePatternNode::GetOperator1()
+{
+    return mOp1;
+}
+
+std::shared_ptr<AST::StatementNode> SequencePatternNode::GetRight()
+{
+    return mRight;
+}
+
+std::shared_ptr<Token> SequencePatternNode::GetOperator2()
+{
+    return mOp2;
+}
@@ -8,10 +8,20 @@ SignedNumberNode::SignedNumberNode(
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<Token> sign,
                             std::shared_ptr<NumberToken> number
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::SignedNumber)
 {
     
     mSign = sign;
     mNumber = number;
 
 }
+
+std::shared_ptr<Token> SignedNumberNode::GetSign()
+{
+    return mSign;
+}
+
+std::shared_ptr<NumberToken> SignedNumberNode::GetNumber()
+{
+    return mNumber;
+}
@@ -0,0 +1,182 @@
+#include <ast/SourceEmitter.h>
+#include <ast/NodeVisitor.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+SourceEmitter::SourceEmitter(wchar_t *buffer, std::size_t capacity, Sink sink)
+{
+    mBuffer = buffer;
+    mCapacity = capacity;
+    mUsed = 0;
+    mLength = 0;
+    mSink = std::move(sink);
+    mSorted = true;
+}
+
+void SourceEmitter::Replace(std::shared_ptr<Node> node, std::shared_ptr<Node> replacement, std::shared_ptr<std::wstring> source)
+{
+    auto &entry = mReplacements[node.get()];
+
+    if (entry.mNode == nullptr) mPieces.push_back(&entry);
+    entry = { node, replacement, source, SpanOf(node) };
+    mSorted = false;
+}
+
+void SourceEmitter::Write(const wchar_t *text, std::size_t length)
+{
+    mLength += length;
+
+    if (mUsed == 0 && length >= mCapacity)
+    {
+        mSink(text, length);
+        return;
+    }
+
+    while (length > 0)
+    {
+        auto count = std::min(length, mCapacity - mUsed);
+        std::memcpy(mBuffer + mUsed, text, count * sizeof(wchar_t));
+        mUsed += count;
+        text += count;
+        length -= count;
+
+        if (mUsed == mCapacity)
+        {
+            mSink(mBuffer, mUsed);
+            mUsed = 0;
+        }
+    }
+}
+
+std::size_t SourceEmitter::Flush()
+{
+    if (mUsed > 0) mSink(mBuffer, mUsed);
+    mUsed = 0;
+
+    return mLength;
+}
+
+namespace
+{
+    /* Widens a span over the tokens met, queues the nodes. */
+    struct CollectSpan
+    {
+        std::vector<std::shared_ptr<Node>> &mStack;
+        unsigned int &mFullStart;
+        unsigned int &mEnd;
+
+        void operator()(std::shared_ptr<Token> token)
+        {
+            if (token == nullptr) return;
+            mFullStart = std::min(mFullStart, token->GetFullStartPosition());
+            mEnd = std::max(mEnd, token->GetTokenEndPosition());
+        }
+
+        void operator()(std::shared_ptr<Node> node)
+        {
+            if (node != nullptr) mStack.push_back(node);
+        }
+
+        template <typename T>
+        void operator()(std::shared_ptr<std::vector<std::shared_ptr<T>>> nodes)
+        {
+            if (nodes == nullptr) return;
+            for (auto &element : *nodes) (*this)(element);
+        }
+    };
+}
+
+SourceEmitter::Span SourceEmitter::SpanOf(std::shared_ptr<Node> root)
+{
+    Span span { std::numeric_limits<unsigned int>::max(), 0 };
+    if (root == nullptr) return span;
+
+    std::vector<std::shared_ptr<Node>> stack { root };
+    CollectSpan collect { stack, span.mFullStart, span.mEnd };
+
+    while (!stack.empty())
+    {
+        auto node = std::move(stack.back());
+        stack.pop_back();
+        ForEachChild(node, collect);
+    }
+
+    return span;
+}
+
+void SourceEmitter::Copy(const std::wstring &source, Span span, bool replace)
+{
+    auto text = source.data();
+    auto position = span.mFullStart;
+
+    if (replace && !mPieces.empty())
+    {
+        /* Outer nodes come before the nodes inside them, which are then skipped. */
+        if (!mSorted)
+        {
+            std::sort(mPieces.begin(), mPieces.end(), [](const Replacement *a, const Replacement *b) {
+                return a->mSpan.mFullStart != b->mSpan.mFullStart ? a->mSpan.mFullStart < b->mSpan.mFullStart : a->mSpan.mEnd > b->mSpan.mEnd;
+            });
+            mSorted = true;
+        }
+
+        auto piece = std::lower_bound(mPieces.begin(), mPieces.end(), span.mFullStart,
+            [](const Replacement *a, unsigned int start) { return a->mSpan.mFullStart < start; });
+
+        for (; piece != mPieces.end() && (*piece)->mSpan.mFullStart < span.mEnd; ++piece)
+        {
+            auto &replaced = **piece;
+            if (replaced.mSpan.mFullStart < position || replaced.mSpan.mEnd > span.mEnd) continue;
+
+            if (replaced.mSpan.mFullStart > position) Write(text + position, replaced.mSpan.mFullStart - position);
+            if (replaced.mReplacement != nullptr) Copy(*replaced.mSource, SpanOf(replaced.mReplacement), false);
+            position = replaced.mSpan.mEnd;
+        }
+    }
+
+    if (span.mEnd > position) Write(text + position, span.mEnd - position);
+}
+
+void SourceEmitter::Emit(std::shared_ptr<Node> root, std::shared_ptr<std::wstring> source)
+{
+    if (root == nullptr) return;
+
+    /* A file spans its source up to the end of file, only other trees are walked for
+       their span. Text is written from the source in one piece up to each replaced
+       node, an unmodified tree is a single write. */
+    auto span = root->GetKind() == NodeKind::FileInput
+        ? Span { 0, std::static_pointer_cast<FileInputNode>(root)->GetEof()->GetTokenEndPosition() }
+        : SpanOf(root);
+
+    if (span.mEnd == 0) return;
+    Copy(*source, span, true);
+}
+
+void SourceEmitter::Emit(std::shared_ptr<const GreenNode> root)
+{
+    if (root == nullptr) return;
+
+    std::vector<std::pair<const GreenNode *, unsigned int>> stack { { root.get(), 0 } };
+
+    while (!stack.empty())
+    {
+        auto &top = stack.back();
+
+        if (top.second == top.first->GetChildCount())
+        {
+            stack.pop_back();
+            continue;
+        }
+
+        auto &child = top.first->GetChild(top.second++);
+
+        if (child.mNode != nullptr) stack.emplace_back(child.mNode.get(), 0);
+        else Write(child.mToken->GetFullText().data(), child.mToken->GetWidth());
+    }
+}
@@ -0,0 +1,311 @@
+#include <ast/StructuralHash.h>
+#include <ast/NodeVisitor.h>
+
+#include <algorithm>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::uint64_t Mix(std::uint64_t hash, std::uint64_t value)
+{
+    hash = (hash ^ value) * 0xff51afd7ed558ccdull;
+    return hash ^ (hash >> 33);
+}
+
+static std::uint64_t MixText(std::uint64_t hash, const std::wstring &text)
+{
+    hash = Mix(hash, text.size());
+    for (auto ch : text) hash = Mix(hash, static_cast<std::uint64_t>(ch));
+    return hash;
+}
+
+static std::shared_ptr<const std::wstring> TokenText(std::shared_ptr<Token> token)
+{
+    switch (token->GetSymbolKind())
+    {
+        case TokenKind::Name:
+            return std::static_pointer_cast<NameToken>(token)->GetText();
+        case TokenKind::Number:
+            return std::static_pointer_cast<NumberToken>(token)->GetText();
+        case TokenKind::String:
+            return std::static_pointer_cast<StringToken>(token)->GetText();
+        case TokenKind::TypeComment:
+            return std::static_pointer_cast<TypeCommentToken>(token)->GetTypeCommentText();
+        default:
+            return nullptr;
+    }
+}
+
+/* String prefixes, which the text leaves out, so r'\n' and '\n' differ. */
+static unsigned int TokenFlags(std::shared_ptr<Token> token)
+{
+    if (token->GetSymbolKind() != TokenKind::String) return 0;
+
+    auto string = std::static_pointer_cast<StringToken>(token);
+    return  (string->IsRaw() ? HashConsToken::Raw : 0) | (string->IsUnicode() ? HashConsToken::Unicode : 0) |
+            (string->IsFormated() ? HashConsToken::Formatted : 0) | (string->IsBytes() ? HashConsToken::Bytes : 0);
+}
+
+static const std::uint64_t AbsentChild = 0x6a09e667f3bcc909ull;
+static const std::uint64_t ListStart = 0xbb67ae8584caa73bull;
+
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    /* Post-order, so the children of a node are hashed when it is left. */
+    class StructuralHashWalker : public NodeWalker<StructuralHashWalker>
+    {
+        public:
+            StructuralHashWalker(StructuralHasher &hasher) : mHasher(hasher) {}
+
+            void Leave(std::shared_ptr<Node> node)
+            {
+                mHash = Mix(0, static_cast<std::uint64_t>(node->GetKind()));
+                ForEachChild(node, *this);
+                mHasher.mHashes[node.get()] = mHash;
+            }
+
+            void operator()(std::shared_ptr<Node> node)
+            {
+                mHash = Mix(mHash, node != nullptr ? mHasher.mHashes[node.get()] : AbsentChild);
+            }
+
+            void operator()(std::shared_ptr<Token> token)
+            {
+                mHash = Mix(mHash, token != nullptr ? mHasher.HashToken(token) : AbsentChild);
+            }
+
+            template <typename T>
+            void operator()(std::shared_ptr<std::vector<std::shared_ptr<T>>> nodes)
+            {
+                if (nodes == nullptr)
+                {
+                    mHash = Mix(mHash, AbsentChild);
+                    return;
+                }
+
+                mHash = Mix(mHash, ListStart + nodes->size());
+                for (auto &element : *nodes) (*this)(element);
+            }
+
+        protected:
+            StructuralHasher &mHasher;
+            std::uint64_t mHash;
+    };
+
+    class HashConsWalker : public NodeWalker<HashConsWalker>
+    {
+        public:
+            HashConsWalker(HashConsStore &store, std::unordered_map<Node *, unsigned int> &ids) : mStore(store), mIds(ids) {}
+
+            void Leave(std::shared_ptr<Node> node)
+            {
+                mChildren.clear();
+                ForEachChild(node, *this);
+                mIds[node.get()] = mStore.InternNode(node->GetKind(), mChildren);
+            }
+
+            void operator()(std::shared_ptr<Node> node)
+            {
+                mChildren.push_back(node != nullptr ? mIds[node.get()] : HashConsStore::NoChild);
+            }
+
+            void operator()(std::shared_ptr<Token> token)
+            {
+                mChildren.push_back(token != nullptr ? HashConsStore::TokenBit | mStore.InternToken(token) : HashConsStore::NoChild);
+            }
+
+            template <typename T>
+            void operator()(std::shared_ptr<std::vector<std::shared_ptr<T>>> nodes)
+            {
+                if (nodes == nullptr)
+                {
+                    mChildren.push_back(HashConsStore::NoChild);
+                    return;
+                }
+
+                mChildren.push_back(HashConsStore::ListBit | static_cast<unsigned int>(nodes->size()));
+                for (auto &element : *nodes) (*this)(element);
+            }
+
+        protected:
+            HashConsStore &mStore;
+            std::unordered_map<Node *, unsigned int> &mIds;
+            std::vector<unsigned int> mChildren;
+    };
+}
+
+
+StructuralHasher::StructuralHasher(bool includeTrivia)
+{
+    mIncludeTrivia = includeTrivia;
+}
+
+std::uint64_t StructuralHasher::Hash(std::shared_ptr<Node> root)
+{
+    if (root == nullptr) return AbsentChild;
+
+    StructuralHashWalker walker(*this);
+    walker.Walk(root);
+
+    return mHashes[root.get()];
+}
+
+std::uint64_t StructuralHasher::HashToken(std::shared_ptr<Token> token)
+{
+    auto hash = Mix(ListStart, static_cast<std::uint64_t>(token->GetSymbolKind()));
+    auto text = TokenText(token);
+
+    hash = Mix(hash, TokenFlags(token));
+
+    if (text != nullptr) hash = MixText(hash, *text);
+
+    auto trivia = token->GetTriviaList();
+
+    if (mIncludeTrivia && trivia != nullptr)
+    {
+        for (auto &element : *trivia)
+        {
+            hash = Mix(hash, static_cast<std::uint64_t>(element->GetKind()));
+            hash = Mix(hash, element->GetEndPosition() - element->GetStartPosition());
+
+            switch (element->GetKind())
+            {
+                case TriviaKind::Comment:
+                    {
+                        auto comment = std::static_pointer_cast<CommentTrivia>(element)->GetCommentText();
+                        if (comment != nullptr) hash = MixText(hash, *comment);
+                    }
+                    break;
+                case TriviaKind::WhiteSpace:
+                    hash = Mix(hash, static_cast<std::uint64_t>(std::static_pointer_cast<WhiteSpaceTrivia>(element)->GetSpaceChar()));
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    return hash;
+}
+
+std::uint64_t StructuralHasher::GetHash(Node *node)
+{
+    auto it = mHashes.find(node);
+    return it == mHashes.end() ? 0 : it->second;
+}
+
+
+HashConsStore::HashConsStore()
+{
+}
+
+unsigned int HashConsStore::Intern(std::shared_ptr<Node> root, std::unordered_map<Node *, unsigned int> *ids)
+{
+    if (root == nullptr) return NoChild;
+
+    std::unordered_map<Node *, unsigned int> local;
+    auto &map = ids != nullptr ? *ids : local;
+
+    HashConsWalker walker(*this, map);
+    walker.Walk(root);
+
+    return map[root.get()];
+}
+
+unsigned int HashConsStore::InternToken(std::shared_ptr<Token> token)
+{
+    auto text = TokenText(token);
+    unsigned int textId = NoChild;
+
+    if (text != nullptr)
+    {
+        auto it = mTextIndex.emplace(*text, static_cast<unsigned int>(mTexts.size())).first;
+        if (it->second == mTexts.size()) mTexts.push_back(*text);
+        textId = it->second;
+    }
+
+    auto flags = TokenFlags(token);
+    auto key = (static_cast<std::uint64_t>(token->GetSymbolKind()) << 40) | (static_cast<std::uint64_t>(flags) << 32) | textId;
+    auto it = mTokenIndex.emplace(key, static_cast<unsigned int>(mTokens.size())).first;
+
+    if (it->second == mTokens.size()) mTokens.push_back( { token->GetSymbolKind(), textId, flags } );
+
+    return it->second;
+}
+
+unsigned int HashConsStore::InternNode(NodeKind kind, const std::vector<unsigned int> &children)
+{
+    auto hash = Mix(0, static_cast<std::uint64_t>(kind));
+    for (auto child : children) hash = Mix(hash, child);
+
+    auto range = mNodeIndex.equal_range(hash);
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        auto &entry = mNodes[it->second];
+
+        if (    entry.mKind == kind &&
+                entry.mChildCount == children.size() &&
+                std::equal(children.begin(), children.end(), mChildren.begin() + entry.mFirstChild) ) return it->second;
+    }
+
+    auto id = static_cast<unsigned int>(mNodes.size());
+
+    mNodes.push_back( { kind, static_cast<unsigned int>(mChildren.size()), static_cast<unsigned int>(children.size()) } );
+    mChildren.insert(mChildren.end(), children.begin(), children.end());
+    mNodeIndex.emplace(hash, id);
+
+    return id;
+}
+
+unsigned int HashConsStore::NodeCount()
+{
+    return static_cast<unsigned int>(mNodes.size());
+}
+
+unsigned int HashConsStore::TokenCount()
+{
+    return static_cast<unsigned int>(mTokens.size());
+}
+
+unsigned int HashConsStore::TextCount()
+{
+    return static_cast<unsigned int>(mTexts.size());
+}
+
+const HashConsEntry & HashConsStore::GetNode(unsigned int id)
+{
+    return mNodes[id];
+}
+
+unsigned int HashConsStore::GetChild(unsigned int id, unsigned int index)
+{
+    return mChildren[mNodes[id].mFirstChild + index];
+}
+
+const HashConsToken & HashConsStore::GetToken(unsigned int id)
+{
+    return mTokens[id];
+}
+
+const std::wstring & HashConsStore::GetText(unsigned int text)
+{
+    return mTexts[text];
+}
+
+/* Approximate, hash table nodes are counted as two pointers plus the element. */
+std::size_t HashConsStore::MemoryUsage()
+{
+    std::size_t size =  sizeof(HashConsStore) +
+                        mNodes.capacity() * sizeof(HashConsEntry) +
+                        mChildren.capacity() * sizeof(unsigned int) +
+                        mTokens.capacity() * sizeof(HashConsToken) +
+                        mNodeIndex.size() * (2 * sizeof(void *) + sizeof(std::pair<std::uint64_t, unsigned int>)) +
+                        mTokenIndex.size() * (2 * sizeof(void *) + sizeof(std::pair<std::uint64_t, unsigned int>));
+
+    for (auto &text : mTexts) size += sizeof(std::wstring) + text.capacity() * sizeof(wchar_t) + 2 * sizeof(void *) + sizeof(std::pair<std::wstring, unsigned int>);
+
+    return size;
+}
@@ -2,11 +2,17 @@
 #include <ast/SubjectExprNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 SubjectExprNode::SubjectExprNode(  
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<ExpressionNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::SubjectExpr)
 {
     mRight = right;
 }
+
+std::shared_ptr<ExpressionNode> SubjectExprNode::GetRight()
+{
+    return mRight;
+}
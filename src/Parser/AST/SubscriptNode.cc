@@ -2,6 +2,7 @@
 #include <ast/SubscriptNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 SubscriptNode::SubscriptNode(  
                             unsigned int start, unsigned int end, 
@@ -10,7 +11,7 @@ SubscriptNode::SubscriptNode(
                             std::shared_ptr<ExpressionNode> right,
                             std::shared_ptr<Token> op2,
                             std::shared_ptr<ExpressionNode> next
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::Subscript)
 {
     mLeft = left;
     mOp1 = op1;
@@ -18,3 +19,28 @@ SubscriptNode::SubscriptNode(
     mOp2 = op2;
     mNext = next;
 }
+
+std::shared_ptr<ExpressionNode> SubscriptNode::GetLeft()
+{
+    return mLeft;
+}
+
+std::shared_ptr<Token> SubscriptNode::GetOperator1()
+{
+    return mOp1;
+}
+
+std::shared_ptr<ExpressionNode> SubscriptNode::GetRight()
+{
+    return mRight;
+}
+
+std::shared_ptr<Token> SubscriptNode::GetOperator2()
+{
+    return mOp2;
+}
+
+std::shared_ptr<ExpressionNode> SubscriptNode::GetNext()
+{
+    return mNext;
+}
@@ -0,0 +1,860 @@
+#include <ast/SymbolTable.h>
+#include <ast/NodeVisitor.h>
+
+#include <map>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+Scope::Scope(ScopeKind kind, std::shared_ptr<Node> node, Scope *parent)
+{
+    mKind = kind;
+    mNode = node;
+    mParent = parent;
+    mSlotCount = 0;
+}
+
+ScopeKind Scope::GetKind()
+{
+    return mKind;
+}
+
+std::shared_ptr<Node> Scope::GetNode()
+{
+    return mNode;
+}
+
+Scope * Scope::GetParent()
+{
+    return mParent;
+}
+
+const std::vector<Scope *> & Scope::GetChildren()
+{
+    return mChildren;
+}
+
+unsigned int Scope::SymbolCount()
+{
+    return static_cast<unsigned int>(mSymbols.size());
+}
+
+Symbol & Scope::GetSymbol(unsigned int index)
+{
+    return mSymbols[index];
+}
+
+unsigned int Scope::Find(const std::wstring &name)
+{
+    auto it = mIndex.find(name);
+    return it == mIndex.end() ? Symbol::NoSlot : it->second;
+}
+
+unsigned int Scope::ParameterCount()
+{
+    return static_cast<unsigned int>(mParameters.size());
+}
+
+unsigned int Scope::SlotCount()
+{
+    return mSlotCount;
+}
+
+unsigned int Scope::Add(const std::wstring &name)
+{
+    auto it = mIndex.emplace(name, static_cast<unsigned int>(mSymbols.size()));
+    if (it.second) mSymbols.push_back( { name, SymbolKind::Local, 0, Symbol::NoSlot } );
+
+    return it.first->second;
+}
+
+
+Scope * SymbolTable::GetModule()
+{
+    return mScopes.empty() ? nullptr : mScopes.front().get();
+}
+
+Scope * SymbolTable::GetScope(Node *node)
+{
+    auto it = mScopeOf.find(node);
+    return it == mScopeOf.end() ? nullptr : it->second;
+}
+
+Symbol * SymbolTable::Resolve(NameToken *name)
+{
+    auto it = mReferences.find(name);
+    return it == mReferences.end() ? nullptr : &it->second.mScope->mSymbols[it->second.mSymbol];
+}
+
+Symbol * SymbolTable::Resolve(AtomNameNode *name)
+{
+    return Resolve(name->GetNameText().get());
+}
+
+Scope * SymbolTable::GetScopeOf(NameToken *name)
+{
+    auto it = mReferences.find(name);
+    return it == mReferences.end() ? nullptr : it->second.mScope;
+}
+
+unsigned int SymbolTable::GlobalCount()
+{
+    return static_cast<unsigned int>(mGlobals.size());
+}
+
+const std::wstring & SymbolTable::GetGlobalName(unsigned int slot)
+{
+    return mGlobals[slot];
+}
+
+
+namespace PythonCoreNative::RunTime::Parser::AST
+{
+    /* Collects the names of every scope in one walk over the tree, then resolves the
+       scope tree top down. Bindings of enclosing functions are kept as a stack per name,
+       so finding the scope a free name comes from is a lookup, and each scope on the
+       way to it is marked once. */
+    class SymbolTableBuilder
+    {
+        public:
+            SymbolTableBuilder(SymbolTable &table) : mTable(table), mCurrent(nullptr) {}
+
+            void Build(std::shared_ptr<FileInputNode> root)
+            {
+                Open(ScopeKind::Module, root);
+                VisitChildren(root);
+                Close();
+
+                Resolve(mTable.GetModule());
+
+                for (auto &scope : mTable.mScopes) AssignSlots(scope.get());
+            }
+
+        protected:
+            struct VisitChild
+            {
+                SymbolTableBuilder *mBuilder;
+
+                void operator()(std::shared_ptr<Token> token) {}
+
+                void operator()(std::shared_ptr<Node> node)
+                {
+                    mBuilder->Visit(node);
+                }
+
+                template <typename T>
+                void operator()(std::shared_ptr<std::vector<std::shared_ptr<T>>> nodes)
+                {
+                    if (nodes == nullptr) return;
+                    for (auto &element : *nodes) (*this)(element);
+                }
+            };
+
+            static std::shared_ptr<NameToken> AsName(std::shared_ptr<Token> token)
+            {
+                return std::static_pointer_cast<NameToken>(token);
+            }
+
+            static std::shared_ptr<SyntaxError> Error(std::shared_ptr<NameToken> name, const wchar_t *message)
+            {
+                return std::make_shared<SyntaxError>(name->GetTokenStartPosition(), name, std::make_shared<std::wstring>(message));
+            }
+
+            static bool IsFunctionLike(Scope *scope)
+            {
+                return  scope->mKind == ScopeKind::Function ||
+                        scope->mKind == ScopeKind::Lambda ||
+                        scope->mKind == ScopeKind::Comprehension;
+            }
+
+            void Open(ScopeKind kind, std::shared_ptr<Node> node)
+            {
+                mTable.mScopes.push_back( std::make_unique<Scope>(kind, node, mCurrent) );
+                auto scope = mTable.mScopes.back().get();
+
+                if (mCurrent != nullptr) mCurrent->mChildren.push_back(scope);
+                mTable.mScopeOf[node.get()] = scope;
+                mCurrent = scope;
+            }
+
+            void Close()
+            {
+                mCurrent = mCurrent->mParent;
+            }
+
+            unsigned int Note(Scope *scope, std::shared_ptr<NameToken> name, unsigned int flags)
+            {
+                auto index = scope->Add(*name->GetText());
+                scope->mSymbols[index].mFlags |= flags;
+                mTable.mReferences[name.get()] = { scope, index };
+
+                return index;
+            }
+
+            void Use(std::shared_ptr<NameToken> name)
+            {
+                if (name != nullptr) Note(mCurrent, name, Symbol::Used);
+            }
+
+            void Bind(std::shared_ptr<NameToken> name)
+            {
+                if (name != nullptr) Note(mCurrent, name, Symbol::Bound);
+            }
+
+            void BindParameter(std::shared_ptr<NameToken> name)
+            {
+                if (name == nullptr) return;
+
+                if (mCurrent->Find(*name->GetText()) != Symbol::NoSlot)
+                    throw Error(name, L"Duplicate argument name in function definition!");
+
+                mCurrent->mParameters.push_back( Note(mCurrent, name, Symbol::Bound | Symbol::Parameter) );
+            }
+
+            void VisitChildren(std::shared_ptr<Node> node)
+            {
+                ForEachChild(node, VisitChild { this });
+            }
+
+            void Visit(std::shared_ptr<Node> node)
+            {
+                if (node == nullptr) return;
+
+                switch (node->GetKind())
+                {
+                    case NodeKind::AtomName:
+                        Use(std::static_pointer_cast<AtomNameNode>(node)->GetNameText());
+                        break;
+
+                    case NodeKind::DotName:
+                        break;
+
+                    case NodeKind::FuncDefStatement:
+                        FuncDef(std::static_pointer_cast<FuncDefStatementNode>(node));
+                        break;
+
+                    case NodeKind::ClassStatement:
+                        {
+                            auto n = std::static_pointer_cast<ClassStatementNode>(node);
+                            Bind(AsName(n->GetOperator2()));
+                            Visit(n->GetLeft());
+                            Open(ScopeKind::Class, n);
+                            Visit(n->GetRight());
+                            Close();
+                        }
+                        break;
+
+                    case NodeKind::Lambda:
+                        Lambda(std::static_pointer_cast<LambdaNode>(node));
+                        break;
+
+                    case NodeKind::GlobalStatement:
+                        for (auto &name : *std::static_pointer_cast<GlobalStatementNode>(node)->GetNodes()) Declare(name, false);
+                        break;
+
+                    case NodeKind::NonlocalStatement:
+                        for (auto &name : *std::static_pointer_cast<NonlocalStatementNode>(node)->GetNodes()) Declare(name, true);
+                        break;
+
+                    case NodeKind::AssignStatement:
+                        {
+                            auto n = std::static_pointer_cast<AssignStatementNode>(node);
+                            auto &nodes = *n->GetRightNodes();
+
+                            Target(n->GetLeft());
+                            for (std::size_t i = 0; i + 1 < nodes.size(); i++) Target(nodes[i]);
+                            if (!nodes.empty()) Visit(nodes.back());
+                        }
+                        break;
+
+                    case NodeKind::AnnAssignStatement:
+                        {
+                            auto n = std::static_pointer_cast<AnnAssignStatementNode>(node);
+                            Target(n->GetLeftNode());
+                            Visit(n->GetRightNode());
+                            Visit(n->GetNextNode());
+                        }
+                        break;
+
+                    case NodeKind::PlusAssignStatement:         AugAssign<PlusAssignStatementNode>(node); break;
+                    case NodeKind::MinusAssignStatement:        AugAssign<MinusAssignStatementNode>(node); break;
+                    case NodeKind::MulAssignStatement:          AugAssign<MulAssignStatementNode>(node); break;
+                    case NodeKind::DivAssignStatement:          AugAssign<DivAssignStatementNode>(node); break;
+                    case NodeKind::FloorDivAssignStatement:     AugAssign<FloorDivAssignStatementNode>(node); break;
+                    case NodeKind::ModuloAssignStatement:       AugAssign<ModuloAssignStatementNode>(node); break;
+                    case NodeKind::MatriceAssignStatement:      AugAssign<MatriceAssignStatementNode>(node); break;
+                    case NodeKind::PowerAssignStatement:        AugAssign<PowerAssignStatementNode>(node); break;
+                    case NodeKind::ShiftLeftAssignStatement:    AugAssign<ShiftLeftAssignStatementNode>(node); break;
+                    case NodeKind::ShiftRightAssignStatement:   AugAssign<ShiftRightAssignStatementNode>(node); break;
+                    case NodeKind::BitAndAssignStatement:       AugAssign<BitAndAssignStatementNode>(node); break;
+                    case NodeKind::BitOrAssignStatement:        AugAssign<BitOrAssignStatementNode>(node); break;
+                    case NodeKind::BitXorAssignStatement:       AugAssign<BitXorAssignStatementNode>(node); break;
+
+                    case NodeKind::ForStatement:
+                        {
+                            auto n = std::static_pointer_cast<ForStatementNode>(node);
+                            Target(n->GetLeft());
+                            Visit(n->GetRight());
+                            Visit(n->GetNext());
+                            Visit(n->GetExtra());
+                        }
+                        break;
+
+                    case NodeKind::WithItemStatement:
+                        {
+                            auto n = std::static_pointer_cast<WithItemStatementNode>(node);
+                            Visit(n->GetLeft());
+                            Target(n->GetRight());
+                        }
+                        break;
+
+                    case NodeKind::ExceptClause:
+                        {
+                            auto n = std::static_pointer_cast<ExceptClauseNode>(node);
+                            Visit(n->GetLeft());
+                            Bind(n->GetOperator3());
+                        }
+                        break;
+
+                    case NodeKind::DelStatement:
+                        Target(std::static_pointer_cast<DelStatementNode>(node)->GetRight());
+                        break;
+
+                    case NodeKind::ImportStatement:
+                        BindFirst(std::static_pointer_cast<ImportStatementNode>(node)->GetRight());
+                        break;
+
+                    case NodeKind::ImportFromStatement:
+                        Visit(std::static_pointer_cast<ImportFromStatementNode>(node)->GetRight());
+                        break;
+
+                    case NodeKind::ImportAsNameStatement:
+                        {
+                            auto n = std::static_pointer_cast<ImportAsNameStatementNode>(node);
+                            Bind(AsName(n->GetOperator3() != nullptr ? n->GetOperator3() : n->GetOperator1()));
+                        }
+                        break;
+
+                    case NodeKind::DottedAsNameStatement:
+                        {
+                            auto n = std::static_pointer_cast<DottedAsNameStatementNode>(node);
+                            if (n->GetOperator2() != nullptr) Bind(n->GetOperator2());
+                            else BindFirst(n->GetLeft());
+                        }
+                        break;
+
+                    case NodeKind::DecoratorStatement:
+                        {
+                            auto n = std::static_pointer_cast<DecoratorStatementNode>(node);
+                            auto dotted = std::static_pointer_cast<DottedNameStatementNode>(n->GetLeft());
+                            if (dotted != nullptr && !dotted->GetNodes()->empty()) Use(dotted->GetNodes()->front());
+                            Visit(n->GetRight());
+                        }
+                        break;
+
+                    case NodeKind::NamedExpr:
+                        {
+                            auto n = std::static_pointer_cast<NamedExprNode>(node);
+                            Visit(n->GetRight());
+                            NamedTarget(n->GetLeft());
+                        }
+                        break;
+
+                    case NodeKind::Argument:
+                        Argument(std::static_pointer_cast<ArgumentNode>(node));
+                        break;
+
+                    case NodeKind::TestListComp:
+                        Container(node, std::static_pointer_cast<TestListCompNode>(node)->GetNodes());
+                        break;
+
+                    case NodeKind::DictionaryContainer:
+                        Container(node, std::static_pointer_cast<DictionaryContainerNode>(node)->GetEntries());
+                        break;
+
+                    case NodeKind::SetContainer:
+                        Container(node, std::static_pointer_cast<SetContainerNode>(node)->GetEntries());
+                        break;
+
+                    case NodeKind::CapturePattern:
+                        Bind(AsName(std::static_pointer_cast<CapturePatternNode>(node)->GetOperator()));
+                        break;
+
+                    case NodeKind::KeywordPattern:
+                        Visit(std::static_pointer_cast<KeywordPatternNode>(node)->GetRight());
+                        break;
+
+                    case NodeKind::ValuePattern:
+                        Use(std::static_pointer_cast<ValuePatternNode>(node)->GetNodes()->front());
+                        break;
+
+                    case NodeKind::ClassPattern:
+                        {
+                            auto n = std::static_pointer_cast<ClassPatternNode>(node);
+                            Use(n->GetNodes()->front());
+                            Visit(n->GetPositionals());
+                            Visit(n->GetKeywords());
+                        }
+                        break;
+
+                    case NodeKind::Plus:
+                    case NodeKind::Minus:
+                    case NodeKind::Mul:
+                    case NodeKind::Matrice:
+                    case NodeKind::Div:
+                    case NodeKind::FloorDiv:
+                    case NodeKind::Modulo:
+                    case NodeKind::ShiftLeft:
+                    case NodeKind::ShiftRight:
+                    case NodeKind::BitAnd:
+                    case NodeKind::BitOr:
+                    case NodeKind::BitXor:
+                        Chain(node);
+                        break;
+
+                    default:
+                        VisitChildren(node);
+                        break;
+                }
+            }
+
+            template <typename T>
+            static bool Operands(std::shared_ptr<Node> node, std::shared_ptr<Node> &left, std::shared_ptr<Node> &right)
+            {
+                auto n = std::static_pointer_cast<T>(node);
+                left = n->GetLeft();
+                right = n->GetRight();
+                return true;
+            }
+
+            static bool BinaryOperands(std::shared_ptr<Node> node, std::shared_ptr<Node> &left, std::shared_ptr<Node> &right)
+            {
+                switch (node->GetKind())
+                {
+                    case NodeKind::Plus:        return Operands<PlusNode>(node, left, right);
+                    case NodeKind::Minus:       return Operands<MinusNode>(node, left, right);
+                    case NodeKind::Mul:         return Operands<MulNode>(node, left, right);
+                    case NodeKind::Matrice:     return Operands<MatriceNode>(node, left, right);
+                    case NodeKind::Div:         return Operands<DivNode>(node, left, right);
+                    case NodeKind::FloorDiv:    return Operands<FloorDivNode>(node, left, right);
+                    case NodeKind::Modulo:      return Operands<ModuloNode>(node, left, right);
+                    case NodeKind::ShiftLeft:   return Operands<ShiftLeftNode>(node, left, right);
+                    case NodeKind::ShiftRight:  return Operands<ShiftRightNode>(node, left, right);
+                    case NodeKind::BitAnd:      return Operands<BitAndNode>(node, left, right);
+                    case NodeKind::BitOr:       return Operands<BitOrNode>(node, left, right);
+                    case NodeKind::BitXor:      return Operands<BitXorNode>(node, left, right);
+                    default:                    return false;
+                }
+            }
+
+            /* Operator chains such as 'a + b + c' lean left as deep as they are long, their
+               left operands are followed in a loop and the right ones visited in source order. */
+            void Chain(std::shared_ptr<Node> node)
+            {
+                std::vector<std::shared_ptr<Node>> rights;
+                std::shared_ptr<Node> left, right;
+
+                for (; BinaryOperands(node, left, right); node = left) rights.push_back(right);
+
+                Visit(node);
+                for (auto i = rights.rbegin(); i != rights.rend(); ++i) Visit(*i);
+            }
+
+            template <typename T>
+            void AugAssign(std::shared_ptr<Node> node)
+            {
+                auto n = std::static_pointer_cast<T>(node);
+                std::shared_ptr<Node> left = n->GetLeft();
+
+                /* The target comes wrapped in a list of one. */
+                if (left->GetKind() == NodeKind::TestListStarExprListStatement)
+                {
+                    auto nodes = std::static_pointer_cast<TestListStarExprListStatementNode>(left)->GetNodes();
+                    if (nodes->size() == 1) left = nodes->front();
+                }
+
+                if (left->GetKind() == NodeKind::AtomName)
+                    Note(mCurrent, std::static_pointer_cast<AtomNameNode>(left)->GetNameText(), Symbol::Bound | Symbol::Used);
+                else Visit(left);
+
+                Visit(n->GetRight());
+            }
+
+            void BindFirst(std::shared_ptr<StatementNode> dotted)
+            {
+                auto nodes = std::static_pointer_cast<DottedNameStatementNode>(dotted)->GetNodes();
+                if (!nodes->empty()) Bind(nodes->front());
+            }
+
+            /* Names stored to, anything else in a target is read. */
+            void Target(std::shared_ptr<Node> node)
+            {
+                if (node == nullptr) return;
+
+                switch (node->GetKind())
+                {
+                    case NodeKind::AtomName:
+                        Bind(std::static_pointer_cast<AtomNameNode>(node)->GetNameText());
+                        break;
+
+                    case NodeKind::ExprList:
+                        for (auto &element : *std::static_pointer_cast<ExprListNode>(node)->GetNodes()) Target(element);
+                        break;
+
+                    case NodeKind::TestList:
+                        for (auto &element : *std::static_pointer_cast<TestListNode>(node)->GetNodes()) Target(element);
+                        break;
+
+                    case NodeKind::TestListStarExprListStatement:
+                        for (auto &element : *std::static_pointer_cast<TestListStarExprListStatementNode>(node)->GetNodes()) Target(element);
+                        break;
+
+                    case NodeKind::TestListComp:
+                        for (auto &element : *std::static_pointer_cast<TestListCompNode>(node)->GetNodes()) Target(element);
+                        break;
+
+                    case NodeKind::AtomTuple:
+                        Target(std::static_pointer_cast<AtomTupleNode>(node)->GetRight());
+                        break;
+
+                    case NodeKind::AtomList:
+                        Target(std::static_pointer_cast<AtomListNode>(node)->GetRight());
+                        break;
+
+                    case NodeKind::StarExpr:
+                        Target(std::static_pointer_cast<StarExprNode>(node)->GetRight());
+                        break;
+
+                    default:
+                        Visit(node);
+                        break;
+                }
+            }
+
+            /* Assignment expressions bind in the nearest scope that is not a comprehension,
+               the comprehensions in between refer to that binding. */
+            void NamedTarget(std::shared_ptr<Node> node)
+            {
+                if (node->GetKind() != NodeKind::AtomName)
+                {
+                    Visit(node);
+                    return;
+                }
+
+                auto name = std::static_pointer_cast<AtomNameNode>(node)->GetNameText();
+                auto target = mCurrent;
+
+                while (target->mKind == ScopeKind::Comprehension) target = target->mParent;
+
+                if (target == mCurrent)
+                {
+                    Bind(name);
+                    return;
+                }
+
+                if (target->mKind == ScopeKind::Class)
+                    throw Error(name, L"Assignment expression within a comprehension can not be used in a class body!");
+
+                auto flag = target->mKind == ScopeKind::Module ? Symbol::DeclaredGlobal : Symbol::DeclaredNonlocal;
+
+                target->mSymbols[target->Add(*name->GetText())].mFlags |= Symbol::Bound;
+
+                for (auto scope = mCurrent->mParent; scope != target; scope = scope->mParent)
+                    scope->mSymbols[scope->Add(*name->GetText())].mFlags |= flag;
+
+                Note(mCurrent, name, Symbol::Used | flag);
+            }
+
+            void Declare(std::shared_ptr<NameToken> name, bool nonlocal)
+            {
+                if (nonlocal && mCurrent->mKind == ScopeKind::Module)
+                    throw Error(name, L"Nonlocal declaration not allowed at module level!");
+
+                auto index = mCurrent->Add(*name->GetText());
+                auto flags = mCurrent->mSymbols[index].mFlags;
+
+                if (flags & Symbol::Parameter)
+                    throw Error(name, nonlocal ? L"Name is parameter and nonlocal!" : L"Name is parameter and global!");
+
+                if (flags & (nonlocal ? Symbol::DeclaredGlobal : Symbol::DeclaredNonlocal))
+                    throw Error(name, L"Name is nonlocal and global!");
+
+                Note(mCurrent, name, nonlocal ? Symbol::DeclaredNonlocal : Symbol::DeclaredGlobal);
+
+                if (nonlocal) mNonlocals.emplace( std::make_pair(mCurrent, index), name );
+            }
+
+            void FuncDef(std::shared_ptr<FuncDefStatementNode> node)
+            {
+                Bind(AsName(node->GetOperator2()));
+
+                /* Defaults and annotations are evaluated where the function is defined. */
+                auto parameters = std::static_pointer_cast<ParameterStatementNode>(node->GetLeft());
+                auto list = std::static_pointer_cast<TypedArgsListStatementNode>(parameters->GetRight());
+                std::vector<std::shared_ptr<TFPDefStatementNode>> names;
+
+                auto add = [this, &names](std::shared_ptr<StatementNode> element) {
+                    if (element == nullptr) return;
+
+                    if (element->GetKind() == NodeKind::TFPDefAssignStatement)
+                    {
+                        auto assign = std::static_pointer_cast<TFPDefAssignStatementNode>(element);
+                        element = assign->GetLeft();
+                        Visit(assign->GetRight());
+                    }
+
+                    auto def = std::static_pointer_cast<TFPDefStatementNode>(element);
+                    Visit(def->GetRight());
+                    names.push_back(def);
+                };
+
+                if (list != nullptr)
+                {
+                    for (auto &element : *list->GetNodes()) add(element);
+                    add(list->GetMulNode());
+                    add(list->GetPowerNode());
+                }
+
+                Visit(node->GetRight());
+
+                Open(ScopeKind::Function, node);
+                for (auto &def : names) BindParameter(AsName(def->GetOperator1()));
+                Visit(node->GetNext());
+                Close();
+            }
+
+            void Lambda(std::shared_ptr<LambdaNode> node)
+            {
+                auto list = std::static_pointer_cast<VarArgsListExpressionNode>(node->GetLeft());
+
+                if (list != nullptr)
+                    for (auto &element : *list->GetNodes())
+                        Visit(std::static_pointer_cast<VFPDefAssignExpressionNode>(element)->GetRight());
+
+                Open(ScopeKind::Lambda, node);
+
+                if (list != nullptr)
+                {
+                    for (auto &element : *list->GetNodes())
+                        BindParameter(std::static_pointer_cast<VFPDefAssignExpressionNode>(element)->GetOperator1());
+
+                    BindParameter(list->GetMulNode());
+                    BindParameter(list->GetPowerNode());
+                }
+
+                Visit(node->GetRight());
+                Close();
+            }
+
+            void Argument(std::shared_ptr<ArgumentNode> node)
+            {
+                auto op = node->GetOperator();
+
+                if (node->GetLeft() != nullptr && op == nullptr && node->GetRight() != nullptr)
+                {
+                    Comprehension(node->GetLeft(), node->GetRight());
+                    return;
+                }
+
+                if (op != nullptr && op->GetSymbolKind() == TokenKind::PyColonAssign)
+                {
+                    Visit(node->GetRight());
+                    NamedTarget(node->GetLeft());
+                    return;
+                }
+
+                /* Keyword names are not variables. */
+                if (op == nullptr || op->GetSymbolKind() != TokenKind::PyAssign) Visit(node->GetLeft());
+                Visit(node->GetRight());
+            }
+
+            static bool IsCompFor(std::shared_ptr<Node> node)
+            {
+                return  node != nullptr &&
+                        (node->GetKind() == NodeKind::CompFor || node->GetKind() == NodeKind::SyncCompFor);
+            }
+
+            void Container(std::shared_ptr<Node> node, std::shared_ptr<std::vector<std::shared_ptr<ExpressionNode>>> nodes)
+            {
+                if (nodes->size() == 2 && IsCompFor(nodes->back())) Comprehension(nodes->front(), nodes->back());
+                else VisitChildren(node);
+            }
+
+            static std::shared_ptr<SyncCompForNode> SyncFor(std::shared_ptr<Node> node)
+            {
+                if (node->GetKind() == NodeKind::CompFor)
+                    node = std::static_pointer_cast<CompForNode>(node)->GetRight();
+
+                return std::static_pointer_cast<SyncCompForNode>(node);
+            }
+
+            /* The first iterable is evaluated outside, everything else inside the
+               comprehension's own scope. */
+            void Comprehension(std::shared_ptr<Node> element, std::shared_ptr<Node> comp)
+            {
+                auto first = SyncFor(comp);
+
+                Visit(first->GetRight());
+                Open(ScopeKind::Comprehension, comp);
+                Target(first->GetLeft());
+
+                std::shared_ptr<Node> next = first->GetNext();
+
+                while (next != nullptr)
+                {
+                    if (next->GetKind() == NodeKind::CompIf)
+                    {
+                        auto compIf = std::static_pointer_cast<CompIfNode>(next);
+                        Visit(compIf->GetRight());
+                        next = compIf->GetNext();
+                        continue;
+                    }
+
+                    auto sync = SyncFor(next);
+                    Visit(sync->GetRight());
+                    Target(sync->GetLeft());
+                    next = sync->GetNext();
+                }
+
+                Visit(element);
+                Close();
+            }
+
+            Scope * Lookup(const std::wstring &name)
+            {
+                auto it = mBindings.find(name);
+                return it == mBindings.end() || it->second.empty() ? nullptr : it->second.back();
+            }
+
+            /* Name is free in scope and bound in owner, the scopes in between pass it on. */
+            void Capture(Scope *scope, const std::wstring &name, Scope *owner)
+            {
+                for (auto between = scope->mParent; between != owner; between = between->mParent)
+                {
+                    auto &symbol = between->mSymbols[between->Add(name)];
+
+                    if (symbol.mKind == SymbolKind::Free || (symbol.mFlags & Symbol::FreeInClass)) break;
+
+                    if (between->mKind == ScopeKind::Class && (symbol.mFlags & Symbol::Bound)) symbol.mFlags |= Symbol::FreeInClass;
+                    else symbol.mKind = SymbolKind::Free;
+                }
+
+                owner->mSymbols[owner->Find(name)].mKind = SymbolKind::Cell;
+            }
+
+            void Resolve(Scope *scope)
+            {
+                std::vector<const std::wstring *> pushed;
+
+                for (unsigned int i = 0; i < scope->mSymbols.size(); i++)
+                {
+                    auto &symbol = scope->mSymbols[i];
+                    auto flags = symbol.mFlags;
+
+                    if ((flags & Symbol::DeclaredGlobal) || scope->mKind == ScopeKind::Module)
+                        symbol.mKind = SymbolKind::Global;
+
+                    else if (flags & Symbol::DeclaredNonlocal)
+                    {
+                        auto owner = Lookup(symbol.mName);
+
+                        if (owner == nullptr)
+                        {
+                            auto it = mNonlocals.find( std::make_pair(scope, i) );
+                            if (it != mNonlocals.end()) throw Error(it->second, L"No binding for nonlocal name found!");
+                            symbol.mKind = SymbolKind::Global;
+                        }
+                        else
+                        {
+                            symbol.mKind = SymbolKind::Free;
+                            Capture(scope, symbol.mName, owner);
+                        }
+                    }
+
+                    else if (flags & Symbol::Bound)
+                        symbol.mKind = SymbolKind::Local;
+
+                    else
+                    {
+                        auto owner = Lookup(symbol.mName);
+
+                        if (owner == nullptr) symbol.mKind = SymbolKind::Global;
+                        else
+                        {
+                            symbol.mKind = SymbolKind::Free;
+                            Capture(scope, symbol.mName, owner);
+                        }
+                    }
+
+                    /* Locals of functions are visible to nested scopes, class locals are
+                       not, and a global declaration hides outer bindings. */
+                    if (scope->mKind == ScopeKind::Module) continue;
+
+                    if (flags & Symbol::DeclaredGlobal)
+                    {
+                        mBindings[symbol.mName].push_back(nullptr);
+                        pushed.push_back(&symbol.mName);
+                    }
+                    else if (IsFunctionLike(scope) && symbol.mKind == SymbolKind::Local)
+                    {
+                        mBindings[symbol.mName].push_back(scope);
+                        pushed.push_back(&symbol.mName);
+                    }
+                }
+
+                /* Children may add pass through symbols, names are copied before that. */
+                std::vector<std::wstring> names;
+                names.reserve(pushed.size());
+                for (auto name : pushed) names.push_back(*name);
+
+                for (auto child : scope->mChildren) Resolve(child);
+
+                for (auto &name : names) mBindings[name].pop_back();
+            }
+
+            void AssignSlots(Scope *scope)
+            {
+                auto globalSlot = [this](const std::wstring &name) {
+                    auto it = mGlobalSlots.emplace(name, static_cast<unsigned int>(mTable.mGlobals.size()));
+                    if (it.second) mTable.mGlobals.push_back(name);
+                    return it.first->second;
+                };
+
+                unsigned int slot = 0;
+
+                for (auto index : scope->mParameters) scope->mSymbols[index].mSlot = slot++;
+
+                for (auto &symbol : scope->mSymbols)
+                    if (symbol.mKind == SymbolKind::Global) symbol.mSlot = globalSlot(symbol.mName);
+
+                if (IsFunctionLike(scope))
+                    for (auto &symbol : scope->mSymbols)
+                        if (symbol.mKind == SymbolKind::Local && !(symbol.mFlags & Symbol::Parameter)) symbol.mSlot = slot++;
+
+                for (auto &symbol : scope->mSymbols)
+                    if (symbol.mKind == SymbolKind::Cell && !(symbol.mFlags & Symbol::Parameter)) symbol.mSlot = slot++;
+
+                for (auto &symbol : scope->mSymbols)
+                    if (symbol.mKind == SymbolKind::Free || (symbol.mFlags & Symbol::FreeInClass)) symbol.mSlot = slot++;
+
+                scope->mSlotCount = slot;
+            }
+
+            SymbolTable &mTable;
+            Scope *mCurrent;
+            std::unordered_map<std::wstring, std::vector<Scope *>> mBindings;
+            std::unordered_map<std::wstring, unsigned int> mGlobalSlots;
+            std::map<std::pair<Scope *, unsigned int>, std::shared_ptr<NameToken>> mNonlocals;
+    };
+}
+
+std::shared_ptr<SymbolTable> SymbolTable::Build(std::shared_ptr<FileInputNode> root)
+{
+    auto table = std::make_shared<SymbolTable>();
+
+    SymbolTableBuilder builder(*table);
+    builder.Build(root);
+
+    return table;
+}
@@ -2,6 +2,7 @@
 #include <ast/SyncCompForNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 SyncCompForNode::SyncCompForNode(  
                             unsigned int start, unsigned int end,
@@ -10,7 +11,7 @@ SyncCompForNode::SyncCompForNode(
                             std::shared_ptr<Token> op2,
                             std::shared_ptr<ExpressionNode> right,
                             std::shared_ptr<ExpressionNode> next
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::SyncCompFor)
 {
     mOp1 = op1;
     mOp2 = op2;
@@ -18,3 +19,28 @@ SyncCompForNode::SyncCompForNode(
     mRight = right;
     mNext = next;
 }
+
+std::shared_ptr<ExpressionNode> SyncCompForNode::GetLeft()
+{
+    return mLeft;
+}
+
+std::shared_ptr<Token> SyncCompForNode::GetOperator1()
+{
+    return mOp1;
+}
+
+std::shared_ptr<Token> SyncCompForNode::GetOperator2()
+{
+    return mOp2;
+}
+
+std::shared_ptr<ExpressionNode> SyncCompForNode::GetRight()
+{
+    return mRight;
+}
+
+std::shared_ptr<ExpressionNode> SyncCompForNode::GetNext()
+{
+    return mNext;
+}
@@ -2,6 +2,7 @@
 #include <ast/TryStatementNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 TryStatementNode::TryStatementNode(  
                             unsigned int start, unsigned int end,
@@ -13,7 +14,7 @@ TryStatementNode::TryStatementNode(
                             std::shared_ptr<Token> op3,
                             std::shared_ptr<Token> op4,
                             std::shared_ptr<StatementNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::TryStatement)
 {
     mOp1 = op1;
     mLeft = left;
@@ -24,3 +25,43 @@ TryStatementNode::TryStatementNode(
     mExceptNodes = exceptNodes;
     mElseNode = elseNode;
 }
+
+std::shared_ptr<Token> TryStatementNode::GetOperator1()
+{
+    return mOp1;
+}
+
+std::shared_ptr<Token> TryStatementNode::GetOperator2()
+{
+    return mOp2;
+}
+
+std::shared_ptr<StatementNode> TryStatementNode::GetLeft()
+{
+    return mLeft;
+}
+
+std::shared_ptr<std::vector<std::shared_ptr<StatementNode>>> TryStatementNode::GetExceptNodes()
+{
+    return mExceptNodes;
+}
+
+std::shared_ptr<StatementNode> TryStatementNode::GetElseNode()
+{
+    return mElseNode;
+}
+
+std::shared_ptr<Token> TryStatementNode::GetOperator3()
+{
+    return mOp3;
+}
+
+std::shared_ptr<Token> TryStatementNode::GetOperator4()
+{
+    return mOp4;
+}
+
+std::shared_ptr<StatementNode> TryStatementNode::GetRight()
+{
+    return mRight;
+}
@@ -2,6 +2,7 @@
 #include <ast/TypeListNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 TypeListNode::TypeListNode(  
                             unsigned int start, unsigned int end, 
@@ -11,7 +12,7 @@ TypeListNode::TypeListNode(
                             std::shared_ptr<ExpressionNode> mulNode,
                             std::shared_ptr<Token> power,
                             std::shared_ptr<ExpressionNode> powerNode
-                        ) : TypeNode(start, end)
+                        ) : TypeNode(start, end, NodeKind::TypeList)
 {
     mNodes = nodes;
     mSeparators = separators;
@@ -20,3 +21,33 @@ TypeListNode::TypeListNode(
     mPower = power;
     mPowerNode = powerNode;
 }
+
+std::shared_ptr<std::vector<std::shared_ptr<ExpressionNode>>> TypeListNode::GetNodes()
+{
+    return mNodes;
+}
+
+std::shared_ptr<std::vector<std::shared_ptr<Token>>> TypeListNode::GetSeparators()
+{
+    return mSeparators;
+}
+
+std::shared_ptr<Token> TypeListNode::GetMul()
+{
+    return mMul;
+}
+
+std::shared_ptr<ExpressionNode> TypeListNode::GetMulNode()
+{
+    return mMulNode;
+}
+
+std::shared_ptr<Token> TypeListNode::GetPower()
+{
+    return mPower;
+}
+
+std::shared_ptr<ExpressionNode> TypeListNode::GetPowerNode()
+{
+    return mPowerNode;
+}
@@ -3,4 +3,4 @@
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
 
-TypeNode::TypeNode(unsigned int start, unsigned int end) : Node(start, end) {}
+TypeNode::TypeNode(unsigned int start, unsigned int end, NodeKind kind) : Node(start, end, kind) {}
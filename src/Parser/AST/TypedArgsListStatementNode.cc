@@ -2,6 +2,7 @@
 #include <ast/TypedArgsListStatementNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 TypedArgsListStatementNode::TypedArgsListStatementNode(  
                             unsigned int start, unsigned int end, 
@@ -13,7 +14,7 @@ TypedArgsListStatementNode::TypedArgsListStatementNode(
                             std::shared_ptr<Token> power,
                             std::shared_ptr<StatementNode> powerNode,
                             std::shared_ptr<std::vector<std::shared_ptr<Token>>> typeComment
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::TypedArgsListStatement)
 {
     mNodes = nodes;
     mSeparators = separators;
@@ -24,3 +25,43 @@ TypedArgsListStatementNode::TypedArgsListStatementNode(
     mPowerNode = powerNode;
     mTypeComment = typeComment;
 }
+
+std::shared_ptr<std::vector<std::shared_ptr<StatementNode>>> TypedArgsListStatementNode::GetNodes()
+{
+    return mNodes;
+}
+
+std::shared_ptr<std::vector<std::shared_ptr<Token>>> TypedArgsListStatementNode::GetSeparators()
+{
+    return mSeparators;
+}
+
+std::shared_ptr<Token> TypedArgsListStatementNode::GetSlash()
+{
+    return mSlash;
+}
+
+std::shared_ptr<Token> TypedArgsListStatementNode::GetMul()
+{
+    return mMul;
+}
+
+std::shared_ptr<StatementNode> TypedArgsListStatementNode::GetMulNode()
+{
+    return mMulNode;
+}
+
+std::shared_ptr<Token> TypedArgsListStatementNode::GetPower()
+{
+    return mPower;
+}
+
+std::shared_ptr<StatementNode> TypedArgsListStatementNode::GetPowerNode()
+{
+    return mPowerNode;
+}
+
+std::shared_ptr<std::vector<std::shared_ptr<Token>>> TypedArgsListStatementNode::GetTypeComment()
+{
+    return mTypeComment;
+}
@@ -2,6 +2,7 @@
 #include <ast/VarArgsListExpressionNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 VarArgsListExpressionNode::VarArgsListExpressionNode(  
                             unsigned int start, unsigned int end, 
@@ -12,7 +13,7 @@ VarArgsListExpressionNode::VarArgsListExpressionNode(
                             std::shared_ptr<NameToken> mulNode,
                             std::shared_ptr<Token> power,
                             std::shared_ptr<NameToken> powerNode
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::VarArgsListExpression)
 {
     mNodes = nodes;
     mSeparators = separators;
@@ -22,3 +23,38 @@ VarArgsListExpressionNode::VarArgsListExpressionNode(
     mPower = power;
     mPowerNode = powerNode;
 }
+
+std::shared_ptr<std::vector<std::shared_ptr<ExpressionNode>>> VarArgsListExpressionNode::GetNodes()
+{
+    return mNodes;
+}
+
+std::shared_ptr<std::vector<std::shared_ptr<Token>>> VarArgsListExpressionNode::GetSeparators()
+{
+    return mSeparators;
+}
+
+std::shared_ptr<Token> VarArgsListExpressionNode::GetSlash()
+{
+    return mSlash;
+}
+
+std::shared_ptr<Token> VarArgsListExpressionNode::GetMul()
+{
+    return mMul;
+}
+
+std::shared_ptr<NameToken> VarArgsListExpressionNode::GetMulNode()
+{
+    return mMulNode;
+}
+
+std::shared_ptr<Token> VarArgsListExpressionNode::GetPower()
+{
+    return mPower;
+}
+
+std::shared_ptr<NameToken> VarArgsListExpressionNode::GetPowerNode()
+{
+    return mPowerNode;
+}
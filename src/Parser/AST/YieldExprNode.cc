@@ -2,13 +2,24 @@
 #include <ast/YieldExprNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 YieldExprNode::YieldExprNode(  
                             unsigned int start, unsigned int end,
                             std::shared_ptr<Token> op1,
                             std::shared_ptr<StatementNode> right
-                        ) : ExpressionNode(start, end)
+                        ) : ExpressionNode(start, end, NodeKind::YieldExpr)
 {
     mOp1 = op1;
     mRight = right;
 }
+
+std::shared_ptr<Token> YieldExprNode::GetOperator()
+{
+    return mOp1;
+}
+
+std::shared_ptr<StatementNode> YieldExprNode::GetRight()
+{
+    return mRight;
+}
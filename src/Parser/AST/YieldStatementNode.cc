@@ -2,11 +2,17 @@
 #include <ast/YieldStatementNode.h>
 
 using namespace PythonCoreNative::RunTime::Parser::AST;
+using namespace PythonCoreNative::RunTime::Parser;
 
 YieldStatementNode::YieldStatementNode(  
                             unsigned int start, unsigned int end, 
                             std::shared_ptr<ExpressionNode> right
-                        ) : StatementNode(start, end)
+                        ) : StatementNode(start, end, NodeKind::YieldStatement)
 {
     mRight = right;
 }
+
+std::shared_ptr<ExpressionNode> YieldStatementNode::GetRight()
+{
+    return mRight;
+}
@@ -0,0 +1,588 @@
+#include <FloatConversion.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+using Words = std::vector<std::uint32_t>;
+using Wide = unsigned __int128;
+
+static constexpr int SmallestPower = -342;     /* below, every decimal with 19 digits is zero */
+static constexpr int LargestPower = 308;       /* above, infinity */
+static constexpr int RyuBits = 125;
+static constexpr int RyuInverseSize = 342;
+static constexpr int RyuSize = 326;
+
+/* Power tables. Ryu multiplies by 5**i kept in its top 125 bits and divides by 5**q
+   through 2**k / 5**q rounded up, low word first. Eisel-Lemire scales by 5**q for q from
+   SmallestPower to LargestPower in 128 bits, high word first. */
+struct PowerTables
+{
+    std::uint64_t mRyu[RyuSize][2];
+    std::uint64_t mRyuInverse[RyuInverseSize][2];
+    std::uint64_t mPowers[LargestPower - SmallestPower + 1][2];
+};
+
+
+/* Exact arithmetic on little endian 32-bit words, only to build the tables. */
+
+static std::size_t BitLength(const Words &x)
+{
+    for (auto i = x.size(); i-- > 0; )
+        if (x[i] != 0) return i * 32 + 32 - static_cast<std::size_t>( __builtin_clz(x[i]) );
+
+    return 0;
+}
+
+/* x / 2**shift rounded down, or x * 2**-shift for a negative shift. */
+static Words Shift(const Words &x, long shift)
+{
+    Words result;
+
+    if (shift < 0)
+    {
+        auto words = static_cast<std::size_t>(-shift) / 32;
+        auto bits = static_cast<unsigned int>(-shift % 32);
+
+        result.assign(words, 0);
+        std::uint32_t carry = 0;
+
+        for (auto word : x)
+        {
+            result.push_back(bits != 0 ? (word << bits) | carry : word);
+            carry = bits != 0 ? word >> (32 - bits) : 0;
+        }
+
+        result.push_back(carry);
+        return result;
+    }
+
+    auto words = static_cast<std::size_t>(shift) / 32;
+    auto bits = static_cast<unsigned int>(shift % 32);
+
+    for (auto i = words; i < x.size(); i++)
+    {
+        auto high = i + 1 < x.size() ? x[i + 1] : 0;
+        result.push_back(bits != 0 ? (x[i] >> bits) | (high << (32 - bits)) : x[i]);
+    }
+
+    return result;
+}
+
+static Wide Low128(const Words &x)
+{
+    Wide result = 0;
+    for (std::size_t i = 0; i < x.size() && i < 4; i++) result |= Wide(x[i]) << (32 * i);
+    return result;
+}
+
+static void MultiplySmall(Words &x, std::uint32_t factor)
+{
+    std::uint64_t carry = 0;
+
+    for (auto &word : x)
+    {
+        auto product = std::uint64_t(word) * factor + carry;
+        word = static_cast<std::uint32_t>(product);
+        carry = product >> 32;
+    }
+
+    if (carry != 0) x.push_back(static_cast<std::uint32_t>(carry));
+}
+
+static void DivideSmall(Words &x, std::uint32_t divisor)
+{
+    std::uint64_t remainder = 0;
+
+    for (auto i = x.size(); i-- > 0; )
+    {
+        auto dividend = (remainder << 32) | x[i];
+        x[i] = static_cast<std::uint32_t>(dividend / divisor);
+        remainder = dividend % divisor;
+    }
+}
+
+static void AddOne(Words &x)
+{
+    for (auto &word : x)
+        if (++word != 0) return;
+
+    x.push_back(1);
+}
+
+static void Store(std::uint64_t (&entry)[2], Wide value, bool highFirst)
+{
+    entry[highFirst ? 0 : 1] = static_cast<std::uint64_t>(value >> 64);
+    entry[highFirst ? 1 : 0] = static_cast<std::uint64_t>(value);
+}
+
+/* 5**q exactly by repeated multiplication, and 2**Scale / 5**q rounded down by
+   repeated division, which stays exact since floor(floor(x) / 5) is floor(x / 5). */
+static PowerTables MakeTables()
+{
+    constexpr long Scale = 1800;
+
+    PowerTables tables;
+    Words power { 1 }, inverse(Scale / 32 + 1, 0);
+    inverse.back() = std::uint32_t(1) << (Scale % 32);
+
+    for (int q = 0; q <= -SmallestPower; q++)
+    {
+        auto length = static_cast<long>( BitLength(power) );
+
+        if (q < RyuSize) Store(tables.mRyu[q], Low128( Shift(power, length - RyuBits) ), false);
+        if (q <= LargestPower) Store(tables.mPowers[q - SmallestPower], Low128( Shift(power, length - 128) ), true);
+
+        /* 2**(length - 1 + RyuBits) / 5**q, plus one. */
+        if (q < RyuInverseSize)
+        {
+            auto value = Shift(inverse, Scale - (length - 1 + RyuBits));
+            AddOne(value);
+            Store(tables.mRyuInverse[q], Low128(value), false);
+        }
+
+        /* As the table of the fast_float library: 2**b / 5**q plus one, cut to 128 bits. */
+        if (q > 0)
+        {
+            auto b = q <= 27 ? length + 127 : 2 * length + 128;
+            auto value = Shift(inverse, Scale - b);
+            AddOne(value);
+
+            Store(tables.mPowers[-q - SmallestPower], Low128( Shift(value, static_cast<long>(BitLength(value)) - 128) ), true);
+        }
+
+        MultiplySmall(power, 5);
+        DivideSmall(inverse, 5);
+    }
+
+    return tables;
+}
+
+static const PowerTables & Tables()
+{
+    static const PowerTables tables = MakeTables();
+    return tables;
+}
+
+
+/* Parsing */
+
+static double FromBits(std::uint64_t bits)
+{
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/* Nearest double to w * 10**q for a w of at most 19 digits. Exact doubles are used as
+   they are when both w and 10**q are, otherwise the Eisel-Lemire algorithm, which
+   always decides with the 128-bit power as Mushtak and Lemire show. */
+static double Compute(std::uint64_t w, long q)
+{
+    static const double Exact[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+    if (w == 0 || q < SmallestPower) return 0.0;
+    if (q > LargestPower) return std::numeric_limits<double>::infinity();
+
+    if (w <= (std::uint64_t(1) << 53) && q >= -22 && q <= 22)
+        return q >= 0 ? static_cast<double>(w) * Exact[q] : static_cast<double>(w) / Exact[-q];
+
+    auto &power = Tables().mPowers[q - SmallestPower];
+    auto zeros = __builtin_clzll(w);
+    w <<= zeros;
+
+    /* Only the 55 top bits matter, the low word is needed when they may carry. */
+    auto product = Wide(w) * power[0];
+    auto high = static_cast<std::uint64_t>(product >> 64), low = static_cast<std::uint64_t>(product);
+
+    if ((high & 0x1ff) == 0x1ff)
+    {
+        auto second = static_cast<std::uint64_t>( (Wide(w) * power[1]) >> 64 );
+        low += second;
+        if (second > low) high++;
+    }
+
+    auto upper = static_cast<int>(high >> 63);
+    auto mantissa = high >> (upper + 9);
+    auto exponent = static_cast<long>( ((152170 + 65536) * q) >> 16 ) + 63 + upper - zeros + 1023;
+
+    if (exponent <= 0)
+    {
+        if (-exponent + 1 >= 64) return 0.0;
+
+        mantissa >>= -exponent + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+
+        /* Rounding may carry into the smallest normal, whose bits are the same. */
+        return FromBits(mantissa);
+    }
+
+    /* Exactly halfway, between -4 and 23 only, rounds to even. */
+    if (low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << (upper + 9)) == high) mantissa &= ~std::uint64_t(1);
+
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+
+    if (mantissa >= (std::uint64_t(2) << 52))
+    {
+        mantissa = std::uint64_t(1) << 52;
+        exponent++;
+    }
+
+    if (exponent >= 0x7ff) return std::numeric_limits<double>::infinity();
+
+    mantissa &= ~(std::uint64_t(1) << 52);
+    return FromBits(mantissa | (std::uint64_t(exponent) << 52));
+}
+
+static bool IsWord(std::wstring_view text, const wchar_t *word)
+{
+    if (text.size() != std::wcslen(word)) return false;
+
+    for (std::size_t i = 0; i < text.size(); i++)
+        if ((text[i] | 0x20) != word[i]) return false;
+
+    return true;
+}
+
+static bool IsDigit(std::wstring_view text, std::size_t at)
+{
+    return at < text.size() && text[at] >= L'0' && text[at] <= L'9';
+}
+
+bool FloatConversion::Parse(std::wstring_view text, double &result)
+{
+    std::size_t at = 0;
+    auto negative = false;
+
+    if (at < text.size() && (text[at] == L'+' || text[at] == L'-')) negative = text[at++] == L'-';
+
+    auto word = text.substr(at);
+
+    if (IsWord(word, L"inf") || IsWord(word, L"infinity") || IsWord(word, L"nan"))
+    {
+        result = (word[0] | 0x20) == L'n' ? std::numeric_limits<double>::quiet_NaN() : std::numeric_limits<double>::infinity();
+        if (negative) result = -result;
+        return true;
+    }
+
+    /* The first 19 significant digits, the exponent counts the rest. */
+    std::uint64_t w = 0;
+    long exponent = 0;
+    unsigned int taken = 0;
+    auto truncated = false, any = false, fraction = false;
+
+    for (; at < text.size(); at++)
+    {
+        auto ch = text[at];
+
+        if (ch == L'_' && at > 0 && IsDigit(text, at - 1) && IsDigit(text, at + 1)) continue;
+
+        if (ch == L'.' && !fraction)
+        {
+            fraction = true;
+            continue;
+        }
+
+        if (ch < L'0' || ch > L'9') break;
+
+        any = true;
+        auto digit = static_cast<unsigned int>(ch - L'0');
+
+        if (w == 0 && digit == 0)
+        {
+            if (fraction) exponent--;
+        }
+        else if (taken < 19)
+        {
+            w = w * 10 + digit;
+            taken++;
+            if (fraction) exponent--;
+        }
+        else
+        {
+            truncated |= digit != 0;
+            if (!fraction) exponent++;
+        }
+    }
+
+    if (!any) return false;
+
+    if (at < text.size() && (text[at] | 0x20) == L'e')
+    {
+        auto sign = 1;
+        at++;
+
+        if (at < text.size() && (text[at] == L'+' || text[at] == L'-')) sign = text[at++] == L'-' ? -1 : 1;
+        if (!IsDigit(text, at)) return false;
+
+        long value = 0;
+
+        for (; at < text.size(); at++)
+        {
+            if (text[at] == L'_' && IsDigit(text, at - 1) && IsDigit(text, at + 1)) continue;
+            if (!IsDigit(text, at)) break;
+
+            if (value < 100000) value = value * 10 + (text[at] - L'0');
+        }
+
+        exponent += sign * value;
+    }
+
+    if (at != text.size()) return false;
+
+    result = Compute(w, exponent);
+
+    /* The digits dropped lie between w and w + 1, when those round apart only all the
+       digits decide. */
+    if (truncated && Compute(w + 1, exponent) != result)
+    {
+        std::string narrow;
+
+        for (auto ch : text)
+            if (ch != L'_') narrow.push_back(static_cast<char>(ch));
+
+        result = std::strtod(narrow.c_str(), nullptr);
+        return true;
+    }
+
+    if (negative) result = -result;
+    return true;
+}
+
+
+/* Formatting */
+
+static std::uint32_t Pow5Bits(std::int32_t e)
+{
+    return ((static_cast<std::uint32_t>(e) * 1217359) >> 19) + 1;
+}
+
+static std::uint32_t Log10Pow2(std::int32_t e)
+{
+    return (static_cast<std::uint32_t>(e) * 78913) >> 18;
+}
+
+static std::uint32_t Log10Pow5(std::int32_t e)
+{
+    return (static_cast<std::uint32_t>(e) * 732923) >> 20;
+}
+
+static unsigned int Pow5Factor(std::uint64_t value)
+{
+    unsigned int count = 0;
+
+    for (; value % 5 == 0; value /= 5) count++;
+    return count;
+}
+
+static bool MultipleOfPowerOf5(std::uint64_t value, std::uint32_t p)
+{
+    return Pow5Factor(value) >= p;
+}
+
+static bool MultipleOfPowerOf2(std::uint64_t value, std::uint32_t p)
+{
+    return (value & ((std::uint64_t(1) << p) - 1)) == 0;
+}
+
+static std::uint64_t MulShift(std::uint64_t m, const std::uint64_t *mul, std::int32_t j)
+{
+    auto low = Wide(m) * mul[0], high = Wide(m) * mul[1];
+    return static_cast<std::uint64_t>( ((low >> 64) + high) >> (j - 64) );
+}
+
+unsigned int FloatConversion::Shortest(double value, char digits[17], int &exponent)
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    auto ieeeMantissa = bits & ((std::uint64_t(1) << 52) - 1);
+    auto ieeeExponent = static_cast<std::uint32_t>((bits >> 52) & 0x7ff);
+
+    /* The interval of reals rounding to the double, in units of a quarter of its spacing. */
+    std::int32_t e2;
+    std::uint64_t m2;
+
+    if (ieeeExponent == 0)
+    {
+        e2 = 1 - 1023 - 52 - 2;
+        m2 = ieeeMantissa;
+    }
+    else
+    {
+        e2 = static_cast<std::int32_t>(ieeeExponent) - 1023 - 52 - 2;
+        m2 = (std::uint64_t(1) << 52) | ieeeMantissa;
+    }
+
+    auto acceptBounds = (m2 & 1) == 0;
+    auto mv = 4 * m2;
+    std::uint32_t mmShift = ieeeMantissa != 0 || ieeeExponent <= 1;
+
+    auto &tables = Tables();
+    std::uint64_t vr, vp, vm;
+    std::int32_t e10;
+    auto vmIsTrailingZeros = false, vrIsTrailingZeros = false;
+
+    /* Bounds and value times a power of ten, with whether the dropped part was zero. */
+    if (e2 >= 0)
+    {
+        auto q = Log10Pow2(e2) - (e2 > 3);
+        e10 = static_cast<std::int32_t>(q);
+
+        auto k = RyuBits + static_cast<std::int32_t>( Pow5Bits(static_cast<std::int32_t>(q)) ) - 1;
+        auto i = -e2 + static_cast<std::int32_t>(q) + k;
+        auto mul = tables.mRyuInverse[q];
+
+        vr = MulShift(4 * m2, mul, i);
+        vp = MulShift(4 * m2 + 2, mul, i);
+        vm = MulShift(4 * m2 - 1 - mmShift, mul, i);
+
+        if (q <= 21)
+        {
+            if (mv % 5 == 0) vrIsTrailingZeros = MultipleOfPowerOf5(mv, q);
+            else if (acceptBounds) vmIsTrailingZeros = MultipleOfPowerOf5(mv - 1 - mmShift, q);
+            else vp -= MultipleOfPowerOf5(mv + 2, q);
+        }
+    }
+    else
+    {
+        auto q = Log10Pow5(-e2) - (-e2 > 1);
+        e10 = static_cast<std::int32_t>(q) + e2;
+
+        auto i = -e2 - static_cast<std::int32_t>(q);
+        auto k = static_cast<std::int32_t>( Pow5Bits(i) ) - RyuBits;
+        auto j = static_cast<std::int32_t>(q) - k;
+        auto mul = tables.mRyu[i];
+
+        vr = MulShift(4 * m2, mul, j);
+        vp = MulShift(4 * m2 + 2, mul, j);
+        vm = MulShift(4 * m2 - 1 - mmShift, mul, j);
+
+        if (q <= 1)
+        {
+            vrIsTrailingZeros = true;
+            if (acceptBounds) vmIsTrailingZeros = mmShift == 1;
+            else vp--;
+        }
+        else if (q < 63) vrIsTrailingZeros = MultipleOfPowerOf2(mv, q);
+    }
+
+    /* Drops digits while the bounds still differ above them. */
+    std::int32_t removed = 0;
+    std::uint64_t output;
+
+    if (vmIsTrailingZeros || vrIsTrailingZeros)
+    {
+        unsigned int lastRemovedDigit = 0;
+
+        for (; vp / 10 > vm / 10; removed++)
+        {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = static_cast<unsigned int>(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+        }
+
+        if (vmIsTrailingZeros)
+        {
+            for (; vm % 10 == 0; removed++)
+            {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = static_cast<unsigned int>(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+            }
+        }
+
+        /* Exactly halfway rounds to even. */
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) lastRemovedDigit = 4;
+
+        output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+    }
+    else
+    {
+        auto roundUp = false;
+
+        for (; vp / 10 > vm / 10; removed++)
+        {
+            roundUp = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+        }
+
+        output = vr + (vr == vm || roundUp);
+    }
+
+    unsigned int count = 0;
+    char reversed[17];
+
+    for (; output != 0; output /= 10) reversed[count++] = static_cast<char>('0' + output % 10);
+    for (unsigned int i = 0; i < count; i++) digits[i] = reversed[count - 1 - i];
+
+    exponent = e10 + removed;
+    return count;
+}
+
+std::wstring FloatConversion::Repr(double value)
+{
+    if (std::isnan(value)) return L"nan";
+    if (std::isinf(value)) return value < 0 ? L"-inf" : L"inf";
+
+    std::wstring result = std::signbit(value) ? L"-" : L"";
+    if (value == 0.0) return result + L"0.0";
+
+    char digits[17];
+    int exponent;
+    auto count = static_cast<int>( Shortest(std::fabs(value), digits, exponent) );
+
+    /* Place of the decimal point after the first digit, Python writes exponents outside -4 to 16. */
+    auto point = count + exponent;
+    auto append = [&](int from, int to) { for (auto i = from; i < to; i++) result += static_cast<wchar_t>(digits[i]); };
+
+    if (point > -4 && point <= 16)
+    {
+        if (point <= 0)
+        {
+            result += L"0." + std::wstring(static_cast<std::size_t>(-point), L'0');
+            append(0, count);
+        }
+        else if (point >= count)
+        {
+            append(0, count);
+            result += std::wstring(static_cast<std::size_t>(point - count), L'0') + L".0";
+        }
+        else
+        {
+            append(0, point);
+            result += L'.';
+            append(point, count);
+        }
+
+        return result;
+    }
+
+    append(0, 1);
+
+    if (count > 1)
+    {
+        result += L'.';
+        append(1, count);
+    }
+
+    auto scientific = point - 1;
+    result += scientific < 0 ? L"e-" : L"e+";
+    if (std::abs(scientific) < 10) result += L'0';
+    return result + std::to_wstring(std::abs(scientific));
+}
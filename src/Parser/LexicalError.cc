@@ -8,3 +8,13 @@ LexicalError::LexicalError(unsigned int position, std::shared_ptr<std::wstring>
     mPosition = position;
     mMsg = msg;
 }
+
+unsigned int LexicalError::GetPosition()
+{
+    return mPosition;
+}
+
+std::shared_ptr<std::wstring> LexicalError::GetMessage()
+{
+    return mMsg;
+}
@@ -0,0 +1,25 @@
+#include <NameInterner.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+NameInterner::NameInterner()
+{
+
+}
+
+std::shared_ptr<const std::wstring> NameInterner::Intern(const std::wstring &text)
+{
+    auto it = mNames.find(text);
+
+    if (it != mNames.end()) return it->second;
+
+    auto name = std::make_shared<const std::wstring>(text);
+    mNames.emplace(text, name);
+
+    return name;
+}
+
+std::size_t NameInterner::Count()
+{
+    return mNames.size();
+}
@@ -4,7 +4,7 @@ using namespace PythonCoreNative::RunTime::Parser;
 
 NameToken::NameToken(   unsigned int startPosition, 
                         unsigned int endPosition, 
-                        std::shared_ptr<std::wstring> text,
+                        std::shared_ptr<const std::wstring> text,
                         std::shared_ptr<std::vector<std::shared_ptr<Trivia>>> triviaList) 
     :   Token(startPosition, endPosition, TokenKind::Name, triviaList) 
 {
@@ -13,17 +13,17 @@ NameToken::NameToken(   unsigned int startPosition,
 
 bool NameToken::IsCaseSoftKeyword()
 {
-    return mText->find_first_of(L"case", 0, sizeof(wchar_t)) && mText->size() == 4;
+    return *mText == L"case";
 }
 
 bool NameToken::IsMatchSoftKeyword()
 {
-    return mText->find_first_of(L"match", 0, sizeof(wchar_t)) && mText->size() == 5;
+    return *mText == L"match";
 }
 
 bool NameToken::IsWildCardPattern()
 {
-    return mText->find_first_of(L"_", 0, sizeof(wchar_t)) && mText->size() == 1;
+    return *mText == L"_";
 }
 
 bool NameToken::IsNotWildCardPrefixed()
@@ -31,7 +31,7 @@ bool NameToken::IsNotWildCardPrefixed()
     return !mText->find_first_of(L"_", 0, sizeof(wchar_t));
 }
 
-std::shared_ptr<std::wstring> NameToken::GetText()
+std::shared_ptr<const std::wstring> NameToken::GetText()
 {
     return mText;
 }
@@ -0,0 +1,77 @@
+#include <NodeArena.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+/* Objects larger than this come from the heap, so chunks are not left mostly empty. */
+static constexpr std::size_t MaxArenaObject = NodeArena::ChunkSize / 8;
+
+static std::size_t Align(std::size_t size)
+{
+    return (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+}
+
+NodeArena::NodeArena()
+{
+    mChunk = nullptr;
+    mUsed = 0;
+    mChunks = 0;
+}
+
+NodeArena::~NodeArena()
+{
+    if (mChunk != nullptr) Retire(mChunk);
+}
+
+void *NodeArena::Allocate(std::size_t size)
+{
+    size = Align(size);
+
+    if (size > MaxArenaObject) return ::operator new(size);
+
+    if (mChunk == nullptr || mUsed + size > ChunkSize)
+    {
+        auto memory = std::aligned_alloc(ChunkSize, ChunkSize);
+        if (memory == nullptr) throw std::bad_alloc();
+
+        /* The arena holds one count on its current chunk. */
+        if (mChunk != nullptr) Retire(mChunk);
+        mChunk = new (memory) Chunk { { 1 } };
+        mUsed = Align(sizeof(Chunk));
+        mChunks++;
+    }
+
+    mChunk->mLive.fetch_add(1, std::memory_order_relaxed);
+
+    auto pointer = reinterpret_cast<char *>(mChunk) + mUsed;
+    mUsed += size;
+
+    return pointer;
+}
+
+void NodeArena::Release(void *pointer, std::size_t size)
+{
+    if (Align(size) > MaxArenaObject)
+    {
+        ::operator delete(pointer);
+        return;
+    }
+
+    Retire(reinterpret_cast<Chunk *>(reinterpret_cast<std::uintptr_t>(pointer) & ~(ChunkSize - 1)));
+}
+
+void NodeArena::Retire(Chunk *chunk)
+{
+    if (chunk->mLive.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+    chunk->~Chunk();
+    std::free(chunk);
+}
+
+std::size_t NodeArena::ChunkCount()
+{
+    return mChunks;
+}
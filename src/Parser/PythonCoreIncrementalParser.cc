@@ -0,0 +1,258 @@
+#include <PythonCoreIncrementalParser.h>
+#include <ast/NodeVisitor.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+ParsedFile::ParsedFile( std::shared_ptr<std::wstring> source,
+                        std::shared_ptr<AST::FileInputNode> root,
+                        std::vector<unsigned int> boundaries,
+                        std::vector<StatementSpans> spans,
+                        std::vector<int> pending,
+                        unsigned int reusedStatements )
+{
+    mSource = source;
+    mRoot = root;
+    mBoundaries = std::move(boundaries);
+    mSpans = std::move(spans);
+    mPending = std::move(pending);
+    mReusedStatements = reusedStatements;
+}
+
+std::shared_ptr<std::wstring> ParsedFile::GetSource()
+{
+    return mSource;
+}
+
+std::shared_ptr<AST::FileInputNode> ParsedFile::GetRoot()
+{
+    if (mRoot == nullptr) return nullptr;
+
+    for (unsigned int i = 0; i < mPending.size(); i++) Settle(i);
+    return mRoot;
+}
+
+std::shared_ptr<AST::StatementNode> ParsedFile::GetStatement(unsigned int index)
+{
+    Settle(index);
+    return (*mRoot->GetNodes())[index];
+}
+
+const std::vector<unsigned int> & ParsedFile::GetBoundaries()
+{
+    return mBoundaries;
+}
+
+unsigned int ParsedFile::GetReusedStatements()
+{
+    return mReusedStatements;
+}
+
+void ParsedFile::Settle(unsigned int index)
+{
+    if (mPending[index] == 0) return;
+
+    for (auto node : mSpans[index].mNodes) node->Shift(mPending[index]);
+    for (auto token : mSpans[index].mTokens) token->Shift(mPending[index]);
+    mPending[index] = 0;
+}
+
+
+namespace
+{
+    struct CollectChildren
+    {
+        std::vector<std::shared_ptr<AST::Node>> &mStack;
+        StatementSpans &mSpans;
+
+        void operator()(std::shared_ptr<Token> token)
+        {
+            if (token != nullptr) mSpans.mTokens.push_back(token.get());
+        }
+
+        void operator()(std::shared_ptr<AST::Node> node)
+        {
+            if (node != nullptr) mStack.push_back(node);
+        }
+
+        template <typename T>
+        void operator()(std::shared_ptr<std::vector<std::shared_ptr<T>>> nodes)
+        {
+            if (nodes == nullptr) return;
+            for (auto &element : *nodes) (*this)(element);
+        }
+    };
+}
+
+static StatementSpans CollectSpans(std::shared_ptr<AST::Node> root)
+{
+    StatementSpans spans;
+    std::vector<std::shared_ptr<AST::Node>> stack { root };
+    CollectChildren collect { stack, spans };
+
+    while (!stack.empty())
+    {
+        auto node = std::move(stack.back());
+        stack.pop_back();
+
+        spans.mNodes.push_back(node.get());
+        AST::ForEachChild(node, collect);
+    }
+
+    return spans;
+}
+
+static unsigned int Moved(unsigned int position, int delta)
+{
+    return static_cast<unsigned int>(static_cast<long long>(position) + delta);
+}
+
+PythonCoreIncrementalParser::PythonCoreIncrementalParser(unsigned int tabSize, unsigned int maxDepth)
+{
+    mTabSize = tabSize;
+    mMaxDepth = maxDepth;
+}
+
+std::shared_ptr<ParsedFile> PythonCoreIncrementalParser::Parse(std::shared_ptr<std::wstring> source)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>(source);
+    auto lexer = std::make_shared<PythonCoreTokenizer>(mTabSize, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer, mMaxDepth);
+    auto nodes = std::make_shared<std::vector<std::shared_ptr<AST::StatementNode>>>();
+    auto newlines = std::make_shared<std::vector<std::shared_ptr<Token>>>();
+    std::vector<unsigned int> boundaries;
+
+    lexer->Advance();
+    auto startPos = lexer->Position();
+
+    parser->ParseFileInputStatements(std::numeric_limits<unsigned int>::max(), nodes, newlines, &boundaries);
+
+    auto root = std::make_shared<AST::FileInputNode>(startPos, lexer->Position(), newlines, nodes, lexer->CurSymbol());
+
+    std::vector<StatementSpans> spans;
+    for (auto &node : *nodes) spans.push_back(CollectSpans(node));
+
+    std::vector<int> pending(nodes->size(), 0);
+
+    return std::make_shared<ParsedFile>(source, root, std::move(boundaries), std::move(spans), std::move(pending), 0);
+}
+
+std::shared_ptr<ParsedFile> PythonCoreIncrementalParser::Reparse(std::shared_ptr<ParsedFile> previous, const TextEdit &edit, std::shared_ptr<std::wstring> source)
+{
+    auto root = previous->mRoot;
+    auto &bounds = previous->GetBoundaries();
+    auto oldNodes = root->GetNodes();
+    auto oldNewlines = root->GetNewlines();
+    auto count = static_cast<unsigned int>(oldNodes->size());
+    auto delta = static_cast<int>(edit.mNewLength) - static_cast<int>(edit.mOldLength);
+
+    if (count == 0) return Parse(source);
+
+    /* Statement k owns [bounds[k - 1], bounds[k]), the first one starts at 0 and text after
+       the last boundary belongs to the end of file token. */
+    auto owner = [&bounds](unsigned int position) {
+        return static_cast<unsigned int>(std::upper_bound(bounds.begin(), bounds.end(), position) - bounds.begin());
+    };
+
+    auto first = owner(edit.mStart);
+    auto last = owner(edit.mOldLength > 0 ? edit.mStart + edit.mOldLength - 1 : edit.mStart);
+
+    /* One statement of context on each side. An indented line joins the suite before it,
+       and a joined line pulls in the statement after it. */
+    first = first > 0 ? first - 1 : 0;
+    last = std::min(last + 1, count - 1);
+
+    auto toEnd = last == count - 1;
+    auto regionStart = first == 0 ? 0 : bounds[first - 1];
+    auto regionEnd = toEnd ? std::numeric_limits<unsigned int>::max() : Moved(bounds[last], delta);
+
+    auto sourceBuffer = std::make_shared<SourceBuffer>(source);
+    sourceBuffer->SetPosition(regionStart);
+
+    auto lexer = std::make_shared<PythonCoreTokenizer>(mTabSize, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer, mMaxDepth);
+
+    auto nodes = std::make_shared<std::vector<std::shared_ptr<AST::StatementNode>>>(oldNodes->begin(), oldNodes->begin() + first);
+    auto newlines = std::make_shared<std::vector<std::shared_ptr<Token>>>();
+    std::vector<unsigned int> boundaries(bounds.begin(), bounds.begin() + first);
+
+    for (auto &newline : *oldNewlines)
+        if (newline->GetFullStartPosition() < regionStart) newlines->push_back(newline);
+
+    unsigned int startPos;
+
+    try
+    {
+
+        lexer->Advance();
+        startPos = first == 0 ? lexer->Position() : root->GetStart();
+
+        parser->ParseFileInputStatements(regionEnd, nodes, newlines, &boundaries);
+
+    }
+    catch (std::shared_ptr<SyntaxError> error)
+    {
+        return Parse(source);
+    }
+    catch (std::shared_ptr<LexicalError> error)
+    {
+        return Parse(source);
+    }
+
+    if (!toEnd)
+    {
+        /* The edited statements must end where the old ones did, with the lexer back at the
+           start of a file level line, else the edit reached past the region. */
+        auto next = lexer->CurSymbol();
+
+        if (    next->GetFullStartPosition() != regionEnd ||
+                next->GetSymbolKind() == TokenKind::Indent ||
+                next->GetSymbolKind() == TokenKind::Dedent ||
+                next->GetSymbolKind() == TokenKind::EndOfFile ) return Parse(source);
+    }
+
+    std::vector<StatementSpans> spans;
+    auto &oldSpans = previous->mSpans;
+    auto &oldPending = previous->mPending;
+
+    for (unsigned int i = 0; i < first; i++) spans.push_back(std::move(oldSpans[i]));
+    for (auto i = first; i < nodes->size(); i++) spans.push_back(CollectSpans((*nodes)[i]));
+
+    std::vector<int> pending(oldPending.begin(), oldPending.begin() + first);
+    pending.resize(nodes->size(), 0);
+
+    previous->mRoot = nullptr;
+
+    if (toEnd)
+    {
+        auto file = std::make_shared<AST::FileInputNode>(startPos, lexer->Position(), newlines, nodes, lexer->CurSymbol());
+
+        return std::make_shared<ParsedFile>(source, file, std::move(boundaries), std::move(spans), std::move(pending), first);
+    }
+
+    for (auto i = last + 1; i < count; i++)
+    {
+        nodes->push_back((*oldNodes)[i]);
+        boundaries.push_back(Moved(bounds[i], delta));
+        spans.push_back(std::move(oldSpans[i]));
+        pending.push_back(oldPending[i] + delta);
+    }
+
+    for (auto &newline : *oldNewlines)
+    {
+        if (newline->GetFullStartPosition() < bounds[last]) continue;
+
+        if (delta != 0) newline->Shift(delta);
+        newlines->push_back(newline);
+    }
+
+    auto eof = root->GetEof();
+    if (delta != 0) eof->Shift(delta);
+
+    auto file = std::make_shared<AST::FileInputNode>(startPos, Moved(root->GetEnd(), delta), newlines, nodes, eof);
+
+    return std::make_shared<ParsedFile>(source, file, std::move(boundaries), std::move(spans), std::move(pending), first + count - last - 1);
+}
@@ -0,0 +1,184 @@
+#include <PythonCoreParseCache.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+/* Two independent 64 bit lanes over 8 byte words, good enough to spread keys since hits
+   are checked against the stored source anyway. */
+static void HashWords(const void *data, std::size_t size, std::uint64_t &first, std::uint64_t &second)
+{
+    auto bytes = static_cast<const unsigned char *>(data);
+
+    while (size > 0)
+    {
+        std::uint64_t word = 0;
+        auto count = std::min<std::size_t>(size, sizeof(word));
+        std::memcpy(&word, bytes, count);
+
+        first = (first ^ word) * 0x100000001b3ull;
+        first ^= first >> 29;
+        second = (second ^ word) * 0x9e3779b97f4a7c15ull;
+        second ^= second >> 32;
+
+        bytes += count;
+        size -= count;
+    }
+}
+
+PythonCoreParseCache::PythonCoreParseCache(const std::string &directory, const ParseCacheOptions &options)
+    : mHits(0), mMisses(0), mBytes(0)
+{
+    mDirectory = directory;
+    mOptions = options;
+
+    std::error_code error;
+    std::filesystem::create_directories(mDirectory, error);
+
+    Evict();
+}
+
+std::string PythonCoreParseCache::GetEntryPath(const std::wstring &source)
+{
+    std::uint64_t key[] =
+    {
+        ParserVersion, PythonCoreTokenizer::Revision, AST::MappedCompactTree::Version,
+        mOptions.mTabSize, mOptions.mMaxDepth, source.size()
+    };
+    std::uint64_t first = 0xcbf29ce484222325ull, second = 0x84222325cbf29ce4ull;
+
+    HashWords(key, sizeof(key), first, second);
+    HashWords(source.data(), source.size() * sizeof(wchar_t), first, second);
+
+    static const char digits[] = "0123456789abcdef";
+    std::string name(32, '0');
+
+    for (unsigned int i = 0; i < 16; i++)
+    {
+        name[15 - i] = digits[(first >> (i * 4)) & 0xf];
+        name[31 - i] = digits[(second >> (i * 4)) & 0xf];
+    }
+
+    return ( std::filesystem::path(mDirectory) / (name + ".ast") ).string();
+}
+
+std::shared_ptr<AST::MappedCompactTree> PythonCoreParseCache::Parse(std::shared_ptr<std::wstring> source)
+{
+    auto path = GetEntryPath(*source);
+    auto tree = AST::MappedCompactTree::Open(path);
+
+    if (tree != nullptr && tree->GetSource() == std::wstring_view(*source))
+    {
+        mHits++;
+
+        std::error_code error;
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+
+        return tree;
+    }
+
+    mMisses++;
+
+    auto sourceBuffer = std::make_shared<SourceBuffer>(source);
+    auto lexer = std::make_shared<PythonCoreTokenizer>(mOptions.mTabSize, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer, mOptions.mMaxDepth);
+
+    auto compact = AST::CompactTree::FromNode(parser->ParseFileInput(), source);
+    auto bytes = AST::MappedCompactTree::Serialize(*compact);
+
+    /* A miss may replace an entry that holds other source or is damaged, its size
+       leaves the total. */
+    std::error_code error;
+    auto replaced = std::filesystem::file_size(path, error);
+    if (error) replaced = 0;
+
+    if (AST::MappedCompactTree::Write(bytes, path))
+    {
+        auto total = bytes.size() >= replaced ?
+            mBytes += bytes.size() - replaced :
+            mBytes -= replaced - bytes.size();
+
+        if (total > mOptions.mMaxBytes) Evict();
+    }
+
+    return AST::MappedCompactTree::FromBytes(std::move(bytes));
+}
+
+void PythonCoreParseCache::Evict()
+{
+    struct Entry
+    {
+        std::filesystem::path mPath;
+        std::filesystem::file_time_type mTime;
+        std::uint64_t mSize;
+    };
+
+    std::lock_guard<std::mutex> lock(mEvictLock);
+
+    std::vector<Entry> entries;
+    std::uint64_t total = 0;
+    std::error_code error, walk;
+
+    auto now = std::filesystem::file_time_type::clock::now();
+
+    for (std::filesystem::directory_iterator it(mDirectory, walk), end; !walk && it != end; it.increment(walk))
+    {
+        if (!it->is_regular_file(error)) continue;
+
+        auto time = it->last_write_time(error);
+        if (error) continue;
+
+        if (it->path().extension() == ".tmp")
+        {
+            /* Writers publish within moments, an old temporary file is left over from a crash. */
+            if (now - time > std::chrono::hours(1)) std::filesystem::remove(it->path(), error);
+            continue;
+        }
+
+        if (it->path().extension() != ".ast") continue;
+
+        auto size = it->file_size(error);
+        if (error) continue;
+
+        entries.push_back( { it->path(), time, size } );
+        total += size;
+    }
+
+    /* Down to nine tenths, so the next few stores do not scan again. */
+    if (total > mOptions.mMaxBytes)
+    {
+        auto target = mOptions.mMaxBytes - mOptions.mMaxBytes / 10;
+
+        std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return a.mTime < b.mTime; });
+
+        for (auto &entry : entries)
+        {
+            if (total <= target) break;
+
+            std::filesystem::remove(entry.mPath, error);
+            total -= entry.mSize;
+        }
+    }
+
+    mBytes = total;
+}
+
+std::uint64_t PythonCoreParseCache::GetHits()
+{
+    return mHits;
+}
+
+std::uint64_t PythonCoreParseCache::GetMisses()
+{
+    return mMisses;
+}
+
+std::uint64_t PythonCoreParseCache::GetBytes()
+{
+    return mBytes;
+}
@@ -0,0 +1,265 @@
+#include <PythonCoreParseFiles.h>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+namespace
+{
+    /* Owner takes from the front, thieves from the back. All work is dealt out before
+       the workers start, so an empty pass over every queue means the pool is done. */
+    class WorkQueue
+    {
+        public:
+            void Push(unsigned int item)
+            {
+                std::lock_guard<std::mutex> lock(mLock);
+                mItems.push_back(item);
+            }
+
+            bool Pop(unsigned int &item)
+            {
+                std::lock_guard<std::mutex> lock(mLock);
+                if (mItems.empty()) return false;
+                item = mItems.front();
+                mItems.pop_front();
+                return true;
+            }
+
+            bool Steal(unsigned int &item)
+            {
+                std::lock_guard<std::mutex> lock(mLock);
+                if (mItems.empty()) return false;
+                item = mItems.back();
+                mItems.pop_back();
+                return true;
+            }
+
+        protected:
+            std::mutex mLock;
+            std::deque<unsigned int> mItems;
+    };
+
+    /* Per worker scratch, the raw byte buffer is reused between files, names are
+       interned and nodes allocated from one arena across all files the worker parses. */
+    struct WorkerState
+    {
+        std::string mBytes;
+        std::shared_ptr<NameInterner> mInterner = std::make_shared<NameInterner>();
+        std::shared_ptr<NodeArena> mArena = std::make_shared<NodeArena>();
+    };
+}
+
+static ParseFileResult ParseOneFile(const std::string &path, const ParseFilesOptions &options, WorkerState &state)
+{
+    ParseFileResult result;
+    result.mPath = path;
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+    if (!file)
+    {
+        result.mError = std::make_shared<std::wstring>(L"Unable to open file!");
+        return result;
+    }
+
+    auto size = static_cast<std::size_t>(file.tellg());
+    file.seekg(0);
+    state.mBytes.resize(size);
+
+    if (size > 0 && !file.read(&state.mBytes[0], size))
+    {
+        result.mError = std::make_shared<std::wstring>(L"Unable to read file!");
+        return result;
+    }
+
+    result.mSource = std::make_shared<std::wstring>();
+    DecodeUtf8(state.mBytes, *result.mSource);
+
+    try
+    {
+
+        auto sourceBuffer = std::make_shared<SourceBuffer>(result.mSource);
+        auto lexer = std::make_shared<PythonCoreTokenizer>(options.mTabSize, sourceBuffer);
+        lexer->SetInterner(state.mInterner);
+
+        auto parser = std::make_shared<PythonCoreParser>(lexer, options.mMaxDepth);
+        parser->SetPatternMemo(options.mPatternMemo);
+        parser->SetLazyFunctionBodies(options.mLazyFunctionBodies);
+        parser->SetErrorRecovery(options.mErrorRecovery);
+        parser->SetArena(state.mArena);
+
+        result.mRoot = parser->ParseFileInput();
+        result.mDiagnostics = parser->GetDiagnostics();
+
+    }
+    catch (std::shared_ptr<SyntaxError> error)
+    {
+        result.mError = error->GetMessage();
+        result.mErrorPosition = error->GetPosition();
+    }
+    catch (std::shared_ptr<LexicalError> error)
+    {
+        result.mError = error->GetMessage();
+        result.mErrorPosition = error->GetPosition();
+    }
+    catch (std::exception &error)
+    {
+        std::string what = error.what();
+        result.mRoot = nullptr;
+        result.mError = std::make_shared<std::wstring>(L"Internal error: " + std::wstring(what.begin(), what.end()));
+    }
+    catch (...)
+    {
+        result.mRoot = nullptr;
+        result.mError = std::make_shared<std::wstring>(L"Internal error!");
+    }
+
+    return result;
+}
+
+void PythonCoreNative::RunTime::Parser::ParseFiles(    const std::vector<std::string> &paths,
+                                                        const ParseFilesOptions &options,
+                                                        std::function<void(ParseFileResult &)> callback )
+{
+    if (paths.empty()) return;
+
+    /* Largest first, so the long parses start early instead of trailing at the end. */
+    std::vector<std::uintmax_t> sizes(paths.size());
+
+    for (std::size_t i = 0; i < paths.size(); i++)
+    {
+        std::error_code error;
+        auto size = std::filesystem::file_size(paths[i], error);
+        sizes[i] = error ? 0 : size;
+    }
+
+    std::vector<unsigned int> order(paths.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](unsigned int a, unsigned int b) { return sizes[a] > sizes[b]; });
+
+    unsigned int workers = options.mThreads > 0 ? options.mThreads : std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min<std::size_t>(workers, paths.size());
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+
+    for (unsigned int i = 0; i < workers; i++) queues.push_back(std::make_unique<WorkQueue>());
+    for (std::size_t i = 0; i < order.size(); i++) queues[i % workers]->Push(order[i]);
+
+    std::mutex callbackLock;
+    std::atomic<bool> stop(false);
+    std::exception_ptr failure;
+
+    auto run = [&](unsigned int worker)
+    {
+        WorkerState state;
+        unsigned int item;
+
+        while (!stop.load(std::memory_order_relaxed))
+        {
+
+            auto found = queues[worker]->Pop(item);
+
+            for (unsigned int i = 1; !found && i < workers; i++)
+                found = queues[(worker + i) % workers]->Steal(item);
+
+            if (!found) break;
+
+            auto result = ParseOneFile(paths[item], options, state);
+            result.mWorker = worker;
+
+            std::lock_guard<std::mutex> lock(callbackLock);
+
+            if (stop.load(std::memory_order_relaxed)) break;
+
+            try
+            {
+                callback(result);
+            }
+            catch (...)
+            {
+                failure = std::current_exception();
+                stop.store(true, std::memory_order_relaxed);
+            }
+
+        }
+    };
+
+    /* The calling thread is worker 0. */
+    std::vector<std::thread> threads;
+
+    for (unsigned int i = 1; i < workers; i++) threads.emplace_back(run, i);
+
+    run(0);
+
+    for (auto &thread : threads) thread.join();
+
+    if (failure) std::rethrow_exception(failure);
+}
+
+void PythonCoreNative::RunTime::Parser::DecodeUtf8(const std::string &bytes, std::wstring &text)
+{
+    auto data = reinterpret_cast<const unsigned char *>(bytes.data());
+    std::size_t size = bytes.size(), index = 0;
+
+    text.clear();
+    text.reserve(size);
+
+    if (size >= 3 && data[0] == 0xef && data[1] == 0xbb && data[2] == 0xbf) index = 3;
+
+    while (index < size)
+    {
+
+        unsigned int ch = data[index];
+
+        if (ch < 0x80)
+        {
+            text.push_back(static_cast<wchar_t>(ch));
+            index++;
+            continue;
+        }
+
+        unsigned int length = ch >= 0xf0 && ch < 0xf5 ? 4 : ch >= 0xe0 ? 3 : ch >= 0xc2 ? 2 : 0;
+
+        if (length == 0 || (length == 3 && ch >= 0xf0) || index + length > size)
+        {
+            text.push_back(static_cast<wchar_t>(0xfffd));
+            index++;
+            continue;
+        }
+
+        unsigned int codePoint = ch & (0x7f >> length);
+        auto valid = true;
+
+        for (unsigned int i = 1; i < length; i++)
+        {
+            if ((data[index + i] & 0xc0) != 0x80) { valid = false; break; }
+            codePoint = (codePoint << 6) | (data[index + i] & 0x3f);
+        }
+
+        /* Overlong forms, surrogates and values above U+10FFFF are rejected. */
+        if (valid && (  (length == 3 && codePoint < 0x800) ||
+                        (length == 4 && (codePoint < 0x10000 || codePoint > 0x10ffff)) ||
+                        (codePoint >= 0xd800 && codePoint <= 0xdfff) )) valid = false;
+
+        if (!valid)
+        {
+            text.push_back(static_cast<wchar_t>(0xfffd));
+            index++;
+            continue;
+        }
+
+        text.push_back(static_cast<wchar_t>(codePoint));
+        index += length;
+
+    }
+}
@@ -1,13 +1,65 @@
 
 #include <PythonCoreParser.h>
 
+#include <limits>
+
 using namespace PythonCoreNative::RunTime::Parser;
 
-PythonCoreParser::PythonCoreParser(std::shared_ptr<PythonCoreTokenizer> lexer)
+PythonCoreParser::PythonCoreParser(std::shared_ptr<PythonCoreTokenizer> lexer, unsigned int maxDepth)
 {
     mLexer = lexer;
     mFlowLevel = 0;
     mFuncLevel = 0;
+    mMaxDepth = maxDepth;
+    mDepth = 0;
+    mUsePatternMemo = true;
+    mLazyFunctionBodies = false;
+    mErrorRecovery = false;
+}
+
+void PythonCoreParser::SetPatternMemo(bool enabled)
+{
+    mUsePatternMemo = enabled;
+    mPatternMemo.clear();
+}
+
+void PythonCoreParser::SetLazyFunctionBodies(bool enabled)
+{
+    mLazyFunctionBodies = enabled;
+}
+
+void PythonCoreParser::SetErrorRecovery(bool enabled)
+{
+    mErrorRecovery = enabled;
+}
+
+void PythonCoreParser::SetArena(std::shared_ptr<NodeArena> arena)
+{
+    mArena = arena;
+}
+
+const std::vector<std::shared_ptr<SyntaxError>> & PythonCoreParser::GetDiagnostics()
+{
+    return mDiagnostics;
+}
+
+void PythonCoreParser::CheckNesting(unsigned int extra)
+{
+    if (mDepth + extra >= mMaxDepth)
+        throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Too many nested levels in source code!"));
+}
+
+PythonCoreParser::NestingGuard::NestingGuard(PythonCoreParser *parser, unsigned int weight)
+{
+    parser->CheckNesting(weight - 1);
+    mParser = parser;
+    mWeight = weight;
+    mParser->mDepth += weight;
+}
+
+PythonCoreParser::NestingGuard::~NestingGuard()
+{
+    mParser->mDepth -= mWeight;
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseEvalInput()
@@ -27,17 +79,45 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseEvalInput()
     if ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::EndOfFile )
         throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Expecting End of File in Func!"));
 
-    return std::make_shared<AST::EvalInputNode>(startPos, mLexer->Position(), newlines, right, mLexer->CurSymbol());
+    return MakeNode<AST::EvalInputNode>(startPos, mLexer->Position(), newlines, right, mLexer->CurSymbol());
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseFileInput()
 {
-    mLexer->Advance();
-    auto startPos = mLexer->Position();
+    auto startPos = 0u;
     auto nodes = std::make_shared<std::vector<std::shared_ptr<AST::StatementNode>>>();
     auto newlines = std::make_shared<std::vector<std::shared_ptr<Token>>>();
 
-    while ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::EndOfFile )
+    try
+    {
+
+        mLexer->Advance();
+        startPos = mLexer->Position();
+
+        ParseFileInputStatements(std::numeric_limits<unsigned int>::max(), nodes, newlines, nullptr);
+
+    }
+    catch (std::shared_ptr<LexicalError> error)
+    {
+        if (!mErrorRecovery) throw;
+
+        /* The lexer can not go on, the file ends at the error. */
+        mDiagnostics.push_back( std::make_shared<SyntaxError>(error->GetPosition(), nullptr, error->GetMessage()) );
+
+        auto eof = std::make_shared<Token>( error->GetPosition(), error->GetPosition(), TokenKind::EndOfFile, std::make_shared<std::vector<std::shared_ptr<Trivia>>>() );
+
+        return MakeNode<AST::FileInputNode>(startPos, error->GetPosition(), newlines, nodes, eof);
+    }
+
+    return MakeNode<AST::FileInputNode>(startPos, mLexer->Position(), newlines, nodes, mLexer->CurSymbol());
+}
+
+void PythonCoreParser::ParseFileInputStatements(    unsigned int end,
+                                                    std::shared_ptr<std::vector<std::shared_ptr<AST::StatementNode>>> nodes,
+                                                    std::shared_ptr<std::vector<std::shared_ptr<Token>>> newlines,
+                                                    std::vector<unsigned int> *boundaries )
+{
+    while ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::EndOfFile && mLexer->CurSymbol()->GetFullStartPosition() < end )
     {
         if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Newline )
         {
@@ -45,10 +125,16 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseFileInput()
             mLexer->Advance();
         }
         else
-            nodes->push_back( ParseStmt() );
-    }
+        {
+            nodes->push_back( ParseStmtOrError() );
+
+            if (boundaries != nullptr) boundaries->push_back( mLexer->CurSymbol()->GetFullStartPosition() );
 
-    return std::make_shared<AST::FileInputNode>(startPos, mLexer->Position(), newlines, nodes, mLexer->CurSymbol());
+            /* Nothing rewinds across file level statements. */
+            mLexer->Release( mLexer->TokenIndex() );
+            if (!mPatternMemo.empty()) mPatternMemo.clear();
+        }
+    }
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSingleInput()
@@ -73,19 +159,19 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSingleInput()
                 if ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::EndOfFile )
                     throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Expecting Newline after compund statement!"));
 
-                return std::make_shared<AST::SingleInputNode>(startPos, mLexer->Position(), mLexer->CurSymbol(), right);
+                return MakeNode<AST::SingleInputNode>(startPos, mLexer->Position(), mLexer->CurSymbol(), right);
             }
             break;
 
         case TokenKind::Newline:
 
-            return std::make_shared<AST::SingleInputNode>(startPos, mLexer->Position(), mLexer->CurSymbol(), nullptr);
+            return MakeNode<AST::SingleInputNode>(startPos, mLexer->Position(), mLexer->CurSymbol(), nullptr);
 
         default:
             {
                 auto right = ParseSimpleStmt();
 
-                return std::make_shared<AST::SingleInputNode>(startPos, mLexer->Position(), nullptr, right);
+                return MakeNode<AST::SingleInputNode>(startPos, mLexer->Position(), nullptr, right);
             }
     }
 }
@@ -108,7 +194,7 @@ std::shared_ptr<AST::TypeNode> PythonCoreParser::ParseFuncTypeInput()
         throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Expecting End of File in Func!"));
 
 
-    return std::make_shared<AST::TypeInputNode>(startPos, mLexer->Position(), newlines, right, mLexer->CurSymbol());
+    return MakeNode<AST::TypeInputNode>(startPos, mLexer->Position(), newlines, right, mLexer->CurSymbol());
 }
 
 std::shared_ptr<AST::TypeNode> PythonCoreParser::ParseFuncType()
@@ -137,7 +223,7 @@ std::shared_ptr<AST::TypeNode> PythonCoreParser::ParseFuncType()
 
     auto right = ParseTest();
 
-    return std::make_shared<AST::FuncTypeNode>(startPos, mLexer->Position(), symbol1, left, symbol2, symbol3, right);
+    return MakeNode<AST::FuncTypeNode>(startPos, mLexer->Position(), symbol1, left, symbol2, symbol3, right);
 }
 
 std::shared_ptr<AST::TypeNode> PythonCoreParser::ParseTypeList()
@@ -241,5 +327,5 @@ std::shared_ptr<AST::TypeNode> PythonCoreParser::ParseTypeList()
             break;
     }
 
-    return std::make_shared<AST::TypeListNode>(startPos, mLexer->Position(), nodes, separators, mulOp, mulNode, powerOp, powerNode);
+    return MakeNode<AST::TypeListNode>(startPos, mLexer->Position(), nodes, separators, mulOp, mulNode, powerOp, powerNode);
 }
\ No newline at end of file
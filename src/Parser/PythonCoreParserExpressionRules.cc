@@ -1,6 +1,7 @@
 
 #include <PythonCoreParser.h>
 
+#include <array>
 #include <typeinfo>
 
 using namespace PythonCoreNative::RunTime::Parser;
@@ -15,32 +16,32 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseAtom()
         case TokenKind::PyFalse:
 
             mLexer->Advance();
-            return std::make_shared<AST::AtomFalseNode>(startPos, mLexer->Position(), curSymbol);
+            return MakeNode<AST::AtomFalseNode>(startPos, mLexer->Position(), curSymbol);
         
         case TokenKind::PyTrue:
 
             mLexer->Advance();
-            return std::make_shared<AST::AtomTrueNode>(startPos, mLexer->Position(), curSymbol);
+            return MakeNode<AST::AtomTrueNode>(startPos, mLexer->Position(), curSymbol);
         
         case TokenKind::PyNone:
         
             mLexer->Advance();
-            return std::make_shared<AST::AtomNoneNode>(startPos, mLexer->Position(), curSymbol);
+            return MakeNode<AST::AtomNoneNode>(startPos, mLexer->Position(), curSymbol);
         
         case TokenKind::PyElipsis:
         
             mLexer->Advance();
-            return std::make_shared<AST::AtomElipsisNode>(startPos, mLexer->Position(), curSymbol);
+            return MakeNode<AST::AtomElipsisNode>(startPos, mLexer->Position(), curSymbol);
         
         case TokenKind::Name:
         
             mLexer->Advance();
-            return std::make_shared<AST::AtomNameNode>(startPos, mLexer->Position(), std::static_pointer_cast<NameToken>(curSymbol));
+            return MakeNode<AST::AtomNameNode>(startPos, mLexer->Position(), std::static_pointer_cast<NameToken>(curSymbol));
         
         case TokenKind::Number:
         
             mLexer->Advance();
-            return std::make_shared<AST::AtomNumberNode>(startPos, mLexer->Position(), std::static_pointer_cast<NumberToken>(curSymbol));
+            return MakeNode<AST::AtomNumberNode>(startPos, mLexer->Position(), std::static_pointer_cast<NumberToken>(curSymbol));
         
         case TokenKind::String:
         
@@ -52,18 +53,19 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseAtom()
                     mLexer->Advance();
                     curSymbol = mLexer->CurSymbol();
                 }
-                return std::make_shared<AST::AtomStringNode>(startPos, mLexer->Position(), lst);
+                return MakeNode<AST::AtomStringNode>(startPos, mLexer->Position(), lst);
             }
         
         case TokenKind::PyLeftParen:
         
             {
+                NestingGuard guard(this, DeepLevel);
                 mLexer->Advance();
                 if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightParen)
                 {
                     auto symbol2 = mLexer->CurSymbol();
                     mLexer->Advance();
-                    return std::make_shared<AST::AtomTupleNode>(startPos, mLexer->Position(), curSymbol, nullptr, symbol2);
+                    return MakeNode<AST::AtomTupleNode>(startPos, mLexer->Position(), curSymbol, nullptr, symbol2);
                 }
                 if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield)
                 {
@@ -72,7 +74,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseAtom()
                         throw std::make_shared<SyntaxError>(startPos, curSymbol, std::make_shared<std::wstring>(L"Missing ')' in tuple!"));
                     auto symbol2 = mLexer->CurSymbol();
                     mLexer->Advance();
-                    return std::make_shared<AST::AtomTupleNode>(startPos, mLexer->Position(), curSymbol, node, symbol2);
+                    return MakeNode<AST::AtomTupleNode>(startPos, mLexer->Position(), curSymbol, node, symbol2);
                 }
                 else
                 {
@@ -81,19 +83,20 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseAtom()
                         throw std::make_shared<SyntaxError>(startPos, curSymbol, std::make_shared<std::wstring>(L"Missing ')' in tuple!"));
                     auto symbol2 = mLexer->CurSymbol();
                     mLexer->Advance();
-                    return std::make_shared<AST::AtomTupleNode>(startPos, mLexer->Position(), curSymbol, node, symbol2);
+                    return MakeNode<AST::AtomTupleNode>(startPos, mLexer->Position(), curSymbol, node, symbol2);
                 }
             }
         
         case TokenKind::PyLeftBracket:
         
             {
+                NestingGuard guard(this, DeepLevel);
                 mLexer->Advance();
                 if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightBracket)
                 {
                     auto symbol2 = mLexer->CurSymbol();
                     mLexer->Advance();
-                    return std::make_shared<AST::AtomListNode>(startPos, mLexer->Position(), curSymbol, nullptr, symbol2);
+                    return MakeNode<AST::AtomListNode>(startPos, mLexer->Position(), curSymbol, nullptr, symbol2);
                 }
                 else
                 {
@@ -102,19 +105,20 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseAtom()
                         throw std::make_shared<SyntaxError>(startPos, curSymbol, std::make_shared<std::wstring>(L"Missing ']' in list!"));
                     auto symbol2 = mLexer->CurSymbol();
                     mLexer->Advance();
-                    return std::make_shared<AST::AtomListNode>(startPos, mLexer->Position(), curSymbol, node, symbol2);
+                    return MakeNode<AST::AtomListNode>(startPos, mLexer->Position(), curSymbol, node, symbol2);
                 }
             }
         
         case TokenKind::PyLeftCurly:
         
             {
+                NestingGuard guard(this, DeepLevel);
                 mLexer->Advance();
                 if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightCurly)
                 {
                     auto symbol2 = mLexer->CurSymbol();
                     mLexer->Advance();
-                    return std::make_shared<AST::AtomDictionaryNode>(startPos, mLexer->Position(), curSymbol, nullptr, symbol2);
+                    return MakeNode<AST::AtomDictionaryNode>(startPos, mLexer->Position(), curSymbol, nullptr, symbol2);
                 }
                 else
                 {
@@ -125,9 +129,9 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseAtom()
                     mLexer->Advance();
                     if (typeid(node) == typeid(AST::AtomSetNode))
                     {
-                        return std::make_shared<AST::AtomSetNode>(startPos, mLexer->Position(), curSymbol, node, symbol2);
+                        return MakeNode<AST::AtomSetNode>(startPos, mLexer->Position(), curSymbol, node, symbol2);
                     }
-                    return std::make_shared<AST::AtomDictionaryNode>(startPos, mLexer->Position(), curSymbol, node, symbol2);
+                    return MakeNode<AST::AtomDictionaryNode>(startPos, mLexer->Position(), curSymbol, node, symbol2);
                 }
             }
         
@@ -153,7 +157,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseAtomExpr()
                 {
                     lst->push_back(ParseTrailer());
                 }
-        return std::make_shared<AST::AtomExprNode>(startPos, mLexer->Position(), symbol, node, lst->size() == 0 ? nullptr : lst);
+        return MakeNode<AST::AtomExprNode>(startPos, mLexer->Position(), symbol, node, lst->size() == 0 ? nullptr : lst);
     }
     else
     {
@@ -170,194 +174,189 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseAtomExpr()
                             {
                                 lst->push_back(ParseTrailer());
                             }
-                    return std::make_shared<AST::AtomExprNode>(startPos, mLexer->Position(), nullptr, node, lst);
+                    return MakeNode<AST::AtomExprNode>(startPos, mLexer->Position(), nullptr, node, lst);
                 }
         return node;
     }
 }
 
-std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParsePower()
+/* Binding power of the binary operators, loosest first. A token with power zero does not
+   continue an expression. 'not' only binds as the first half of 'not in' here, its prefix
+   form is handled in ParseBinary. */
+enum BindingPower : unsigned int
 {
-    auto startPos = mLexer->Position();
-    auto left = ParseAtomExpr();
-
-    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPower)
-    {
-        auto symbol = mLexer->CurSymbol();
-        mLexer->Advance();
-        auto right = ParseFactor();
-        return std::make_shared<AST::PowerNode>(startPos, mLexer->Position(), left, symbol, right);
-    }
+    NoPower = 0, OrTestPower, AndTestPower, NotTestPower, ComparisonPower, BitOrPower,
+    BitXorPower, BitAndPower, ShiftPower, ArithPower, TermPower, FactorPower, PowerPower
+};
 
-    return left;
+static constexpr std::array<unsigned char, static_cast<std::size_t>(TokenKind::String) + 1> MakeBindingPowers()
+{
+    std::array<unsigned char, static_cast<std::size_t>(TokenKind::String) + 1> table {};
+
+    table[static_cast<std::size_t>(TokenKind::PyOr)] = OrTestPower;
+    table[static_cast<std::size_t>(TokenKind::PyAnd)] = AndTestPower;
+    table[static_cast<std::size_t>(TokenKind::PyLess)] = ComparisonPower;
+    table[static_cast<std::size_t>(TokenKind::PyLessEqual)] = ComparisonPower;
+    table[static_cast<std::size_t>(TokenKind::PyEqual)] = ComparisonPower;
+    table[static_cast<std::size_t>(TokenKind::PyGreater)] = ComparisonPower;
+    table[static_cast<std::size_t>(TokenKind::PyGreaterEqual)] = ComparisonPower;
+    table[static_cast<std::size_t>(TokenKind::PyNotEqual)] = ComparisonPower;
+    table[static_cast<std::size_t>(TokenKind::PyIn)] = ComparisonPower;
+    table[static_cast<std::size_t>(TokenKind::PyNot)] = ComparisonPower;
+    table[static_cast<std::size_t>(TokenKind::PyIs)] = ComparisonPower;
+    table[static_cast<std::size_t>(TokenKind::PyBitOr)] = BitOrPower;
+    table[static_cast<std::size_t>(TokenKind::PyBitXor)] = BitXorPower;
+    table[static_cast<std::size_t>(TokenKind::PyBitAnd)] = BitAndPower;
+    table[static_cast<std::size_t>(TokenKind::PyShiftLeft)] = ShiftPower;
+    table[static_cast<std::size_t>(TokenKind::PyShiftRight)] = ShiftPower;
+    table[static_cast<std::size_t>(TokenKind::PyPlus)] = ArithPower;
+    table[static_cast<std::size_t>(TokenKind::PyMinus)] = ArithPower;
+    table[static_cast<std::size_t>(TokenKind::PyMul)] = TermPower;
+    table[static_cast<std::size_t>(TokenKind::PyDiv)] = TermPower;
+    table[static_cast<std::size_t>(TokenKind::PyModulo)] = TermPower;
+    table[static_cast<std::size_t>(TokenKind::PyMatrice)] = TermPower;
+    table[static_cast<std::size_t>(TokenKind::PyFloorDiv)] = TermPower;
+    table[static_cast<std::size_t>(TokenKind::PyPower)] = PowerPower;
+
+    return table;
 }
 
-std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseFactor()
-{
-    auto startPos = mLexer->Position();
-    auto symbol = mLexer->CurSymbol();
+static constexpr auto BindingPowers = MakeBindingPowers();
 
+std::shared_ptr<AST::ExpressionNode> PythonCoreParser::MakeBinaryNode(  unsigned int startPos, unsigned int endPos,
+                                                                        std::shared_ptr<AST::ExpressionNode> left,
+                                                                        std::shared_ptr<Token> symbol,
+                                                                        std::shared_ptr<Token> symbol2,
+                                                                        std::shared_ptr<AST::ExpressionNode> right )
+{
     switch (symbol->GetSymbolKind())
     {
-        case TokenKind::PyPlus:
-            {
-                mLexer->Advance();
-                auto rightPlus = ParseFactor();
-                return std::make_shared<AST::UnaryPlusNode>(startPos, mLexer->Position(), symbol, rightPlus);
-            }
-        case TokenKind::PyMinus:
-            {
-                mLexer->Advance();
-                auto rightMinus = ParseFactor();
-                return std::make_shared<AST::UnaryMinusNode>(startPos, mLexer->Position(), symbol, rightMinus);
-            }
-        case TokenKind::PyBitInvert:
-            {
-                mLexer->Advance();
-                auto rightInvert = ParseFactor();
-                return std::make_shared<AST::UnaryBitInvertNode>(startPos, mLexer->Position(), symbol, rightInvert);
-            }
-        default:
-            return ParsePower();
+        case TokenKind::PyOr:           return MakeNode<AST::OrTestNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyAnd:          return MakeNode<AST::AndTestNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyLess:         return MakeNode<AST::CompareLessNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyLessEqual:    return MakeNode<AST::CompareLessEqualNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyEqual:        return MakeNode<AST::CompareEqualNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyGreater:      return MakeNode<AST::CompareGreaterNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyGreaterEqual: return MakeNode<AST::CompareGreaterEqualNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyNotEqual:     return MakeNode<AST::CompareNotEqualNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyIn:           return MakeNode<AST::CompareInNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyNot:          return MakeNode<AST::CompareNotInNode>(startPos, endPos, left, symbol, symbol2, right);
+        case TokenKind::PyIs:
+            if (symbol2 != nullptr)     return MakeNode<AST::CompareIsNotNode>(startPos, endPos, left, symbol, symbol2, right);
+            return MakeNode<AST::CompareIsNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyBitOr:        return MakeNode<AST::BitOrNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyBitXor:       return MakeNode<AST::BitXorNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyBitAnd:       return MakeNode<AST::BitAndNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyShiftLeft:    return MakeNode<AST::ShiftLeftNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyShiftRight:   return MakeNode<AST::ShiftRightNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyPlus:         return MakeNode<AST::PlusNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyMinus:        return MakeNode<AST::MinusNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyMul:          return MakeNode<AST::MulNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyDiv:          return MakeNode<AST::DivNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyModulo:       return MakeNode<AST::ModuloNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyMatrice:      return MakeNode<AST::MatriceNode>(startPos, endPos, left, symbol, right);
+        case TokenKind::PyFloorDiv:     return MakeNode<AST::FloorDivNode>(startPos, endPos, left, symbol, right);
+        default:                        return MakeNode<AST::PowerNode>(startPos, endPos, left, symbol, right);
     }
 }
 
-std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTerm()
+/* Precedence climbing over the 'or_test' down to 'power' rules of the grammar. Operands of a
+   left associative operator are parsed one level above it, '**' is right associative and
+   takes a 'factor' as its right operand. Operators still waiting for their right operand are
+   kept on a heap stack, so prefix and right associative chains do not recurse natively. */
+std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseBinary(unsigned int minPower)
 {
-    auto startPos = mLexer->Position();
-    auto left = ParseFactor();
-
-    while ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyMul ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyDiv ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyModulo ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyMatrice ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyFloorDiv)
-            {
-                auto symbol = mLexer->CurSymbol();
-                mLexer->Advance();
-                auto right = ParseFactor();
-                switch (symbol->GetSymbolKind())
-                {
-                    case TokenKind::PyMul:
-                        left = std::make_shared<AST::MulNode>(startPos, mLexer->Position(), left, symbol, right);
-                        break;
-                    case TokenKind::PyDiv:
-                        left = std::make_shared<AST::DivNode>(startPos, mLexer->Position(), left, symbol, right);
-                        break;
-                    case TokenKind::PyModulo:
-                        left = std::make_shared<AST::ModuloNode>(startPos, mLexer->Position(), left, symbol, right);
-                        break;
-                    case TokenKind::PyMatrice:
-                        left = std::make_shared<AST::MatriceNode>(startPos, mLexer->Position(), left, symbol, right);
-                        break;
-                    case TokenKind::PyFloorDiv:
-                        left = std::make_shared<AST::FloorDivNode>(startPos, mLexer->Position(), left, symbol, right);
-                        break;
-                    default:    break;
-                }
-            }
+    struct Pending
+    {
+        unsigned int mStartPos;
+        unsigned int mMinPower;
+        std::shared_ptr<Token> mSymbol;
+        std::shared_ptr<Token> mSymbol2;
+        std::shared_ptr<AST::ExpressionNode> mLeft;  /* nullptr for prefix operators */
+    };
 
-    return left;
-}
+    std::vector<Pending> pending;
 
-std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseArith()
-{
-    auto startPos = mLexer->Position();
-    auto left = ParseTerm();
-
-    while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPlus || mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyMinus)
+    while (true)
     {
+        auto startPos = mLexer->Position();
         auto symbol = mLexer->CurSymbol();
-        mLexer->Advance();
-        auto right = ParseTerm();
 
-        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPlus)
+        if (    (symbol->GetSymbolKind() == TokenKind::PyNot && minPower <= NotTestPower) ||
+                symbol->GetSymbolKind() == TokenKind::PyPlus ||
+                symbol->GetSymbolKind() == TokenKind::PyMinus ||
+                symbol->GetSymbolKind() == TokenKind::PyBitInvert )
         {
-            left = std::make_shared<AST::PlusNode>(startPos, mLexer->Position(), left, symbol, right);
+            CheckNesting(static_cast<unsigned int>(pending.size()));
+            pending.push_back( { startPos, minPower, symbol, nullptr, nullptr } );
+            mLexer->Advance();
+            minPower = symbol->GetSymbolKind() == TokenKind::PyNot ? NotTestPower : FactorPower;
+            continue;
         }
-        else
+
+        auto left = ParseAtomExpr();
+
+        while (true)
         {
-            left = std::make_shared<AST::MinusNode>(startPos, mLexer->Position(), left, symbol, right);
-        }
-    }
+            symbol = mLexer->CurSymbol();
+            unsigned int power = BindingPowers[static_cast<std::size_t>(symbol->GetSymbolKind())];
 
-    return left;
-}
+            if (power != NoPower && power >= minPower) break;
+            if (pending.empty()) return left;
 
+            auto operation = pending.back();
+            pending.pop_back();
 
-std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseShift()
-{
-    auto startPos = mLexer->Position();
-    auto left = ParseArith();
+            switch (operation.mLeft != nullptr ? TokenKind::Empty : operation.mSymbol->GetSymbolKind())
+            {
+                case TokenKind::PyNot:
+                    left = MakeNode<AST::NotTestNode>(operation.mStartPos, mLexer->Position(), operation.mSymbol, left);
+                    break;
+                case TokenKind::PyPlus:
+                    left = MakeNode<AST::UnaryPlusNode>(operation.mStartPos, mLexer->Position(), operation.mSymbol, left);
+                    break;
+                case TokenKind::PyMinus:
+                    left = MakeNode<AST::UnaryMinusNode>(operation.mStartPos, mLexer->Position(), operation.mSymbol, left);
+                    break;
+                case TokenKind::PyBitInvert:
+                    left = MakeNode<AST::UnaryBitInvertNode>(operation.mStartPos, mLexer->Position(), operation.mSymbol, left);
+                    break;
+                default:
+                    left = MakeBinaryNode(operation.mStartPos, mLexer->Position(), operation.mLeft, operation.mSymbol, operation.mSymbol2, left);
+                    break;
+            }
 
-    while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyShiftLeft || mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyShiftRight)
-    {
-        auto symbol = mLexer->CurSymbol();
+            startPos = operation.mStartPos;
+            minPower = operation.mMinPower;
+        }
+
+        unsigned int power = BindingPowers[static_cast<std::size_t>(symbol->GetSymbolKind())];
         mLexer->Advance();
-        auto right = ParseArith();
+        std::shared_ptr<Token> symbol2 = nullptr;
 
-        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyShiftLeft)
+        if (symbol->GetSymbolKind() == TokenKind::PyIs && mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyNot)
         {
-            left = std::make_shared<AST::ShiftLeftNode>(startPos, mLexer->Position(), left, symbol, right);
+            symbol2 = mLexer->CurSymbol();
+            mLexer->Advance();
         }
-        else
+        else if (symbol->GetSymbolKind() == TokenKind::PyNot)
         {
-            left = std::make_shared<AST::ShiftRightNode>(startPos, mLexer->Position(), left, symbol, right);
-        }
-    }
-
-    return left;
-}
-
-std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseAndExpr()
-{
-    auto startPos = mLexer->Position();
-    auto left = ParseShift();
-
-    while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyBitAnd)
-    {
-        auto symbol = mLexer->CurSymbol();
-        mLexer->Advance();
-        auto right = ParseShift();
-
-        left = std::make_shared<AST::BitAndNode>(startPos, mLexer->Position(), left, symbol, right);
-    }
-
-    return left;
-}
-
-std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseXorExpr()
-{
-    auto startPos = mLexer->Position();
-    auto left = ParseAndExpr();
+            if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyIn)
+                throw std::make_shared<SyntaxError>(startPos, mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing 'in' after 'not' in 'not in' operator!"));
 
-    while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyBitXor)
-    {
-        auto symbol = mLexer->CurSymbol();
-        mLexer->Advance();
-        auto right = ParseAndExpr();
+            symbol2 = mLexer->CurSymbol();
+            mLexer->Advance();
+        }
 
-        left = std::make_shared<AST::BitXorNode>(startPos, mLexer->Position(), left, symbol, right);
+        CheckNesting(static_cast<unsigned int>(pending.size()));
+        pending.push_back( { startPos, minPower, symbol, symbol2, left } );
+        minPower = power == PowerPower ? FactorPower : power + 1;
     }
-
-    return left;
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseOrExpr()
 {
-    auto startPos = mLexer->Position();
-    auto left = ParseXorExpr();
-
-    while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyBitOr)
-    {
-        auto symbol = mLexer->CurSymbol();
-        mLexer->Advance();
-        auto right = ParseXorExpr();
-
-        left = std::make_shared<AST::BitOrNode>(startPos, mLexer->Position(), left, symbol, right);
-    }
-
-    return left;
+    return ParseBinary(BitOrPower);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseStarExpr()
@@ -368,157 +367,19 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseStarExpr()
         throw std::make_shared<SyntaxError>(startPos, mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing '*' in star expression!"));
 
     auto symbol = mLexer->CurSymbol();
+    mLexer->Advance();
     auto right = ParseOrExpr();
-    return std::make_shared<AST::StarExprNode>(startPos, mLexer->Position(), symbol, right);
-}
-
-std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseComparison()
-{
-    auto startPos = mLexer->Position();
-    auto left = ParseOrExpr();
-
-    while ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyLess ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyLessEqual ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyEqual ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyGreater ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyGreaterEqual ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyNotEqual ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyIn ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyNot ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyIs )
-    {
-        auto symbol = mLexer->CurSymbol();
-        mLexer->Advance();
-
-        switch (symbol->GetSymbolKind())
-        {
-            case TokenKind::PyLess:
-                {
-                    auto right = ParseOrExpr();
-                    left = std::make_shared<AST::CompareLessNode>(startPos, mLexer->Position(), left, symbol, right);
-                }
-                break;
-            case TokenKind::PyLessEqual:
-                {
-                    auto right = ParseOrExpr();
-                    left = std::make_shared<AST::CompareLessEqualNode>(startPos, mLexer->Position(), left, symbol, right);
-                }
-                break;
-            case TokenKind::PyEqual:
-                {
-                    auto right = ParseOrExpr();
-                    left = std::make_shared<AST::CompareEqualNode>(startPos, mLexer->Position(), left, symbol, right);
-                }
-                break;
-            case TokenKind::PyGreater:
-                {
-                    auto right = ParseOrExpr();
-                    left = std::make_shared<AST::CompareGreaterNode>(startPos, mLexer->Position(), left, symbol, right);
-                }
-                break;
-            case TokenKind::PyGreaterEqual:
-                {
-                    auto right = ParseOrExpr();
-                    left = std::make_shared<AST::CompareGreaterEqualNode>(startPos, mLexer->Position(), left, symbol, right);
-                }
-                break;
-            case TokenKind::PyIn:
-                {
-                    auto right = ParseOrExpr();
-                    left = std::make_shared<AST::CompareInNode>(startPos, mLexer->Position(), left, symbol, right);
-                }
-                break;
-            case TokenKind::PyNotEqual:
-                {
-                    auto right = ParseOrExpr();
-                    left = std::make_shared<AST::CompareNotEqualNode>(startPos, mLexer->Position(), left, symbol, right);
-                }
-                break;
-            case TokenKind::PyIs:
-                {
-                    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyNot)
-                    {
-                        auto symbol2 = mLexer->CurSymbol();
-                        mLexer->Advance();
-                        auto right = ParseOrExpr();
-                        left = std::make_shared<AST::CompareIsNotNode>(startPos, mLexer->Position(), left, symbol, symbol2, right);
-                    }
-                    else
-                    {
-                        auto right = ParseOrExpr();
-                        left = std::make_shared<AST::CompareIsNode>(startPos, mLexer->Position(), left, symbol, right);
-                    }
-                }
-                break;
-            case TokenKind::PyNot:
-                {
-                    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyIn)
-                        throw std::make_shared<SyntaxError>(startPos, mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing 'in' after 'not' in 'not in' operator!"));
-                    
-                    auto symbol2 = mLexer->CurSymbol();
-                    mLexer->Advance();
-                    auto right = ParseOrExpr();
-                    left = std::make_shared<AST::CompareNotInNode>(startPos, mLexer->Position(), left, symbol, symbol2, right);
-                }
-                break;
-            default:    break;
-        }
-    }
-
-    return left;
-}
-
-std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseNotTest()
-{
-    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyNot)
-    {
-        auto startPos = mLexer->Position();
-        auto symbol = mLexer->CurSymbol();
-        mLexer->Advance();
-        auto right = ParseNotTest();
-
-        return std::make_shared<AST::NotTestNode>(startPos, mLexer->Position(), symbol, right);
-    }
-
-    return ParseComparison();
-}
-
-std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseAndTest()
-{
-    auto startPos = mLexer->Position();
-    auto left = ParseNotTest();
-
-    while ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyAnd)
-    {
-        auto symbol = mLexer->CurSymbol();
-        mLexer->Advance();
-        auto right = ParseNotTest();
-
-        left = std::make_shared<AST::AndTestNode>(startPos, mLexer->Position(), left, symbol, right);
-    }
-
-    return left;
+    return MakeNode<AST::StarExprNode>(startPos, mLexer->Position(), symbol, right);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseOrTest()
 {
-    auto startPos = mLexer->Position();
-    auto left = ParseAndTest();
-
-    while ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyOr)
-    {
-        auto symbol = mLexer->CurSymbol();
-        mLexer->Advance();
-        auto right = ParseAndTest();
-
-        left = std::make_shared<AST::OrTestNode>(startPos, mLexer->Position(), left, symbol, right);
-    }
-
-    return left;
+    return ParseBinary(OrTestPower);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseLambda(bool isCond)
 {
+    NestingGuard guard(this);
     auto startPos = mLexer->Position();
     auto symbol = mLexer->CurSymbol();
     mLexer->Advance();
@@ -531,7 +392,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseLambda(bool isCond)
     mLexer->Advance();
     auto right = isCond ? ParseTest() : ParseTestNoCond();
 
-    return std::make_shared<AST::LambdaNode>(startPos, mLexer->Position(), symbol, left, symbol2, right);
+    return MakeNode<AST::LambdaNode>(startPos, mLexer->Position(), symbol, left, symbol2, right);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTestNoCond()
@@ -539,15 +400,39 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTestNoCond()
     return mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyLambda ? ParseLambda(false) : ParseOrTest();
 }
 
+/* Conditional expressions nest to the right, 'a if b else c if d else e', so the chain is
+   collected first and folded from the innermost 'else' outwards. */
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTest()
 {
-    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyLambda) return ParseLambda(true);
+    struct Pending
+    {
+        unsigned int mStartPos;
+        std::shared_ptr<AST::ExpressionNode> mLeft;
+        std::shared_ptr<Token> mSymbol;
+        std::shared_ptr<AST::ExpressionNode> mRight;
+        std::shared_ptr<Token> mSymbol2;
+    };
 
-    auto startPos = mLexer->Position();
-    auto left = ParseOrTest();
+    std::vector<Pending> pending;
+    std::shared_ptr<AST::ExpressionNode> node = nullptr;
 
-    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyIf)
+    while (true)
     {
+        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyLambda)
+        {
+            node = ParseLambda(true);
+            break;
+        }
+
+        auto startPos = mLexer->Position();
+        auto left = ParseOrTest();
+
+        if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyIf)
+        {
+            node = left;
+            break;
+        }
+
         auto symbol = mLexer->CurSymbol();
         mLexer->Advance();
         auto right = ParseOrTest();
@@ -557,12 +442,19 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTest()
 
         auto symbol2 = mLexer->CurSymbol();
         mLexer->Advance();
-        auto next = ParseTest();
 
-        return std::make_shared<AST::TestNode>(startPos, mLexer->Position(), left, symbol, right, symbol2, next);
+        CheckNesting(static_cast<unsigned int>(pending.size()));
+        pending.push_back( { startPos, left, symbol, right, symbol2 } );
     }
 
-    return left;
+    while (!pending.empty())
+    {
+        auto &test = pending.back();
+        node = MakeNode<AST::TestNode>(test.mStartPos, mLexer->Position(), test.mLeft, test.mSymbol, test.mRight, test.mSymbol2, node);
+        pending.pop_back();
+    }
+
+    return node;
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseNamedExpr()
@@ -576,7 +468,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseNamedExpr()
         mLexer->Advance();
         auto right = ParseTest();
 
-        return std::make_shared<AST::NamedExprNode>(startPos, mLexer->Position(), left, symbol, right);
+        return MakeNode<AST::NamedExprNode>(startPos, mLexer->Position(), left, symbol, right);
     }
 
     return left;;
@@ -599,7 +491,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseStarNamedExpressions
             nodes->push_back( ParseStarNamedExpression() );
     }
 
-    return std::make_shared<AST::StarNamedExpressionNode>(startPos, mLexer->Position(), nodes, separartors);
+    return MakeNode<AST::StarNamedExpressionNode>(startPos, mLexer->Position(), nodes, separartors);
 
 }
 
@@ -630,8 +522,8 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTestListComp()
         {
             separators->push_back( mLexer->CurSymbol() );
             mLexer->Advance();
-            if (    mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightParen ||
-                    mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightBracket )
+            if (    mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen &&
+                    mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightBracket )
                     {
                         nodes->push_back(mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyMul ? ParseStarExpr() : ParseNamedExpr());
                     }
@@ -642,11 +534,12 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTestListComp()
 
     if ( nodes->size() == 1 && separators->size() == 0 ) return nodes->back();
     
-    return std::make_shared<AST::TestListCompNode>(startPos, mLexer->Position(), nodes, separators);
+    return MakeNode<AST::TestListCompNode>(startPos, mLexer->Position(), nodes, separators);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTrailer()
 {
+    NestingGuard guard(this, DeepLevel);
     auto startPos = mLexer->Position();
     auto symbol = mLexer->CurSymbol();
     mLexer->Advance();
@@ -655,7 +548,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTrailer()
     {
         case TokenKind::PyLeftParen:
             {
-                auto right = mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen ? ParseVarArgsList() : nullptr;
+                auto right = mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen ? ParseArgList() : nullptr;
 
                 if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen)
                     throw std::make_shared<SyntaxError>(startPos, mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Expecting ')' in call!"));
@@ -663,7 +556,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTrailer()
                 auto symbol2 = mLexer->CurSymbol();
                 mLexer->Advance();
 
-                return std::make_shared<AST::CallNode>(startPos, mLexer->Position(), symbol, right, symbol2);
+                return MakeNode<AST::CallNode>(startPos, mLexer->Position(), symbol, right, symbol2);
             }
         case TokenKind::PyLeftBracket:
             {
@@ -675,17 +568,17 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTrailer()
                 auto symbol2 = mLexer->CurSymbol();
                 mLexer->Advance();
 
-                return std::make_shared<AST::IndexNode>(startPos, mLexer->Position(), symbol, right, symbol2);
+                return MakeNode<AST::IndexNode>(startPos, mLexer->Position(), symbol, right, symbol2);
             }
         default:    // Dot Name
             {
-                if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightBracket)
+                if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Name)
                     throw std::make_shared<SyntaxError>(startPos, mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Expecting Name literal after '.'!"));
             
                 auto symbol2 = mLexer->CurSymbol();
                 mLexer->Advance();
 
-                return std::make_shared<AST::DotNameNode>(startPos, mLexer->Position(), symbol, std::static_pointer_cast<NameToken>( symbol2 ) );
+                return MakeNode<AST::DotNameNode>(startPos, mLexer->Position(), symbol, std::static_pointer_cast<NameToken>( symbol2 ) );
             }
             break;
     }
@@ -709,7 +602,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseSubscriptList()
 
     if (nodes->size() == 1 && separators->size() == 0) return nodes->back();
 
-    return std::make_shared<AST::SubscriptListNode>(startPos, mLexer->Position(), nodes, separators);
+    return MakeNode<AST::SubscriptListNode>(startPos, mLexer->Position(), nodes, separators);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseSubscript()
@@ -723,19 +616,19 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseSubscript()
     {
         one = mLexer->CurSymbol();
         mLexer->Advance();
-        if (    mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyComma ||
-                mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon ||
+        if (    mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyComma &&
+                mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon &&
                 mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightBracket ) second = ParseTest();
         if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyColon)
         {
             two = mLexer->CurSymbol();
             mLexer->Advance();
-            if (    mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyComma ||
+            if (    mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyComma &&
                     mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightBracket ) third = ParseTest();
         }
     }
 
-    return std::make_shared<AST::SubscriptNode>(startPos, mLexer->Position(), first, one, second, two, third);
+    return MakeNode<AST::SubscriptNode>(startPos, mLexer->Position(), first, one, second, two, third);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseExprList()
@@ -756,7 +649,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseExprList()
 
     if (nodes->size() == 1 && separators->size() == 0) return nodes->back();
 
-    return std::make_shared<AST::ExprListNode>(startPos, mLexer->Position(), nodes, separators);
+    return MakeNode<AST::ExprListNode>(startPos, mLexer->Position(), nodes, separators);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTestList()
@@ -779,7 +672,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseTestList()
 
     if (nodes->size() == 1 && separators->size() == 0) return nodes->back();
 
-    return std::make_shared<AST::TestListNode>(startPos, mLexer->Position(), nodes, separators);
+    return MakeNode<AST::TestListNode>(startPos, mLexer->Position(), nodes, separators);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseDictorSetMaker()
@@ -803,7 +696,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseDictorSetMaker()
                 auto powerOp = mLexer->CurSymbol();
                 mLexer->Advance();
                 auto powerNode = ParseOrExpr();
-                nodes->push_back(std::make_shared<AST::DictionaryKWEntryNode>(startPos, mLexer->Position(), powerOp, powerNode));
+                nodes->push_back(MakeNode<AST::DictionaryKWEntryNode>(startPos, mLexer->Position(), powerOp, powerNode));
             }
             break;
         default:
@@ -815,7 +708,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseDictorSetMaker()
                     auto symbol = mLexer->CurSymbol();
                     mLexer->Advance();
                     auto value = ParseOrExpr();
-                    nodes->push_back(std::make_shared<AST::DictionaryEntryNode>(startPos, mLexer->Position(), key, symbol, value));
+                    nodes->push_back(MakeNode<AST::DictionaryEntryNode>(startPos, mLexer->Position(), key, symbol, value));
                 }
                 else
                 {
@@ -846,7 +739,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseDictorSetMaker()
                     auto powerOp = mLexer->CurSymbol();
                     mLexer->Advance();
                     auto powerNode = ParseOrExpr();
-                    nodes->push_back(std::make_shared<AST::DictionaryKWEntryNode>(startPos, mLexer->Position(), powerOp, powerNode));
+                    nodes->push_back(MakeNode<AST::DictionaryKWEntryNode>(startPos, mLexer->Position(), powerOp, powerNode));
                 }
                 else
                 {
@@ -859,7 +752,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseDictorSetMaker()
                     mLexer->Advance();
                     auto value = ParseTest();
 
-                    nodes->push_back( std::make_shared<AST::DictionaryEntryNode>(startPos, mLexer->Position(), key, symbol, value));
+                    nodes->push_back( MakeNode<AST::DictionaryEntryNode>(startPos, mLexer->Position(), key, symbol, value));
                 }
             }
             else
@@ -871,9 +764,9 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseDictorSetMaker()
     }
 
     if (isDictionary)
-        return std::make_shared<AST::DictionaryContainerNode>(startPos, mLexer->Position(), nodes, separators);
+        return MakeNode<AST::DictionaryContainerNode>(startPos, mLexer->Position(), nodes, separators);
     
-    return std::make_shared<AST::SetContainerNode>(startPos, mLexer->Position(), nodes, separators);
+    return MakeNode<AST::SetContainerNode>(startPos, mLexer->Position(), nodes, separators);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseArgList()
@@ -894,7 +787,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseArgList()
 
     if (nodes->size() == 1 && separators->size() == 0) return nodes->back();
 
-    return std::make_shared<AST::ArgsListNode>(startPos, mLexer->Position(), nodes, separators);
+    return MakeNode<AST::ArgsListNode>(startPos, mLexer->Position(), nodes, separators);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseArgument()
@@ -910,7 +803,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseArgument()
                 mLexer->Advance();
                 auto right = ParseTest();
 
-                return std::make_shared<AST::ArgumentNode>(startPos, mLexer->Position(), nullptr, symbol, right);
+                return MakeNode<AST::ArgumentNode>(startPos, mLexer->Position(), nullptr, symbol, right);
             }
         default:
             {
@@ -923,7 +816,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseArgument()
                         {
                             auto right = ParseCompIter();
 
-                            return std::make_shared<AST::ArgumentNode>(startPos, mLexer->Position(), left, nullptr, right);
+                            return MakeNode<AST::ArgumentNode>(startPos, mLexer->Position(), left, nullptr, right);
                         }
                     case TokenKind::PyColonAssign:
                     case TokenKind::PyAssign:
@@ -932,7 +825,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseArgument()
                             mLexer->Advance();
                             auto right = ParseTest();
 
-                            return std::make_shared<AST::ArgumentNode>(startPos, mLexer->Position(), left, symbol, right);
+                            return MakeNode<AST::ArgumentNode>(startPos, mLexer->Position(), left, symbol, right);
                         }
                     default:
                         return left;
@@ -972,10 +865,10 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseSyncCompFor()
             {
                 auto next = ParseCompIter();
 
-                return std::make_shared<AST::SyncCompForNode>(startPos, mLexer->Position(), symbol1, left, symbol2, right, next);
+                return MakeNode<AST::SyncCompForNode>(startPos, mLexer->Position(), symbol1, left, symbol2, right, next);
             }
 
-    return std::make_shared<AST::SyncCompForNode>(startPos, mLexer->Position(), symbol1, left, symbol2, right, nullptr);
+    return MakeNode<AST::SyncCompForNode>(startPos, mLexer->Position(), symbol1, left, symbol2, right, nullptr);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseCompFor()
@@ -988,7 +881,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseCompFor()
         mLexer->Advance();
         auto right = ParseSyncCompFor();
 
-        return std::make_shared<AST::CompForNode>(startPos, mLexer->Position(), symbol, right);
+        return MakeNode<AST::CompForNode>(startPos, mLexer->Position(), symbol, right);
     }
 
     return ParseSyncCompFor();;
@@ -1007,10 +900,10 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseCompIf()
             {
                 auto next = ParseCompIter();
 
-                return std::make_shared<AST::CompIfNode>(startPos, mLexer->Position(), symbol, left, next);
+                return MakeNode<AST::CompIfNode>(startPos, mLexer->Position(), symbol, left, next);
             }
 
-    return std::make_shared<AST::CompIfNode>(startPos, mLexer->Position(), symbol, left, nullptr);
+    return MakeNode<AST::CompIfNode>(startPos, mLexer->Position(), symbol, left, nullptr);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseYieldExpr()
@@ -1026,12 +919,12 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseYieldExpr()
 
         auto right = ParseTest();
 
-        return std::make_shared<AST::YieldFromNode>(startPos, mLexer->Position(), symbol1, symbol2, right);
+        return MakeNode<AST::YieldFromNode>(startPos, mLexer->Position(), symbol1, symbol2, right);
     }
 
     auto right = ParseTestListStarExpr();
 
-    return std::make_shared<AST::YieldExprNode>(startPos, mLexer->Position(), symbol1, right);
+    return MakeNode<AST::YieldExprNode>(startPos, mLexer->Position(), symbol1, right);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseVarArgsList()
@@ -1234,7 +1127,7 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseVarArgsList()
         }
     }
 
-    return std::make_shared<AST::VarArgsListExpressionNode>(startPos, mLexer->Position(), nodes, separators, div, mulOp, mulNode, powerOp, powerNode);
+    return MakeNode<AST::VarArgsListExpressionNode>(startPos, mLexer->Position(), nodes, separators, div, mulOp, mulNode, powerOp, powerNode);
 }
 
 std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseVFPAssign()
@@ -1257,5 +1150,5 @@ std::shared_ptr<AST::ExpressionNode> PythonCoreParser::ParseVFPAssign()
         right = ParseTest();
     }
 
-    return std::make_shared<AST::VFPDefAssignExpressionNode>(startPos, mLexer->Position(), left, symbol, right);
+    return MakeNode<AST::VFPDefAssignExpressionNode>(startPos, mLexer->Position(), left, symbol, right);
 }
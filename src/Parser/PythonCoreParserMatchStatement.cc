@@ -11,6 +11,8 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseMatch()
     auto symbol = mLexer->CurSymbol(); /* Identifier 'match' */
     mLexer->Advance();
 
+    mPatternMemo.clear();
+
     auto left = ParseSubjectExpr();
 
     if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon)
@@ -52,7 +54,9 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseMatch()
     auto symbol5 = mLexer->CurSymbol();
     mLexer->Advance();
 
-    return std::make_shared<AST::MatchStatementNode>(
+    mPatternMemo.clear();
+
+    return MakeNode<AST::MatchStatementNode>(
         startPos,
         mLexer->Position(),
         symbol,     /* 'match' */
@@ -69,7 +73,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSubjectExpr()
     auto startPos = mLexer->Position();
     auto right = ParseStarNamedExpression();
 
-    return std::make_shared<AST::SubjectExprNode>(startPos, mLexer->Position(), right);
+    return MakeNode<AST::SubjectExprNode>(startPos, mLexer->Position(), right);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseCaseBlock()
@@ -99,7 +103,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseCaseBlock()
 
                 auto next = ParseSuite();
 
-                return std::make_shared<AST::CaseStatementNode>(
+                return MakeNode<AST::CaseStatementNode>(
                         startPos,
                         mLexer->Position(),
                         std::static_pointer_cast<NameToken>(symbol), 
@@ -126,20 +130,19 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseGuard()
 
     auto right = ParseNamedExpr();
 
-    return std::make_shared<AST::GuardNode>(startPos, mLexer->Position(), symbol, right);
+    return MakeNode<AST::GuardNode>(startPos, mLexer->Position(), symbol, right);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParsePatterns()
 {
 
-    return mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyBitOr ? 
-        ParsePattern() :
-        ParseOpenSequencePattern(); 
+    return ParseMemoized(PatternRule::OpenSequencePattern, &PythonCoreParser::ParseOpenSequencePattern);
 
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParsePattern()
 {
+    NestingGuard guard(this);
 
     auto startPos = mLexer->Position();
     auto left = ParseOrPattern();
@@ -158,7 +161,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseAsPattern(unsigned in
 
     auto right = ParseCapturePattern();
 
-    return std::make_shared<AST::AsPatternNode>(
+    return MakeNode<AST::AsPatternNode>(
         startPos,
         mLexer->Position(),
         left,
@@ -173,20 +176,20 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseOrPattern()
     auto nodes = std::make_shared<std::vector<std::shared_ptr<AST::StatementNode>>>();
     auto separators = std::make_shared<std::vector<std::shared_ptr<Token>>>();
 
-    separators->push_back( mLexer->CurSymbol() );
-    mLexer->Advance();
-    nodes->push_back( ParseClosedPattern() );
+    nodes->push_back( ParseMemoized(PatternRule::ClosedPattern, &PythonCoreParser::ParseClosedPattern) );
 
     while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyBitOr)
     {
 
         separators->push_back( mLexer->CurSymbol() );
         mLexer->Advance();
-        nodes->push_back( ParseClosedPattern() );
+        nodes->push_back( ParseMemoized(PatternRule::ClosedPattern, &PythonCoreParser::ParseClosedPattern) );
     
     }
 
-    return std::make_shared<AST::OrPatternNode>(
+    if (separators->size() == 0) return nodes->back();
+
+    return MakeNode<AST::OrPatternNode>(
         startPos,
         mLexer->Position(),
         nodes,
@@ -214,20 +217,22 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseClosedPattern()
         case TokenKind::PyLeftParen:
             {
 
-                auto startPos = mLexer->CurSymbol()->GetTokenStartPosition(); /* Start of first token */
-                auto symbol = mLexer->CurSymbol();
-                mLexer->Advance();
+                /* group_pattern is tried first, '(' pattern ')' , and on failure the same
+                   tokens are parsed again as a sequence pattern. */
+                auto mark = mLexer->TokenIndex();
 
-                if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyBitOr)
+                try
                 {
 
-                    mLexer->UnWindTokenStream(startPos); /* Reset back Token stream */
-
                     return ParseGroupPattern();
-                
+
                 }
+                catch (std::shared_ptr<SyntaxError> error)
+                {
 
-                mLexer->UnWindTokenStream(startPos); /* Reset back Token stream */
+                    mLexer->Rewind(mark); /* Reset back Token stream */
+
+                }
 
                 return ParseSequencePattern();
 
@@ -241,7 +246,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseClosedPattern()
         case TokenKind::Name:
             {
                 auto symbol = std::static_pointer_cast<NameToken>( mLexer->CurSymbol() );
-                auto startPos = mLexer->CurSymbol()->GetTokenStartPosition();
+                auto mark = mLexer->TokenIndex();
 
                 if (symbol->IsWildCardPattern() ) return ParseWildCardPattern();
 
@@ -251,11 +256,10 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseClosedPattern()
                     mLexer->Advance();
 
                     if (    mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyDot &&
-                            mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyLeftParen &&
-                            mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyAssign )
+                            mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyLeftParen )
                             {
 
-                                mLexer->UnWindTokenStream(startPos); /* Reset back Token stream */
+                                mLexer->Rewind(mark); /* Reset back Token stream */
 
                                 return ParseCapturePattern();
 
@@ -278,13 +282,13 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseClosedPattern()
                     if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyLeftParen)
                     {
 
-                        mLexer->UnWindTokenStream(startPos); /* Reset back Token stream */
+                        mLexer->Rewind(mark); /* Reset back Token stream */
 
-                        return ParseClassPattern();
+                        return ParseMemoized(PatternRule::ClassPattern, &PythonCoreParser::ParseClassPattern);
                     
                     }
 
-                    mLexer->UnWindTokenStream(startPos); /* Reset back Token stream */
+                    mLexer->Rewind(mark); /* Reset back Token stream */
 
                     return ParseValuePattern();
                     
@@ -319,7 +323,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseLiteralPattern()
                 auto symbol = mLexer->CurSymbol();
                 mLexer->Advance();
 
-                return std::make_shared<AST::LiteralPatternNode>(
+                return MakeNode<AST::LiteralPatternNode>(
                     startPos,
                     mLexer->Position(),
                     symbol,
@@ -340,12 +344,13 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseLiteralPattern()
                             std::make_shared<std::wstring>(L"Expecting Number after '-' in signed number!"));
 
                 auto left = std::static_pointer_cast<NumberToken>(mLexer->CurSymbol());
+                mLexer->Advance();
 
-                auto node = left->IsRealNumber() ? 
+                auto node = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPlus || mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyMinus ? 
                     ParseComplexNumber(startPos, symbol, left) :
                     ParseSignedNumber(startPos, symbol, left);
 
-                return std::make_shared<AST::LiteralPatternNode>(
+                return MakeNode<AST::LiteralPatternNode>(
                     startPos,
                     mLexer->Position(),
                     nullptr,
@@ -375,7 +380,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseLiteralExpr()
                 auto symbol = mLexer->CurSymbol();
                 mLexer->Advance();
 
-                return std::make_shared<AST::LiteralPatternNode>(
+                return MakeNode<AST::LiteralPatternNode>(
                     startPos,
                     mLexer->Position(),
                     symbol,
@@ -396,12 +401,13 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseLiteralExpr()
                             std::make_shared<std::wstring>(L"Expecting Number after '-' in signed number!"));
 
                 auto left = std::static_pointer_cast<NumberToken>(mLexer->CurSymbol());
+                mLexer->Advance();
 
-                auto node = left->IsRealNumber() ? 
+                auto node = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPlus || mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyMinus ? 
                     ParseComplexNumber(startPos, symbol, left) :
                     ParseSignedNumber(startPos, symbol, left);
 
-                return std::make_shared<AST::LiteralExprNode>(
+                return MakeNode<AST::LiteralExprNode>(
                     startPos,
                     mLexer->Position(),
                     nullptr,
@@ -432,7 +438,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseComplexNumber( unsign
 
                         mLexer->Advance();
 
-                        return std::make_shared<AST::ComplexNumberNode>(
+                        return MakeNode<AST::ComplexNumberNode>(
                             startPos,
                             mLexer->Position(),
                             symbol,
@@ -472,7 +478,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseComplexNumber( unsign
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSignedNumber( unsigned int startPos, std::shared_ptr<Token> symbol, std::shared_ptr<NumberToken> left )
 {
 
-    return std::make_shared<AST::SignedNumberNode>(startPos, mLexer->Position(), symbol, left);
+    return MakeNode<AST::SignedNumberNode>(startPos, mLexer->Position(), symbol, left);
 
 }
 
@@ -482,7 +488,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseCapturePattern()
     auto symbol = std::static_pointer_cast<NameToken>( mLexer->CurSymbol() );
     mLexer->Advance();
 
-    return std::make_shared<AST::CapturePatternNode>(
+    return MakeNode<AST::CapturePatternNode>(
         startPos,
         mLexer->Position(),
         symbol );
@@ -499,7 +505,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseWildCardPattern()
         auto symbol = mLexer->CurSymbol();  /* '_' */
         mLexer->Advance();
 
-        return std::make_shared<AST::WildCardPatternNode>(startPos, mLexer->Position(), symbol);
+        return MakeNode<AST::WildCardPatternNode>(startPos, mLexer->Position(), symbol);
 
     }
 
@@ -522,7 +528,10 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseValuePattern()
         mLexer->Advance();
 
         if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Name)
-            throw ;
+            throw std::make_shared<SyntaxError>(
+                        mLexer->Position(), 
+                        mLexer->CurSymbol(),
+                        std::make_shared<std::wstring>(L"Expecting Name after '.' in value pattern!"));
 
         nodes->push_back( std::static_pointer_cast<NameToken>(mLexer->CurSymbol()) );
         mLexer->Advance();
@@ -531,7 +540,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseValuePattern()
 
     /* We alredy made sure we dont have more '.', '(' or '=' */
 
-    return std::make_shared<AST::ValuePatternNode>(
+    return MakeNode<AST::ValuePatternNode>(
                         startPos,
                         mLexer->Position(),
                         nodes,
@@ -556,7 +565,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseGroupPattern()
     auto symbol2 = mLexer->CurSymbol();
     mLexer->Advance();
 
-    return std::make_shared<AST::GroupPatternNode>(
+    return MakeNode<AST::GroupPatternNode>(
         startPos,
         mLexer->Position(),
         symbol1,
@@ -575,17 +584,20 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSequencePattern()
         auto symbol1 = mLexer->CurSymbol();
         mLexer->Advance();
 
-        auto right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightBracket ?
-                        ParseMaybeeSequencePattern() :
+        auto right = mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightBracket ?
+                        ParseMemoized(PatternRule::MaybeeSequencePattern, &PythonCoreParser::ParseMaybeeSequencePattern) :
                         nullptr;
 
         if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightBracket)
-            throw ;
+            throw std::make_shared<SyntaxError>(
+                        mLexer->Position(), 
+                        mLexer->CurSymbol(),
+                        std::make_shared<std::wstring>(L"Expecting ']' in sequence pattern!"));
 
         auto symbol2 = mLexer->CurSymbol();
         mLexer->Advance();
 
-        return std::make_shared<AST::SequencePatternNode>(
+        return MakeNode<AST::SequencePatternNode>(
                     startPos,
                     mLexer->Position(),
                     symbol1,
@@ -599,29 +611,20 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSequencePattern()
         auto symbol1 = mLexer->CurSymbol();
         mLexer->Advance();
 
-        auto right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightParen ?
-                        ParseOpenSequencePattern() : // Check for single entry. Group Pattern if onlye one.
+        auto right = mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen ?
+                        ParseMemoized(PatternRule::OpenSequencePattern, &PythonCoreParser::ParseOpenSequencePattern) :
                         nullptr;
 
         if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen)
-            throw ;
+            throw std::make_shared<SyntaxError>(
+                        mLexer->Position(), 
+                        mLexer->CurSymbol(),
+                        std::make_shared<std::wstring>(L"Expecting ')' in sequence pattern!"));
 
         auto symbol2 = mLexer->CurSymbol();
         mLexer->Advance();
 
-        if (right != nullptr && std::static_pointer_cast<AST::OpenSequencePatternNode>(right)->IsGroupPattern() )
-        {
-
-            return std::make_shared<AST::GroupPatternNode>(
-                    startPos,
-                    mLexer->Position(),
-                    symbol1,
-                    right,
-                    symbol2 );
-
-        }
-
-        return std::make_shared<AST::SequencePatternNode>(
+        return MakeNode<AST::SequencePatternNode>(
                     startPos,
                     mLexer->Position(),
                     symbol1,
@@ -635,7 +638,6 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSequencePattern()
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseOpenSequencePattern()
 {
     auto startPos = mLexer->Position();
-    mLexer->Advance();
     auto nodes = std::make_shared<std::vector<std::shared_ptr<AST::StatementNode>>>();
     auto separators = std::make_shared<std::vector<std::shared_ptr<Token>>>();
 
@@ -647,13 +649,28 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseOpenSequencePattern()
         separators->push_back( mLexer->CurSymbol() );
         mLexer->Advance();
 
-        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightParen ) continue;
+        if (    mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightParen ||
+                mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyColon ||
+                mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyIf ) break;
 
         nodes->push_back( ParseMaybeeStarExpr() );
     
     }
 
-    return std::make_shared<AST::OpenSequencePatternNode>(
+    if (separators->size() == 0)
+    {
+
+        if (nodes->back()->GetKind() == AST::NodeKind::StarPattern)
+            throw std::make_shared<SyntaxError>(
+                        mLexer->Position(), 
+                        mLexer->CurSymbol(),
+                        std::make_shared<std::wstring>(L"Star pattern is only allowed inside a sequence pattern!"));
+
+        return nodes->back();
+
+    }
+
+    return MakeNode<AST::OpenSequencePatternNode>(
                         startPos,
                         mLexer->Position(),
                         nodes,
@@ -665,7 +682,6 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseMaybeeSequencePattern
 {
     
     auto startPos = mLexer->Position();
-    mLexer->Advance();
     auto nodes = std::make_shared<std::vector<std::shared_ptr<AST::StatementNode>>>();
     auto separators = std::make_shared<std::vector<std::shared_ptr<Token>>>();
 
@@ -677,13 +693,13 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseMaybeeSequencePattern
         separators->push_back( mLexer->CurSymbol() );
         mLexer->Advance();
 
-        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightBracket ) continue;
+        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightBracket ) break;
 
         nodes->push_back( ParseMaybeeStarExpr() );
     
     }
 
-    return std::make_shared<AST::MaybeeStarSequencePatternNode>(
+    return MakeNode<AST::MaybeeStarSequencePatternNode>(
                         startPos,
                         mLexer->Position(),
                         nodes,
@@ -706,30 +722,17 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseStarPattern()
     auto symbol = mLexer->CurSymbol();
     mLexer->Advance();
 
-    std::shared_ptr<AST::StatementNode> right = nullptr;
-
-    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Name)
-    {
-
-        auto a = std::static_pointer_cast<NameToken>( mLexer->CurSymbol() );
-
-        if (a->IsNotWildCardPrefixed()) right = ParseWildCardPattern();
-
-        else
-            throw std::make_shared<SyntaxError>(
-                        mLexer->Position(), 
-                        mLexer->CurSymbol(),
-                        std::make_shared<std::wstring>(L"Expecting '*' '_' pattern!"));
-
-    }
-    else
-    {
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Name)
+        throw std::make_shared<SyntaxError>(
+                    mLexer->Position(), 
+                    mLexer->CurSymbol(),
+                    std::make_shared<std::wstring>(L"Expecting '*' '_' pattern!"));
 
-        right = ParseCapturePattern();
-    
-    }
+    auto right = std::static_pointer_cast<NameToken>( mLexer->CurSymbol() )->IsWildCardPattern() ?
+                    ParseWildCardPattern() :
+                    ParseCapturePattern();
 
-    return std::make_shared<AST::StarPatternNode>(startPos, mLexer->Position(), symbol, right);
+    return MakeNode<AST::StarPatternNode>(startPos, mLexer->Position(), symbol, right);
 
 }
 
@@ -742,70 +745,48 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseMappingPattern()
     std::shared_ptr<AST::StatementNode> left = nullptr, right = nullptr;
     std::shared_ptr<Token> symbol2 = nullptr, symbol3 = nullptr, symbol4 = nullptr;
 
-    switch (mLexer->CurSymbol()->GetSymbolKind())
+    if (    mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightCurly &&
+            mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyPower )
     {
-        case TokenKind::PyRightCurly:   /* Empty mapping pattern '{' '}' */
-            
-            symbol2 = mLexer->CurSymbol();
-            mLexer->Advance();
-
-            break;
-
-        case TokenKind::PyPower:
-            
-            right = ParseDoubleStarPattern();
-
-            if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma)
-            {
-
-                symbol4 = mLexer->CurSymbol();
-                mLexer->Advance();
 
-            }
+        left = ParseItemsPattern();
 
-            if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightCurly)
-                throw std::make_shared<SyntaxError>(
-                                        mLexer->Position(), 
-                                        mLexer->CurSymbol(),
-                                        std::make_shared<std::wstring>(L"Expecting '}' in mapping pattern!"));
+        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma)
+        {
 
-            symbol2 = mLexer->CurSymbol();
+            symbol3 = mLexer->CurSymbol();
             mLexer->Advance();
 
-            break;
+        }
 
-        default:
+    }
 
-            left = ParseItemsPattern();
+    if (    mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPower &&
+            (left == nullptr || symbol3 != nullptr) )
+    {
 
-            if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyComma)
-                throw std::make_shared<SyntaxError>(
-                                        mLexer->Position(), 
-                                        mLexer->CurSymbol(),
-                                        std::make_shared<std::wstring>(L"Expecting ',' in mapping pattern!"));
+        right = ParseDoubleStarPattern();
 
-            symbol3 = mLexer->CurSymbol();
+        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma)
+        {
+
+            symbol4 = mLexer->CurSymbol();
             mLexer->Advance();
 
-            if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma)
-            {
+        }
 
-                symbol4 = mLexer->CurSymbol();
-                mLexer->Advance();
+    }
 
-            }
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightCurly)
+        throw std::make_shared<SyntaxError>(
+                                mLexer->Position(), 
+                                mLexer->CurSymbol(),
+                                std::make_shared<std::wstring>(L"Expecting '}' in mapping pattern!"));
 
-            if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightCurly)
-                throw std::make_shared<SyntaxError>(
-                                        mLexer->Position(), 
-                                        mLexer->CurSymbol(),
-                                        std::make_shared<std::wstring>(L"Expecting '}' in mapping pattern!"));
-                
-            break;
-            
-    }
+    symbol2 = mLexer->CurSymbol();
+    mLexer->Advance();
 
-    return std::make_shared<AST::MappingPatternNode>(
+    return MakeNode<AST::MappingPatternNode>(
                                 startPos,
                                 mLexer->Position(),
                                 symbol1,
@@ -828,17 +809,26 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseItemsPattern()
     while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma)
     {
 
-        separators->push_back( mLexer->CurSymbol() );
+        /* A trailing ',' or the one before '**' belongs to the mapping pattern. */
+        auto separator = mLexer->CurSymbol();
+        auto mark = mLexer->TokenIndex();
         mLexer->Advance();
 
-        if( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightBracket ||
-            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPower ) continue;
+        if( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightCurly ||
+            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPower )
+        {
 
+            mLexer->Rewind(mark);
+            break;
+
+        }
+
+        separators->push_back( separator );
         nodes->push_back( ParseKeyValuePattern() );
 
     }
 
-    return std::make_shared<AST::ItemsPatternNode>(
+    return MakeNode<AST::ItemsPatternNode>(
                                 startPos,
                                 mLexer->Position(),
                                 nodes,
@@ -887,7 +877,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseKeyValuePattern()
 
     auto value = ParsePattern();
 
-    return std::make_shared<AST::KeyValuePatternNode>(
+    return MakeNode<AST::KeyValuePatternNode>(
                     startPos,
                     mLexer->Position(),
                     key,
@@ -905,7 +895,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDoubleStarPattern()
 
     auto right = ParseCapturePattern();
 
-    return std::make_shared<AST::DoubleStarPatternNode>(startPos, mLexer->Position(), symbol, right);
+    return MakeNode<AST::DoubleStarPatternNode>(startPos, mLexer->Position(), symbol, right);
 
 }
 
@@ -933,7 +923,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseClassPattern()
                                     mLexer->CurSymbol(),
                                     std::make_shared<std::wstring>(L"Expecting Name in class pattern!"));
 
-        nodes->push_back( std::static_pointer_cast<NameToken>( std::static_pointer_cast<NameToken>(mLexer->CurSymbol()) ) );
+        nodes->push_back( std::static_pointer_cast<NameToken>(mLexer->CurSymbol()) );
         mLexer->Advance();
     
     }
@@ -942,22 +932,16 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseClassPattern()
         throw std::make_shared<SyntaxError>(
                                     mLexer->Position(), 
                                     mLexer->CurSymbol(),
-                                    std::make_shared<std::wstring>(L"Expecting ')' in class pattern!"));
+                                    std::make_shared<std::wstring>(L"Expecting '(' in class pattern!"));
 
     symbol1 = mLexer->CurSymbol();
     mLexer->Advance();
 
-    switch (mLexer->CurSymbol()->GetSymbolKind())
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen)
     {
 
-        case TokenKind::PyRightParen:
-
-            symbol2 = mLexer->CurSymbol();
-            mLexer->Advance();
-
-            break;
-
-        case TokenKind::PyBitOr:
+        if (!IsKeywordPatternStart()) 
+        {
 
             left = ParsePositionalPattern();
 
@@ -967,33 +951,13 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseClassPattern()
                 symbol3 = mLexer->CurSymbol();
                 mLexer->Advance();
 
-                if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen)
-                {
-
-                    right = ParseKeywordPatterns();
-
-                    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma)
-                    {
-
-                        symbol4 = mLexer->CurSymbol();
-                        mLexer->Advance();
-
-                    }
-                }
             }
 
-            if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen)
-                throw std::make_shared<SyntaxError>(
-                                    mLexer->Position(), 
-                                    mLexer->CurSymbol(),
-                                    std::make_shared<std::wstring>(L"Expecting ')' in class pattern!"));
-
-            symbol2 = mLexer->CurSymbol();
-            mLexer->Advance();
-
-            break;
+        }
 
-        default:
+        if (    mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen && 
+                (left == nullptr || symbol3 != nullptr) )
+        {
 
             right = ParseKeywordPatterns();
 
@@ -1005,19 +969,20 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseClassPattern()
 
             }
 
-            if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen)
-                throw std::make_shared<SyntaxError>(
-                                    mLexer->Position(), 
-                                    mLexer->CurSymbol(),
-                                    std::make_shared<std::wstring>(L"Expecting ')' in class pattern!"));
-
-            symbol2 = mLexer->CurSymbol();
-            mLexer->Advance();
+        }
 
-            break;
     }
 
-    return std::make_shared<AST::ClassPatternNode>(
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen)
+        throw std::make_shared<SyntaxError>(
+                            mLexer->Position(), 
+                            mLexer->CurSymbol(),
+                            std::make_shared<std::wstring>(L"Expecting ')' in class pattern!"));
+
+    symbol2 = mLexer->CurSymbol();
+    mLexer->Advance();
+
+    return MakeNode<AST::ClassPatternNode>(
                                 startPos,
                                 mLexer->Position(),
                                 nodes,
@@ -1041,14 +1006,22 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParsePositionalPattern()
 
     while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma)
     {
-        separators->push_back( mLexer->CurSymbol() );
+        /* The ',' in front of the keyword patterns or ')' belongs to the class pattern. */
+        auto mark = mLexer->TokenIndex();
+        auto separator = mLexer->CurSymbol();
         mLexer->Advance();
 
-        if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen)
-            nodes->push_back( ParsePattern() );
+        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightParen || IsKeywordPatternStart())
+        {
+            mLexer->Rewind(mark);
+            break;
+        }
+
+        separators->push_back( separator );
+        nodes->push_back( ParsePattern() );
     }
 
-    return std::make_shared<AST::PositionalPatternsNode>(startPos, mLexer->Position(), nodes, separators);
+    return MakeNode<AST::PositionalPatternsNode>(startPos, mLexer->Position(), nodes, separators);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseKeywordPatterns()
@@ -1061,14 +1034,34 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseKeywordPatterns()
 
     while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma)
     {
-        separators->push_back( mLexer->CurSymbol() );
+        auto mark = mLexer->TokenIndex();
+        auto separator = mLexer->CurSymbol();
         mLexer->Advance();
 
-        if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen)
-            nodes->push_back( ParseKeywordPattern() );
+        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightParen)
+        {
+            mLexer->Rewind(mark);
+            break;
+        }
+
+        separators->push_back( separator );
+        nodes->push_back( ParseKeywordPattern() );
     }
 
-    return std::make_shared<AST::KeywordPatternsNode>(startPos, mLexer->Position(), nodes, separators);
+    return MakeNode<AST::KeywordPatternsNode>(startPos, mLexer->Position(), nodes, separators);
+}
+
+/* Name '=' starts a keyword pattern, looks one token ahead and rewinds. */
+bool PythonCoreParser::IsKeywordPatternStart()
+{
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Name) return false;
+
+    auto mark = mLexer->TokenIndex();
+    mLexer->Advance();
+    auto isKeyword = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyAssign;
+    mLexer->Rewind(mark);
+
+    return isKeyword;
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseKeywordPattern()
@@ -1095,6 +1088,42 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseKeywordPattern()
 
     auto right = ParsePattern();
 
-    return std::make_shared<AST::KeywordPatternNode>(
+    return MakeNode<AST::KeywordPatternNode>(
                             startPos, mLexer->Position(), symbol, symbol2, right);
 }
+
+std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseMemoized(PatternRule rule, std::shared_ptr<AST::StatementNode> (PythonCoreParser::*parse)())
+{
+
+    if (!mUsePatternMemo) return (this->*parse)();
+
+    auto key = (static_cast<unsigned long long>(mLexer->TokenIndex()) << 2) | static_cast<unsigned long long>(rule);
+    auto hit = mPatternMemo.find(key);
+
+    if (hit != mPatternMemo.end())
+    {
+
+        if (hit->second.mError != nullptr) throw hit->second.mError;
+
+        mLexer->Rewind(hit->second.mEndToken);
+        return hit->second.mNode;
+
+    }
+
+    try
+    {
+
+        auto node = (this->*parse)();
+        mPatternMemo[key] = { node, nullptr, mLexer->TokenIndex() };
+        return node;
+
+    }
+    catch (std::shared_ptr<SyntaxError> error)
+    {
+
+        mPatternMemo[key] = { nullptr, error, 0 };
+        throw;
+
+    }
+
+}
@@ -53,7 +53,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseIf()
 
     if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyElse) node = ParseElse();
 
-    return std::make_shared<AST::IfStatementNode>(startPos, mLexer->Position(), symbol, left, symbol2, right, nodes,node);
+    return MakeNode<AST::IfStatementNode>(startPos, mLexer->Position(), symbol, left, symbol2, right, nodes,node);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseElif()
@@ -64,7 +64,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseElif()
 
     auto left = ParseNamedExpr();
 
-    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyElif)
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon)
         throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing ':' in 'elif' statement!"));
 
     auto symbol2 = mLexer->CurSymbol();
@@ -72,7 +72,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseElif()
 
     auto right = ParseSuite();
 
-    return std::make_shared<AST::ElifStatementNode>(startPos, mLexer->Position(), symbol, left, symbol2, right);
+    return MakeNode<AST::ElifStatementNode>(startPos, mLexer->Position(), symbol, left, symbol2, right);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseElse()
@@ -81,7 +81,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseElse()
     auto symbol = mLexer->CurSymbol();
     mLexer->Advance();
 
-    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyElif)
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon)
         throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing ':' in 'else' statement!"));
 
     auto symbol2 = mLexer->CurSymbol();
@@ -89,7 +89,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseElse()
 
     auto right = ParseSuite();
 
-    return std::make_shared<AST::ElseStatementNode>(startPos, mLexer->Position(), symbol, symbol2, right);;
+    return MakeNode<AST::ElseStatementNode>(startPos, mLexer->Position(), symbol, symbol2, right);;
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseWhile()
@@ -101,7 +101,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseWhile()
 
     auto left = ParseNamedExpr();
 
-    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyElif)
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon)
         throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing ':' in 'while' statement!"));
 
     auto symbol2 = mLexer->CurSymbol();
@@ -113,7 +113,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseWhile()
 
     auto next = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyElse ? ParseElse() : nullptr;
 
-    return std::make_shared<AST::WhileStatementNode>(startPos, mLexer->Position(), symbol, left, symbol2, right, next);
+    return MakeNode<AST::WhileStatementNode>(startPos, mLexer->Position(), symbol, left, symbol2, right, next);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseFor()
@@ -148,7 +148,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseFor()
 
     auto nodeElse = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyElse ? ParseElse() : nullptr;
 
-    return std::make_shared<AST::ForStatementNode>(startPos, mLexer->Position(), symbol1, left, symbol2, right, symbol3, tc, next, nodeElse);
+    return MakeNode<AST::ForStatementNode>(startPos, mLexer->Position(), symbol1, left, symbol2, right, symbol3, tc, next, nodeElse);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseWith()
@@ -158,34 +158,61 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseWith()
     mLexer->Advance();
     auto nodes = std::make_shared<std::vector<std::shared_ptr<AST::StatementNode>>>();
     auto separators = std::make_shared<std::vector<std::shared_ptr<Token>>>();
-    nodes->push_back( ParseWithItem() );
+    std::shared_ptr<Token> symbol10 = nullptr, symbol11 = nullptr;
 
-    auto symbol10 = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyLeftParen ?
-                        mLexer->CurSymbol() : nullptr;
+    /* '(' with_item ( ',' with_item )* [ ',' ] ')' ':' , when the ')' is not followed by ':'
+       the '(' belongs to the first expression and the items are parsed again without it. */
+    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyLeftParen)
+    {
+        auto mark = mLexer->TokenIndex();
 
-    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyLeftParen) mLexer->Advance();
+        try
+        {
+            symbol10 = mLexer->CurSymbol();
+            mLexer->Advance();
 
-    while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma)
-    {
+            nodes->push_back( ParseWithItem() );
 
-        separators->push_back( mLexer->CurSymbol() );
-        mLexer->Advance();
+            while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma)
+            {
+                separators->push_back( mLexer->CurSymbol() );
+                mLexer->Advance();
 
-        if (    mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightParen &&
-                symbol10 != nullptr ) continue;
+                if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightParen) break;
 
-        nodes->push_back( ParseWithItem() );
-    
+                nodes->push_back( ParseWithItem() );
+            }
+
+            if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen)
+                throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing ')' in 'with' statement!"));
+
+            symbol11 = mLexer->CurSymbol();
+            mLexer->Advance();
+
+            if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon)
+                throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing ':' in 'with' statement!"));
+        }
+        catch (std::shared_ptr<SyntaxError> error)
+        {
+            mLexer->Rewind(mark);
+            nodes->clear();
+            separators->clear();
+            symbol10 = symbol11 = nullptr;
+        }
     }
 
-    if (symbol10->GetSymbolKind() == TokenKind::PyLeftParen && mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen)
-        throw ;
+    if (symbol10 == nullptr)
+    {
+        nodes->push_back( ParseWithItem() );
 
-    auto symbol11 = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightParen ?
-                        mLexer->CurSymbol() :
-                        nullptr;
+        while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma)
+        {
+            separators->push_back( mLexer->CurSymbol() );
+            mLexer->Advance();
 
-    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightParen) mLexer->Advance();
+            nodes->push_back( ParseWithItem() );
+        }
+    }
 
     if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon)
         throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing ':' in 'with' statement!"));
@@ -198,7 +225,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseWith()
 
     auto right = ParseSuite();
 
-    return std::make_shared<AST::WithStatementNode>(startPos, mLexer->Position(), symbol, symbol10, nodes, separators, symbol11, symbol2, tc, right);
+    return MakeNode<AST::WithStatementNode>(startPos, mLexer->Position(), symbol, symbol10, nodes, separators, symbol11, symbol2, tc, right);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseWithItem()
@@ -213,10 +240,10 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseWithItem()
 
         auto right = ParseOrExpr();
 
-        return std::make_shared<AST::WithItemStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+        return MakeNode<AST::WithItemStatementNode>(startPos, mLexer->Position(), left, symbol, right);
     }
 
-    return std::make_shared<AST::WithItemStatementNode>(startPos, mLexer->Position(), left, nullptr, nullptr);
+    return MakeNode<AST::WithItemStatementNode>(startPos, mLexer->Position(), left, nullptr, nullptr);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTry()
@@ -225,7 +252,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTry()
     auto symbol = mLexer->CurSymbol();
     mLexer->Advance();
 
-    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Name)
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon)
             throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing ':' in 'try' statement!"));
     
     auto symbol2 = mLexer->CurSymbol();
@@ -238,7 +265,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTry()
         auto symbol3 = mLexer->CurSymbol();
         mLexer->Advance();
 
-        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Name)
+        if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon)
             throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing ':' in 'finally' statement!"));
     
         auto symbol4 = mLexer->CurSymbol();
@@ -246,11 +273,11 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTry()
 
         auto right = ParseSuite();  
 
-        return std::make_shared<AST::TryStatementNode>(startPos, mLexer->Position(), symbol, symbol2, left, nullptr, nullptr, symbol3, symbol4, right);
+        return MakeNode<AST::TryStatementNode>(startPos, mLexer->Position(), symbol, symbol2, left, nullptr, nullptr, symbol3, symbol4, right);
     }
     else
     {
-        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Name)
+        if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyExcept)
             throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing 'except' in 'try' statement!"));
         auto nodes = std::make_shared<std::vector<std::shared_ptr<AST::StatementNode>>>();   
 
@@ -263,7 +290,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTry()
             auto symbol3 = mLexer->CurSymbol();
             mLexer->Advance();
 
-            if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Name)
+            if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon)
                 throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing ':' in 'finally' statement!"));
         
             auto symbol4 = mLexer->CurSymbol();
@@ -271,10 +298,10 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTry()
 
             auto right = ParseSuite();
 
-            return std::make_shared<AST::TryStatementNode>(startPos, mLexer->Position(), symbol, symbol2, left, nodes, node, symbol3, symbol4, right);
+            return MakeNode<AST::TryStatementNode>(startPos, mLexer->Position(), symbol, symbol2, left, nodes, node, symbol3, symbol4, right);
         }
 
-        return std::make_shared<AST::TryStatementNode>(startPos, mLexer->Position(), symbol, symbol2, left, nodes, node, nullptr, nullptr, nullptr);
+        return MakeNode<AST::TryStatementNode>(startPos, mLexer->Position(), symbol, symbol2, left, nodes, node, nullptr, nullptr, nullptr);
     }
 }
 
@@ -283,7 +310,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExcept()
     auto startPos = mLexer->Position();
     auto left = ParseExceptClause();
 
-    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Name)
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon)
             throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing ':' in 'except' statement!"));
     
     auto symbol = mLexer->CurSymbol();
@@ -291,7 +318,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExcept()
 
     auto right = ParseSuite();  
 
-    return std::make_shared<AST::ExceptNode>(startPos, mLexer->Position(), left, symbol, right);
+    return MakeNode<AST::ExceptNode>(startPos, mLexer->Position(), left, symbol, right);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExceptClause()
@@ -302,7 +329,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExceptClause()
 
     if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyColon)
     {
-        return std::make_shared<AST::ExceptClauseNode>(startPos, mLexer->Position(), symbol, nullptr, nullptr, nullptr);
+        return MakeNode<AST::ExceptClauseNode>(startPos, mLexer->Position(), symbol, nullptr, nullptr, nullptr);
     }
 
     auto left = ParseTest();
@@ -312,16 +339,16 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExceptClause()
         auto symbol2 = mLexer->CurSymbol();
         mLexer->Advance();
 
-        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Name)
+        if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Name)
             throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing Name after 'as' in 'except' statement!"));
         
         auto right = std::static_pointer_cast<NameToken> ( mLexer->CurSymbol() );
         mLexer->Advance();
 
-        return std::make_shared<AST::ExceptClauseNode>(startPos, mLexer->Position(), symbol, left, symbol2, right);
+        return MakeNode<AST::ExceptClauseNode>(startPos, mLexer->Position(), symbol, left, symbol2, right);
     }
 
-    return std::make_shared<AST::ExceptClauseNode>(startPos, mLexer->Position(), symbol, left, nullptr, nullptr);
+    return MakeNode<AST::ExceptClauseNode>(startPos, mLexer->Position(), symbol, left, nullptr, nullptr);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDecorated()
@@ -353,7 +380,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDecorated()
             throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Expecting 'class', 'def' or 'async' after '@'in Decorator Statement!"));
     }
 
-    return std::make_shared<AST::DecoratedStatementNode>(startPos, mLexer->Position(), left, right);
+    return MakeNode<AST::DecoratedStatementNode>(startPos, mLexer->Position(), left, right);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDecorators()
@@ -363,7 +390,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDecorators()
 
     while (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyMatrice) nodes->push_back( ParseDecorator() );
 
-    return std::make_shared<AST::DecoratorsStatementNode>(startPos, mLexer->Position(), nodes);
+    return MakeNode<AST::DecoratorsStatementNode>(startPos, mLexer->Position(), nodes);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDecorator()
@@ -397,7 +424,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDecorator()
     symbol4 = mLexer->CurSymbol();
     mLexer->Advance();
 
-    return std::make_shared<AST::DecoratorStatementNode>(startPos, mLexer->Position(), symbol, left, symbol2, right, symbol3, symbol4);
+    return MakeNode<AST::DecoratorStatementNode>(startPos, mLexer->Position(), symbol, left, symbol2, right, symbol3, symbol4);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseAsyncFuncDef()
@@ -411,7 +438,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseAsyncFuncDef()
 
     auto right = ParseFuncDef();
 
-    return std::make_shared<AST::AsyncStatementNode>(startPos, mLexer->Position(), symbol, right);
+    return MakeNode<AST::AsyncStatementNode>(startPos, mLexer->Position(), symbol, right);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseFuncDef()
@@ -420,6 +447,10 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseFuncDef()
     auto symbol1 = mLexer->CurSymbol();
     mLexer->Advance();
     mFuncLevel++;
+
+    /* Loops around the definition do not reach into its body. */
+    auto flowLevel = mFlowLevel;
+    mFlowLevel = 0;
     
     if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Name)
         throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Expecting Name of function declaration!"));
@@ -449,18 +480,101 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseFuncDef()
     auto tc = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::TypeComment ? mLexer->CurSymbol() : nullptr;
     if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::TypeComment) mLexer->Advance();
 
+    if (mLazyFunctionBodies && mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Newline)
+    {
+        auto bodyStart = mLexer->TokenIndex();
+        SkipFuncBodySuite();
+        auto bodyEnd = mLexer->TokenIndex();
+
+        mFuncLevel--;
+        mFlowLevel = flowLevel;
+
+        /* The body is parsed again from a copy of its tokens, up to the token after it,
+           by a parser in the same state this one had at the body. */
+        auto body = mLexer->Replay(bodyStart, bodyEnd);
+        auto maxDepth = mMaxDepth;
+        auto depth = mDepth;
+        auto funcLevel = mFuncLevel + 1;
+        auto usePatternMemo = mUsePatternMemo;
+        auto last = bodyEnd - bodyStart;
+
+        auto thunk = [body, maxDepth, depth, funcLevel, usePatternMemo, last]()
+        {
+            PythonCoreParser parser(body, maxDepth);
+            parser.mDepth = depth;
+            parser.mFuncLevel = funcLevel;
+            parser.mUsePatternMemo = usePatternMemo;
+            parser.mLazyFunctionBodies = true;
+
+            body->Rewind(0);
+            auto suite = parser.ParseFuncBodySuite();
+
+            if (body->TokenIndex() != last)
+                throw std::make_shared<SyntaxError>(body->Position(), body->CurSymbol(), std::make_shared<std::wstring>(L"Function body does not end at its last Dedent!"));
+
+            return suite;
+        };
+
+        return MakeNode<AST::FuncDefStatementNode>(startPos, mLexer->Position(), symbol1, symbol2, left, symbol3, right, symbol4, tc,
+                                                            std::function<std::shared_ptr<AST::StatementNode>()>(thunk));
+    }
+
     auto next = ParseFuncBodySuite();
 
     mFuncLevel--;
+    mFlowLevel = flowLevel;
+
+    return MakeNode<AST::FuncDefStatementNode>(startPos, mLexer->Position(), symbol1, symbol2, left, symbol3, right, symbol4, tc, next);
+}
+
+void PythonCoreParser::SkipFuncBodySuite()
+{
+    /* Indent and Dedent are never produced inside brackets, so counting them finds the
+       Dedent closing the body. Every token is still scanned, which raises the lexer's
+       errors, unbalanced brackets included. */
+    mLexer->Advance();
+
+    if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::TypeComment)
+    {
+        mLexer->Advance();
+
+        if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Newline)
+            throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing Newline after TypeComment in Suite!"));
+
+        mLexer->Advance();
+    }
+
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Indent)
+        throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing Indent in suite!"));
+
+    unsigned int level = 0;
+
+    do
+    {
+        switch (mLexer->CurSymbol()->GetSymbolKind())
+        {
+            case TokenKind::Indent:
+                level++;
+                break;
+            case TokenKind::Dedent:
+                level--;
+                break;
+            case TokenKind::EndOfFile:
+                throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Unexpected end of file in function body!"));
+            default:
+                break;
+        }
 
-    return std::make_shared<AST::FuncDefStatementNode>(startPos, mLexer->Position(), symbol1, symbol2, left, symbol3, right, symbol4, tc, next);
+        mLexer->Advance();
+
+    } while (level > 0);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseParameter()
 {
     auto startPos = mLexer->Position();
 
-    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon)
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyLeftParen)
         throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing '(' in function declaration!"));
 
     auto symbol = mLexer->CurSymbol();
@@ -468,17 +582,19 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseParameter()
 
     auto right = mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen ? ParseTypedArgsList() : nullptr;
 
-    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon)
+    if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyRightParen)
         throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing ')' in function declaration!"));
 
     auto symbol2 = mLexer->CurSymbol();
     mLexer->Advance();
 
-    return std::make_shared<AST::ParameterStatementNode>(startPos, mLexer->Position(), symbol, right, symbol2);
+    return MakeNode<AST::ParameterStatementNode>(startPos, mLexer->Position(), symbol, right, symbol2);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseFuncBodySuite()
 {
+    NestingGuard guard(this, DeepLevel);
+
     if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Newline)
     {
         auto startPos = mLexer->Position();
@@ -497,35 +613,35 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseFuncBodySuite()
 
             nl = mLexer->CurSymbol();
             mLexer->Advance();
+        }
 
-            if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Indent)
-                throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing Indent in suite!"));
+        if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Indent)
+            throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing Indent in suite!"));
 
-            auto symbol2 = mLexer->CurSymbol();
-            mLexer->Advance();
+        auto symbol2 = mLexer->CurSymbol();
+        mLexer->Advance();
 
-            auto nodes = std::make_shared<std::vector<std::shared_ptr<AST::StatementNode>>>();
-            nodes->push_back( ParseStmt() );
-            auto newlines = std::make_shared<std::vector<std::shared_ptr<Token>>>();
+        auto nodes = std::make_shared<std::vector<std::shared_ptr<AST::StatementNode>>>();
+        nodes->push_back( ParseStmtOrError() );
+        auto newlines = std::make_shared<std::vector<std::shared_ptr<Token>>>();
 
-            while (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Dedent)
+        while (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Dedent)
+        {
+            if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Newline)
             {
-                if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Newline)
-                {
-                    newlines->push_back(mLexer->CurSymbol());
-                    mLexer->Advance();
-                }
-                else
-                {
-                    nodes->push_back( ParseStmt() );
-                }
+                newlines->push_back(mLexer->CurSymbol());
+                mLexer->Advance();
+            }
+            else
+            {
+                nodes->push_back( ParseStmtOrError() );
             }
+        }
 
-            auto symbol3 = mLexer->CurSymbol();
-            mLexer->Advance();
+        auto symbol3 = mLexer->CurSymbol();
+        mLexer->Advance();
 
-            return std::make_shared<AST::FuncBodySuiteStatementNode>(startPos, mLexer->Position(), symbol1, tc, nl, symbol2,  nodes, newlines, symbol3);
-        }
+        return MakeNode<AST::FuncBodySuiteStatementNode>(startPos, mLexer->Position(), symbol1, tc, nl, symbol2,  nodes, newlines, symbol3);
     }
 
     return ParseSimpleStmt();
@@ -541,59 +657,33 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTypedArgsList()
     std::shared_ptr<Token> mulOp = nullptr, powerOp = nullptr;
     std::shared_ptr<AST::StatementNode> mulNode = nullptr, powerNode = nullptr;
 
-    switch ( mLexer->CurSymbol()->GetSymbolKind() )
+    while (true)
     {
-        case TokenKind::PyMul:
-
-            {
-                mulOp = mLexer->CurSymbol();
-                mLexer->Advance();
-
-                if ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Name )
-                    throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing Name literal after '*' in argument list!"));
-
-                mulNode = ParseTFPDef();
-
-                while ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                {
-                    separators->push_back( mLexer->CurSymbol() );
-                    mLexer->Advance();
-
-                    if ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyComma )
-                        throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Unexpected ',' in argument list!"));
+        switch ( mLexer->CurSymbol()->GetSymbolKind() )
+        {
+            case TokenKind::PyDiv:
 
-                    if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyColon ) continue;
+                if ( div != nullptr || mulOp != nullptr || nodes->empty() )
+                    throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Unexpected '/' in argument list!"));
 
-                    if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPower )
-                    {
-                        powerOp = mLexer->CurSymbol();
-                        mLexer->Advance();
+                div = mLexer->CurSymbol();
+                mLexer->Advance();
+                break;
 
-                        if ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Name )
-                            throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing Name literal after '**' in argument list!"));
+            case TokenKind::PyMul:
 
-                        powerNode = ParseTFPDef();
+                if ( mulOp != nullptr )
+                    throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Only one '*' allowed in argument list!"));
 
-                        if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                        {
-                            separators->push_back( mLexer->CurSymbol() );
-                            mLexer->Advance();
-                        }
+                mulOp = mLexer->CurSymbol();
+                mLexer->Advance();
 
-                        if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                            throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Unexpected ',' in argument!"));
-       
-                        continue;
-                    }
+                /* A bare '*' only marks the start of keyword only arguments. */
+                if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Name ) mulNode = ParseTFPDef();
+                break;
 
-                    nodes->push_back( ParseTFPDef() );
-                }
-            }
-            break;
+            case TokenKind::PyPower:
 
-        case TokenKind::PyPower:
-            
-            {
                 powerOp = mLexer->CurSymbol();
                 mLexer->Advance();
 
@@ -601,140 +691,38 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTypedArgsList()
                     throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing Name literal after '**' in argument list!"));
 
                 powerNode = ParseTFPDef();
+                break;
 
-                if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                {
-                    separators->push_back( mLexer->CurSymbol() );
-                    mLexer->Advance();
-                }
+            default:
 
-                if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                    throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Unexpected ',' in argument!"));
-            }
-            break;
+                nodes->push_back( ParseTypedAssign() );
+                break;
+        }
 
-        default:
-            {
-                nodes->push_back( ParseTFPDef() );
+        if ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyComma ) break;
 
-                while ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                {
-                    separators->push_back( mLexer->CurSymbol() );
-                    mLexer->Advance();
+        separators->push_back( mLexer->CurSymbol() );
+        mLexer->Advance();
 
-                    if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                        throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Unexpected ',' in argument!"));
- 
-                    if (    mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyMul ||
-                            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPower ||
-                            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyColon ||
-                            mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyDiv) continue;
+        if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::TypeComment )
+        {
+            tc->push_back( mLexer->CurSymbol() );
+            mLexer->Advance();
+        }
 
-                    nodes->push_back( ParseTFPDef() );
-                }
+        if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyRightParen ) break;
 
-                if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyDiv )
-                {
-                    div = mLexer->CurSymbol();
-                    mLexer->Advance();
+        if ( powerOp != nullptr )
+            throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Unexpected argument after '**' argument!"));
+    }
 
-                    auto lastToken = div;
-
-                    if ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyColon )
-                    {
-                        while ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                        {
-                            separators->push_back( mLexer->CurSymbol() );
-                            lastToken = mLexer->CurSymbol();
-                            mLexer->Advance();
-
-                            if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                                throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Unexpected ',' in argument!"));
-                             
-                            if (    mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyMul ||
-                                    mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPower ||
-                                    mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyColon) continue;
-
-                            nodes->push_back( ParseTFPDef() );
-
-                            if (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyComma)
-                                return std::make_shared<AST::TypedArgsListStatementNode>(startPos, mLexer->Position(), nodes, separators, div, mulOp, mulNode, powerOp, powerNode, tc);
-                        }
-
-                        if (lastToken->GetSymbolKind() != TokenKind::PyComma)
-                            throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Expecting ',' after '/' in argument list!"));
-
-                        if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyMul)
-                        {
-                            mulOp = mLexer->CurSymbol();
-                            mLexer->Advance();
-
-                            if ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Name )
-                                throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing Name literal after '*' in argument list!"));
-
-                            mulNode = ParseTFPDef();
-
-                            while ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                            {
-                                separators->push_back( mLexer->CurSymbol() );
-                                mLexer->Advance();
-
-                                if ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::PyComma )
-                                    throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Unexpected ',' in argument list!"));
-
-                                if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyColon ) continue;
-
-                                if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPower )
-                                {
-                                    powerOp = mLexer->CurSymbol();
-                                    mLexer->Advance();
-
-                                    if ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Name )
-                                        throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing Name literal after '**' in argument list!"));
-
-                                    powerNode = ParseTFPDef();
-
-                                    if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                                    {
-                                        separators->push_back( mLexer->CurSymbol() );
-                                        mLexer->Advance();
-                                    }
-
-                                    if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                                        throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Unexpected ',' in argument!"));
-                
-                                    continue;
-                                }
-
-                                nodes->push_back( ParseTFPDef() );
-                            }
-                        }
-                        else if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyPower)
-                        {
-                            powerOp = mLexer->CurSymbol();
-                            mLexer->Advance();
-
-                            if ( mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Name )
-                                throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Missing Name literal after '**' in argument list!"));
-
-                            powerNode = ParseTFPDef();
-
-                            if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                            {
-                                separators->push_back( mLexer->CurSymbol() );
-                                mLexer->Advance();
-                            }
-
-                            if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyComma )
-                                throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Unexpected ',' in argument!"));
-                        }
-                    }
-                }
-            }
-            break;
+    if ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::TypeComment )
+    {
+        tc->push_back( mLexer->CurSymbol() );
+        mLexer->Advance();
     }
 
-    return std::make_shared<AST::TypedArgsListStatementNode>(startPos, mLexer->Position(), nodes, separators, div, mulOp, mulNode, powerOp, powerNode, tc);
+    return MakeNode<AST::TypedArgsListStatementNode>(startPos, mLexer->Position(), nodes, separators, div, mulOp, mulNode, powerOp, powerNode, tc);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTypedAssign()
@@ -749,7 +737,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTypedAssign()
 
         auto right = ParseTest();
 
-        return std::make_shared<AST::TFPDefAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+        return MakeNode<AST::TFPDefAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
     }
 
     return left;
@@ -772,10 +760,10 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTFPDef()
 
         auto right = ParseTest();
 
-        return std::make_shared<AST::TFPDefStatementNode>(startPos, mLexer->Position(), symbol, symbol2, right);
+        return MakeNode<AST::TFPDefStatementNode>(startPos, mLexer->Position(), symbol, symbol2, right);
     }
 
-    return std::make_shared<AST::TFPDefStatementNode>(startPos, mLexer->Position(), symbol, nullptr, nullptr);
+    return MakeNode<AST::TFPDefStatementNode>(startPos, mLexer->Position(), symbol, nullptr, nullptr);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseClass()
@@ -816,11 +804,13 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseClass()
 
     auto right = ParseSuite();
 
-    return std::make_shared<AST::ClassStatementNode>(startPos, mLexer->Position(), symbol1, symbol2, symbol3, left, symbol4, symbol5, right);
+    return MakeNode<AST::ClassStatementNode>(startPos, mLexer->Position(), symbol1, symbol2, symbol3, left, symbol4, symbol5, right);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSuite()
 {
+    NestingGuard guard(this, DeepLevel);
+
     if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Newline)
     {
         auto startPos = mLexer->Position();
@@ -834,7 +824,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSuite()
         mLexer->Advance();
 
         auto nodes = std::make_shared<std::vector<std::shared_ptr<AST::StatementNode>>>();
-        nodes->push_back( ParseStmt() );
+        nodes->push_back( ParseStmtOrError() );
         auto newlines = std::make_shared<std::vector<std::shared_ptr<Token>>>();
 
         while (mLexer->CurSymbol()->GetSymbolKind() != TokenKind::Dedent)
@@ -846,14 +836,14 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSuite()
             }
             else
             {
-                nodes->push_back( ParseStmt() );
+                nodes->push_back( ParseStmtOrError() );
             }
         }
 
         auto symbol3 = mLexer->CurSymbol();
         mLexer->Advance();
 
-        return std::make_shared<AST::SuiteStatementNode>(startPos, mLexer->Position(), symbol1, symbol2, nodes, newlines, symbol3);
+        return MakeNode<AST::SuiteStatementNode>(startPos, mLexer->Position(), symbol1, symbol2, nodes, newlines, symbol3);
     }
 
     return ParseSimpleStmt();
@@ -889,7 +879,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseAsync()
             throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Expecting 'with', 'def' or 'for' after 'async'!"));
     }
 
-    return std::make_shared<AST::AsyncStatementNode>(startPos, mLexer->Position(), symbol, right);
+    return MakeNode<AST::AsyncStatementNode>(startPos, mLexer->Position(), symbol, right);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseStmt()
@@ -913,7 +903,22 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseStmt()
             {
                 auto match = std::static_pointer_cast<NameToken>(mLexer->CurSymbol());
 
-                return match->IsMatchSoftKeyword() ? ParseMatch() : ParseSimpleStmt();
+                if (!match->IsMatchSoftKeyword()) return ParseSimpleStmt();
+
+                /* 'match' is a soft keyword, when the statement is not a match statement
+                   the name is parsed again as the start of an expression. */
+                auto mark = mLexer->TokenIndex();
+
+                try
+                {
+                    return ParseMatch();
+                }
+                catch (std::shared_ptr<SyntaxError> error)
+                {
+                    mLexer->Rewind(mark);
+                }
+
+                return ParseSimpleStmt();
             }
         
         default:
@@ -922,6 +927,88 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseStmt()
     }
 }
 
+static bool IsStatementKeyword(TokenKind kind)
+{
+    switch (kind)
+    {
+        case TokenKind::PyAssert:
+        case TokenKind::PyBreak:
+        case TokenKind::PyClass:
+        case TokenKind::PyContinue:
+        case TokenKind::PyDef:
+        case TokenKind::PyDel:
+        case TokenKind::PyGlobal:
+        case TokenKind::PyImport:
+        case TokenKind::PyNonLocal:
+        case TokenKind::PyPass:
+        case TokenKind::PyRaise:
+        case TokenKind::PyReturn:
+        case TokenKind::PyTry:
+        case TokenKind::PyWhile:
+        case TokenKind::PyWith:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseStmtOrError()
+{
+    if (!mErrorRecovery) return ParseStmt();
+
+    auto startPos = mLexer->Position();
+    auto first = mLexer->TokenIndex();
+    auto flowLevel = mFlowLevel;
+    auto funcLevel = mFuncLevel;
+
+    try
+    {
+        return ParseStmt();
+    }
+    catch (std::shared_ptr<SyntaxError> error)
+    {
+        mDiagnostics.push_back(error);
+        mFlowLevel = flowLevel;
+        mFuncLevel = funcLevel;
+    }
+
+    /* Skip the statement from its first token. A block following a broken header is
+       skipped with it, a statement keyword outside blocks starts the next statement,
+       except for the 'import' that belongs to a broken 'from' statement. */
+    mLexer->Rewind(first);
+
+    auto nodes = std::make_shared<std::vector<std::shared_ptr<Token>>>();
+    unsigned int level = 0;
+    auto importOfFrom = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyFrom;
+
+    while (true)
+    {
+        auto kind = mLexer->CurSymbol()->GetSymbolKind();
+
+        if (kind == TokenKind::EndOfFile) break;
+        if (level == 0 && kind == TokenKind::Dedent) break;
+        if (level == 0 && !nodes->empty() && IsStatementKeyword(kind))
+        {
+            if (kind != TokenKind::PyImport || !importOfFrom) break;
+            importOfFrom = false;
+        }
+
+        nodes->push_back(mLexer->CurSymbol());
+        mLexer->Advance();
+
+        if (kind == TokenKind::Indent) level++;
+        else if (kind == TokenKind::Dedent) level--;
+
+        if (level == 0 && (kind == TokenKind::Newline || kind == TokenKind::Dedent))
+        {
+            if (kind == TokenKind::Newline && mLexer->CurSymbol()->GetSymbolKind() == TokenKind::Indent) continue;
+            break;
+        }
+    }
+
+    return MakeNode<AST::ErrorStatementNode>(startPos, mLexer->Position(), nodes);
+}
+
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSimpleStmt()
 {
     auto startPos = mLexer->Position();
@@ -944,7 +1031,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSimpleStmt()
     auto symbol = mLexer->CurSymbol();
     mLexer->Advance();
 
-    return std::make_shared<AST::SimpleStatementNode>(startPos, mLexer->Position(), nodes, separators, symbol);
+    return MakeNode<AST::SimpleStatementNode>(startPos, mLexer->Position(), nodes, separators, symbol);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseSmallStmt()
@@ -1017,7 +1104,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::PlusAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::PlusAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyMinusAssign:
 
@@ -1025,7 +1112,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::MinusAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::MinusAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyMulAssign:
 
@@ -1033,7 +1120,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::MulAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::MulAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyDivAssign:
 
@@ -1041,7 +1128,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::DivAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::DivAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyPowerAssign:
 
@@ -1049,7 +1136,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::PowerAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::PowerAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyFloorDivAssign:
 
@@ -1057,7 +1144,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::FloorDivAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::FloorDivAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyShiftLeftAssign:
 
@@ -1065,7 +1152,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::ShiftLeftAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::ShiftLeftAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyShiftRightAssign:
 
@@ -1073,7 +1160,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::ShiftRightAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::ShiftRightAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyModuloAssign:
 
@@ -1081,7 +1168,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::ModuloAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::ModuloAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyMatriceAssign:
 
@@ -1089,7 +1176,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::MatriceAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::MatriceAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyBitAndAssign:
 
@@ -1097,7 +1184,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::BitAndAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::BitAndAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyBitXorAssign:
 
@@ -1105,7 +1192,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::BitXorAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::BitXorAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyBitOrAssign:
 
@@ -1113,7 +1200,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
             mLexer->Advance();
             right = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyYield ? ParseYieldExpr() : ParseTestList();
 
-            return std::make_shared<AST::BitOrAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
+            return MakeNode<AST::BitOrAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right);
 
         case TokenKind::PyColon:
 
@@ -1140,7 +1227,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseExpr()
                 auto tc = mLexer->CurSymbol()->GetSymbolKind() == TokenKind::TypeComment ? mLexer->CurSymbol() : nullptr;
                 if (mLexer->CurSymbol()->GetSymbolKind() == TokenKind::TypeComment) mLexer->Advance();
 
-                return std::make_shared<AST::AssignStatementNode>(startPos, mLexer->Position(), left, operators, nodes, tc);
+                return MakeNode<AST::AssignStatementNode>(startPos, mLexer->Position(), left, operators, nodes, tc);
             }
 
         default:
@@ -1164,10 +1251,10 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseAnnAssign(unsigned in
                             std::static_pointer_cast<AST::Node>( ParseYieldExpr() ) :
                             std::static_pointer_cast<AST::Node>( ParseTestListStarExpr() );
 
-        return std::make_shared<AST::AnnAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right, symbol2, next);
+        return MakeNode<AST::AnnAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right, symbol2, next);
     }
 
-    return std::make_shared<AST::AnnAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right, nullptr, nullptr);
+    return MakeNode<AST::AnnAssignStatementNode>(startPos, mLexer->Position(), left, symbol, right, nullptr, nullptr);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTestListStarExpr()
@@ -1209,7 +1296,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseTestListStarExpr()
         }
     }
 
-    return std::make_shared<AST::TestListStarExprListStatementNode>(startPos, mLexer->Position(), nodes, separators);
+    return MakeNode<AST::TestListStarExprListStatementNode>(startPos, mLexer->Position(), nodes, separators);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDel()
@@ -1220,7 +1307,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDel()
 
     auto right = ParseExprList();
 
-    return std::make_shared<AST::DelStatementNode>(startPos, mLexer->Position(), symbol, right);
+    return MakeNode<AST::DelStatementNode>(startPos, mLexer->Position(), symbol, right);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParsePass()
@@ -1229,7 +1316,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParsePass()
     auto symbol = mLexer->CurSymbol();
     mLexer->Advance();
 
-    return std::make_shared<AST::PassStatementNode>(startPos, mLexer->Position(), symbol);
+    return MakeNode<AST::PassStatementNode>(startPos, mLexer->Position(), symbol);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseBreak()
@@ -1240,7 +1327,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseBreak()
 
     if (mFlowLevel == 0) throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Found 'break' outside of a loop statement!"));
 
-    return std::make_shared<AST::BreakStatementNode>(startPos, mLexer->Position(), symbol);
+    return MakeNode<AST::BreakStatementNode>(startPos, mLexer->Position(), symbol);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseContinue()
@@ -1251,7 +1338,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseContinue()
 
     if (mFlowLevel == 0) throw std::make_shared<SyntaxError>(mLexer->Position(), mLexer->CurSymbol(), std::make_shared<std::wstring>(L"Found 'continue' outside of a loop statement!"));
 
-    return std::make_shared<AST::ContinueStatementNode>(startPos, mLexer->Position(), symbol);
+    return MakeNode<AST::ContinueStatementNode>(startPos, mLexer->Position(), symbol);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseReturn()
@@ -1267,13 +1354,13 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseReturn()
         case TokenKind::Newline:
         case TokenKind::PySemiColon:
 
-            return std::make_shared<AST::ReturnStatementNode>(startPos, mLexer->Position(), symbol, nullptr);
+            return MakeNode<AST::ReturnStatementNode>(startPos, mLexer->Position(), symbol, nullptr);
 
         default:
 
             auto right = ParseTestListStarExpr();
 
-            return std::make_shared<AST::ReturnStatementNode>(startPos, mLexer->Position(), symbol, right);
+            return MakeNode<AST::ReturnStatementNode>(startPos, mLexer->Position(), symbol, right);
             
     }
 }
@@ -1286,7 +1373,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseYieldStmt()
 
     auto right = ParseYieldExpr();
 
-    return std::make_shared<AST::YieldStatementNode>(startPos, mLexer->Position(), right);
+    return MakeNode<AST::YieldStatementNode>(startPos, mLexer->Position(), right);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseRaise()
@@ -1300,7 +1387,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseRaise()
         case TokenKind::Newline:
         case TokenKind::PySemiColon:
 
-            return std::make_shared<AST::RaiseStatementNode>(startPos, mLexer->Position(), symbol, nullptr, nullptr, nullptr);
+            return MakeNode<AST::RaiseStatementNode>(startPos, mLexer->Position(), symbol, nullptr, nullptr, nullptr);
 
         default:
             
@@ -1313,10 +1400,10 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseRaise()
 
                 auto right = ParseTest();
 
-                return std::make_shared<AST::RaiseStatementNode>(startPos, mLexer->Position(), symbol, left, symbol2, right);
+                return MakeNode<AST::RaiseStatementNode>(startPos, mLexer->Position(), symbol, left, symbol2, right);
             }
 
-            return std::make_shared<AST::RaiseStatementNode>(startPos, mLexer->Position(), symbol, left, nullptr, nullptr);
+            return MakeNode<AST::RaiseStatementNode>(startPos, mLexer->Position(), symbol, left, nullptr, nullptr);
     }
 }
 
@@ -1333,7 +1420,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseImportName()
 
     auto right = ParseDottedName();
 
-    return std::make_shared<AST::ImportStatementNode>(startPos, mLexer->Position(), symbol, right);
+    return MakeNode<AST::ImportStatementNode>(startPos, mLexer->Position(), symbol, right);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseImportFrom()
@@ -1341,7 +1428,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseImportFrom()
     auto startPos = mLexer->Position();
     auto symbol1 = mLexer->CurSymbol(); // 'from'
     mLexer->Advance();
-    auto dots = std::shared_ptr<std::vector<std::shared_ptr<Token>>>();
+    auto dots = std::make_shared<std::vector<std::shared_ptr<Token>>>();
     std::shared_ptr<AST::StatementNode> left = nullptr, right = nullptr;
 
     while ( mLexer->CurSymbol()->GetSymbolKind() == TokenKind::PyDot ||
@@ -1371,7 +1458,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseImportFrom()
                 auto symbol5 = mLexer->CurSymbol();
                 mLexer->Advance();
 
-                return std::make_shared<AST::ImportFromStatementNode>(startPos, mLexer->Position(), symbol1, dots, left, symbol2, symbol5, nullptr, nullptr);
+                return MakeNode<AST::ImportFromStatementNode>(startPos, mLexer->Position(), symbol1, dots, left, symbol2, symbol5, nullptr, nullptr);
             }
 
         case TokenKind::PyLeftParen:
@@ -1388,14 +1475,14 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseImportFrom()
                 auto symbol4 = mLexer->CurSymbol(); // ')'
                 mLexer->Advance();
 
-                return std::make_shared<AST::ImportFromStatementNode>(startPos, mLexer->Position(), symbol1, dots, left, symbol2, symbol3, right, symbol4);
+                return MakeNode<AST::ImportFromStatementNode>(startPos, mLexer->Position(), symbol1, dots, left, symbol2, symbol3, right, symbol4);
             }
 
         default:
 
             right = ParseImportAsNames();
 
-            return std::make_shared<AST::ImportFromStatementNode>(startPos, mLexer->Position(), symbol1, dots, left, symbol2, nullptr, right, nullptr);
+            return MakeNode<AST::ImportFromStatementNode>(startPos, mLexer->Position(), symbol1, dots, left, symbol2, nullptr, right, nullptr);
     }
 }
 
@@ -1420,10 +1507,10 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseImportAsName()
         auto symbol3 = mLexer->CurSymbol();
         mLexer->Advance();
 
-        return std::make_shared<AST::ImportAsNameStatementNode>(startPos, mLexer->Position(), symbol1, symbol2, symbol3);
+        return MakeNode<AST::ImportAsNameStatementNode>(startPos, mLexer->Position(), symbol1, symbol2, symbol3);
     }
 
-    return std::make_shared<AST::ImportAsNameStatementNode>(startPos, mLexer->Position(), symbol1, nullptr, nullptr);
+    return MakeNode<AST::ImportAsNameStatementNode>(startPos, mLexer->Position(), symbol1, nullptr, nullptr);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDottedAsName()
@@ -1446,7 +1533,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDottedAsName()
         auto symbol3 = std::static_pointer_cast<NameToken>( mLexer->CurSymbol() );
         mLexer->Advance();
 
-        return std::make_shared<AST::DottedAsNameStatementNode>(startPos, mLexer->Position(), left, symbol2, symbol3);
+        return MakeNode<AST::DottedAsNameStatementNode>(startPos, mLexer->Position(), left, symbol2, symbol3);
     }
 
     return left;
@@ -1475,7 +1562,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseImportAsNames()
 
     if ( nodes->size() == 1 && separators->size() == 0 ) return nodes->back();
 
-    return std::make_shared<AST::ImportAsNamesStatementNode>(startPos, mLexer->Position(), nodes, separators);
+    return MakeNode<AST::ImportAsNamesStatementNode>(startPos, mLexer->Position(), nodes, separators);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDottedAsNames()
@@ -1496,7 +1583,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDottedAsNames()
 
     if ( nodes->size() == 1 && separators->size() == 0 ) return nodes->back();
 
-    return std::make_shared<AST::DottedAsNamesStatementNode>(startPos, mLexer->Position(), nodes, separators);
+    return MakeNode<AST::DottedAsNamesStatementNode>(startPos, mLexer->Position(), nodes, separators);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDottedName()
@@ -1523,7 +1610,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseDottedName()
         mLexer->Advance();
     }
 
-    return std::make_shared<AST::DottedNameStatementNode>(startPos, mLexer->Position(), nodes, dots);
+    return MakeNode<AST::DottedNameStatementNode>(startPos, mLexer->Position(), nodes, dots);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseGlobal()
@@ -1553,7 +1640,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseGlobal()
         mLexer->Advance();
     }
 
-    return std::make_shared<AST::GlobalStatementNode>(startPos, mLexer->Position(), symbol, nodes, separators);
+    return MakeNode<AST::GlobalStatementNode>(startPos, mLexer->Position(), symbol, nodes, separators);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseNonlocal()
@@ -1583,7 +1670,7 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseNonlocal()
         mLexer->Advance();
     }
 
-    return std::make_shared<AST::NonlocalStatementNode>(startPos, mLexer->Position(), symbol, nodes, separators);
+    return MakeNode<AST::NonlocalStatementNode>(startPos, mLexer->Position(), symbol, nodes, separators);
 }
 
 std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseAssert()
@@ -1601,8 +1688,8 @@ std::shared_ptr<AST::StatementNode> PythonCoreParser::ParseAssert()
 
         auto right = ParseTest();
 
-        return std::make_shared<AST::AssertStatementNode>(startPos, mLexer->Position(), symbol, left, symbol2, right);
+        return MakeNode<AST::AssertStatementNode>(startPos, mLexer->Position(), symbol, left, symbol2, right);
     }
 
-    return std::make_shared<AST::AssertStatementNode>(startPos, mLexer->Position(), symbol, left, nullptr, nullptr);
+    return MakeNode<AST::AssertStatementNode>(startPos, mLexer->Position(), symbol, left, nullptr, nullptr);
 }
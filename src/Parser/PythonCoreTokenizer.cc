@@ -1,8 +1,10 @@
 
 #include <PythonCoreTokenizer.h>
 
+#include <algorithm>
+#include <cwctype>
+
 using namespace PythonCoreNative::RunTime::Parser;
-#include <iostream>
 
 PythonCoreTokenizer::PythonCoreTokenizer(unsigned int tabSize, std::shared_ptr<SourceBuffer> sourceBuffer)
 {
@@ -11,9 +13,31 @@ PythonCoreTokenizer::PythonCoreTokenizer(unsigned int tabSize, std::shared_ptr<S
     mSourceBuffer = sourceBuffer;
     mPosition = mSourceBuffer->BufferPosition();
     mAtBOL = true;
+    mIsBlankLine = false;
     mPending = 0;
-    
-    
+    mTabSize = tabSize;
+    mIsInteractive = false;
+    mIndentLevel.push(0);
+    mFirstToken = 0;
+    mNextToken = 0;
+}
+
+PythonCoreTokenizer::PythonCoreTokenizer(std::vector<std::shared_ptr<Token>> tokens, std::vector<unsigned int> positions)
+{
+    if (tokens.empty() || tokens.size() != positions.size()) throw ;
+
+    mTokens = std::move(tokens);
+    mTokenPositions = std::move(positions);
+    mCurSymbol = mTokens.front();
+    mFirstToken = 0;
+    mNextToken = 1;
+    mPosition = 0;
+    mAtBOL = false;
+    mIsBlankLine = false;
+    mPending = 0;
+    mTabSize = 0;
+    mIsInteractive = false;
+    mIndentLevel.push(0);
 }
 
 std::shared_ptr<Token> PythonCoreTokenizer::CurSymbol()
@@ -23,26 +47,75 @@ std::shared_ptr<Token> PythonCoreTokenizer::CurSymbol()
             
 unsigned int PythonCoreTokenizer::Position()
 {
-    return mSourceBuffer->BufferPosition();
+    return mNextToken == 0 ? mSourceBuffer->BufferPosition() : mTokenPositions[mNextToken - 1 - mFirstToken];
 }
 
-void PythonCoreTokenizer::UnWindTokenStream(unsigned int pos)
+unsigned int PythonCoreTokenizer::TokenIndex()
 {
-    mSourceBuffer->SetPosition(pos);
+    return mNextToken == 0 ? 0 : mNextToken - 1;
 }
-            
+
+void PythonCoreTokenizer::Rewind(unsigned int tokenIndex)
+{
+    mCurSymbol = mTokens[tokenIndex - mFirstToken];
+    mNextToken = tokenIndex + 1;
+}
+
+void PythonCoreTokenizer::Release(unsigned int tokenIndex)
+{
+    tokenIndex = std::min(tokenIndex, TokenIndex());
+    if (tokenIndex <= mFirstToken) return;
+
+    auto count = tokenIndex - mFirstToken;
+    mTokens.erase(mTokens.begin(), mTokens.begin() + count);
+    mTokenPositions.erase(mTokenPositions.begin(), mTokenPositions.begin() + count);
+    mFirstToken += count;
+}
+
+std::shared_ptr<PythonCoreTokenizer> PythonCoreTokenizer::Replay(unsigned int first, unsigned int last)
+{
+    first -= mFirstToken;
+    last -= mFirstToken;
+
+    return std::make_shared<PythonCoreTokenizer>(
+        std::vector<std::shared_ptr<Token>>(mTokens.begin() + first, mTokens.begin() + last + 1),
+        std::vector<unsigned int>(mTokenPositions.begin() + first, mTokenPositions.begin() + last + 1));
+}
+
+void PythonCoreTokenizer::SetInterner(std::shared_ptr<NameInterner> interner)
+{
+    mInterner = interner;
+}
+
 void PythonCoreTokenizer::Advance()
+{
+    if (mNextToken - mFirstToken < mTokens.size())
+    {
+        mCurSymbol = mTokens[mNextToken++ - mFirstToken];
+        return;
+    }
+
+    if (mSourceBuffer == nullptr) return;
+
+    ScanToken();
+
+    mTokens.push_back(mCurSymbol);
+    mTokenPositions.push_back(mSourceBuffer->BufferPosition());
+    mNextToken = mFirstToken + static_cast<unsigned int>(mTokens.size());
+}
+            
+void PythonCoreTokenizer::ScanToken()
 {
 
     auto triviaList = std::make_shared<std::vector<std::shared_ptr<Trivia>>>();
 
-    auto isUnicode = false, isFormated = false, isRaw = false;
+    auto isUnicode = false, isFormated = false, isRaw = false, isBytes = false;
 
 _nextLine:  
 
     mIsBlankLine = false;
 
-    isUnicode = isRaw = isFormated = false;
+    isUnicode = isRaw = isFormated = isBytes = false;
 
     /* Analyze start of source code line */
     if (mAtBOL)
@@ -150,7 +223,7 @@ _nextLine:
 
     /* Handling indent or dedent(s) */
     if (mPending != 0)
-    {   std::wcout << L" Pending: " << mPending << L" " << std::endl;
+    {
 
         if (mPending < 0)
         {
@@ -186,6 +259,7 @@ _again:
     /* Handle whitespace and other trivia */
     while (mSourceBuffer->PeekChar() == ' ' || mSourceBuffer->PeekChar() == '\v' || mSourceBuffer->PeekChar() == '\t')
     {
+        auto startPos = mSourceBuffer->BufferPosition();
         auto ch = mSourceBuffer->GetChar();
         switch (ch)
         {
@@ -196,12 +270,13 @@ _again:
                     mSourceBuffer->Next();
                 }
 
-                triviaList->push_back( std::make_shared<WhiteSpaceTrivia>(mPosition, mSourceBuffer->BufferPosition(), ch) );
+                triviaList->push_back( std::make_shared<WhiteSpaceTrivia>(startPos, mSourceBuffer->BufferPosition(), ch) );
                 break;
 
             case '\t':
+            case '\v':
 
-                triviaList->push_back( std::make_shared<WhiteSpaceTrivia>(mPosition, mSourceBuffer->BufferPosition(), ch) );
+                triviaList->push_back( std::make_shared<WhiteSpaceTrivia>(startPos, mSourceBuffer->BufferPosition(), ch) );
                 break;
 
             default:
@@ -217,13 +292,13 @@ _again:
     {
         std::wstringstream buffer;
 
-        while ( mSourceBuffer->PeekChar() != '\r' ||
-                mSourceBuffer->PeekChar() != '\n' ||
+        while ( mSourceBuffer->PeekChar() != '\r' &&
+                mSourceBuffer->PeekChar() != '\n' &&
                 mSourceBuffer->PeekChar() != '\0' ) buffer << mSourceBuffer->GetChar();
 
         std::wstring key = buffer.str(); 
 
-        if (key.find_first_of(L"# type: ", 0, sizeof(wchar_t)) == 0)
+        if (key.compare(0, 8, L"# type: ") == 0)
         {
             /* Type Comments starts with '# type: ' */
             mCurSymbol = std::make_shared<TypeCommentToken>(
@@ -281,67 +356,22 @@ _again:
         else if (key.size() < 3 && ( mSourceBuffer->PeekChar() == '"' || mSourceBuffer->PeekChar() == '\'') )
         {
 
-            if (key.find_first_of(L"r", 0, sizeof(wchar_t)))
-            {
-                isRaw = true;
-            }
-
-            else if (key.find_first_of(L"u", 0, sizeof(wchar_t)))
-            {
-                isUnicode = true;
-            }
+            auto isIllegal = key.size() == 2 && std::towlower(key[0]) == std::towlower(key[1]);
 
-            else if (key.find_first_of(L"R", 0, sizeof(wchar_t)))
+            for (auto ch : key)
             {
-                isRaw = true;
-            }
-
-            else if (key.find_first_of(L"U", 0, sizeof(wchar_t)))
-            {
-                isUnicode = true;
-            }
-
-            else if (key.find_first_of(L"f", 0, sizeof(wchar_t)))
-            {
-                isFormated = true;
-            }
-
-            else if (key.find_first_of(L"F", 0, sizeof(wchar_t)))
-            {
-                isFormated = true;
-            }
-
-            else if (key.find_first_of(L"fr", 0, sizeof(wchar_t)))
-            {
-                isFormated = isRaw = true;
-            }
-
-            else if (key.find_first_of(L"FR", 0, sizeof(wchar_t)))
-            {
-                isFormated = isRaw = true;
-            }
-
-            else if (key.find_first_of(L"rf", 0, sizeof(wchar_t)))
-            {
-                isFormated = isRaw = true;
-            }
-
-            else if (key.find_first_of(L"rF", 0, sizeof(wchar_t)))
-            {
-                isFormated = isRaw = true;
-            }
-
-            else if (key.find_first_of(L"Rf", 0, sizeof(wchar_t)))
-            {
-                isFormated = isRaw = true;
+                switch (ch)
+                {
+                    case L'r': case L'R':   isRaw = true; break;
+                    case L'u': case L'U':   isUnicode = true; break;
+                    case L'f': case L'F':   isFormated = true; break;
+                    case L'b': case L'B':   isBytes = true; break;
+                    default:                isIllegal = true; break;
+                }
             }
 
-            else if (key.find_first_of(L"RF", 0, sizeof(wchar_t)))
-            {
-                isFormated = isRaw = true;
-            }
-
-            else
+            /* u stands alone, f and b combine with r only. */
+            if (isIllegal || (isUnicode && key.size() > 1) || (isFormated && isBytes))
             {
 
                 throw std::make_shared<LexicalError>(   
@@ -358,7 +388,7 @@ _again:
             mCurSymbol = std::make_shared<NameToken>(
                 mPosition, 
                 mSourceBuffer->BufferPosition(), 
-                std::make_shared<std::wstring>(key),
+                mInterner == nullptr ? std::make_shared<std::wstring>(key) : mInterner->Intern(key),
                 triviaList);
             
             return;
@@ -417,10 +447,17 @@ _again:
 
                 return;
             }
-            else 
-                throw std::make_shared<LexicalError>(
+
+            /* Two dots are two tokens, as in 'from ..a import b'. */
+            mSourceBuffer->UngetChar(L'.');
+
+            mCurSymbol = std::make_shared<Token>(
+                    mPosition,
                     mSourceBuffer->BufferPosition(),
-                    std::make_shared<std::wstring>(L"Missing one '.' in elipsis operator '...' or uneeded '.'") );
+                    TokenKind::PyDot,
+                    triviaList);
+
+            return;
         }
         else if (!mSourceBuffer->IsDigit())
         {
@@ -450,7 +487,7 @@ _again:
         {
             buffer << mSourceBuffer->GetChar();
 
-            if (mSourceBuffer->PeekChar() == 'x' || mSourceBuffer->GetChar() == 'X')
+            if (mSourceBuffer->PeekChar() == 'x' || mSourceBuffer->PeekChar() == 'X')
             {
                 
                 buffer << mSourceBuffer->GetChar();
@@ -477,7 +514,7 @@ _again:
                 
             }
 
-            else if (mSourceBuffer->PeekChar() == 'o' || mSourceBuffer->GetChar() == 'O')
+            else if (mSourceBuffer->PeekChar() == 'o' || mSourceBuffer->PeekChar() == 'O')
             {
 
                 buffer << mSourceBuffer->GetChar();
@@ -502,14 +539,14 @@ _again:
 
                 } while (mSourceBuffer->PeekChar() == '_');
 
-                if (!mSourceBuffer->IsDigit()) 
+                if (mSourceBuffer->IsDigit()) 
                         throw std::make_shared<LexicalError>(
                             mSourceBuffer->BufferPosition(),
                             std::make_shared<std::wstring>(L"Expecting octet digits!"));
 
             }
 
-            else if (mSourceBuffer->PeekChar() == 'b' || mSourceBuffer->GetChar() == 'B')
+            else if (mSourceBuffer->PeekChar() == 'b' || mSourceBuffer->PeekChar() == 'B')
             {
 
                 buffer << mSourceBuffer->GetChar();
@@ -534,7 +571,7 @@ _again:
 
                 } while (mSourceBuffer->PeekChar() == '_');
 
-                if (!mSourceBuffer->IsDigit()) 
+                if (mSourceBuffer->IsDigit()) 
                         throw std::make_shared<LexicalError>(
                             mSourceBuffer->BufferPosition(),
                             std::make_shared<std::wstring>(L"Expecting binary digits!"));
@@ -758,9 +795,9 @@ _again:
 
         mCurSymbol = std::make_shared<NumberToken>(
             mPosition,
+            mSourceBuffer->BufferPosition(),
             isImaginary,
             isReal,
-            mSourceBuffer->BufferPosition(),
             std::make_shared<std::wstring>(key),
             triviaList );
 
@@ -797,7 +834,6 @@ _letterQuote:
             else quoteEndSize = 1;
 
         }
-        else mSourceBuffer->UngetChar(quote);
 
         while (quoteSize != quoteEndSize)
         {
@@ -860,11 +896,13 @@ _letterQuote:
 
                                 buffer << mSourceBuffer->GetChar();
 
-                            }
+                                if (mSourceBuffer->PeekChar() == '\n') buffer << mSourceBuffer->GetChar();
 
-                            if (mSourceBuffer->PeekChar() == '\n')
+                            }
+                            else if (mSourceBuffer->PeekChar() != '\0')
                             {
 
+                                /* Escaped line break, quote or backslash does not end the string. */
                                 buffer << mSourceBuffer->GetChar();
                                 
                             }
@@ -893,6 +931,7 @@ _letterQuote:
             isRaw,
             isUnicode,
             isFormated,
+            isBytes,
             triviaList );
 
         return;
@@ -8,6 +8,7 @@ StringToken::StringToken(   unsigned int startPosition,
                             bool isRaw,
                             bool isUnicode,
                             bool isFormated,
+                            bool isBytes,
                             std::shared_ptr<std::vector<std::shared_ptr<Trivia>>> triviaList) 
     :   Token(startPosition, endPosition, TokenKind::String, triviaList) 
 {
@@ -15,6 +16,7 @@ StringToken::StringToken(   unsigned int startPosition,
     mIsRaw = isRaw;
     mIsUnicode = isUnicode;
     mIsFormated = isFormated;
+    mIsBytes = isBytes;
 }
 
 std::shared_ptr<std::wstring> StringToken::GetText()
@@ -36,3 +38,8 @@ bool StringToken::IsFormated()
 {
     return mIsFormated;
 }
+
+bool StringToken::IsBytes()
+{
+    return mIsBytes;
+}
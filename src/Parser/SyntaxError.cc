@@ -9,3 +9,18 @@ SyntaxError::SyntaxError(unsigned int position, std::shared_ptr<Token> curSymbol
     mSymbol = curSymbol;
     mMsg = msg;
 }
+
+unsigned int SyntaxError::GetPosition()
+{
+    return mPosition;
+}
+
+std::shared_ptr<Token> SyntaxError::GetSymbol()
+{
+    return mSymbol;
+}
+
+std::shared_ptr<std::wstring> SyntaxError::GetMessage()
+{
+    return mMsg;
+}
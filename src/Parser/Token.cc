@@ -29,3 +29,17 @@ std::shared_ptr<std::vector<std::shared_ptr<Trivia>>> Token::GetTriviaList()
 {
     return mTriviaList;
 }
+
+unsigned int Token::GetFullStartPosition()
+{
+    return mTriviaList == nullptr || mTriviaList->empty() ? mTokenStartPosition : mTriviaList->front()->GetStartPosition();
+}
+
+void Token::Shift(int delta)
+{
+    mTokenStartPosition += delta;
+    mTokenEndPosition += delta;
+
+    if (mTriviaList != nullptr)
+        for (auto &trivia : *mTriviaList) trivia->Shift(delta);
+}
@@ -3,10 +3,11 @@
 
 using namespace PythonCoreNative::RunTime::Parser;
 
-Trivia::Trivia(unsigned int startPosition, unsigned int endPosition)
+Trivia::Trivia(unsigned int startPosition, unsigned int endPosition, TriviaKind kind)
 {
     mTriviaStartPosition = startPosition;
     mTriviaEndPosition = endPosition;
+    mKind = kind;
 }
 
 unsigned int Trivia::GetStartPosition()
@@ -19,10 +20,21 @@ unsigned int Trivia::GetEndPosition()
     return mTriviaEndPosition;
 }
 
+TriviaKind Trivia::GetKind()
+{
+    return mKind;
+}
+
+void Trivia::Shift(int delta)
+{
+    mTriviaStartPosition += delta;
+    mTriviaEndPosition += delta;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 NewLineTrivia::NewLineTrivia(unsigned int startPosition, unsigned int endPosition, wchar_t ch1, wchar_t ch2)
-    :   Trivia(startPosition, endPosition)
+    :   Trivia(startPosition, endPosition, TriviaKind::NewLine)
     {
         mChar1 = ch1;
         mChar2 = ch2;
@@ -41,21 +53,26 @@ wchar_t NewLineTrivia::GetNewLineCharTwo()
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 LineContinuationTrivia::LineContinuationTrivia(unsigned int startPosition, unsigned int endPosition)
-    :   Trivia(startPosition, endPosition)
+    :   Trivia(startPosition, endPosition, TriviaKind::LineContinuation)
     {}
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 WhiteSpaceTrivia::WhiteSpaceTrivia(unsigned int startPosition, unsigned int endPosition, wchar_t ch)
-    : Trivia(startPosition, endPosition)
+    : Trivia(startPosition, endPosition, TriviaKind::WhiteSpace)
     {
         mSpaceChar = ch;
     }
 
+wchar_t WhiteSpaceTrivia::GetSpaceChar()
+{
+    return mSpaceChar;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 CommentTrivia::CommentTrivia(unsigned int startPosition, unsigned int endPosition, std::shared_ptr<std::wstring> text)
-    : Trivia(startPosition, endPosition)
+    : Trivia(startPosition, endPosition, TriviaKind::Comment)
     {
         mCommentText = text;
     }
@@ -0,0 +1,826 @@
+#include <vm/BigInteger.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+using namespace PythonCoreNative::RunTime::VM;
+
+
+using Digits = std::vector<std::uint32_t>;
+
+/* The magnitude routines work in either base, binary for the numbers themselves and
+   10**9 for the decimal side of conversions, both fit a digit in 32 bits. */
+static constexpr std::uint64_t Binary = std::uint64_t(1) << 32;
+static constexpr std::uint64_t Decimal = 1000000000;
+
+static void Trim(Digits &digits)
+{
+    while (!digits.empty() && digits.back() == 0) digits.pop_back();
+}
+
+static int CompareDigits(const Digits &a, const Digits &b)
+{
+    if (a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+
+    for (auto i = a.size(); i-- > 0; )
+        if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+
+    return 0;
+}
+
+/* Adds count digits of b to a from digit offset on. */
+template <std::uint64_t Base>
+static void AddAt(Digits &a, const std::uint32_t *b, std::size_t count, std::size_t offset)
+{
+    if (a.size() < offset + count) a.resize(offset + count, 0);
+
+    std::uint64_t carry = 0;
+    auto i = offset;
+
+    for (std::size_t j = 0; j < count; i++, j++)
+    {
+        auto sum = std::uint64_t(a[i]) + b[j] + carry;
+        carry = sum >= Base;
+        a[i] = static_cast<std::uint32_t>(carry ? sum - Base : sum);
+    }
+
+    for (; carry != 0; i++)
+    {
+        if (i == a.size()) a.push_back(0);
+
+        auto sum = std::uint64_t(a[i]) + carry;
+        carry = sum >= Base;
+        a[i] = static_cast<std::uint32_t>(carry ? sum - Base : sum);
+    }
+}
+
+/* Subtracts count digits of b from a from digit offset on, a is not the smaller. */
+template <std::uint64_t Base>
+static void SubtractAt(Digits &a, const std::uint32_t *b, std::size_t count, std::size_t offset)
+{
+    std::uint64_t borrow = 0;
+    auto i = offset;
+
+    for (std::size_t j = 0; j < count; i++, j++)
+    {
+        auto subtrahend = std::uint64_t(b[j]) + borrow;
+        borrow = a[i] < subtrahend;
+        a[i] = static_cast<std::uint32_t>(std::uint64_t(a[i]) + (borrow ? Base : 0) - subtrahend);
+    }
+
+    for (; borrow != 0; i++)
+    {
+        borrow = a[i] == 0;
+        a[i] = static_cast<std::uint32_t>(borrow ? Base - 1 : a[i] - 1);
+    }
+
+    Trim(a);
+}
+
+/* Product into out, which holds n + m zero digits. */
+template <std::uint64_t Base>
+static void MultiplySchoolbook(const std::uint32_t *a, std::size_t n, const std::uint32_t *b, std::size_t m, std::uint32_t *out)
+{
+    for (std::size_t i = 0; i < n; i++)
+    {
+        if (a[i] == 0) continue;
+
+        std::uint64_t carry = 0;
+
+        for (std::size_t j = 0; j < m; j++)
+        {
+            auto product = std::uint64_t(a[i]) * b[j] + out[i + j] + carry;
+            out[i + j] = static_cast<std::uint32_t>(product % Base);
+            carry = product / Base;
+        }
+
+        out[i + m] = static_cast<std::uint32_t>(carry);
+    }
+}
+
+template <std::uint64_t Base>
+static Digits Multiply(const std::uint32_t *a, std::size_t n, const std::uint32_t *b, std::size_t m)
+{
+    while (n > 0 && a[n - 1] == 0) n--;
+    while (m > 0 && b[m - 1] == 0) m--;
+
+    if (n < m)
+    {
+        std::swap(a, b);
+        std::swap(n, m);
+    }
+
+    Digits result;
+    if (m == 0) return result;
+
+    if (m < BigInteger::KaratsubaThreshold)
+    {
+        result.assign(n + m, 0);
+        MultiplySchoolbook<Base>(a, n, b, m, result.data());
+        Trim(result);
+        return result;
+    }
+
+    /* Much longer than b, a is multiplied a slice as long as b at a time. */
+    if (n >= 2 * m)
+    {
+        for (std::size_t at = 0; at < n; at += m)
+        {
+            auto part = Multiply<Base>(a + at, std::min(m, n - at), b, m);
+            AddAt<Base>(result, part.data(), part.size(), at);
+        }
+
+        Trim(result);
+        return result;
+    }
+
+    /* (a1 B + a0)(b1 B + b0) = a1 b1 B**2 + ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) B + a0 b0 */
+    auto half = (n + 1) / 2;
+    auto low = std::min(half, m);
+
+    auto z0 = Multiply<Base>(a, half, b, low);
+    auto z2 = Multiply<Base>(a + half, n - half, b + low, m - low);
+
+    Digits x(a, a + half), y(b, b + low);
+    AddAt<Base>(x, a + half, n - half, 0);
+    AddAt<Base>(y, b + low, m - low, 0);
+
+    auto z1 = Multiply<Base>(x.data(), x.size(), y.data(), y.size());
+    SubtractAt<Base>(z1, z0.data(), z0.size(), 0);
+    SubtractAt<Base>(z1, z2.data(), z2.size(), 0);
+
+    result = std::move(z0);
+    result.reserve(n + m);
+    AddAt<Base>(result, z1.data(), z1.size(), half);
+    AddAt<Base>(result, z2.data(), z2.size(), 2 * half);
+    Trim(result);
+    return result;
+}
+
+template <std::uint64_t Base>
+static Digits Multiply(const Digits &a, const Digits &b)
+{
+    return Multiply<Base>(a.data(), a.size(), b.data(), b.size());
+}
+
+/* digits * factor + addend */
+template <std::uint64_t Base>
+static void MultiplyAdd(Digits &digits, std::uint32_t factor, std::uint32_t addend)
+{
+    std::uint64_t carry = addend;
+
+    for (auto &digit : digits)
+    {
+        auto product = std::uint64_t(digit) * factor + carry;
+        digit = static_cast<std::uint32_t>(product % Base);
+        carry = product / Base;
+    }
+
+    if (carry != 0) digits.push_back(static_cast<std::uint32_t>(carry));
+}
+
+/* Divides binary digits in place, the remainder is returned. */
+static std::uint32_t DivideSmall(Digits &digits, std::uint32_t divisor)
+{
+    std::uint64_t remainder = 0;
+
+    for (auto i = digits.size(); i-- > 0; )
+    {
+        auto dividend = (remainder << 32) | digits[i];
+        digits[i] = static_cast<std::uint32_t>(dividend / divisor);
+        remainder = dividend % divisor;
+    }
+
+    Trim(digits);
+    return static_cast<std::uint32_t>(remainder);
+}
+
+/* Long division of binary magnitudes, Knuth's algorithm D. */
+static void Divide(const Digits &a, const Digits &b, Digits &quotient, Digits &remainder)
+{
+    if (CompareDigits(a, b) < 0)
+    {
+        quotient.clear();
+        remainder = a;
+        return;
+    }
+
+    if (b.size() == 1)
+    {
+        quotient = a;
+        auto rest = DivideSmall(quotient, b[0]);
+        remainder = rest != 0 ? Digits { rest } : Digits();
+        return;
+    }
+
+    /* Divisor shifted until its top bit is set, so each estimate is at most two too large. */
+    auto shift = static_cast<unsigned int>( __builtin_clz(b.back()) );
+    auto n = b.size(), m = a.size() - n;
+
+    Digits u(a.size() + 1, 0), v(n, 0);
+
+    for (std::size_t i = 0; i < n; i++)
+        v[i] = (b[i] << shift) | (shift != 0 && i > 0 ? b[i - 1] >> (32 - shift) : 0);
+
+    for (std::size_t i = 0; i <= a.size(); i++)
+        u[i] = (i < a.size() ? a[i] << shift : 0) | (shift != 0 && i > 0 ? a[i - 1] >> (32 - shift) : 0);
+
+    quotient.assign(m + 1, 0);
+
+    for (auto j = m + 1; j-- > 0; )
+    {
+        auto numerator = (std::uint64_t(u[j + n]) << 32) | u[j + n - 1];
+        auto estimate = numerator / v[n - 1], rest = numerator % v[n - 1];
+
+        while (estimate >= Binary || estimate * v[n - 2] > ((rest << 32) | u[j + n - 2]))
+        {
+            estimate--;
+            rest += v[n - 1];
+            if (rest >= Binary) break;
+        }
+
+        std::int64_t borrow = 0;
+        std::uint64_t carry = 0;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            auto product = estimate * v[i] + carry;
+            carry = product >> 32;
+
+            auto difference = std::int64_t(u[i + j]) - borrow - std::int64_t(product & 0xffffffff);
+            u[i + j] = static_cast<std::uint32_t>(difference);
+            borrow = difference < 0;
+        }
+
+        auto top = std::int64_t(u[j + n]) - borrow - std::int64_t(carry);
+        u[j + n] = static_cast<std::uint32_t>(top);
+
+        /* One too large, added back. */
+        if (top < 0)
+        {
+            estimate--;
+            carry = 0;
+
+            for (std::size_t i = 0; i < n; i++)
+            {
+                auto sum = std::uint64_t(u[i + j]) + v[i] + carry;
+                u[i + j] = static_cast<std::uint32_t>(sum);
+                carry = sum >> 32;
+            }
+
+            u[j + n] += static_cast<std::uint32_t>(carry);
+        }
+
+        quotient[j] = static_cast<std::uint32_t>(estimate);
+    }
+
+    Trim(quotient);
+
+    remainder.assign(n, 0);
+    for (std::size_t i = 0; i < n; i++)
+        remainder[i] = (u[i] >> shift) | (shift != 0 ? u[i + 1] << (32 - shift) : 0);
+    Trim(remainder);
+}
+
+static Digits ShiftLeft(const Digits &digits, std::size_t shift)
+{
+    auto words = shift / 32;
+    auto bits = static_cast<unsigned int>(shift % 32);
+
+    Digits result(words, 0);
+    result.reserve(words + digits.size() + 1);
+
+    std::uint32_t carry = 0;
+
+    for (auto digit : digits)
+    {
+        result.push_back(bits != 0 ? (digit << bits) | carry : digit);
+        carry = bits != 0 ? digit >> (32 - bits) : 0;
+    }
+
+    result.push_back(carry);
+    Trim(result);
+    return result;
+}
+
+/* Truncated, lost tells whether a set bit was shifted out. */
+static Digits ShiftRight(const Digits &digits, std::size_t shift, bool &lost)
+{
+    auto words = shift / 32;
+    auto bits = static_cast<unsigned int>(shift % 32);
+
+    lost = false;
+    if (words >= digits.size())
+    {
+        lost = !digits.empty();
+        return Digits();
+    }
+
+    for (std::size_t i = 0; i < words; i++) lost |= digits[i] != 0;
+    if (bits != 0) lost |= (digits[words] & ((std::uint32_t(1) << bits) - 1)) != 0;
+
+    Digits result(digits.size() - words);
+
+    for (std::size_t i = 0; i < result.size(); i++)
+    {
+        auto high = words + i + 1 < digits.size() ? digits[words + i + 1] : 0;
+        result[i] = bits != 0 ? (digits[words + i] >> bits) | (high << (32 - bits)) : digits[words + i];
+    }
+
+    Trim(result);
+    return result;
+}
+
+
+/* Conversion */
+
+/* Base 10**9 digits of a binary magnitude. Above the threshold the number is split at
+   the largest 2**(32 * 2**k) below it, powers[k] holds that power in decimal. */
+static Digits ToDecimal(const std::uint32_t *digits, std::size_t count, std::vector<Digits> &powers)
+{
+    while (count > 0 && digits[count - 1] == 0) count--;
+
+    if (count <= BigInteger::ConversionThreshold)
+    {
+        Digits rest(digits, digits + count), result;
+        while (!rest.empty()) result.push_back( DivideSmall(rest, Decimal) );
+        return result;
+    }
+
+    std::size_t k = 0;
+    while ((std::size_t(2) << k) < count) k++;
+
+    while (powers.size() <= k)
+        powers.push_back( powers.empty() ? Digits { 294967296, 4 } : Multiply<Decimal>(powers.back(), powers.back()) );
+
+    auto split = std::size_t(1) << k;
+    auto result = Multiply<Decimal>( ToDecimal(digits + split, count - split, powers), powers[k] );
+    auto low = ToDecimal(digits, split, powers);
+
+    AddAt<Decimal>(result, low.data(), low.size(), 0);
+    return result;
+}
+
+/* Binary magnitude of base 10**9 digits, the converse of ToDecimal. */
+static Digits FromDecimal(const std::uint32_t *digits, std::size_t count, std::vector<Digits> &powers)
+{
+    while (count > 0 && digits[count - 1] == 0) count--;
+
+    if (count <= BigInteger::ConversionThreshold)
+    {
+        Digits result;
+        for (auto i = count; i-- > 0; ) MultiplyAdd<Binary>(result, Decimal, digits[i]);
+        return result;
+    }
+
+    std::size_t k = 0;
+    while ((std::size_t(2) << k) < count) k++;
+
+    while (powers.size() <= k)
+        powers.push_back( powers.empty() ? Digits { static_cast<std::uint32_t>(Decimal) } : Multiply<Binary>(powers.back(), powers.back()) );
+
+    auto split = std::size_t(1) << k;
+    auto result = Multiply<Binary>( FromDecimal(digits + split, count - split, powers), powers[k] );
+    auto low = FromDecimal(digits, split, powers);
+
+    AddAt<Binary>(result, low.data(), low.size(), 0);
+    return result;
+}
+
+static unsigned int DigitValue(wchar_t ch)
+{
+    if (ch >= L'0' && ch <= L'9') return ch - L'0';
+    if ((ch | 0x20) >= L'a' && (ch | 0x20) <= L'z') return (ch | 0x20) - L'a' + 10;
+    return 36;
+}
+
+
+BigInteger::BigInteger(std::int64_t value) : mNegative(value < 0)
+{
+    auto magnitude = mNegative ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+
+    if (magnitude != 0) mDigits.push_back( static_cast<std::uint32_t>(magnitude) );
+    if ((magnitude >> 32) != 0) mDigits.push_back( static_cast<std::uint32_t>(magnitude >> 32) );
+}
+
+BigInteger::BigInteger(Digits digits, bool negative) : mDigits(std::move(digits))
+{
+    Trim(mDigits);
+    mNegative = negative && !mDigits.empty();
+}
+
+BigInteger BigInteger::FromDouble(double value)
+{
+    if (value > -1.0 && value < 1.0) return BigInteger();
+
+    int exponent;
+    auto mantissa = std::frexp(std::fabs(value), &exponent);
+    auto bits = static_cast<std::uint64_t>( std::ldexp(mantissa, 64) );
+
+    Digits digits { static_cast<std::uint32_t>(bits), static_cast<std::uint32_t>(bits >> 32) };
+    bool lost;
+
+    exponent -= 64;
+    return BigInteger(exponent >= 0 ? ShiftLeft(digits, static_cast<std::size_t>(exponent)) : ::ShiftRight(digits, static_cast<std::size_t>(-exponent), lost), value < 0);
+}
+
+bool BigInteger::Parse(std::wstring_view text, unsigned int base, BigInteger &result)
+{
+    std::size_t at = 0;
+    auto negative = false;
+
+    if (at < text.size() && (text[at] == L'+' || text[at] == L'-')) negative = text[at++] == L'-';
+
+    if (text.size() > at + 1 && text[at] == L'0')
+    {
+        auto prefix = text[at + 1] | 0x20;
+        auto named = prefix == L'x' ? 16 : prefix == L'o' ? 8 : prefix == L'b' ? 2 : 0u;
+
+        if (named != 0 && (base == 0 || base == named))
+        {
+            base = named;
+            at += 2;
+            if (at < text.size() && text[at] == L'_') at++;
+        }
+    }
+
+    if (base == 0) base = 10;
+    if (base < 2 || base > 36) return false;
+
+    /* Digit values, most significant first, underscores only between digits. */
+    std::vector<std::uint8_t> values;
+    values.reserve(text.size() - at);
+
+    for (; at < text.size(); at++)
+    {
+        if (text[at] == L'_' && !values.empty() && at + 1 < text.size() && text[at + 1] != L'_') continue;
+
+        auto value = DigitValue(text[at]);
+        if (value >= base) return false;
+        values.push_back( static_cast<std::uint8_t>(value) );
+    }
+
+    if (values.empty()) return false;
+
+    Digits digits;
+
+    if ((base & (base - 1)) == 0)
+    {
+        /* Bits are laid down from the least significant digit up. */
+        auto width = static_cast<unsigned int>( __builtin_ctz(base) );
+        std::uint64_t pending = 0;
+        unsigned int filled = 0;
+
+        digits.reserve(values.size() * width / 32 + 1);
+
+        for (auto i = values.size(); i-- > 0; )
+        {
+            pending |= std::uint64_t(values[i]) << filled;
+            filled += width;
+
+            if (filled >= 32)
+            {
+                digits.push_back( static_cast<std::uint32_t>(pending) );
+                pending >>= 32;
+                filled -= 32;
+            }
+        }
+
+        digits.push_back( static_cast<std::uint32_t>(pending) );
+    }
+    else if (base == 10)
+    {
+        Digits decimal;
+        decimal.reserve(values.size() / 9 + 1);
+
+        for (auto end = values.size(); end > 0; )
+        {
+            auto start = end >= 9 ? end - 9 : 0;
+            std::uint32_t chunk = 0;
+
+            for (auto i = start; i < end; i++) chunk = chunk * 10 + values[i];
+            decimal.push_back(chunk);
+            end = start;
+        }
+
+        std::vector<Digits> powers;
+        digits = FromDecimal(decimal.data(), decimal.size(), powers);
+    }
+    else
+    {
+        /* As many digits at a time as fit 32 bits. */
+        for (std::size_t i = 0; i < values.size(); )
+        {
+            std::uint32_t factor = 1, chunk = 0;
+
+            for (; i < values.size() && std::uint64_t(factor) * base < Binary; i++)
+            {
+                factor *= base;
+                chunk = chunk * base + values[i];
+            }
+
+            MultiplyAdd<Binary>(digits, factor, chunk);
+        }
+    }
+
+    result = BigInteger(std::move(digits), negative);
+    return true;
+}
+
+std::wstring BigInteger::ToString(unsigned int base) const
+{
+    if (mDigits.empty()) return L"0";
+
+    std::wstring text;
+    if (mNegative) text += L'-';
+
+    if (base == 10)
+    {
+        std::vector<Digits> powers;
+        auto decimal = ToDecimal(mDigits.data(), mDigits.size(), powers);
+
+        text += std::to_wstring(decimal.back());
+
+        for (auto i = decimal.size() - 1; i-- > 0; )
+        {
+            auto digit = decimal[i];
+            wchar_t chunk[9];
+
+            for (auto j = 9; j-- > 0; digit /= 10) chunk[j] = static_cast<wchar_t>(L'0' + digit % 10);
+            text.append(chunk, 9);
+        }
+
+        return text;
+    }
+
+    auto width = static_cast<unsigned int>( __builtin_ctz(base) );
+    auto bits = BitLength();
+    auto count = (bits + width - 1) / width;
+
+    /* Each digit from the bits at its place, the most significant first. */
+    for (auto i = count; i-- > 0; )
+    {
+        auto at = i * width;
+        auto value = std::uint64_t(mDigits[at / 32]) >> (at % 32);
+        if (at % 32 + width > 32 && at / 32 + 1 < mDigits.size()) value |= std::uint64_t(mDigits[at / 32 + 1]) << (32 - at % 32);
+
+        text += L"0123456789abcdef"[value & (base - 1)];
+    }
+
+    return text;
+}
+
+std::size_t BigInteger::BitLength() const
+{
+    if (mDigits.empty()) return 0;
+    return (mDigits.size() - 1) * 32 + 32 - static_cast<std::size_t>( __builtin_clz(mDigits.back()) );
+}
+
+bool BigInteger::FitsInt64() const
+{
+    auto bits = BitLength();
+    return bits < 64 || (bits == 64 && mNegative && mDigits[0] == 0 && mDigits[1] == 0x80000000);
+}
+
+std::int64_t BigInteger::ToInt64() const
+{
+    std::uint64_t magnitude = 0;
+
+    if (mDigits.size() > 0) magnitude |= mDigits[0];
+    if (mDigits.size() > 1) magnitude |= std::uint64_t(mDigits[1]) << 32;
+
+    return static_cast<std::int64_t>(mNegative ? 0 - magnitude : magnitude);
+}
+
+bool BigInteger::ToDouble(double &result) const
+{
+    auto bits = BitLength();
+    std::uint64_t top = 0;
+    std::size_t shift = 0;
+
+    if (bits <= 64)
+    {
+        if (mDigits.size() > 0) top |= mDigits[0];
+        if (mDigits.size() > 1) top |= std::uint64_t(mDigits[1]) << 32;
+    }
+    else
+    {
+        /* Bits below the top 64 only matter as a sticky bit, far under the rounding place. */
+        bool lost;
+        shift = bits - 64;
+        auto high = ::ShiftRight(mDigits, shift, lost);
+
+        top = high[0] | (std::uint64_t(high[1]) << 32) | (lost ? 1 : 0);
+    }
+
+    result = std::ldexp(static_cast<double>(top), static_cast<int>( std::min<std::size_t>(shift, 4096) ));
+    if (std::isinf(result)) return false;
+
+    if (mNegative) result = -result;
+    return true;
+}
+
+int BigInteger::Compare(const BigInteger &other) const
+{
+    if (mNegative != other.mNegative) return mNegative ? -1 : 1;
+
+    auto magnitude = CompareDigits(mDigits, other.mDigits);
+    return mNegative ? -magnitude : magnitude;
+}
+
+int BigInteger::Compare(double other) const
+{
+    if (std::isinf(other)) return other > 0 ? -1 : 1;
+
+    auto whole = std::floor(other);
+    auto c = Compare( FromDouble(whole) );
+
+    if (c != 0) return c;
+    return whole == other ? 0 : -1;
+}
+
+std::size_t BigInteger::Hash() const
+{
+    if (FitsInt64()) return std::hash<std::int64_t>()(ToInt64());
+
+    double real;
+    if (ToDouble(real) && Compare(real) == 0) return std::hash<double>()(real);
+
+    std::size_t hash = mNegative ? 0x9e3779b9 : 0x345678;
+    for (auto digit : mDigits) hash = (hash ^ digit) * 1000003;
+    return hash;
+}
+
+
+/* Arithmetic */
+
+BigInteger BigInteger::operator-() const
+{
+    return BigInteger(mDigits, !mNegative);
+}
+
+BigInteger BigInteger::operator~() const
+{
+    return -*this - BigInteger(1);
+}
+
+BigInteger BigInteger::operator+(const BigInteger &other) const
+{
+    if (mNegative == other.mNegative)
+    {
+        auto digits = mDigits;
+        AddAt<Binary>(digits, other.mDigits.data(), other.mDigits.size(), 0);
+        return BigInteger(std::move(digits), mNegative);
+    }
+
+    /* Signs differ, the smaller magnitude comes off the larger. */
+    auto &larger = CompareDigits(mDigits, other.mDigits) >= 0 ? *this : other;
+    auto &smaller = &larger == this ? other : *this;
+
+    auto digits = larger.mDigits;
+    SubtractAt<Binary>(digits, smaller.mDigits.data(), smaller.mDigits.size(), 0);
+    return BigInteger(std::move(digits), larger.mNegative);
+}
+
+BigInteger BigInteger::operator-(const BigInteger &other) const
+{
+    return *this + -other;
+}
+
+BigInteger BigInteger::operator*(const BigInteger &other) const
+{
+    return BigInteger(Multiply<Binary>(mDigits, other.mDigits), mNegative != other.mNegative);
+}
+
+BigInteger::Digits BigInteger::Complement(std::size_t count) const
+{
+    auto digits = mDigits;
+    digits.resize(count, 0);
+
+    if (mNegative)
+    {
+        for (auto &digit : digits) digit = ~digit;
+
+        for (auto &digit : digits)
+            if (++digit != 0) break;
+    }
+
+    return digits;
+}
+
+BigInteger BigInteger::FromComplement(Digits digits)
+{
+    auto negative = !digits.empty() && (digits.back() & 0x80000000) != 0;
+
+    if (negative)
+    {
+        for (auto &digit : digits) digit = ~digit;
+
+        for (auto &digit : digits)
+            if (++digit != 0) break;
+    }
+
+    return BigInteger(std::move(digits), negative);
+}
+
+BigInteger BigInteger::operator&(const BigInteger &other) const
+{
+    auto count = std::max(mDigits.size(), other.mDigits.size()) + 1;
+    auto a = Complement(count), b = other.Complement(count);
+
+    for (std::size_t i = 0; i < count; i++) a[i] &= b[i];
+    return FromComplement(std::move(a));
+}
+
+BigInteger BigInteger::operator|(const BigInteger &other) const
+{
+    auto count = std::max(mDigits.size(), other.mDigits.size()) + 1;
+    auto a = Complement(count), b = other.Complement(count);
+
+    for (std::size_t i = 0; i < count; i++) a[i] |= b[i];
+    return FromComplement(std::move(a));
+}
+
+BigInteger BigInteger::operator^(const BigInteger &other) const
+{
+    auto count = std::max(mDigits.size(), other.mDigits.size()) + 1;
+    auto a = Complement(count), b = other.Complement(count);
+
+    for (std::size_t i = 0; i < count; i++) a[i] ^= b[i];
+    return FromComplement(std::move(a));
+}
+
+BigInteger BigInteger::operator<<(std::size_t shift) const
+{
+    return BigInteger(::ShiftLeft(mDigits, shift), mNegative);
+}
+
+BigInteger BigInteger::operator>>(std::size_t shift) const
+{
+    bool lost;
+    BigInteger result(::ShiftRight(mDigits, shift, lost), mNegative);
+
+    /* Truncation went toward zero. */
+    if (mNegative && lost) result = result - BigInteger(1);
+    return result;
+}
+
+void BigInteger::DivMod(const BigInteger &a, const BigInteger &b, BigInteger &quotient, BigInteger &remainder)
+{
+    Digits q, r;
+    Divide(a.mDigits, b.mDigits, q, r);
+
+    quotient = BigInteger(std::move(q), a.mNegative != b.mNegative);
+    remainder = BigInteger(std::move(r), a.mNegative);
+
+    if (!remainder.IsZero() && a.mNegative != b.mNegative)
+    {
+        quotient = quotient - BigInteger(1);
+        remainder = remainder + b;
+    }
+}
+
+bool BigInteger::TrueDivide(const BigInteger &a, const BigInteger &b, double &result)
+{
+    auto negative = a.mNegative != b.mNegative;
+
+    if (a.IsZero())
+    {
+        result = negative ? -0.0 : 0.0;
+        return true;
+    }
+
+    /* Scaled so the quotient has 64 or 65 bits, the remainder is its sticky bit. */
+    BigInteger x(a.mDigits, false), y(b.mDigits, false), q, r;
+    auto shift = 64 + static_cast<long>(y.BitLength()) - static_cast<long>(x.BitLength());
+
+    if (shift > 0) x = x << static_cast<std::size_t>(shift);
+    else y = y << static_cast<std::size_t>(-shift);
+
+    DivMod(x, y, q, r);
+    if (!r.IsZero()) q.mDigits[0] |= 1;
+
+    double scaled;
+    q.ToDouble(scaled);
+
+    result = std::ldexp(scaled, static_cast<int>( std::max(-100000L, std::min(100000L, -shift)) ));
+    if (std::isinf(result)) return false;
+
+    if (negative) result = -result;
+    return true;
+}
+
+BigInteger BigInteger::Power(BigInteger base, std::uint64_t exponent)
+{
+    BigInteger result(1);
+
+    while (exponent != 0)
+    {
+        if ((exponent & 1) != 0) result = result * base;
+        exponent >>= 1;
+        if (exponent != 0) base = base * base;
+    }
+
+    return result;
+}
@@ -0,0 +1,1072 @@
+#include <PythonCoreVirtualMachine.h>
+#include <FloatConversion.h>
+#include <vm/UnicodeCase.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <cwchar>
+#include <cwctype>
+
+using namespace PythonCoreNative::RunTime::VM;
+using namespace PythonCoreNative::RunTime::Compiler;
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+namespace PythonCoreNative::RunTime::VM
+{
+    /* Functions of the builtins module and the methods of lists, dicts and strings. */
+    class Builtins
+    {
+        public:
+            static void Install(VirtualMachine &vm);
+
+        protected:
+            static void CheckCount(const wchar_t *name, unsigned int count, unsigned int low, unsigned int high);
+            static std::vector<Value> Items(VirtualMachine &vm, Value iterable);
+            static std::int64_t ToInteger(VirtualMachine &vm, const wchar_t *name, Value value);
+            static StringObject * String(VirtualMachine &vm, const wchar_t *name, Value value);
+            static Value Extreme(VirtualMachine &vm, const wchar_t *name, OpCode op, Value *args, unsigned int count);
+
+            static Value Print(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Len(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Range(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Abs(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Min(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Max(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Int(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Float(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Str(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Repr(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Bool(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value List(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Tuple(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Set(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Dict(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value IsInstance(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Sum(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Enumerate(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value Zip(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value EllipsisRepr(VirtualMachine &vm, Value *args, unsigned int count);
+
+            static Value ListAppend(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value ListPop(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value ListInsert(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value ListExtend(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value ListReverse(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value ListIndex(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value ListSort(VirtualMachine &vm, Value *args, unsigned int count);
+
+            static Value DictGet(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value DictKeys(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value DictValues(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value DictItems(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value DictPop(VirtualMachine &vm, Value *args, unsigned int count);
+
+            static Value StringJoin(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value StringSplit(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value StringReplace(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value StringFind(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value StringUpper(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value StringLower(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value StringStrip(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value StringStartsWith(VirtualMachine &vm, Value *args, unsigned int count);
+            static Value StringEndsWith(VirtualMachine &vm, Value *args, unsigned int count);
+    };
+}
+
+
+static bool IsKind(Value value, ObjectKind kind)
+{
+    return value.IsObject() && value.AsObject()->mKind == kind;
+}
+
+template <typename T>
+static T * As(Value value)
+{
+    return static_cast<T *>(value.AsObject());
+}
+
+static void Define(VirtualMachine &vm, DictObject *dict, const wchar_t *name, BuiltinFunction function)
+{
+    dict->Insert(vm.Intern(name), Value::FromObject( vm.New<BuiltinObject>(name, function) ));
+}
+
+
+void VirtualMachine::InstallBuiltins()
+{
+    mObjectClass = BuiltinClass(L"object", nullptr);
+
+    auto base = BuiltinClass(L"BaseException", mObjectClass);
+    base->mIsException = true;
+
+    auto exception = BuiltinClass(L"Exception", base);
+
+    auto arithmetic = BuiltinClass(L"ArithmeticError", exception);
+    BuiltinClass(L"ZeroDivisionError", arithmetic);
+    BuiltinClass(L"OverflowError", arithmetic);
+
+    auto lookup = BuiltinClass(L"LookupError", exception);
+    BuiltinClass(L"IndexError", lookup);
+    BuiltinClass(L"KeyError", lookup);
+
+    BuiltinClass(L"StopIteration", exception);
+    BuiltinClass(L"AssertionError", exception);
+    BuiltinClass(L"AttributeError", exception);
+
+    auto name = BuiltinClass(L"NameError", exception);
+    BuiltinClass(L"UnboundLocalError", name);
+
+    BuiltinClass(L"TypeError", exception);
+    BuiltinClass(L"ValueError", exception);
+
+    auto runtime = BuiltinClass(L"RuntimeError", exception);
+    BuiltinClass(L"RecursionError", runtime);
+    BuiltinClass(L"NotImplementedError", runtime);
+
+    BuiltinClass(L"MemoryError", exception);
+
+    auto ellipsis = BuiltinClass(L"ellipsis", mObjectClass);
+    mBuiltins->Erase(Intern(L"ellipsis"));
+    mBuiltins->Insert(Intern(L"Ellipsis"), Value::FromObject( NewInstance(ellipsis) ));
+
+    Builtins::Install(*this);
+}
+
+ClassObject * VirtualMachine::BuiltinClass(const wchar_t *name, ClassObject *base)
+{
+    auto type = New<ClassObject>(name, New<DictObject>());
+
+    mClassEpoch++;
+    type->mMro.push_back(type);
+
+    if (base != nullptr)
+    {
+        type->mBases.push_back(base);
+        type->mMro.insert(type->mMro.end(), base->mMro.begin(), base->mMro.end());
+        type->mIsException = base->mIsException;
+    }
+
+    mBuiltins->Insert(Intern(name), Value::FromObject(type));
+    return type;
+}
+
+/* C3 linearisation: the class, then a merge of the orders of its bases that keeps
+   every local precedence order. */
+static std::vector<ClassObject *> Linearize(ClassObject *type)
+{
+    std::vector<std::vector<ClassObject *>> sequences;
+
+    for (auto base : type->mBases) sequences.push_back(base->mMro);
+    sequences.push_back(type->mBases);
+
+    std::vector<ClassObject *> result = { type };
+
+    while (true)
+    {
+        sequences.erase(std::remove_if(sequences.begin(), sequences.end(), [](auto &sequence) { return sequence.empty(); }), sequences.end());
+        if (sequences.empty()) return result;
+
+        ClassObject *candidate = nullptr;
+
+        for (auto &sequence : sequences)
+        {
+            candidate = sequence.front();
+
+            for (auto &other : sequences)
+                if (std::find(other.begin() + 1, other.end(), candidate) != other.end())
+                {
+                    candidate = nullptr;
+                    break;
+                }
+
+            if (candidate != nullptr) break;
+        }
+
+        if (candidate == nullptr) VirtualMachine::Throw(L"TypeError", L"Cannot create a consistent method resolution order (MRO) for class " + type->mName);
+
+        result.push_back(candidate);
+
+        for (auto &sequence : sequences)
+            if (sequence.front() == candidate) sequence.erase(sequence.begin());
+    }
+}
+
+Value VirtualMachine::MakeClass(const std::wstring &name, FunctionObject *body, Value *bases, unsigned int count)
+{
+    auto dict = New<DictObject>();
+
+    /* The body runs as a call without arguments whose stores go to the namespace. */
+    PushFrame(body, StackTop() + 1, 0, nullptr);
+    mFrames[mFrameCount - 1].mNamespace = dict;
+    Execute(mFrameCount - 1);
+
+    auto type = New<ClassObject>(name, dict);
+
+    /* A new class may sit where a collected one was, cached class attributes go. */
+    mClassEpoch++;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (!IsKind(bases[i], ObjectKind::Class)) Throw(L"TypeError", L"bases must be classes, not " + TypeName(bases[i]));
+
+        auto base = As<ClassObject>(bases[i]);
+        type->mBases.push_back(base);
+        type->mIsException = type->mIsException || base->mIsException;
+    }
+
+    if (count == 0) type->mBases.push_back(mObjectClass);
+
+    type->mMro = Linearize(type);
+    return Value::FromObject(type);
+}
+
+Value VirtualMachine::Instantiate(ClassObject *type, Value *args, unsigned int count)
+{
+    auto instance = NewInstance(type);
+
+    if (type->mIsException)
+        instance->mDict->Insert(Intern(L"args"), Value::FromObject( New<TupleObject>(std::vector<Value>(args, args + count)) ));
+    else if (count > 0)
+        Throw(L"TypeError", type->mName + L"() takes no arguments");
+
+    return Value::FromObject(instance);
+}
+
+InstanceObject * VirtualMachine::NewInstance(ClassObject *type)
+{
+    auto dict = New<DictObject>();
+    dict->mShape = mRootShape.get();
+
+    return New<InstanceObject>(type, dict);
+}
+
+void VirtualMachine::Raise(Value exception)
+{
+    if (IsKind(exception, ObjectKind::Class)) exception = Instantiate(As<ClassObject>(exception), nullptr, 0);
+
+    if (IsKind(exception, ObjectKind::Instance) && As<InstanceObject>(exception)->mClass->mIsException)
+    {
+        auto type = As<InstanceObject>(exception)->mClass->mName;
+        Throw(type.c_str(), Str(exception));
+    }
+
+    Throw(L"TypeError", L"exceptions must derive from BaseException");
+}
+
+/* Builtin types are functions here, class patterns of the ones PEP 634 lists match them
+   by type name and take the subject itself as their one positional attribute. */
+static const wchar_t *MatchableTypes[] = { L"bool", L"int", L"float", L"str", L"list", L"tuple", L"dict", L"set" };
+
+Value VirtualMachine::MatchClass(Value type, Value subject, unsigned int count, TupleObject *names)
+{
+    std::vector<Value> wanted, attributes;
+    std::wstring name;
+
+    if (IsKind(type, ObjectKind::Builtin) &&
+        std::any_of(std::begin(MatchableTypes), std::end(MatchableTypes),
+                    [&](const wchar_t *text) { return std::wcscmp(text, As<BuiltinObject>(type)->mName) == 0; }))
+    {
+        name = As<BuiltinObject>(type)->mName;
+
+        auto actual = TypeName(subject);
+        if (actual != name && !(name == L"int" && actual == L"bool")) return Value::None();
+
+        if (count > 1) Throw(L"TypeError", name + L"() accepts 1 positional sub-pattern (" + std::to_wstring(count) + L" given)");
+        if (count == 1) attributes.push_back(subject);
+    }
+    else if (IsKind(type, ObjectKind::Class))
+    {
+        auto cls = As<ClassObject>(type);
+        name = cls->mName;
+
+        if (!IsKind(subject, ObjectKind::Instance) || !As<InstanceObject>(subject)->mClass->IsSubclassOf(cls)) return Value::None();
+
+        if (count > 0)
+        {
+            auto args = cls->Lookup(Intern(L"__match_args__"));
+
+            if (args != nullptr && !IsKind(*args, ObjectKind::Tuple))
+                Throw(L"TypeError", name + L".__match_args__ must be a tuple (got " + TypeName(*args) + L")");
+
+            auto size = args != nullptr ? As<TupleObject>(*args)->mItems.size() : 0;
+
+            if (count > size)
+                Throw(L"TypeError", name + L"() accepts " + std::to_wstring(size) + L" positional sub-pattern" +
+                                    (size == 1 ? L"" : L"s") + L" (" + std::to_wstring(count) + L" given)");
+
+            for (unsigned int k = 0; k < count; k++)
+            {
+                auto item = As<TupleObject>(*args)->mItems[k];
+                if (!IsKind(item, ObjectKind::String)) Throw(L"TypeError", L"__match_args__ elements must be strings (got " + TypeName(item) + L")");
+                wanted.push_back(item);
+            }
+        }
+    }
+    else Throw(L"TypeError", L"called match pattern must be a class");
+
+    wanted.insert(wanted.end(), names->mItems.begin(), names->mItems.end());
+
+    for (std::size_t k = 0; k < wanted.size(); k++)
+    {
+        auto text = As<StringObject>(wanted[k]);
+
+        for (std::size_t j = 0; j < k; j++)
+            if (As<StringObject>(wanted[j])->Equals(text))
+                Throw(L"TypeError", name + L"() got multiple sub-patterns for attribute '" + text->Text() + L"'");
+
+        try
+        {
+            attributes.push_back( GetAttr(subject, wanted[k]) );
+        }
+        catch (std::shared_ptr<ExecutionError> &error)
+        {
+            if (*error->GetType() == L"AttributeError") return Value::None();
+            throw;
+        }
+    }
+
+    return Value::FromObject( New<TupleObject>(std::move(attributes)) );
+}
+
+
+/* Helpers */
+
+void Builtins::CheckCount(const wchar_t *name, unsigned int count, unsigned int low, unsigned int high)
+{
+    if (count < low || count > high)
+        VirtualMachine::Throw(L"TypeError", std::wstring(name) + L"() takes " +
+                (low == high ? std::to_wstring(low) : L"from " + std::to_wstring(low) + L" to " + std::to_wstring(high)) +
+                L" arguments (" + std::to_wstring(count) + L" given)");
+}
+
+std::vector<Value> Builtins::Items(VirtualMachine &vm, Value iterable)
+{
+    if (IsKind(iterable, ObjectKind::List)) return As<ListObject>(iterable)->mItems;
+    if (IsKind(iterable, ObjectKind::Tuple)) return As<TupleObject>(iterable)->mItems;
+
+    std::vector<Value> items;
+    auto iterator = vm.GetIter(iterable);
+    Value item;
+
+    while (vm.Next(iterator, item)) items.push_back(item);
+    return items;
+}
+
+std::int64_t Builtins::ToInteger(VirtualMachine &vm, const wchar_t *name, Value value)
+{
+    if (IsKind(value, ObjectKind::BigInteger))
+        VirtualMachine::Throw(L"OverflowError", std::wstring(name) + L"() argument does not fit in 64 bits");
+
+    if (!value.IsInteger() && !value.IsBool())
+        VirtualMachine::Throw(L"TypeError", std::wstring(name) + L"() expects an integer, not '" + vm.TypeName(value) + L"'");
+
+    return value.AsInteger();
+}
+
+StringObject * Builtins::String(VirtualMachine &vm, const wchar_t *name, Value value)
+{
+    if (!IsKind(value, ObjectKind::String))
+        VirtualMachine::Throw(L"TypeError", std::wstring(name) + L"() expects a string, not '" + vm.TypeName(value) + L"'");
+
+    return As<StringObject>(value);
+}
+
+Value Builtins::Extreme(VirtualMachine &vm, const wchar_t *name, OpCode op, Value *args, unsigned int count)
+{
+    if (count == 0) VirtualMachine::Throw(L"TypeError", std::wstring(name) + L"() expected at least 1 argument, got 0");
+
+    auto items = count == 1 ? Items(vm, args[0]) : std::vector<Value>(args, args + count);
+    if (items.empty()) VirtualMachine::Throw(L"ValueError", std::wstring(name) + L"() arg is an empty sequence");
+
+    auto best = items[0];
+
+    for (std::size_t i = 1; i < items.size(); i++)
+        if (vm.IsTrue( vm.Compare(op, items[i], best) )) best = items[i];
+
+    return best;
+}
+
+
+/* Functions */
+
+Value Builtins::Print(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    auto &output = vm.GetOutput();
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (i > 0) output << L' ';
+        output << vm.Str(args[i]);
+    }
+
+    output << L'\n';
+    return Value::None();
+}
+
+Value Builtins::Len(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"len", count, 1, 1);
+    return Value::Integer( vm.Length(args[0]) );
+}
+
+Value Builtins::Range(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"range", count, 1, 3);
+
+    std::int64_t start = 0, stop, step = 1;
+
+    if (count == 1) stop = ToInteger(vm, L"range", args[0]);
+    else
+    {
+        start = ToInteger(vm, L"range", args[0]);
+        stop = ToInteger(vm, L"range", args[1]);
+        if (count == 3) step = ToInteger(vm, L"range", args[2]);
+    }
+
+    if (step == 0) VirtualMachine::Throw(L"ValueError", L"range() arg 3 must not be zero");
+
+    return Value::FromObject( vm.New<RangeObject>(start, stop, step) );
+}
+
+Value Builtins::Abs(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"abs", count, 1, 1);
+
+    if (args[0].IsFloat()) return Value::Float( std::fabs(args[0].AsFloat()) );
+
+    if (IsKind(args[0], ObjectKind::BigInteger))
+    {
+        auto &value = As<BigIntegerObject>(args[0])->mValue;
+        return value.IsNegative() ? vm.NewInteger(-value) : args[0];
+    }
+
+    auto value = ToInteger(vm, L"abs", args[0]);
+    if (value == INT64_MIN) return vm.NewInteger( -BigInteger(value) );
+
+    return vm.NewInteger(value < 0 ? -value : value);
+}
+
+Value Builtins::Min(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    return Extreme(vm, L"min", OpCode::Less, args, count);
+}
+
+Value Builtins::Max(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    return Extreme(vm, L"max", OpCode::Greater, args, count);
+}
+
+Value Builtins::Int(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"int", count, 0, 1);
+
+    if (count == 0) return Value::Integer(0);
+
+    auto value = args[0];
+
+    if (value.IsInteger() || IsKind(value, ObjectKind::BigInteger)) return value;
+    if (value.IsBool()) return Value::Integer(value.AsInteger());
+
+    if (value.IsFloat())
+    {
+        auto real = std::trunc(value.AsFloat());
+        if (!std::isfinite(real))
+            VirtualMachine::Throw(L"OverflowError", L"cannot convert float " + vm.Repr(value) + L" to integer");
+
+        if (std::fabs(real) < 9.2233720368547758e18) return vm.NewInteger( static_cast<std::int64_t>(real) );
+        return vm.NewInteger( BigInteger::FromDouble(real) );
+    }
+
+    if (IsKind(value, ObjectKind::String))
+    {
+        auto text = As<StringObject>(value)->Text();
+        std::size_t start = 0, end = text.size();
+
+        while (start < end && std::iswspace(text[start])) start++;
+        while (end > start && std::iswspace(text[end - 1])) end--;
+
+        BigInteger result;
+        if (BigInteger::Parse(std::wstring_view(text).substr(start, end - start), 10, result)) return vm.NewInteger(std::move(result));
+
+        VirtualMachine::Throw(L"ValueError", L"invalid literal for int() with base 10: " + vm.Repr(value));
+    }
+
+    VirtualMachine::Throw(L"TypeError", L"int() argument must be a string or a number, not '" + vm.TypeName(value) + L"'");
+}
+
+Value Builtins::Float(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"float", count, 0, 1);
+
+    if (count == 0) return Value::Float(0.0);
+
+    auto value = args[0];
+
+    if (value.IsFloat()) return value;
+    if (value.IsInteger() || value.IsBool()) return Value::Float( static_cast<double>(value.AsInteger()) );
+
+    if (IsKind(value, ObjectKind::BigInteger))
+    {
+        double result;
+        if (!As<BigIntegerObject>(value)->mValue.ToDouble(result)) VirtualMachine::Throw(L"OverflowError", L"int too large to convert to float");
+        return Value::Float(result);
+    }
+
+    if (IsKind(value, ObjectKind::String))
+    {
+        auto text = As<StringObject>(value)->Text();
+        std::size_t start = 0, end = text.size();
+        double result;
+
+        while (start < end && std::iswspace(text[start])) start++;
+        while (end > start && std::iswspace(text[end - 1])) end--;
+
+        if (FloatConversion::Parse(std::wstring_view(text).substr(start, end - start), result)) return Value::Float(result);
+
+        VirtualMachine::Throw(L"ValueError", L"could not convert string to float: " + vm.Repr(value));
+    }
+
+    VirtualMachine::Throw(L"TypeError", L"float() argument must be a string or a number, not '" + vm.TypeName(value) + L"'");
+}
+
+Value Builtins::Str(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"str", count, 0, 1);
+    return vm.NewString(count == 0 ? L"" : vm.Str(args[0]));
+}
+
+Value Builtins::Repr(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"repr", count, 1, 1);
+    return vm.NewString( vm.Repr(args[0]) );
+}
+
+Value Builtins::Bool(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"bool", count, 0, 1);
+    return Value::Bool(count == 1 && vm.IsTrue(args[0]));
+}
+
+Value Builtins::List(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"list", count, 0, 1);
+    return Value::FromObject( vm.New<ListObject>(count == 0 ? std::vector<Value>() : Items(vm, args[0])) );
+}
+
+Value Builtins::Tuple(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"tuple", count, 0, 1);
+    return Value::FromObject( vm.New<TupleObject>(count == 0 ? std::vector<Value>() : Items(vm, args[0])) );
+}
+
+Value Builtins::Set(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"set", count, 0, 1);
+
+    auto set = vm.New<DictObject>(ObjectKind::Set);
+
+    if (count == 1)
+        for (auto &item : Items(vm, args[0])) set->Insert(item, Value::None());
+
+    return Value::FromObject(set);
+}
+
+Value Builtins::Dict(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"dict", count, 0, 1);
+
+    auto dict = vm.New<DictObject>();
+
+    if (count == 1 && IsKind(args[0], ObjectKind::Dict))
+    {
+        for (auto &entry : As<DictObject>(args[0])->mEntries)
+            if (entry.mLive) dict->Insert(entry.mKey, entry.mValue);
+    }
+    else if (count == 1)
+    {
+        for (auto &item : Items(vm, args[0]))
+        {
+            auto pair = Items(vm, item);
+            if (pair.size() != 2) VirtualMachine::Throw(L"ValueError", L"dictionary update sequence element has length " + std::to_wstring(pair.size()) + L"; 2 is required");
+            dict->Insert(pair[0], pair[1]);
+        }
+    }
+
+    return Value::FromObject(dict);
+}
+
+Value Builtins::IsInstance(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"isinstance", count, 2, 2);
+
+    std::vector<Value> types = IsKind(args[1], ObjectKind::Tuple) ? As<TupleObject>(args[1])->mItems : std::vector<Value> { args[1] };
+
+    for (auto &type : types)
+    {
+        if (!IsKind(type, ObjectKind::Class)) VirtualMachine::Throw(L"TypeError", L"isinstance() arg 2 must be a class or tuple of classes");
+
+        if (IsKind(args[0], ObjectKind::Instance) && As<InstanceObject>(args[0])->mClass->IsSubclassOf(As<ClassObject>(type)))
+            return Value::Bool(true);
+    }
+
+    return Value::Bool(false);
+}
+
+Value Builtins::Sum(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"sum", count, 1, 2);
+
+    auto total = count == 2 ? args[1] : Value::Integer(0);
+    for (auto &item : Items(vm, args[0])) total = vm.Binary(OpCode::Add, total, item);
+
+    return total;
+}
+
+Value Builtins::Enumerate(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"enumerate", count, 1, 2);
+
+    auto index = count == 2 ? ToInteger(vm, L"enumerate", args[1]) : 0;
+    auto result = vm.New<ListObject>(std::vector<Value>());
+
+    for (auto &item : Items(vm, args[0]))
+        result->mItems.push_back( Value::FromObject( vm.New<TupleObject>(std::vector<Value> { vm.NewInteger(index++), item }) ) );
+
+    return Value::FromObject(result);
+}
+
+Value Builtins::Zip(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    std::vector<std::vector<Value>> sources;
+    std::size_t length = count == 0 ? 0 : SIZE_MAX;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        sources.push_back( Items(vm, args[i]) );
+        length = std::min(length, sources.back().size());
+    }
+
+    auto result = vm.New<ListObject>(std::vector<Value>());
+
+    for (std::size_t i = 0; i < length; i++)
+    {
+        std::vector<Value> items;
+        for (auto &source : sources) items.push_back(source[i]);
+        result->mItems.push_back( Value::FromObject( vm.New<TupleObject>(std::move(items)) ) );
+    }
+
+    return Value::FromObject(result);
+}
+
+Value Builtins::EllipsisRepr(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    return vm.NewString(L"Ellipsis");
+}
+
+
+/* List methods, self comes first */
+
+Value Builtins::ListAppend(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"append", count, 2, 2);
+    As<ListObject>(args[0])->mItems.push_back(args[1]);
+    return Value::None();
+}
+
+Value Builtins::ListPop(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"pop", count, 1, 2);
+
+    auto &items = As<ListObject>(args[0])->mItems;
+    if (items.empty()) VirtualMachine::Throw(L"IndexError", L"pop from empty list");
+
+    auto size = static_cast<std::int64_t>(items.size());
+    auto index = count == 2 ? ToInteger(vm, L"pop", args[1]) : size - 1;
+    if (index < 0) index += size;
+    if (index < 0 || index >= size) VirtualMachine::Throw(L"IndexError", L"pop index out of range");
+
+    auto value = items[static_cast<std::size_t>(index)];
+    items.erase(items.begin() + index);
+    return value;
+}
+
+Value Builtins::ListInsert(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"insert", count, 3, 3);
+
+    auto &items = As<ListObject>(args[0])->mItems;
+    auto size = static_cast<std::int64_t>(items.size());
+    auto index = ToInteger(vm, L"insert", args[1]);
+
+    if (index < 0) index = std::max<std::int64_t>(0, index + size);
+    index = std::min(index, size);
+
+    items.insert(items.begin() + index, args[2]);
+    return Value::None();
+}
+
+Value Builtins::ListExtend(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"extend", count, 2, 2);
+
+    auto items = Items(vm, args[1]);
+    auto &target = As<ListObject>(args[0])->mItems;
+    target.insert(target.end(), items.begin(), items.end());
+    return Value::None();
+}
+
+Value Builtins::ListReverse(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"reverse", count, 1, 1);
+
+    auto &items = As<ListObject>(args[0])->mItems;
+    std::reverse(items.begin(), items.end());
+    return Value::None();
+}
+
+Value Builtins::ListIndex(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"index", count, 2, 2);
+
+    auto &items = As<ListObject>(args[0])->mItems;
+
+    for (std::size_t i = 0; i < items.size(); i++)
+        if (ValueEqual()(items[i], args[1])) return Value::Integer( static_cast<std::int64_t>(i) );
+
+    VirtualMachine::Throw(L"ValueError", vm.Repr(args[1]) + L" is not in list");
+}
+
+Value Builtins::ListSort(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"sort", count, 1, 1);
+
+    auto &items = As<ListObject>(args[0])->mItems;
+    std::stable_sort(items.begin(), items.end(), [&vm](const Value &a, const Value &b) { return vm.IsTrue( vm.Compare(OpCode::Less, a, b) ); });
+    return Value::None();
+}
+
+
+/* Dict methods */
+
+Value Builtins::DictGet(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"get", count, 2, 3);
+
+    auto value = As<DictObject>(args[0])->Find(args[1]);
+    return value != nullptr ? *value : count == 3 ? args[2] : Value::None();
+}
+
+Value Builtins::DictKeys(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"keys", count, 1, 1);
+
+    auto result = vm.New<ListObject>(std::vector<Value>());
+    for (auto &entry : As<DictObject>(args[0])->mEntries)
+        if (entry.mLive) result->mItems.push_back(entry.mKey);
+
+    return Value::FromObject(result);
+}
+
+Value Builtins::DictValues(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"values", count, 1, 1);
+
+    auto result = vm.New<ListObject>(std::vector<Value>());
+    for (auto &entry : As<DictObject>(args[0])->mEntries)
+        if (entry.mLive) result->mItems.push_back(entry.mValue);
+
+    return Value::FromObject(result);
+}
+
+Value Builtins::DictItems(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"items", count, 1, 1);
+
+    auto result = vm.New<ListObject>(std::vector<Value>());
+    for (auto &entry : As<DictObject>(args[0])->mEntries)
+        if (entry.mLive) result->mItems.push_back( Value::FromObject( vm.New<TupleObject>(std::vector<Value> { entry.mKey, entry.mValue }) ) );
+
+    return Value::FromObject(result);
+}
+
+Value Builtins::DictPop(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"pop", count, 2, 3);
+
+    auto dict = As<DictObject>(args[0]);
+    auto value = dict->Find(args[1]);
+
+    if (value == nullptr)
+    {
+        if (count == 3) return args[2];
+        VirtualMachine::Throw(L"KeyError", vm.Repr(args[1]));
+    }
+
+    auto result = *value;
+    dict->Erase(args[1]);
+    return result;
+}
+
+
+/* String methods */
+
+/* Whitespace as str.split and str.strip see it, without a library call for ASCII. */
+static bool IsSpace(std::uint32_t character)
+{
+    if (character < 0x80) return character == L' ' || (character >= L'\t' && character <= L'\r') || (character >= 0x1c && character <= 0x1f);
+    return std::iswspace( static_cast<wint_t>(character) ) != 0;
+}
+
+/* Appends length characters of the string from start, widened to width. */
+static void Append(std::string &data, StringObject *string, std::size_t start, std::size_t length, unsigned int width)
+{
+    if (string->Width() == width) data.append(string->Data() + start * width, length * width);
+    else data += string->Bytes(start, length, width);
+}
+
+/* The part occurs in the text at the character index at. */
+static bool Matches(StringObject *text, std::size_t at, StringObject *part)
+{
+    if (part->Width() > text->Width() || at + part->Length() > text->Length()) return false;
+
+    if (part->Width() == text->Width())
+        return std::memcmp(text->Data() + at * text->Width(), part->Data(), part->Length() * part->Width()) == 0;
+
+    for (std::size_t i = 0; i < part->Length(); i++)
+        if (text->At(at + i) != part->At(i)) return false;
+
+    return true;
+}
+
+static Value Substring(VirtualMachine &vm, StringObject *text, std::size_t start, std::size_t length)
+{
+    if (length == 1) return vm.Character( text->At(start) );
+    return vm.NewString( text->Bytes(start, length, text->Width()), text->Width() );
+}
+
+Value Builtins::StringJoin(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"join", count, 2, 2);
+
+    auto separator = As<StringObject>(args[0]);
+    auto items = Items(vm, args[1]);
+    std::vector<StringObject *> parts;
+
+    unsigned int width = items.size() > 1 ? separator->Width() : 1;
+    std::size_t length = items.size() > 1 ? separator->Length() * (items.size() - 1) : 0;
+
+    for (auto &item : items)
+    {
+        parts.push_back( String(vm, L"join", item) );
+        width = std::max(width, parts.back()->Width());
+        length += parts.back()->Length();
+    }
+
+    /* Parts as wide as the result, all of them when it is ASCII, are copied whole. */
+    std::string data;
+    data.reserve(length * width);
+
+    for (std::size_t i = 0; i < parts.size(); i++)
+    {
+        if (i != 0) Append(data, separator, 0, separator->Length(), width);
+        Append(data, parts[i], 0, parts[i]->Length(), width);
+    }
+
+    return vm.NewString(std::move(data), width);
+}
+
+Value Builtins::StringSplit(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"split", count, 1, 2);
+
+    auto text = As<StringObject>(args[0]);
+    auto result = vm.New<ListObject>(std::vector<Value>());
+
+    if (count == 1 || args[1].IsNone())
+    {
+        std::size_t i = 0;
+
+        while (true)
+        {
+            while (i < text->Length() && IsSpace(text->At(i))) i++;
+            if (i == text->Length()) break;
+
+            auto start = i;
+            while (i < text->Length() && !IsSpace(text->At(i))) i++;
+            result->mItems.push_back( Substring(vm, text, start, i - start) );
+        }
+
+        return Value::FromObject(result);
+    }
+
+    auto separator = String(vm, L"split", args[1]);
+    if (separator->Length() == 0) VirtualMachine::Throw(L"ValueError", L"empty separator");
+
+    std::size_t start = 0, found;
+
+    while ((found = text->Find(separator, start)) != StringObject::NotFound)
+    {
+        result->mItems.push_back( Substring(vm, text, start, found - start) );
+        start = found + separator->Length();
+    }
+
+    result->mItems.push_back( Substring(vm, text, start, text->Length() - start) );
+    return Value::FromObject(result);
+}
+
+Value Builtins::StringReplace(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"replace", count, 3, 3);
+
+    auto text = As<StringObject>(args[0]);
+    auto old = String(vm, L"replace", args[1]);
+    auto replacement = String(vm, L"replace", args[2]);
+
+    if (old->Length() == 0)
+    {
+        auto characters = text->Text(), inserted = replacement->Text();
+        auto result = inserted;
+        for (auto c : characters) result += std::wstring(1, c) + inserted;
+        return vm.NewString(std::move(result));
+    }
+
+    auto found = text->Find(old);
+    if (found == StringObject::NotFound) return args[0];
+
+    auto width = std::max(text->Width(), replacement->Width());
+    std::string data;
+    std::size_t start = 0;
+
+    do
+    {
+        Append(data, text, start, found - start, width);
+        Append(data, replacement, 0, replacement->Length(), width);
+        start = found + old->Length();
+    }
+    while ((found = text->Find(old, start)) != StringObject::NotFound);
+
+    Append(data, text, start, text->Length() - start, width);
+    return vm.NewString(std::move(data), width);
+}
+
+Value Builtins::StringFind(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"find", count, 2, 2);
+
+    auto found = As<StringObject>(args[0])->Find( String(vm, L"find", args[1]) );
+    return Value::Integer(found == StringObject::NotFound ? -1 : static_cast<std::int64_t>(found));
+}
+
+/* ASCII text changes case a byte at a time, other text through the Unicode case tables. */
+static Value ChangeCase(VirtualMachine &vm, StringObject *text, bool upper)
+{
+    if (text->IsAscii())
+    {
+        std::string data(text->Data(), text->Length());
+        char low = upper ? 'a' : 'A', high = upper ? 'z' : 'Z';
+
+        for (auto &c : data)
+            if (c >= low && c <= high) c ^= 0x20;
+
+        return vm.NewString(std::move(data), 1);
+    }
+
+    auto characters = text->Text();
+    return vm.NewString( upper ? UnicodeCase::Upper(characters) : UnicodeCase::Lower(characters) );
+}
+
+Value Builtins::StringUpper(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"upper", count, 1, 1);
+    return ChangeCase(vm, As<StringObject>(args[0]), true);
+}
+
+Value Builtins::StringLower(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"lower", count, 1, 1);
+    return ChangeCase(vm, As<StringObject>(args[0]), false);
+}
+
+Value Builtins::StringStrip(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"strip", count, 1, 1);
+
+    auto text = As<StringObject>(args[0]);
+    std::size_t start = 0, end = text->Length();
+
+    while (start < end && IsSpace(text->At(start))) start++;
+    while (end > start && IsSpace(text->At(end - 1))) end--;
+
+    if (start == 0 && end == text->Length()) return args[0];
+    return Substring(vm, text, start, end - start);
+}
+
+Value Builtins::StringStartsWith(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"startswith", count, 2, 2);
+    return Value::Bool( Matches(As<StringObject>(args[0]), 0, String(vm, L"startswith", args[1])) );
+}
+
+Value Builtins::StringEndsWith(VirtualMachine &vm, Value *args, unsigned int count)
+{
+    CheckCount(L"endswith", count, 2, 2);
+
+    auto text = As<StringObject>(args[0]);
+    auto suffix = String(vm, L"endswith", args[1]);
+    return Value::Bool( suffix->Length() <= text->Length() && Matches(text, text->Length() - suffix->Length(), suffix) );
+}
+
+void Builtins::Install(VirtualMachine &vm)
+{
+    auto builtins = vm.mBuiltins;
+
+    Define(vm, builtins, L"print", Print);
+    Define(vm, builtins, L"len", Len);
+    Define(vm, builtins, L"range", Range);
+    Define(vm, builtins, L"abs", Abs);
+    Define(vm, builtins, L"min", Min);
+    Define(vm, builtins, L"max", Max);
+    Define(vm, builtins, L"int", Int);
+    Define(vm, builtins, L"float", Float);
+    Define(vm, builtins, L"str", Str);
+    Define(vm, builtins, L"repr", Repr);
+    Define(vm, builtins, L"bool", Bool);
+    Define(vm, builtins, L"list", List);
+    Define(vm, builtins, L"tuple", Tuple);
+    Define(vm, builtins, L"set", Set);
+    Define(vm, builtins, L"dict", Dict);
+    Define(vm, builtins, L"isinstance", IsInstance);
+    Define(vm, builtins, L"sum", Sum);
+    Define(vm, builtins, L"enumerate", Enumerate);
+    Define(vm, builtins, L"zip", Zip);
+
+    auto ellipsis = As<InstanceObject>(*builtins->Find(vm.Intern(L"Ellipsis")))->mClass;
+    Define(vm, ellipsis->mDict, L"__repr__", EllipsisRepr);
+
+    Define(vm, vm.mListMethods, L"append", ListAppend);
+    Define(vm, vm.mListMethods, L"pop", ListPop);
+    Define(vm, vm.mListMethods, L"insert", ListInsert);
+    Define(vm, vm.mListMethods, L"extend", ListExtend);
+    Define(vm, vm.mListMethods, L"reverse", ListReverse);
+    Define(vm, vm.mListMethods, L"index", ListIndex);
+    Define(vm, vm.mListMethods, L"sort", ListSort);
+
+    Define(vm, vm.mDictMethods, L"get", DictGet);
+    Define(vm, vm.mDictMethods, L"keys", DictKeys);
+    Define(vm, vm.mDictMethods, L"values", DictValues);
+    Define(vm, vm.mDictMethods, L"items", DictItems);
+    Define(vm, vm.mDictMethods, L"pop", DictPop);
+
+    /* No encode while there is no bytes type to return, the compiler rejects bytes
+       literals for the same reason. */
+    Define(vm, vm.mStringMethods, L"join", StringJoin);
+    Define(vm, vm.mStringMethods, L"split", StringSplit);
+    Define(vm, vm.mStringMethods, L"replace", StringReplace);
+    Define(vm, vm.mStringMethods, L"find", StringFind);
+    Define(vm, vm.mStringMethods, L"upper", StringUpper);
+    Define(vm, vm.mStringMethods, L"lower", StringLower);
+    Define(vm, vm.mStringMethods, L"strip", StringStrip);
+    Define(vm, vm.mStringMethods, L"startswith", StringStartsWith);
+    Define(vm, vm.mStringMethods, L"endswith", StringEndsWith);
+}
@@ -0,0 +1,30 @@
+#include <vm/ExecutionError.h>
+
+using namespace PythonCoreNative::RunTime::VM;
+
+ExecutionError::ExecutionError(std::shared_ptr<std::wstring> type, std::shared_ptr<std::wstring> msg)
+{
+    mType = type;
+    mMsg = msg;
+    mLine = 0;
+}
+
+std::shared_ptr<std::wstring> ExecutionError::GetType()
+{
+    return mType;
+}
+
+std::shared_ptr<std::wstring> ExecutionError::GetMessage()
+{
+    return mMsg;
+}
+
+unsigned int ExecutionError::GetLine()
+{
+    return mLine;
+}
+
+void ExecutionError::SetLine(unsigned int line)
+{
+    mLine = line;
+}
@@ -0,0 +1,580 @@
+#include <vm/Object.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace PythonCoreNative::RunTime::VM;
+
+
+std::int64_t Value::BoxedInteger() const
+{
+    return static_cast<IntegerObject *>(AsObject())->mValue;
+}
+
+static bool IsBigInteger(const Value &value)
+{
+    return value.IsObject() && value.AsObject()->mKind == ObjectKind::BigInteger;
+}
+
+static const BigInteger & Big(const Value &value)
+{
+    return static_cast<BigIntegerObject *>(value.AsObject())->mValue;
+}
+
+static bool IsNumber(const Value &value)
+{
+    return value.IsInteger() || value.IsBool() || value.IsFloat() || IsBigInteger(value);
+}
+
+std::size_t ValueHash::operator()(const Value &value) const
+{
+    switch (value.GetKind())
+    {
+        case ValueKind::Bool:
+        case ValueKind::Integer:
+            return std::hash<std::int64_t>()(value.AsInteger());
+
+        case ValueKind::Float:
+            {
+                /* Integral floats hash as the integer they equal. */
+                auto real = value.AsFloat();
+                if (std::trunc(real) == real && std::fabs(real) < 9.2e18)
+                    return std::hash<std::int64_t>()(static_cast<std::int64_t>(real));
+                return std::hash<double>()(real);
+            }
+
+        case ValueKind::Object:
+            {
+                auto object = value.AsObject();
+
+                if (object->mKind == ObjectKind::String)
+                    return static_cast<StringObject *>(object)->Hash();
+
+                if (object->mKind == ObjectKind::BigInteger)
+                    return static_cast<BigIntegerObject *>(object)->mValue.Hash();
+
+                if (object->mKind == ObjectKind::Tuple)
+                {
+                    std::size_t hash = 0x345678;
+                    for (auto &item : static_cast<TupleObject *>(object)->mItems)
+                        hash = (hash ^ operator()(item)) * 1000003;
+                    return hash;
+                }
+
+                return std::hash<Object *>()(object);
+            }
+
+        default:
+            return static_cast<std::size_t>(value.GetKind());
+    }
+}
+
+bool ValueEqual::operator()(const Value &a, const Value &b) const
+{
+    if (IsNumber(a) && IsNumber(b))
+    {
+        if (IsBigInteger(a) || IsBigInteger(b))
+        {
+            if (a.IsFloat() || b.IsFloat())
+            {
+                auto real = a.IsFloat() ? a.AsFloat() : b.AsFloat();
+                return !std::isnan(real) && Big(IsBigInteger(a) ? a : b).Compare(real) == 0;
+            }
+
+            /* Integers of 64 bits are never made big. */
+            return IsBigInteger(a) && IsBigInteger(b) && Big(a).Compare(Big(b)) == 0;
+        }
+
+        if (a.IsFloat() || b.IsFloat())
+            return (a.IsFloat() ? a.AsFloat() : static_cast<double>(a.AsInteger())) ==
+                   (b.IsFloat() ? b.AsFloat() : static_cast<double>(b.AsInteger()));
+
+        return a.AsInteger() == b.AsInteger();
+    }
+
+    if (!a.IsObject() || !b.IsObject()) return a.GetKind() == b.GetKind() && !a.IsObject() && !b.IsObject();
+
+    auto x = a.AsObject(), y = b.AsObject();
+
+    if (x == y) return true;
+    if (x->mKind != y->mKind) return false;
+
+    switch (x->mKind)
+    {
+        case ObjectKind::String:
+            return static_cast<StringObject *>(x)->Equals( static_cast<StringObject *>(y) );
+
+        case ObjectKind::Tuple:
+        case ObjectKind::List:
+            {
+                auto &left = x->mKind == ObjectKind::Tuple ? static_cast<TupleObject *>(x)->mItems : static_cast<ListObject *>(x)->mItems;
+                auto &right = y->mKind == ObjectKind::Tuple ? static_cast<TupleObject *>(y)->mItems : static_cast<ListObject *>(y)->mItems;
+
+                if (left.size() != right.size()) return false;
+
+                for (std::size_t i = 0; i < left.size(); i++)
+                    if (!operator()(left[i], right[i])) return false;
+
+                return true;
+            }
+
+        case ObjectKind::Dict:
+        case ObjectKind::Set:
+            {
+                auto left = static_cast<DictObject *>(x), right = static_cast<DictObject *>(y);
+
+                if (left->Size() != right->Size()) return false;
+
+                for (auto &entry : left->mEntries)
+                {
+                    if (!entry.mLive) continue;
+
+                    auto other = right->Find(entry.mKey);
+                    if (other == nullptr || (x->mKind == ObjectKind::Dict && !operator()(entry.mValue, *other))) return false;
+                }
+
+                return true;
+            }
+
+        default:
+            return false;
+    }
+}
+
+
+/* Calls f with a character of the type that holds characters of width bytes. */
+template <typename F>
+static auto ForWidth(unsigned int width, F f)
+{
+    switch (width)
+    {
+        case 1:     return f(char());
+        case 2:     return f(char16_t());
+        default:    return f(char32_t());
+    }
+}
+
+/* Code of the character, char and wchar_t may be signed. */
+template <typename C>
+static std::uint32_t Code(C character)
+{
+    return static_cast<std::make_unsigned_t<C>>(character);
+}
+
+/* Or of all characters, its highest bit is the highest bit of the largest one. */
+template <typename C>
+static std::uint32_t Bits(const C *text, std::size_t length)
+{
+    std::uint32_t bits = 0;
+    for (std::size_t i = 0; i < length; i++) bits |= Code(text[i]);
+    return bits;
+}
+
+static unsigned int WidthOf(std::uint32_t bits)
+{
+    return bits < 0x100 ? 1 : bits < 0x10000 ? 2 : 4;
+}
+
+template <typename To, typename From>
+static std::string Convert(const From *text, std::size_t length)
+{
+    std::string data(length * sizeof(To), '\0');
+    auto out = reinterpret_cast<To *>(data.data());
+
+    for (std::size_t i = 0; i < length; i++) out[i] = static_cast<To>( Code(text[i]) );
+    return data;
+}
+
+StringObject::StringObject(std::wstring_view text)
+    : Object(ObjectKind::String), mInterned(false), mLength(text.size()), mHash(0), mHashed(false)
+{
+    auto bits = Bits(text.data(), text.size());
+
+    mWidth = static_cast<unsigned char>( WidthOf(bits) );
+    mAscii = bits < 0x80;
+    mData = ForWidth(mWidth, [&](auto c) { return Convert<decltype(c)>(text.data(), text.size()); });
+}
+
+StringObject::StringObject(std::string data, unsigned int width)
+    : Object(ObjectKind::String), mInterned(false), mLength(data.size() / width), mHash(0), mHashed(false)
+{
+    auto bits = ForWidth(width, [&](auto c) { return Bits(reinterpret_cast<const decltype(c) *>(data.data()), mLength); });
+
+    mWidth = static_cast<unsigned char>( WidthOf(bits) );
+    mAscii = bits < 0x80;
+
+    if (mWidth == width) mData = std::move(data);
+    else
+        mData = ForWidth(width, [&](auto from)
+        {
+            auto text = reinterpret_cast<const decltype(from) *>(data.data());
+            return ForWidth(mWidth, [&](auto to) { return Convert<decltype(to)>(text, mLength); });
+        });
+}
+
+std::string StringObject::Bytes(std::size_t start, std::size_t length, unsigned int width) const
+{
+    if (width == mWidth) return mData.substr(start * width, length * width);
+
+    return ForWidth(mWidth, [&](auto from)
+    {
+        auto text = reinterpret_cast<const decltype(from) *>(mData.data()) + start;
+        return ForWidth(width, [&](auto to) { return Convert<decltype(to)>(text, length); });
+    });
+}
+
+std::wstring StringObject::Text() const
+{
+    std::wstring text(mLength, L'\0');
+    for (std::size_t i = 0; i < mLength; i++) text[i] = static_cast<wchar_t>( At(i) );
+    return text;
+}
+
+std::size_t StringObject::Hash()
+{
+    if (!mHashed)
+    {
+        mHash = std::hash<std::string_view>()(mData);
+        mHashed = true;
+    }
+
+    return mHash;
+}
+
+int StringObject::Compare(const StringObject *other) const
+{
+    if (mWidth == other->mWidth)
+        return ForWidth(mWidth, [&](auto c)
+        {
+            using View = std::basic_string_view<decltype(c)>;
+            return View(reinterpret_cast<const decltype(c) *>(mData.data()), mLength).compare(
+                   View(reinterpret_cast<const decltype(c) *>(other->mData.data()), other->mLength) );
+        });
+
+    for (std::size_t i = 0; i < mLength && i < other->mLength; i++)
+        if (At(i) != other->At(i)) return At(i) < other->At(i) ? -1 : 1;
+
+    return mLength < other->mLength ? -1 : mLength > other->mLength ? 1 : 0;
+}
+
+#if defined(__SSE2__)
+template <typename Char>
+static __m128i Splat(Char c)
+{
+    if constexpr (sizeof(Char) == 1) return _mm_set1_epi8(static_cast<char>(c));
+    else if constexpr (sizeof(Char) == 2) return _mm_set1_epi16(static_cast<short>(c));
+    else return _mm_set1_epi32(static_cast<int>(c));
+}
+
+template <typename Char>
+static __m128i Equal(__m128i left, __m128i right)
+{
+    if constexpr (sizeof(Char) == 1) return _mm_cmpeq_epi8(left, right);
+    else if constexpr (sizeof(Char) == 2) return _mm_cmpeq_epi16(left, right);
+    else return _mm_cmpeq_epi32(left, right);
+}
+#endif
+
+/* First place of pattern in text at or after start. Sixteen bytes of places at a time
+   are kept as candidates where both the first and the last character of the pattern
+   match, and only those are compared in full. */
+template <typename Char>
+static std::size_t Search(const Char *text, std::size_t length, const Char *pattern, std::size_t size, std::size_t start)
+{
+    if (size > length - start) return StringObject::NotFound;
+    if (size == 0) return start;
+
+    auto last = length - size;
+    auto i = start;
+
+#if defined(__SSE2__)
+    constexpr std::size_t Lanes = 16 / sizeof(Char);
+    auto first = Splat(pattern[0]), final = Splat(pattern[size - 1]);
+
+    for (; i + Lanes <= last + 1; i += Lanes)
+    {
+        auto heads = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + i));
+        auto tails = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + i + size - 1));
+        auto bits = static_cast<unsigned int>( _mm_movemask_epi8( _mm_and_si128(Equal<Char>(heads, first), Equal<Char>(tails, final)) ) );
+
+        while (bits != 0)
+        {
+            auto bit = static_cast<unsigned int>( __builtin_ctz(bits) );
+            auto at = i + bit / sizeof(Char);
+
+            if (std::memcmp(text + at, pattern, size * sizeof(Char)) == 0) return at;
+            bits &= ~(((1u << sizeof(Char)) - 1) << bit);
+        }
+    }
+#endif
+
+    for (; i <= last; i++)
+        if (text[i] == pattern[0] && std::memcmp(text + i, pattern, size * sizeof(Char)) == 0) return i;
+
+    return StringObject::NotFound;
+}
+
+std::size_t StringObject::Find(const StringObject *needle, std::size_t start) const
+{
+    /* The needle has a character wider than any of ours. */
+    if (start > mLength || needle->mWidth > mWidth) return NotFound;
+
+    auto bytes = needle->mWidth == mWidth ? std::string() : needle->Bytes(0, needle->mLength, mWidth);
+    auto &pattern = needle->mWidth == mWidth ? needle->mData : bytes;
+
+    return ForWidth(mWidth, [&](auto c) -> std::size_t
+    {
+        using Char = decltype(c);
+        return Search(reinterpret_cast<const Char *>(mData.data()), mLength, reinterpret_cast<const Char *>(pattern.data()), needle->mLength, start);
+    });
+}
+
+
+/* Bits of the 16 control bytes of the group equal to byte. */
+static unsigned int MatchGroup(const std::uint8_t *group, std::uint8_t byte)
+{
+#if defined(__SSE2__)
+    auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    return static_cast<unsigned int>( _mm_movemask_epi8( _mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(byte))) ) );
+#else
+    unsigned int bits = 0;
+    for (unsigned int i = 0; i < DictObject::GroupSize; i++)
+        if (group[i] == byte) bits |= 1u << i;
+    return bits;
+#endif
+}
+
+static bool IsInterned(const Value &value)
+{
+    return value.IsObject() && value.AsObject()->mKind == ObjectKind::String && static_cast<StringObject *>(value.AsObject())->mInterned;
+}
+
+/* Sequential integers hash to themselves, mixing spreads them over the groups. */
+static std::size_t Mix(std::size_t hash)
+{
+    auto mixed = static_cast<std::uint64_t>(hash) * 0x9e3779b97f4a7c15ull;
+    return static_cast<std::size_t>(mixed ^ (mixed >> 32));
+}
+
+static std::uint8_t ControlByte(std::size_t hash)
+{
+    return static_cast<std::uint8_t>(hash & 0x7f);
+}
+
+std::size_t DictObject::Probe(Value key, std::size_t hash)
+{
+    if (mCapacity == 0) return Missing;
+
+    auto mask = mCapacity / GroupSize - 1;
+    auto group = (Mix(hash) >> 7) & mask;
+    auto interned = IsInterned(key);
+
+    for (std::size_t step = 1; ; step++)
+    {
+        auto control = &mControl[group * GroupSize];
+
+        for (auto bits = MatchGroup(control, ControlByte(Mix(hash))); bits != 0; bits &= bits - 1)
+        {
+            auto slot = group * GroupSize + __builtin_ctz(bits);
+            auto &entry = mEntries[mSlots[slot]];
+
+            if (entry.mHash != hash) continue;
+            if (entry.mKey.IsIdentical(key)) return slot;
+            if (interned && IsInterned(entry.mKey)) continue;
+            if (ValueEqual()(entry.mKey, key)) return slot;
+        }
+
+        if (MatchGroup(control, Empty) != 0) return Missing;
+
+        group = (group + step) & mask;
+    }
+}
+
+void DictObject::Rebuild(std::size_t capacity)
+{
+    if (mEntries.size() != mCount)
+    {
+        std::vector<Entry> entries;
+        entries.reserve(mCount);
+
+        for (auto &old : mEntries)
+            if (old.mLive) entries.push_back(old);
+
+        mEntries.swap(entries);
+    }
+
+    mCapacity = capacity;
+    mDeleted = 0;
+    mControl = std::make_unique<std::uint8_t[]>(capacity);
+    mSlots = std::make_unique<std::uint32_t[]>(capacity);
+    std::fill(mControl.get(), mControl.get() + capacity, Empty);
+
+    auto mask = capacity / GroupSize - 1;
+
+    for (std::size_t i = 0; i < mEntries.size(); i++)
+    {
+        auto mixed = Mix(mEntries[i].mHash);
+        auto group = (mixed >> 7) & mask;
+
+        for (std::size_t step = 1; ; step++)
+        {
+            auto bits = MatchGroup(&mControl[group * GroupSize], Empty);
+
+            if (bits != 0)
+            {
+                auto slot = group * GroupSize + __builtin_ctz(bits);
+                mControl[slot] = ControlByte(mixed);
+                mSlots[slot] = static_cast<std::uint32_t>(i);
+                break;
+            }
+
+            group = (group + step) & mask;
+        }
+    }
+}
+
+Value * DictObject::Find(Value key)
+{
+    auto slot = Probe(key, ValueHash()(key));
+    return slot == Missing ? nullptr : &mEntries[mSlots[slot]].mValue;
+}
+
+bool DictObject::FindIndex(Value key, std::size_t &index)
+{
+    auto slot = Probe(key, ValueHash()(key));
+    if (slot == Missing) return false;
+
+    index = mSlots[slot];
+    return true;
+}
+
+void DictObject::Insert(Value key, Value value)
+{
+    auto hash = ValueHash()(key);
+    auto slot = Probe(key, hash);
+
+    if (slot != Missing)
+    {
+        mEntries[mSlots[slot]].mValue = value;
+        return;
+    }
+
+    /* At most 7 of 8 slots in use, deleted ones included; growing leaves room for as many again. */
+    if ((mCount + mDeleted + 1) * 8 > mCapacity * 7)
+    {
+        auto capacity = GroupSize;
+        while (capacity * 7 < (mCount + 1) * 16) capacity *= 2;
+        Rebuild(capacity);
+    }
+
+    auto mixed = Mix(hash);
+    auto mask = mCapacity / GroupSize - 1;
+    auto group = (mixed >> 7) & mask;
+
+    for (std::size_t step = 1; ; step++)
+    {
+        auto control = &mControl[group * GroupSize];
+        auto bits = MatchGroup(control, Empty) | MatchGroup(control, Deleted);
+
+        if (bits != 0)
+        {
+            slot = group * GroupSize + __builtin_ctz(bits);
+            break;
+        }
+
+        group = (group + step) & mask;
+    }
+
+    if (mControl[slot] == Deleted) mDeleted--;
+    mControl[slot] = ControlByte(mixed);
+    mSlots[slot] = static_cast<std::uint32_t>(mEntries.size());
+
+    mEntries.push_back( { key, value, true, hash } );
+    mCount++;
+    mVersion++;
+
+    if (mShape != nullptr)
+        mShape = IsInterned(key) ? mShape->Add(key.AsObject()) : nullptr;
+}
+
+bool DictObject::Erase(Value key)
+{
+    auto slot = Probe(key, ValueHash()(key));
+    if (slot == Missing) return false;
+
+    auto &entry = mEntries[mSlots[slot]];
+    entry.mLive = false;
+    entry.mKey = Value();
+    entry.mValue = Value();
+    mCount--;
+
+    /* Empty bytes are only made by Rebuild, so no probe has gone past a group that has
+       one and the slot can be empty again. */
+    if (MatchGroup(&mControl[slot - slot % GroupSize], Empty) != 0) mControl[slot] = Empty;
+    else
+    {
+        mControl[slot] = Deleted;
+        mDeleted++;
+    }
+
+    mVersion++;
+    mShape = nullptr;
+
+    /* Compact when half of the entries are holes. */
+    if (mCount * 2 < mEntries.size()) Rebuild(mCapacity);
+
+    return true;
+}
+
+Shape * Shape::Add(Object *key)
+{
+    auto &next = mTransitions[key];
+
+    if (next == nullptr)
+    {
+        next = std::make_unique<Shape>();
+        next->mCount = mCount + 1;
+    }
+
+    return next.get();
+}
+
+std::size_t DictObject::Size()
+{
+    return mCount;
+}
+
+
+std::int64_t RangeObject::Length()
+{
+    if (mStep > 0 && mStart < mStop) return (mStop - mStart + mStep - 1) / mStep;
+    if (mStep < 0 && mStart > mStop) return (mStart - mStop - mStep - 1) / -mStep;
+    return 0;
+}
+
+
+Value * ClassObject::Lookup(Value name)
+{
+    for (auto type : mMro)
+    {
+        auto value = type->mDict->Find(name);
+        if (value != nullptr) return value;
+    }
+
+    return nullptr;
+}
+
+bool ClassObject::IsSubclassOf(ClassObject *other)
+{
+    for (auto type : mMro)
+        if (type == other) return true;
+
+    return false;
+}
@@ -0,0 +1,1431 @@
+#include <PythonCoreVirtualMachine.h>
+#include <FloatConversion.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cwchar>
+#include <limits>
+#include <new>
+
+using namespace PythonCoreNative::RunTime::VM;
+using namespace PythonCoreNative::RunTime::Compiler;
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+static bool IsKind(Value value, ObjectKind kind)
+{
+    return value.IsObject() && value.AsObject()->mKind == kind;
+}
+
+template <typename T>
+static T * As(Value value)
+{
+    return static_cast<T *>(value.AsObject());
+}
+
+/* Fits 64 bits, big integers are not. */
+static bool IsInt(Value value)
+{
+    return value.IsInteger() || value.IsBool();
+}
+
+static bool IsBig(Value value)
+{
+    return IsKind(value, ObjectKind::BigInteger);
+}
+
+static bool IsIntegral(Value value)
+{
+    return IsInt(value) || IsBig(value);
+}
+
+static bool IsNumeric(Value value)
+{
+    return IsIntegral(value) || value.IsFloat();
+}
+
+static BigInteger ToBig(Value value)
+{
+    return IsBig(value) ? As<BigIntegerObject>(value)->mValue : BigInteger(value.AsInteger());
+}
+
+static double ToDouble(Value value)
+{
+    if (value.IsFloat()) return value.AsFloat();
+    if (!IsBig(value)) return static_cast<double>(value.AsInteger());
+
+    double result;
+    if (!As<BigIntegerObject>(value)->mValue.ToDouble(result)) VirtualMachine::Throw(L"OverflowError", L"int too large to convert to float");
+    return result;
+}
+
+static const wchar_t * OperatorSymbol(OpCode op)
+{
+    switch (op)
+    {
+        case OpCode::Add:               return L"+";
+        case OpCode::Subtract:          return L"-";
+        case OpCode::Multiply:          return L"*";
+        case OpCode::MatrixMultiply:    return L"@";
+        case OpCode::TrueDivide:        return L"/";
+        case OpCode::FloorDivide:       return L"//";
+        case OpCode::Modulo:            return L"%";
+        case OpCode::Power:             return L"**";
+        case OpCode::ShiftLeft:         return L"<<";
+        case OpCode::ShiftRight:        return L">>";
+        case OpCode::BitAnd:            return L"&";
+        case OpCode::BitOr:             return L"|";
+        case OpCode::BitXor:            return L"^";
+        case OpCode::Less:              return L"<";
+        case OpCode::LessEqual:         return L"<=";
+        case OpCode::Greater:           return L">";
+        case OpCode::GreaterEqual:      return L">=";
+        case OpCode::Negative:          return L"unary -";
+        case OpCode::Positive:          return L"unary +";
+        case OpCode::Invert:            return L"unary ~";
+        default:                        return L"?";
+    }
+}
+
+void VirtualMachine::Throw(const wchar_t *type, std::wstring message)
+{
+    throw std::make_shared<ExecutionError>(std::make_shared<std::wstring>(type), std::make_shared<std::wstring>(std::move(message)));
+}
+
+static void ZeroDivision(const wchar_t *message)
+{
+    VirtualMachine::Throw(L"ZeroDivisionError", message);
+}
+
+/* Reading an unbound local leaves Undefined in the register, it is reported by the
+   first operation that sees it. */
+static void CheckBound(Value value)
+{
+    if (value.IsUndefined()) VirtualMachine::Throw(L"UnboundLocalError", L"local variable referenced before assignment");
+}
+
+
+Value VirtualMachine::NewInteger(std::int64_t value)
+{
+    if (Value::FitsInline(value)) return Value::Integer(value);
+    return Value::Boxed( New<IntegerObject>(value) );
+}
+
+Value VirtualMachine::NewInteger(BigInteger value)
+{
+    if (value.FitsInt64()) return NewInteger(value.ToInt64());
+    return Value::FromObject( New<BigIntegerObject>(std::move(value)) );
+}
+
+Value VirtualMachine::NewString(std::wstring text)
+{
+    return Value::FromObject( New<StringObject>(text) );
+}
+
+Value VirtualMachine::NewString(std::string data, unsigned int width)
+{
+    return Value::FromObject( New<StringObject>(std::move(data), width) );
+}
+
+Value VirtualMachine::Character(std::uint32_t character)
+{
+    if (character >= 256) return NewString( std::wstring(1, static_cast<wchar_t>(character)) );
+
+    auto &value = mCharacters[character];
+    if (value.IsUndefined()) value = Intern( std::wstring(1, static_cast<wchar_t>(character)) );
+    return value;
+}
+
+Value VirtualMachine::Intern(const std::wstring &text)
+{
+    auto it = mInterned.find(text);
+    if (it != mInterned.end()) return Value::FromObject(it->second);
+
+    auto string = New<StringObject>(text);
+    string->mInterned = true;
+    mInterned.emplace(text, string);
+    return Value::FromObject(string);
+}
+
+std::wstring VirtualMachine::TypeName(Value value)
+{
+    switch (value.GetKind())
+    {
+        case ValueKind::Undefined:  return L"unbound";
+        case ValueKind::None:       return L"NoneType";
+        case ValueKind::Bool:       return L"bool";
+        case ValueKind::Integer:    return L"int";
+        case ValueKind::Float:      return L"float";
+        default:                    break;
+    }
+
+    switch (value.AsObject()->mKind)
+    {
+        case ObjectKind::String:        return L"str";
+        case ObjectKind::Tuple:         return L"tuple";
+        case ObjectKind::List:          return L"list";
+        case ObjectKind::Dict:          return L"dict";
+        case ObjectKind::Set:           return L"set";
+        case ObjectKind::Range:         return L"range";
+        case ObjectKind::Iterator:      return L"iterator";
+        case ObjectKind::Slice:         return L"slice";
+        case ObjectKind::Cell:          return L"cell";
+        case ObjectKind::Code:          return L"code";
+        case ObjectKind::Function:      return L"function";
+        case ObjectKind::Builtin:       return L"builtin_function_or_method";
+        case ObjectKind::BoundMethod:   return L"method";
+        case ObjectKind::Class:         return L"type";
+        case ObjectKind::Instance:      return As<InstanceObject>(value)->mClass->mName;
+        case ObjectKind::Integer:
+        case ObjectKind::BigInteger:    return L"int";
+    }
+
+    return L"object";
+}
+
+bool VirtualMachine::IsTrue(Value value)
+{
+    switch (value.GetKind())
+    {
+        case ValueKind::None:       return false;
+        case ValueKind::Bool:
+        case ValueKind::Integer:    return value.AsInteger() != 0;
+        case ValueKind::Float:      return value.AsFloat() != 0.0;
+        case ValueKind::Undefined:  CheckBound(value); return false;
+        default:                    break;
+    }
+
+    switch (value.AsObject()->mKind)
+    {
+        case ObjectKind::String:    return As<StringObject>(value)->Length() != 0;
+        case ObjectKind::Tuple:     return !As<TupleObject>(value)->mItems.empty();
+        case ObjectKind::List:      return !As<ListObject>(value)->mItems.empty();
+        case ObjectKind::Dict:
+        case ObjectKind::Set:       return As<DictObject>(value)->Size() != 0;
+        case ObjectKind::Range:     return As<RangeObject>(value)->Length() != 0;
+        case ObjectKind::Instance:
+            {
+                auto method = As<InstanceObject>(value)->mClass->Lookup(Intern(L"__bool__"));
+                if (method != nullptr) return IsTrue( Call(*method, { value }) );
+
+                method = As<InstanceObject>(value)->mClass->Lookup(Intern(L"__len__"));
+                if (method != nullptr) return IsTrue( Call(*method, { value }) );
+            }
+            return true;
+        default:                    return true;
+    }
+}
+
+static std::wstring StringRepr(const std::wstring &text)
+{
+    auto quote = text.find(L'\'') != std::wstring::npos && text.find(L'"') == std::wstring::npos ? L'"' : L'\'';
+    std::wstring result(1, quote);
+
+    for (auto ch : text)
+    {
+        switch (ch)
+        {
+            case L'\\': result += L"\\\\"; break;
+            case L'\n': result += L"\\n"; break;
+            case L'\r': result += L"\\r"; break;
+            case L'\t': result += L"\\t"; break;
+            default:
+                if (ch == quote) result += std::wstring(L"\\") + ch;
+                else if (ch < 0x20 || ch == 0x7f)
+                {
+                    wchar_t buffer[8];
+                    std::swprintf(buffer, 8, L"\\x%02x", static_cast<unsigned int>(ch));
+                    result += buffer;
+                }
+                else result.push_back(ch);
+                break;
+        }
+    }
+
+    return result + quote;
+}
+
+std::wstring VirtualMachine::Str(Value value)
+{
+    if (IsKind(value, ObjectKind::String)) return As<StringObject>(value)->Text();
+
+    if (IsKind(value, ObjectKind::Instance))
+    {
+        auto instance = As<InstanceObject>(value);
+        auto method = instance->mClass->Lookup(Intern(L"__str__"));
+
+        if (method != nullptr) return Str( Call(*method, { value }) );
+
+        if (instance->mClass->mIsException)
+        {
+            auto args = instance->mDict->Find(Intern(L"args"));
+
+            if (args != nullptr && IsKind(*args, ObjectKind::Tuple))
+            {
+                auto &items = As<TupleObject>(*args)->mItems;
+                if (items.empty()) return L"";
+                if (items.size() == 1) return Str(items[0]);
+            }
+
+            return args == nullptr ? L"" : Repr(*args);
+        }
+    }
+
+    return Repr(value);
+}
+
+std::wstring VirtualMachine::Repr(Value value)
+{
+    switch (value.GetKind())
+    {
+        case ValueKind::Undefined:  return L"<unbound>";
+        case ValueKind::None:       return L"None";
+        case ValueKind::Bool:       return value.AsBool() ? L"True" : L"False";
+        case ValueKind::Integer:    return std::to_wstring(value.AsInteger());
+        case ValueKind::Float:      return FloatConversion::Repr(value.AsFloat());
+        default:                    break;
+    }
+
+    auto join = [this](const std::vector<Value> &items, const wchar_t *open, const wchar_t *close) {
+        std::wstring result = open;
+
+        for (std::size_t i = 0; i < items.size(); i++)
+        {
+            if (i > 0) result += L", ";
+            result += Repr(items[i]);
+        }
+
+        if (items.size() == 1 && open[0] == L'(') result += L",";
+        return result + close;
+    };
+
+    /* A container met again inside itself shows as [...], nesting deeper than calls
+       may go raises. */
+    auto object = value.AsObject();
+    auto container = object->mKind == ObjectKind::Tuple || object->mKind == ObjectKind::List ||
+                     object->mKind == ObjectKind::Dict || object->mKind == ObjectKind::Set;
+
+    if (container)
+    {
+        if (std::find(mRepresenting.begin(), mRepresenting.end(), object) != mRepresenting.end())
+            return object->mKind == ObjectKind::List ? L"[...]" : object->mKind == ObjectKind::Tuple ? L"(...)" : L"{...}";
+
+        if (mRepresenting.size() == MaxFrames) Throw(L"RecursionError", L"maximum recursion depth exceeded while getting the repr of an object");
+        mRepresenting.push_back(object);
+    }
+
+    struct Leave
+    {
+        std::vector<Object *> *mRepresenting;
+        ~Leave() { if (mRepresenting != nullptr) mRepresenting->pop_back(); }
+    } leave { container ? &mRepresenting : nullptr };
+
+    switch (object->mKind)
+    {
+        case ObjectKind::String:    return StringRepr(As<StringObject>(value)->Text());
+        case ObjectKind::BigInteger:    return As<BigIntegerObject>(value)->mValue.ToString();
+        case ObjectKind::Tuple:     return join(As<TupleObject>(value)->mItems, L"(", L")");
+        case ObjectKind::List:      return join(As<ListObject>(value)->mItems, L"[", L"]");
+
+        case ObjectKind::Dict:
+        case ObjectKind::Set:
+            {
+                auto dict = As<DictObject>(value);
+                auto isSet = dict->mKind == ObjectKind::Set;
+
+                if (isSet && dict->Size() == 0) return L"set()";
+
+                std::wstring result = L"{";
+                auto first = true;
+
+                for (auto &entry : dict->mEntries)
+                {
+                    if (!entry.mLive) continue;
+                    if (!first) result += L", ";
+                    first = false;
+
+                    result += Repr(entry.mKey);
+                    if (!isSet) result += L": " + Repr(entry.mValue);
+                }
+
+                return result + L"}";
+            }
+
+        case ObjectKind::Range:
+            {
+                auto range = As<RangeObject>(value);
+                return  L"range(" + std::to_wstring(range->mStart) + L", " + std::to_wstring(range->mStop) +
+                        (range->mStep == 1 ? L")" : L", " + std::to_wstring(range->mStep) + L")");
+            }
+
+        case ObjectKind::Function:  return L"<function " + As<FunctionObject>(value)->mCode->mCode->GetName() + L">";
+        case ObjectKind::Builtin:   return std::wstring(L"<built-in function ") + As<BuiltinObject>(value)->mName + L">";
+        case ObjectKind::Class:     return L"<class '" + As<ClassObject>(value)->mName + L"'>";
+
+        case ObjectKind::Instance:
+            {
+                auto instance = As<InstanceObject>(value);
+                auto method = instance->mClass->Lookup(Intern(L"__repr__"));
+
+                if (method != nullptr) return Str( Call(*method, { value }) );
+
+                if (instance->mClass->mIsException)
+                {
+                    auto args = instance->mDict->Find(Intern(L"args"));
+                    auto text = args == nullptr ? L"()" : Repr(*args);
+
+                    if (args != nullptr && IsKind(*args, ObjectKind::Tuple) && As<TupleObject>(*args)->mItems.size() == 1)
+                        text = L"(" + Repr(As<TupleObject>(*args)->mItems[0]) + L")";
+
+                    return instance->mClass->mName + text;
+                }
+
+                return L"<" + instance->mClass->mName + L" object>";
+            }
+
+        default:
+            return L"<" + TypeName(value) + L" object>";
+    }
+}
+
+
+/* Arithmetic */
+
+/* False when the power does not fit 64 bits. */
+static bool IntPower(std::int64_t base, std::int64_t exponent, std::int64_t &result)
+{
+    result = 1;
+
+    while (exponent > 0)
+    {
+        if ((exponent & 1) && __builtin_mul_overflow(result, base, &result)) return false;
+        exponent >>= 1;
+        if (exponent > 0 && __builtin_mul_overflow(base, base, &base)) return false;
+    }
+
+    return true;
+}
+
+/* Message names the operator for a zero divisor. */
+static double FloatModulo(double x, double y, double &quotient, const wchar_t *message)
+{
+    if (y == 0.0) ZeroDivision(message);
+
+    auto mod = std::fmod(x, y);
+    auto div = (x - mod) / y;
+
+    if (mod != 0.0)
+    {
+        if ((y < 0) != (mod < 0))
+        {
+            mod += y;
+            div -= 1.0;
+        }
+    }
+    else mod = std::copysign(0.0, y);
+
+    if (div != 0.0)
+    {
+        quotient = std::floor(div);
+        if (div - quotient > 0.5) quotient += 1.0;
+    }
+    else quotient = std::copysign(0.0, x / y);
+
+    return mod;
+}
+
+/* Reserves room for size more bytes or items, memory the allocator refuses raises
+   MemoryError instead of leaving the machine as std::bad_alloc. */
+template <typename T>
+static void Reserve(T &container, std::size_t size)
+{
+    try
+    {
+        container.reserve(size);
+    }
+    catch (std::bad_alloc &)
+    {
+        VirtualMachine::Throw(L"MemoryError", L"");
+    }
+}
+
+/* Text repeated count times, built by doubling what is already there. */
+static std::string RepeatText(const StringObject *text, std::int64_t count)
+{
+    std::string data;
+    std::size_t size = text->Length() * text->Width(), total;
+
+    if (count <= 0 || size == 0) return data;
+    if (__builtin_mul_overflow(size, static_cast<std::uint64_t>(count), &total) || total > static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()))
+        VirtualMachine::Throw(L"OverflowError", L"repeated string is too long");
+
+    Reserve(data, total);
+    data.append(text->Data(), size);
+
+    while (data.size() <= total / 2) data.append(data, 0, data.size());
+    data.append(data, 0, total - data.size());
+    return data;
+}
+
+static std::vector<Value> Repeat(const std::vector<Value> &items, std::int64_t count)
+{
+    std::vector<Value> result;
+    std::size_t total;
+
+    if (count <= 0 || items.empty()) return result;
+    if (__builtin_mul_overflow(items.size(), static_cast<std::uint64_t>(count), &total) || total > result.max_size())
+        VirtualMachine::Throw(L"MemoryError", L"");
+
+    Reserve(result, total);
+    for (std::int64_t i = 0; i < count; i++) result.insert(result.end(), items.begin(), items.end());
+    return result;
+}
+
+/* Integer operators beyond 64 bits. False for an operator integers do not have. */
+static bool BigArithmetic(VirtualMachine &vm, OpCode op, Value a, Value b, Value &result)
+{
+    auto x = ToBig(a), y = ToBig(b);
+
+    switch (op)
+    {
+        case OpCode::Add:       result = vm.NewInteger(x + y); return true;
+        case OpCode::Subtract:  result = vm.NewInteger(x - y); return true;
+        case OpCode::Multiply:  result = vm.NewInteger(x * y); return true;
+        case OpCode::BitAnd:    result = vm.NewInteger(x & y); return true;
+        case OpCode::BitOr:     result = vm.NewInteger(x | y); return true;
+        case OpCode::BitXor:    result = vm.NewInteger(x ^ y); return true;
+
+        case OpCode::TrueDivide:
+            {
+                if (y.IsZero()) ZeroDivision(L"division by zero");
+
+                double quotient;
+                if (!BigInteger::TrueDivide(x, y, quotient)) VirtualMachine::Throw(L"OverflowError", L"integer division result too large for a float");
+
+                result = Value::Float(quotient);
+                return true;
+            }
+
+        case OpCode::FloorDivide:
+        case OpCode::Modulo:
+            {
+                if (y.IsZero()) ZeroDivision(op == OpCode::Modulo ? L"integer modulo by zero" : L"integer division or modulo by zero");
+
+                BigInteger quotient, remainder;
+                BigInteger::DivMod(x, y, quotient, remainder);
+
+                result = vm.NewInteger(op == OpCode::Modulo ? std::move(remainder) : std::move(quotient));
+                return true;
+            }
+
+        case OpCode::Power:
+            if (y.IsNegative())
+            {
+                if (x.IsZero()) ZeroDivision(L"0.0 cannot be raised to a negative power");
+                result = Value::Float( std::pow(ToDouble(a), ToDouble(b)) );
+                return true;
+            }
+
+            /* Only 0, 1 and -1 have powers that large. */
+            if (!y.FitsInt64())
+            {
+                if (x.IsZero() || x.Compare(BigInteger(1)) == 0) result = vm.NewInteger(std::move(x));
+                else if (x.Compare(BigInteger(-1)) == 0) result = Value::Integer( (y & BigInteger(1)).IsZero() ? 1 : -1 );
+                else VirtualMachine::Throw(L"OverflowError", L"exponent too large");
+                return true;
+            }
+
+            result = vm.NewInteger( BigInteger::Power(std::move(x), static_cast<std::uint64_t>(y.ToInt64())) );
+            return true;
+
+        case OpCode::ShiftLeft:
+        case OpCode::ShiftRight:
+            if (y.IsNegative()) VirtualMachine::Throw(L"ValueError", L"negative shift count");
+
+            if (!y.FitsInt64())
+            {
+                if (op == OpCode::ShiftLeft && !x.IsZero()) VirtualMachine::Throw(L"OverflowError", L"too many digits in integer");
+                result = Value::Integer(op == OpCode::ShiftRight && x.IsNegative() ? -1 : 0);
+                return true;
+            }
+
+            {
+                auto shift = static_cast<std::size_t>(y.ToInt64());
+                result = vm.NewInteger(op == OpCode::ShiftLeft ? x << shift : x >> shift);
+            }
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+Value VirtualMachine::Binary(OpCode op, Value a, Value b)
+{
+    CheckBound(a);
+    CheckBound(b);
+
+    /* In place operators mutate lists and otherwise behave as the plain ones. */
+    if (op >= OpCode::InPlaceAdd && op <= OpCode::InPlaceBitXor)
+    {
+        op = static_cast<OpCode>( static_cast<unsigned int>(op) - static_cast<unsigned int>(OpCode::InPlaceAdd) + static_cast<unsigned int>(OpCode::Add) );
+
+        if (IsKind(a, ObjectKind::List))
+        {
+            auto &items = As<ListObject>(a)->mItems;
+
+            if (op == OpCode::Add && (IsKind(b, ObjectKind::List) || IsKind(b, ObjectKind::Tuple)))
+            {
+                auto &other = IsKind(b, ObjectKind::List) ? As<ListObject>(b)->mItems : As<TupleObject>(b)->mItems;
+                std::vector<Value> copy(other);
+                items.insert(items.end(), copy.begin(), copy.end());
+                return a;
+            }
+
+            if (op == OpCode::Multiply && IsInt(b))
+            {
+                items = Repeat(items, b.AsInteger());
+                return a;
+            }
+        }
+    }
+
+    if (IsInt(a) && IsInt(b))
+    {
+        auto x = a.AsInteger(), y = b.AsInteger();
+        std::int64_t r;
+
+        switch (op)
+        {
+            case OpCode::Add:       if (__builtin_add_overflow(x, y, &r)) break; return NewInteger(r);
+            case OpCode::Subtract:  if (__builtin_sub_overflow(x, y, &r)) break; return NewInteger(r);
+            case OpCode::Multiply:  if (__builtin_mul_overflow(x, y, &r)) break; return NewInteger(r);
+
+            case OpCode::TrueDivide:
+                if (y == 0) ZeroDivision(L"division by zero");
+                return Value::Float( static_cast<double>(x) / static_cast<double>(y) );
+
+            case OpCode::FloorDivide:
+            case OpCode::Modulo:
+                {
+                    if (y == 0) ZeroDivision(op == OpCode::Modulo ? L"integer modulo by zero" : L"integer division or modulo by zero");
+                    if (x == std::numeric_limits<std::int64_t>::min() && y == -1)
+                    {
+                        if (op == OpCode::Modulo) return Value::Integer(0);
+                        break;
+                    }
+
+                    auto q = x / y, m = x % y;
+                    if (m != 0 && ((m < 0) != (y < 0)))
+                    {
+                        q--;
+                        m += y;
+                    }
+
+                    return NewInteger(op == OpCode::Modulo ? m : q);
+                }
+
+            case OpCode::Power:
+                if (y < 0)
+                {
+                    if (x == 0) ZeroDivision(L"0.0 cannot be raised to a negative power");
+                    return Value::Float( std::pow(static_cast<double>(x), static_cast<double>(y)) );
+                }
+                if (!IntPower(x, y, r)) break;
+                return NewInteger(r);
+
+            case OpCode::ShiftLeft:
+                if (y < 0) Throw(L"ValueError", L"negative shift count");
+                if (x == 0) return Value::Integer(0);
+                if (y >= 63 || (x > 0 ? x > (std::numeric_limits<std::int64_t>::max() >> y) : x < (std::numeric_limits<std::int64_t>::min() >> y))) break;
+                return NewInteger( static_cast<std::int64_t>(static_cast<std::uint64_t>(x) << y) );
+
+            case OpCode::ShiftRight:
+                if (y < 0) Throw(L"ValueError", L"negative shift count");
+                return NewInteger( y >= 63 ? (x < 0 ? -1 : 0) : x >> y );
+
+            case OpCode::BitAnd:
+                if (a.IsBool() && b.IsBool()) return Value::Bool(x & y);
+                return NewInteger(x & y);
+
+            case OpCode::BitOr:
+                if (a.IsBool() && b.IsBool()) return Value::Bool(x | y);
+                return NewInteger(x | y);
+
+            case OpCode::BitXor:
+                if (a.IsBool() && b.IsBool()) return Value::Bool(x ^ y);
+                return NewInteger(x ^ y);
+
+            default:
+                break;
+        }
+    }
+
+    /* Results that overflowed 64 bits come here too. */
+    if (IsIntegral(a) && IsIntegral(b))
+    {
+        Value result;
+        if (BigArithmetic(*this, op, a, b, result)) return result;
+    }
+    else if (IsNumeric(a) && IsNumeric(b))
+    {
+        auto x = ToDouble(a), y = ToDouble(b), q = 0.0;
+
+        switch (op)
+        {
+            case OpCode::Add:           return Value::Float(x + y);
+            case OpCode::Subtract:      return Value::Float(x - y);
+            case OpCode::Multiply:      return Value::Float(x * y);
+
+            case OpCode::TrueDivide:
+                if (y == 0.0) ZeroDivision(L"float division by zero");
+                return Value::Float(x / y);
+
+            case OpCode::FloorDivide:
+                FloatModulo(x, y, q, L"float floor division by zero");
+                return Value::Float(q);
+
+            case OpCode::Modulo:
+                return Value::Float( FloatModulo(x, y, q, L"float modulo") );
+
+            case OpCode::Power:
+                if (x == 0.0 && y < 0.0) ZeroDivision(L"0.0 cannot be raised to a negative power");
+                if (x < 0.0 && y != std::floor(y)) Throw(L"ValueError", L"complex results are not supported");
+                q = std::pow(x, y);
+                /* Finite operands whose power is not finite overflowed. */
+                if (std::isinf(q) && std::isfinite(x) && std::isfinite(y)) Throw(L"OverflowError", L"(34, 'Numerical result out of range')");
+                return Value::Float(q);
+
+            default:
+                break;
+        }
+    }
+    else if (a.IsObject() || b.IsObject())
+    {
+        switch (op)
+        {
+            case OpCode::Add:
+                if (IsKind(a, ObjectKind::String) && IsKind(b, ObjectKind::String))
+                {
+                    auto left = As<StringObject>(a), right = As<StringObject>(b);
+                    auto width = std::max(left->Width(), right->Width());
+                    return NewString( left->Bytes(0, left->Length(), width) + right->Bytes(0, right->Length(), width), width );
+                }
+
+                if (IsKind(a, ObjectKind::List) && IsKind(b, ObjectKind::List))
+                {
+                    std::vector<Value> items(As<ListObject>(a)->mItems);
+                    items.insert(items.end(), As<ListObject>(b)->mItems.begin(), As<ListObject>(b)->mItems.end());
+                    return Value::FromObject( New<ListObject>(std::move(items)) );
+                }
+
+                if (IsKind(a, ObjectKind::Tuple) && IsKind(b, ObjectKind::Tuple))
+                {
+                    std::vector<Value> items(As<TupleObject>(a)->mItems);
+                    items.insert(items.end(), As<TupleObject>(b)->mItems.begin(), As<TupleObject>(b)->mItems.end());
+                    return Value::FromObject( New<TupleObject>(std::move(items)) );
+                }
+                break;
+
+            case OpCode::Multiply:
+                {
+                    auto sequence = IsInt(b) ? a : b;
+                    auto count = IsInt(b) ? b : a;
+
+                    if (!IsInt(count)) break;
+
+                    if (IsKind(sequence, ObjectKind::List))
+                        return Value::FromObject( New<ListObject>( Repeat(As<ListObject>(sequence)->mItems, count.AsInteger()) ) );
+
+                    if (IsKind(sequence, ObjectKind::Tuple))
+                        return Value::FromObject( New<TupleObject>( Repeat(As<TupleObject>(sequence)->mItems, count.AsInteger()) ) );
+
+                    if (IsKind(sequence, ObjectKind::String))
+                    {
+                        auto string = As<StringObject>(sequence);
+                        return NewString(RepeatText(string, count.AsInteger()), string->Width());
+                    }
+                }
+                break;
+
+            case OpCode::BitOr:
+            case OpCode::BitAnd:
+            case OpCode::Subtract:
+                if (IsKind(a, ObjectKind::Set) && IsKind(b, ObjectKind::Set))
+                {
+                    auto left = As<DictObject>(a), right = As<DictObject>(b);
+                    auto result = New<DictObject>(ObjectKind::Set);
+
+                    for (auto &entry : left->mEntries)
+                        if (entry.mLive && (op == OpCode::BitOr || (right->Find(entry.mKey) != nullptr) == (op == OpCode::BitAnd)))
+                            result->Insert(entry.mKey, Value::None());
+
+                    if (op == OpCode::BitOr)
+                        for (auto &entry : right->mEntries)
+                            if (entry.mLive) result->Insert(entry.mKey, Value::None());
+
+                    return Value::FromObject(result);
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    Throw(L"TypeError", std::wstring(L"unsupported operand type(s) for ") + OperatorSymbol(op) + L": '" + TypeName(a) + L"' and '" + TypeName(b) + L"'");
+}
+
+Value VirtualMachine::Unary(OpCode op, Value a)
+{
+    CheckBound(a);
+
+    if (op == OpCode::Not) return Value::Bool( !IsTrue(a) );
+
+    if (IsInt(a))
+    {
+        auto x = a.AsInteger();
+
+        switch (op)
+        {
+            case OpCode::Negative:
+                if (x == std::numeric_limits<std::int64_t>::min()) return NewInteger( -BigInteger(x) );
+                return NewInteger(-x);
+            case OpCode::Positive:  return NewInteger(x);
+            case OpCode::Invert:    return NewInteger(~x);
+            default:                break;
+        }
+    }
+    else if (IsBig(a))
+    {
+        auto &x = As<BigIntegerObject>(a)->mValue;
+
+        switch (op)
+        {
+            case OpCode::Negative:  return NewInteger(-x);
+            case OpCode::Positive:  return a;
+            case OpCode::Invert:    return NewInteger(~x);
+            default:                break;
+        }
+    }
+    else if (a.IsFloat())
+    {
+        if (op == OpCode::Negative) return Value::Float(-a.AsFloat());
+        if (op == OpCode::Positive) return a;
+    }
+
+    Throw(L"TypeError", std::wstring(L"bad operand type for ") + OperatorSymbol(op) + L": '" + TypeName(a) + L"'");
+}
+
+/* Sign of a three way comparison for the ordering operators, sequences compare
+   item by item. */
+static bool Order(VirtualMachine &vm, OpCode op, Value a, Value b, int &sign)
+{
+    if (IsNumeric(a) && IsNumeric(b))
+    {
+        if (IsInt(a) && IsInt(b)) sign = a.AsInteger() < b.AsInteger() ? -1 : a.AsInteger() > b.AsInteger() ? 1 : 0;
+        else if (IsIntegral(a) && IsIntegral(b)) sign = ToBig(a).Compare(ToBig(b));
+        else if (IsBig(a) || IsBig(b))
+        {
+            /* Exact, a big integer may not convert to a double. */
+            auto real = a.IsFloat() ? a.AsFloat() : b.AsFloat();
+            if (std::isnan(real)) return false;
+
+            sign = (IsBig(a) ? 1 : -1) * As<BigIntegerObject>(IsBig(a) ? a : b)->mValue.Compare(real);
+        }
+        else
+        {
+            auto x = ToDouble(a), y = ToDouble(b);
+            if (std::isnan(x) || std::isnan(y)) return false;
+            sign = x < y ? -1 : x > y ? 1 : 0;
+        }
+
+        return true;
+    }
+
+    if (IsKind(a, ObjectKind::String) && IsKind(b, ObjectKind::String))
+    {
+        auto c = As<StringObject>(a)->Compare(As<StringObject>(b));
+        sign = c < 0 ? -1 : c > 0 ? 1 : 0;
+        return true;
+    }
+
+    auto sequence = [](Value value) -> std::vector<Value> * {
+        if (IsKind(value, ObjectKind::List)) return &As<ListObject>(value)->mItems;
+        if (IsKind(value, ObjectKind::Tuple)) return &As<TupleObject>(value)->mItems;
+        return nullptr;
+    };
+
+    auto left = sequence(a), right = sequence(b);
+
+    if (left != nullptr && right != nullptr && a.AsObject()->mKind == b.AsObject()->mKind)
+    {
+        ValueEqual equal;
+
+        for (std::size_t i = 0; i < left->size() && i < right->size(); i++)
+        {
+            if (equal((*left)[i], (*right)[i])) continue;
+            return Order(vm, op, (*left)[i], (*right)[i], sign);
+        }
+
+        sign = left->size() < right->size() ? -1 : left->size() > right->size() ? 1 : 0;
+        return true;
+    }
+
+    VirtualMachine::Throw(L"TypeError", std::wstring(L"'") + OperatorSymbol(op) + L"' not supported between instances of '" + vm.TypeName(a) + L"' and '" + vm.TypeName(b) + L"'");
+}
+
+Value VirtualMachine::Compare(OpCode op, Value a, Value b)
+{
+    CheckBound(a);
+    CheckBound(b);
+
+    switch (op)
+    {
+        case OpCode::Equal:     return Value::Bool( ValueEqual()(a, b) );
+        case OpCode::NotEqual:  return Value::Bool( !ValueEqual()(a, b) );
+        case OpCode::Is:        return Value::Bool( a.IsIdentical(b) );
+        case OpCode::IsNot:     return Value::Bool( !a.IsIdentical(b) );
+        case OpCode::In:        return Value::Bool( Contains(b, a) );
+        case OpCode::NotIn:     return Value::Bool( !Contains(b, a) );
+        default:                break;
+    }
+
+    int sign = 0;
+    if (!Order(*this, op, a, b, sign)) return Value::Bool(false);
+
+    switch (op)
+    {
+        case OpCode::Less:          return Value::Bool(sign < 0);
+        case OpCode::LessEqual:     return Value::Bool(sign <= 0);
+        case OpCode::Greater:       return Value::Bool(sign > 0);
+        default:                    return Value::Bool(sign >= 0);
+    }
+}
+
+bool VirtualMachine::Contains(Value container, Value item)
+{
+    if (container.IsObject())
+    {
+        ValueEqual equal;
+
+        switch (container.AsObject()->mKind)
+        {
+            case ObjectKind::List:
+                for (auto &element : As<ListObject>(container)->mItems) if (equal(element, item)) return true;
+                return false;
+
+            case ObjectKind::Tuple:
+                for (auto &element : As<TupleObject>(container)->mItems) if (equal(element, item)) return true;
+                return false;
+
+            case ObjectKind::Dict:
+            case ObjectKind::Set:
+                return As<DictObject>(container)->Find(item) != nullptr;
+
+            case ObjectKind::String:
+                if (!IsKind(item, ObjectKind::String)) Throw(L"TypeError", L"'in <string>' requires string as left operand");
+                return As<StringObject>(container)->Find(As<StringObject>(item)) != StringObject::NotFound;
+
+            case ObjectKind::Range:
+                {
+                    if (!IsInt(item)) return false;
+
+                    auto range = As<RangeObject>(container);
+                    auto x = item.AsInteger();
+
+                    if (range->mStep > 0 ? (x < range->mStart || x >= range->mStop) : (x > range->mStart || x <= range->mStop)) return false;
+                    return (x - range->mStart) % range->mStep == 0;
+                }
+
+            default:
+                break;
+        }
+    }
+
+    Throw(L"TypeError", L"argument of type '" + TypeName(container) + L"' is not iterable");
+}
+
+
+/* Items */
+
+static std::int64_t Index(Value index, std::int64_t length, const wchar_t *what)
+{
+    auto i = index.AsInteger();
+    if (i < 0) i += length;
+    if (i < 0 || i >= length) VirtualMachine::Throw(L"IndexError", std::wstring(what) + L" index out of range");
+    return i;
+}
+
+/* Start, stop and step of a slice clamped to the length, as Python adjusts them. */
+static std::int64_t SliceIndices(SliceObject *slice, std::int64_t length, std::int64_t &start, std::int64_t &stop, std::int64_t &step)
+{
+    auto bound = [](Value value, const wchar_t *what) {
+        if (!IsInt(value)) VirtualMachine::Throw(L"TypeError", std::wstring(L"slice ") + what + L" must be an integer or None");
+        return value.AsInteger();
+    };
+
+    step = slice->mStep.IsNone() ? 1 : bound(slice->mStep, L"step");
+    if (step == 0) VirtualMachine::Throw(L"ValueError", L"slice step cannot be zero");
+
+    auto adjust = [&](Value value, std::int64_t otherwise) {
+        if (value.IsNone()) return otherwise;
+
+        auto i = bound(value, L"index");
+
+        if (i < 0)
+        {
+            i += length;
+            if (i < 0) i = step < 0 ? -1 : 0;
+        }
+        else if (i >= length) i = step < 0 ? length - 1 : length;
+
+        return i;
+    };
+
+    start = adjust(slice->mStart, step < 0 ? length - 1 : 0);
+    stop = adjust(slice->mStop, step < 0 ? -1 : length);
+
+    if (step < 0) return stop < start ? (start - stop - 1) / -step + 1 : 0;
+    return start < stop ? (stop - start - 1) / step + 1 : 0;
+}
+
+template <typename T>
+static std::vector<Value> SliceItems(const std::vector<Value> &items, SliceObject *slice)
+{
+    std::int64_t start, stop, step;
+    auto count = SliceIndices(slice, static_cast<std::int64_t>(items.size()), start, stop, step);
+
+    std::vector<Value> result;
+    result.reserve(static_cast<std::size_t>(count));
+
+    for (std::int64_t i = 0, at = start; i < count; i++, at += step) result.push_back(items[static_cast<std::size_t>(at)]);
+    return result;
+}
+
+Value VirtualMachine::GetItem(Value object, Value key)
+{
+    CheckBound(object);
+
+    if (object.IsObject())
+    {
+        switch (object.AsObject()->mKind)
+        {
+            case ObjectKind::List:
+                {
+                    auto &items = As<ListObject>(object)->mItems;
+                    if (IsInt(key)) return items[static_cast<std::size_t>( Index(key, static_cast<std::int64_t>(items.size()), L"list") )];
+                    if (IsKind(key, ObjectKind::Slice)) return Value::FromObject( New<ListObject>( SliceItems<ListObject>(items, As<SliceObject>(key)) ) );
+                }
+                Throw(L"TypeError", L"list indices must be integers or slices, not " + TypeName(key));
+
+            case ObjectKind::Tuple:
+                {
+                    auto &items = As<TupleObject>(object)->mItems;
+                    if (IsInt(key)) return items[static_cast<std::size_t>( Index(key, static_cast<std::int64_t>(items.size()), L"tuple") )];
+                    if (IsKind(key, ObjectKind::Slice)) return Value::FromObject( New<TupleObject>( SliceItems<TupleObject>(items, As<SliceObject>(key)) ) );
+                }
+                Throw(L"TypeError", L"tuple indices must be integers or slices, not " + TypeName(key));
+
+            case ObjectKind::String:
+                {
+                    auto string = As<StringObject>(object);
+                    auto length = static_cast<std::int64_t>(string->Length());
+
+                    if (IsInt(key)) return Character( string->At( static_cast<std::size_t>( Index(key, length, L"string") ) ) );
+
+                    if (IsKind(key, ObjectKind::Slice))
+                    {
+                        std::int64_t start, stop, step;
+                        auto count = SliceIndices(As<SliceObject>(key), length, start, stop, step);
+
+                        if (step == 1) return NewString( string->Bytes(static_cast<std::size_t>(start), static_cast<std::size_t>(count), string->Width()), string->Width() );
+
+                        std::wstring result;
+                        for (std::int64_t i = 0, at = start; i < count; i++, at += step) result.push_back( static_cast<wchar_t>( string->At(static_cast<std::size_t>(at)) ) );
+                        return NewString(result);
+                    }
+                }
+                Throw(L"TypeError", L"string indices must be integers, not " + TypeName(key));
+
+            case ObjectKind::Dict:
+                {
+                    auto value = As<DictObject>(object)->Find(key);
+                    if (value == nullptr) Throw(L"KeyError", Repr(key));
+                    return *value;
+                }
+
+            case ObjectKind::Range:
+                if (IsInt(key))
+                {
+                    auto range = As<RangeObject>(object);
+                    return NewInteger( range->mStart + Index(key, range->Length(), L"range object") * range->mStep );
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    Throw(L"TypeError", L"'" + TypeName(object) + L"' object is not subscriptable");
+}
+
+void VirtualMachine::SetItem(Value object, Value key, Value value)
+{
+    CheckBound(object);
+
+    if (IsKind(object, ObjectKind::List) && IsInt(key))
+    {
+        auto &items = As<ListObject>(object)->mItems;
+        items[static_cast<std::size_t>( Index(key, static_cast<std::int64_t>(items.size()), L"list assignment") )] = value;
+        return;
+    }
+
+    if (IsKind(object, ObjectKind::Dict))
+    {
+        As<DictObject>(object)->Insert(key, value);
+        return;
+    }
+
+    Throw(L"TypeError", L"'" + TypeName(object) + L"' object does not support item assignment");
+}
+
+void VirtualMachine::DeleteItem(Value object, Value key)
+{
+    CheckBound(object);
+
+    if (IsKind(object, ObjectKind::List) && IsInt(key))
+    {
+        auto &items = As<ListObject>(object)->mItems;
+        items.erase(items.begin() + Index(key, static_cast<std::int64_t>(items.size()), L"list assignment"));
+        return;
+    }
+
+    if (IsKind(object, ObjectKind::Dict))
+    {
+        if (!As<DictObject>(object)->Erase(key)) Throw(L"KeyError", Repr(key));
+        return;
+    }
+
+    Throw(L"TypeError", L"'" + TypeName(object) + L"' object does not support item deletion");
+}
+
+
+/* Attributes */
+
+Value VirtualMachine::GetAttr(Value object, Value name)
+{
+    CheckBound(object);
+
+    if (object.IsObject())
+    {
+        DictObject *methods = nullptr;
+
+        switch (object.AsObject()->mKind)
+        {
+            case ObjectKind::Instance:
+                {
+                    auto instance = As<InstanceObject>(object);
+                    auto value = instance->mDict->Find(name);
+                    if (value != nullptr) return *value;
+
+                    value = instance->mClass->Lookup(name);
+
+                    if (value != nullptr)
+                    {
+                        if (IsKind(*value, ObjectKind::Function)) return Value::FromObject( New<BoundMethodObject>(object, *value) );
+                        return *value;
+                    }
+                }
+                break;
+
+            case ObjectKind::Class:
+                {
+                    auto value = As<ClassObject>(object)->Lookup(name);
+                    if (value != nullptr) return *value;
+                    if (As<StringObject>(name)->Equals( As<StringObject>(Intern(L"__name__")) )) return NewString(As<ClassObject>(object)->mName);
+                }
+                break;
+
+            case ObjectKind::Function:
+                if (As<StringObject>(name)->Equals( As<StringObject>(Intern(L"__name__")) )) return NewString(As<FunctionObject>(object)->mCode->mCode->GetName());
+                break;
+
+            case ObjectKind::List:      methods = mListMethods; break;
+            case ObjectKind::Dict:      methods = mDictMethods; break;
+            case ObjectKind::String:    methods = mStringMethods; break;
+            default:                    break;
+        }
+
+        if (methods != nullptr)
+        {
+            auto method = methods->Find(name);
+            if (method != nullptr) return Value::FromObject( New<BoundMethodObject>(object, *method) );
+        }
+    }
+
+    Throw(L"AttributeError", L"'" + TypeName(object) + L"' object has no attribute '" + As<StringObject>(name)->Text() + L"'");
+}
+
+/* Instances are told apart by the shape of their dict: it places the instance
+   attributes and proves the class attributes are not shadowed. Class attributes also
+   hold while no class changed. Dicts without a shape are not cached. */
+Value VirtualMachine::GetAttr(Value object, Value name, InlineCache &cache)
+{
+    InstanceObject *instance = nullptr;
+    ClassObject *type = nullptr;
+    Shape *shape = nullptr;
+
+    if (IsKind(object, ObjectKind::Instance))
+    {
+        instance = As<InstanceObject>(object);
+        type = instance->mClass;
+        shape = instance->mDict->mShape;
+    }
+    else if (IsKind(object, ObjectKind::Class)) type = As<ClassObject>(object);
+
+    if (type == nullptr || (instance != nullptr && shape == nullptr))
+    {
+        cache.mMisses++;
+        return GetAttr(object, name);
+    }
+
+    for (unsigned int k = 0; k < cache.mCount; k++)
+    {
+        auto &entry = cache.mEntries[k];
+        if (entry.mShape != shape) continue;
+
+        if (entry.mKind == AttributeEntry::Kind::Slot)
+        {
+            cache.mHits++;
+            return instance->mDict->mEntries[entry.mIndex].mValue;
+        }
+
+        if (entry.mClass != type || entry.mEpoch != mClassEpoch) continue;
+
+        cache.mHits++;
+        if (entry.mKind == AttributeEntry::Kind::Method) return Value::FromObject( New<BoundMethodObject>(object, entry.mValue) );
+        return entry.mValue;
+    }
+
+    cache.mMisses++;
+
+    AttributeEntry entry { AttributeEntry::Kind::Slot, shape, type, mClassEpoch, 0, Value() };
+
+    if (instance == nullptr || !instance->mDict->FindIndex(name, entry.mIndex))
+    {
+        auto value = type->Lookup(name);
+        if (value == nullptr) return GetAttr(object, name);
+
+        entry.mValue = *value;
+        entry.mKind = instance != nullptr && IsKind(*value, ObjectKind::Function) ? AttributeEntry::Kind::Method : AttributeEntry::Kind::Value;
+    }
+
+    if (cache.mCount < InlineCache::Ways) cache.mEntries[cache.mCount++] = entry;
+    else cache.mEntries[cache.mNext++ % InlineCache::Ways] = entry;
+
+    switch (entry.mKind)
+    {
+        case AttributeEntry::Kind::Slot:    return instance->mDict->mEntries[entry.mIndex].mValue;
+        case AttributeEntry::Kind::Method:  return Value::FromObject( New<BoundMethodObject>(object, entry.mValue) );
+        default:                            return entry.mValue;
+    }
+}
+
+/* Stores to attributes an instance already has write their slot. */
+void VirtualMachine::SetAttr(Value object, Value name, Value value, InlineCache &cache)
+{
+    if (IsKind(object, ObjectKind::Instance))
+    {
+        auto dict = As<InstanceObject>(object)->mDict;
+        auto shape = dict->mShape;
+
+        if (shape != nullptr)
+        {
+            for (unsigned int k = 0; k < cache.mCount; k++)
+                if (cache.mEntries[k].mShape == shape)
+                {
+                    cache.mHits++;
+                    dict->mEntries[cache.mEntries[k].mIndex].mValue = value;
+                    return;
+                }
+
+            cache.mMisses++;
+            dict->Insert(name, value);
+
+            /* A new key moved the dict to another shape. */
+            AttributeEntry entry { AttributeEntry::Kind::Slot, shape, nullptr, 0, 0, Value() };
+
+            if (dict->mShape == shape && dict->FindIndex(name, entry.mIndex))
+            {
+                if (cache.mCount < InlineCache::Ways) cache.mEntries[cache.mCount++] = entry;
+                else cache.mEntries[cache.mNext++ % InlineCache::Ways] = entry;
+            }
+
+            return;
+        }
+    }
+
+    cache.mMisses++;
+    SetAttr(object, name, value);
+}
+
+void VirtualMachine::SetAttr(Value object, Value name, Value value)
+{
+    CheckBound(object);
+
+    if (IsKind(object, ObjectKind::Instance))
+    {
+        As<InstanceObject>(object)->mDict->Insert(name, value);
+        return;
+    }
+
+    if (IsKind(object, ObjectKind::Class))
+    {
+        As<ClassObject>(object)->mDict->Insert(name, value);
+        mClassEpoch++;
+        return;
+    }
+
+    Throw(L"AttributeError", L"'" + TypeName(object) + L"' object attribute '" + As<StringObject>(name)->Text() + L"' is read-only");
+}
+
+void VirtualMachine::DeleteAttr(Value object, Value name)
+{
+    CheckBound(object);
+
+    DictObject *dict = nullptr;
+    if (IsKind(object, ObjectKind::Instance)) dict = As<InstanceObject>(object)->mDict;
+    else if (IsKind(object, ObjectKind::Class))
+    {
+        dict = As<ClassObject>(object)->mDict;
+        mClassEpoch++;
+    }
+
+    if (dict == nullptr || !dict->Erase(name))
+        Throw(L"AttributeError", L"'" + TypeName(object) + L"' object has no attribute '" + As<StringObject>(name)->Text() + L"'");
+}
+
+
+/* Iteration */
+
+Value VirtualMachine::GetIter(Value object)
+{
+    CheckBound(object);
+
+    if (object.IsObject())
+    {
+        switch (object.AsObject()->mKind)
+        {
+            case ObjectKind::Iterator:
+                return object;
+
+            case ObjectKind::Range:
+                {
+                    auto range = As<RangeObject>(object);
+                    return Value::FromObject( New<IteratorObject>(Value::None(), range->mStart, range->mStop, range->mStep) );
+                }
+
+            case ObjectKind::List:
+            case ObjectKind::Tuple:
+            case ObjectKind::String:
+            case ObjectKind::Dict:
+            case ObjectKind::Set:
+                return Value::FromObject( New<IteratorObject>(object, 0, 0, 1) );
+
+            default:
+                break;
+        }
+    }
+
+    Throw(L"TypeError", L"'" + TypeName(object) + L"' object is not iterable");
+}
+
+bool VirtualMachine::Next(Value iterator, Value &item)
+{
+    if (!IsKind(iterator, ObjectKind::Iterator)) Throw(L"TypeError", L"'" + TypeName(iterator) + L"' object is not an iterator");
+
+    auto it = As<IteratorObject>(iterator);
+    auto source = it->mSource;
+
+    if (source.IsNone())
+    {
+        if (it->mStep > 0 ? it->mCurrent >= it->mStop : it->mCurrent <= it->mStop) return false;
+
+        item = NewInteger(it->mCurrent);
+        it->mCurrent += it->mStep;
+        return true;
+    }
+
+    auto index = static_cast<std::size_t>(it->mCurrent);
+
+    switch (source.AsObject()->mKind)
+    {
+        case ObjectKind::List:
+            if (index >= As<ListObject>(source)->mItems.size()) return false;
+            item = As<ListObject>(source)->mItems[index];
+            break;
+
+        case ObjectKind::Tuple:
+            if (index >= As<TupleObject>(source)->mItems.size()) return false;
+            item = As<TupleObject>(source)->mItems[index];
+            break;
+
+        case ObjectKind::String:
+            if (index >= As<StringObject>(source)->Length()) return false;
+            item = Character( As<StringObject>(source)->At(index) );
+            break;
+
+        default:
+            {
+                auto &entries = As<DictObject>(source)->mEntries;
+                while (index < entries.size() && !entries[index].mLive) index++;
+
+                if (index >= entries.size())
+                {
+                    it->mCurrent = static_cast<std::int64_t>(index);
+                    return false;
+                }
+
+                item = entries[index].mKey;
+            }
+            break;
+    }
+
+    it->mCurrent = static_cast<std::int64_t>(index) + 1;
+    return true;
+}
+
+std::int64_t VirtualMachine::Length(Value object)
+{
+    if (object.IsObject())
+    {
+        switch (object.AsObject()->mKind)
+        {
+            case ObjectKind::String:    return static_cast<std::int64_t>(As<StringObject>(object)->Length());
+            case ObjectKind::Tuple:     return static_cast<std::int64_t>(As<TupleObject>(object)->mItems.size());
+            case ObjectKind::List:      return static_cast<std::int64_t>(As<ListObject>(object)->mItems.size());
+            case ObjectKind::Dict:
+            case ObjectKind::Set:       return static_cast<std::int64_t>(As<DictObject>(object)->Size());
+            case ObjectKind::Range:     return As<RangeObject>(object)->Length();
+
+            case ObjectKind::Instance:
+                {
+                    auto method = As<InstanceObject>(object)->mClass->Lookup(Intern(L"__len__"));
+
+                    if (method != nullptr)
+                    {
+                        auto result = Call(*method, { object });
+                        if (IsInt(result)) return result.AsInteger();
+                    }
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    Throw(L"TypeError", L"object of type '" + TypeName(object) + L"' has no len()");
+}
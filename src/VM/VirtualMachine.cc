@@ -0,0 +1,1178 @@
+#include <PythonCoreVirtualMachine.h>
+#include <PythonCoreCompiler.h>
+
+#include <algorithm>
+
+using namespace PythonCoreNative::RunTime::VM;
+using namespace PythonCoreNative::RunTime::Compiler;
+
+
+/* Computed gotos jump straight from one handler to the next, every handler ends in
+   its own indirect branch which predicts better than the single one of a switch.
+   Compilers without label addresses, or builds defining PYTHONCORE_SWITCH_DISPATCH,
+   use the switch. */
+#if defined(__GNUC__) && !defined(PYTHONCORE_SWITCH_DISPATCH)
+#define PYTHONCORE_COMPUTED_GOTO 1
+#endif
+
+static constexpr std::size_t InitialThreshold = 100000;
+
+
+VirtualMachine::VirtualMachine()
+{
+    mStack.reset(new Value[StackSize]);
+    mFrames.reset(new Frame[MaxFrames]);
+    mFrameCount = 0;
+
+    mObjects = nullptr;
+    mObjectCount = 0;
+    mThreshold = InitialThreshold;
+    mCollections = 0;
+    mOutput = &std::wcout;
+
+    mRootShape = std::make_unique<Shape>();
+    mClassEpoch = 0;
+
+    mGlobals = New<DictObject>();
+    mBuiltins = New<DictObject>();
+    mListMethods = New<DictObject>();
+    mDictMethods = New<DictObject>();
+    mStringMethods = New<DictObject>();
+
+    InstallBuiltins();
+}
+
+VirtualMachine::~VirtualMachine()
+{
+    while (mObjects != nullptr)
+    {
+        auto next = mObjects->mNext;
+        delete mObjects;
+        mObjects = next;
+    }
+}
+
+void VirtualMachine::Run(std::shared_ptr<CodeObject> code)
+{
+    auto unit = Materialize(code);
+    auto registers = StackTop() + 1;
+
+    if (mFrameCount == MaxFrames || registers + unit->mRegisterCount > mStack.get() + StackSize)
+        Throw(L"RecursionError", L"maximum recursion depth exceeded");
+
+    std::fill(registers, registers + unit->mRegisterCount, Value());
+    mFrames[mFrameCount++] = { unit, unit->mInstructions, registers, nullptr, nullptr };
+
+    Execute(mFrameCount - 1);
+}
+
+void VirtualMachine::RunSource(std::shared_ptr<std::wstring> source)
+{
+    Run( PythonCoreCompiler::CompileSource(source) );
+}
+
+void VirtualMachine::SetOutput(std::wostream *output)
+{
+    mOutput = output;
+}
+
+std::wostream & VirtualMachine::GetOutput()
+{
+    return *mOutput;
+}
+
+Value VirtualMachine::GetGlobal(const std::wstring &name)
+{
+    auto value = mGlobals->Find(Intern(name));
+    return value == nullptr ? Value() : *value;
+}
+
+std::size_t VirtualMachine::GetObjectCount()
+{
+    return mObjectCount;
+}
+
+std::size_t VirtualMachine::GetCollectionCount()
+{
+    return mCollections;
+}
+
+/* Of the code units still alive, in no particular order. */
+std::vector<VirtualMachine::CacheStatistics> VirtualMachine::GetCacheStatistics()
+{
+    std::vector<CacheStatistics> statistics;
+
+    for (auto object = mObjects; object != nullptr; object = object->mNext)
+    {
+        if (object->mKind != ObjectKind::Code) continue;
+
+        auto unit = static_cast<CodeUnitObject *>(object);
+        auto &instructions = unit->mCode->GetInstructions();
+
+        for (unsigned int pc = 0; pc < instructions.size(); pc++)
+        {
+            auto op = GetOpCode(instructions[pc]);
+
+            if (op == OpCode::LoadGlobal || op == OpCode::GetAttr || op == OpCode::SetAttr)
+            {
+                auto &cache = unit->mCaches[unit->mCacheSlots[pc]];
+                auto name = op == OpCode::LoadGlobal ? GetBx(instructions[pc]) : instructions[pc + 1];
+
+                statistics.push_back( { unit->mCode->GetName(), unit->mCode->GetLine(pc), op, Str(unit->mNames[name]),
+                                        cache.mHits, cache.mMisses } );
+            }
+
+            if (HasExtraWord(op)) pc++;
+        }
+    }
+
+    return statistics;
+}
+
+
+/* Code */
+
+Value VirtualMachine::ConstantValue(const Constant &constant)
+{
+    switch (constant.mKind)
+    {
+        case ConstantKind::None:        return Value::None();
+        case ConstantKind::True:        return Value::Bool(true);
+        case ConstantKind::False:       return Value::Bool(false);
+        case ConstantKind::Ellipsis:    return *mBuiltins->Find(Intern(L"Ellipsis"));
+        case ConstantKind::Integer:     return NewInteger(constant.mInteger);
+        case ConstantKind::Float:       return Value::Float(constant.mReal);
+        case ConstantKind::String:      return Intern(constant.mText);
+        case ConstantKind::Code:        return Value::FromObject( Materialize(constant.mCode) );
+
+        case ConstantKind::Tuple:
+            {
+                std::vector<Value> items;
+                for (auto &item : constant.mItems) items.push_back( ConstantValue(item) );
+                return Value::FromObject( New<TupleObject>(std::move(items)) );
+            }
+
+        case ConstantKind::BigInteger:
+            {
+                BigInteger value;
+                BigInteger::Parse(constant.mText, 0, value);
+                return NewInteger(std::move(value));
+            }
+
+        default:
+            Throw(L"ValueError", L"complex numbers are not supported");
+    }
+}
+
+CodeUnitObject * VirtualMachine::Materialize(std::shared_ptr<CodeObject> code)
+{
+    auto unit = New<CodeUnitObject>(code);
+
+    for (auto &constant : code->GetConstants()) unit->mConstants.push_back( ConstantValue(constant) );
+    for (auto &name : code->GetNames()) unit->mNames.push_back( Intern(name) );
+
+    unit->mInstructions = code->GetInstructions().data();
+    unit->mRegisterCount = code->GetRegisterCount();
+    unit->mArgCount = code->GetArgCount();
+    unit->mParameterCount = static_cast<unsigned int>(code->GetParameterNames().size());
+    unit->mIsSimple =   code->GetFlags() == 0 && code->GetKwOnlyCount() == 0 &&
+                        code->GetCellSlots().empty() && code->GetFreeSources().empty();
+
+    /* One inline cache per global load and attribute access. */
+    auto &instructions = code->GetInstructions();
+    unit->mCacheSlots.assign(instructions.size(), 0);
+
+    for (std::size_t pc = 0; pc < instructions.size(); pc++)
+    {
+        auto op = GetOpCode(instructions[pc]);
+
+        if (op == OpCode::LoadGlobal || op == OpCode::GetAttr || op == OpCode::SetAttr)
+        {
+            unit->mCacheSlots[pc] = static_cast<std::uint32_t>(unit->mCaches.size());
+            unit->mCaches.emplace_back();
+        }
+
+        if (HasExtraWord(op)) pc++;
+    }
+
+    return unit;
+}
+
+
+/* Calls */
+
+Value * VirtualMachine::StackTop()
+{
+    if (mFrameCount == 0) return mStack.get();
+
+    /* A bound method call may use the register after the last one of the frame. */
+    auto &frame = mFrames[mFrameCount - 1];
+    return frame.mRegisters + frame.mCode->mRegisterCount + 1;
+}
+
+void VirtualMachine::BindArguments(FunctionObject *function, Value *args, unsigned int count, TupleObject *keywords)
+{
+    auto code = function->mCode->mCode;
+    auto &names = code->GetParameterNames();
+    auto argCount = code->GetArgCount(), kwOnlyCount = code->GetKwOnlyCount(), flags = code->GetFlags();
+    auto named = argCount + kwOnlyCount;
+    auto keywordCount = keywords == nullptr ? 0 : static_cast<unsigned int>(keywords->mItems.size());
+
+    std::vector<Value> keywordValues(args + count, args + count + keywordCount);
+    TupleObject *extra = nullptr;
+
+    if (count > argCount)
+    {
+        if (!(flags & CodeObject::VarArgs))
+            Throw(L"TypeError", code->GetName() + L"() takes " + std::to_wstring(argCount) + L" positional arguments but " + std::to_wstring(count) + L" were given");
+
+        extra = New<TupleObject>( std::vector<Value>(args + argCount, args + count) );
+        count = argCount;
+    }
+
+    std::fill(args + count, args + names.size(), Value());
+
+    auto slot = named;
+    if (flags & CodeObject::VarArgs) args[slot++] = Value::FromObject( extra != nullptr ? extra : New<TupleObject>(std::vector<Value>()) );
+
+    DictObject *rest = nullptr;
+    if (flags & CodeObject::VarKeywords) args[slot] = Value::FromObject( rest = New<DictObject>() );
+
+    for (unsigned int j = 0; j < keywordCount; j++)
+    {
+        auto name = static_cast<StringObject *>(keywords->mItems[j].AsObject())->Text();
+        auto index = static_cast<unsigned int>( std::find(names.begin(), names.begin() + named, name) - names.begin() );
+
+        if (index < named)
+        {
+            if (!args[index].IsUndefined()) Throw(L"TypeError", code->GetName() + L"() got multiple values for argument '" + name + L"'");
+            args[index] = keywordValues[j];
+        }
+        else if (rest != nullptr) rest->Insert(keywords->mItems[j], keywordValues[j]);
+        else Throw(L"TypeError", code->GetName() + L"() got an unexpected keyword argument '" + name + L"'");
+    }
+
+    auto &defaults = code->GetDefaultParameters();
+
+    for (std::size_t j = 0; j < defaults.size(); j++)
+        if (args[defaults[j]].IsUndefined()) args[defaults[j]] = function->mDefaults[j];
+
+    for (unsigned int i = 0; i < named; i++)
+        if (args[i].IsUndefined()) Throw(L"TypeError", code->GetName() + L"() missing required argument '" + names[i] + L"'");
+}
+
+void VirtualMachine::PushFrame(FunctionObject *function, Value *args, unsigned int count, TupleObject *keywords)
+{
+    auto unit = function->mCode;
+
+    if (mFrameCount == MaxFrames || args + unit->mRegisterCount + 1 > mStack.get() + StackSize)
+        Throw(L"RecursionError", L"maximum recursion depth exceeded");
+
+    if (unit->mIsSimple && keywords == nullptr && count == unit->mArgCount)
+    {
+        std::fill(args + count, args + unit->mRegisterCount, Value());
+    }
+    else
+    {
+        BindArguments(function, args, count, keywords);
+        std::fill(args + unit->mParameterCount, args + unit->mRegisterCount, Value());
+
+        auto code = unit->mCode;
+
+        for (auto slot : code->GetCellSlots())
+            args[slot] = Value::FromObject( New<CellObject>(args[slot]) );
+
+        auto freeSlot = code->GetFreeSlot();
+        for (std::size_t i = 0; i < function->mFreeCells.size(); i++) args[freeSlot + i] = function->mFreeCells[i];
+    }
+
+    mFrames[mFrameCount++] = { unit, unit->mInstructions, args, nullptr, nullptr };
+}
+
+/* Makes room for self in front of the arguments. */
+static void InsertSelf(Value *base, unsigned int count, Value self)
+{
+    for (auto i = count; i > 0; i--) base[i + 1] = base[i];
+    base[1] = self;
+}
+
+bool VirtualMachine::CallOther(Value *base, unsigned int count, TupleObject *keywords)
+{
+    auto callable = base[0];
+    auto keywordCount = keywords == nullptr ? 0 : static_cast<unsigned int>(keywords->mItems.size());
+
+    if (callable.IsObject())
+    {
+        switch (callable.AsObject()->mKind)
+        {
+            case ObjectKind::Function:
+                PushFrame(static_cast<FunctionObject *>(callable.AsObject()), base + 1, count, keywords);
+                return false;
+
+            case ObjectKind::Builtin:
+                {
+                    auto builtin = static_cast<BuiltinObject *>(callable.AsObject());
+                    if (keywords != nullptr) Throw(L"TypeError", std::wstring(builtin->mName) + L"() takes no keyword arguments");
+                    base[0] = builtin->mFunction(*this, base + 1, count);
+                }
+                return true;
+
+            case ObjectKind::BoundMethod:
+                {
+                    auto method = static_cast<BoundMethodObject *>(callable.AsObject());
+                    InsertSelf(base, count + keywordCount, method->mSelf);
+                    base[0] = method->mFunction;
+                    return CallOther(base, count + 1, keywords);
+                }
+
+            case ObjectKind::Class:
+                {
+                    auto type = static_cast<ClassObject *>(callable.AsObject());
+                    auto init = type->Lookup(Intern(L"__init__"));
+
+                    if (init == nullptr || init->IsUndefined() || !init->IsObject() || init->AsObject()->mKind != ObjectKind::Function)
+                    {
+                        if (keywords != nullptr) Throw(L"TypeError", type->mName + L"() takes no keyword arguments");
+                        base[0] = Instantiate(type, base + 1, count);
+                        return true;
+                    }
+
+                    auto instance = NewInstance(type);
+                    InsertSelf(base, count + keywordCount, Value::FromObject(instance));
+                    base[0] = *init;
+                    PushFrame(static_cast<FunctionObject *>(init->AsObject()), base + 1, count + 1, keywords);
+                    mFrames[mFrameCount - 1].mInstance = instance;
+                }
+                return false;
+
+            default:
+                break;
+        }
+    }
+
+    Throw(L"TypeError", L"'" + TypeName(callable) + L"' object is not callable");
+}
+
+Value VirtualMachine::Call(Value callable, const std::vector<Value> &args)
+{
+    auto base = StackTop();
+
+    if (base + args.size() + 2 > mStack.get() + StackSize) Throw(L"RecursionError", L"maximum recursion depth exceeded");
+
+    base[0] = callable;
+    std::copy(args.begin(), args.end(), base + 1);
+
+    if (CallOther(base, static_cast<unsigned int>(args.size()), nullptr)) return base[0];
+    return Execute(mFrameCount - 1);
+}
+
+
+/* Collection */
+
+void VirtualMachine::Mark(Value value)
+{
+    if (value.IsObject() || value.IsBoxed()) Mark(value.AsObject());
+}
+
+void VirtualMachine::Mark(Object *object)
+{
+    if (object == nullptr || object->mMarked) return;
+
+    object->mMarked = true;
+    mGray.push_back(object);
+}
+
+void VirtualMachine::CollectIfNeeded()
+{
+    if (mObjectCount >= mThreshold) Collect();
+}
+
+void VirtualMachine::Collect()
+{
+    for (unsigned int i = 0; i < mFrameCount; i++)
+    {
+        auto &frame = mFrames[i];
+
+        for (auto reg = frame.mRegisters - 1; reg < frame.mRegisters + frame.mCode->mRegisterCount + 1; reg++) Mark(*reg);
+
+        Mark(frame.mCode);
+        Mark(frame.mNamespace);
+        Mark(frame.mInstance);
+    }
+
+    Mark(mGlobals);
+    Mark(mBuiltins);
+    Mark(mListMethods);
+    Mark(mDictMethods);
+    Mark(mStringMethods);
+    Mark(mObjectClass);
+    for (auto &interned : mInterned) Mark(interned.second);
+
+    while (!mGray.empty())
+    {
+        auto object = mGray.back();
+        mGray.pop_back();
+
+        switch (object->mKind)
+        {
+            case ObjectKind::Tuple:
+                for (auto &item : static_cast<TupleObject *>(object)->mItems) Mark(item);
+                break;
+
+            case ObjectKind::List:
+                for (auto &item : static_cast<ListObject *>(object)->mItems) Mark(item);
+                break;
+
+            case ObjectKind::Dict:
+            case ObjectKind::Set:
+                for (auto &entry : static_cast<DictObject *>(object)->mEntries)
+                {
+                    Mark(entry.mKey);
+                    Mark(entry.mValue);
+                }
+                break;
+
+            case ObjectKind::Iterator:
+                Mark(static_cast<IteratorObject *>(object)->mSource);
+                break;
+
+            case ObjectKind::Slice:
+                {
+                    auto slice = static_cast<SliceObject *>(object);
+                    Mark(slice->mStart);
+                    Mark(slice->mStop);
+                    Mark(slice->mStep);
+                }
+                break;
+
+            case ObjectKind::Cell:
+                Mark(static_cast<CellObject *>(object)->mValue);
+                break;
+
+            case ObjectKind::Code:
+                for (auto &constant : static_cast<CodeUnitObject *>(object)->mConstants) Mark(constant);
+                for (auto &name : static_cast<CodeUnitObject *>(object)->mNames) Mark(name);
+                break;
+
+            case ObjectKind::Function:
+                {
+                    auto function = static_cast<FunctionObject *>(object);
+                    Mark(function->mCode);
+                    for (auto &value : function->mDefaults) Mark(value);
+                    for (auto &value : function->mFreeCells) Mark(value);
+                }
+                break;
+
+            case ObjectKind::BoundMethod:
+                Mark(static_cast<BoundMethodObject *>(object)->mSelf);
+                Mark(static_cast<BoundMethodObject *>(object)->mFunction);
+                break;
+
+            case ObjectKind::Class:
+                {
+                    auto type = static_cast<ClassObject *>(object);
+                    Mark(type->mDict);
+                    for (auto base : type->mMro) Mark(base);
+                }
+                break;
+
+            case ObjectKind::Instance:
+                Mark(static_cast<InstanceObject *>(object)->mClass);
+                Mark(static_cast<InstanceObject *>(object)->mDict);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    auto link = &mObjects;
+    std::size_t live = 0;
+
+    while (*link != nullptr)
+    {
+        auto object = *link;
+
+        if (object->mMarked)
+        {
+            object->mMarked = false;
+            link = &object->mNext;
+            live++;
+        }
+        else
+        {
+            *link = object->mNext;
+            delete object;
+        }
+    }
+
+    mObjectCount = live;
+    mThreshold = std::max(InitialThreshold, live * 2);
+    mCollections++;
+}
+
+
+/* Dispatch */
+
+#ifdef PYTHONCORE_COMPUTED_GOTO
+#define TARGET(op)      Label##op:
+#define DISPATCH()      do { i = *pc++; goto *labels[i & 0xff]; } while (0)
+#else
+#define TARGET(op)      case OpCode::op:
+#define DISPATCH()      goto dispatch
+#endif
+
+#define LOAD_FRAME()    do {                                            \
+                            frame = &mFrames[mFrameCount - 1];          \
+                            pc = frame->mPc;                            \
+                            R = frame->mRegisters;                      \
+                            K = frame->mCode->mConstants.data();        \
+                            N = frame->mCode->mNames.data();            \
+                        } while (0)
+
+/* Inline cache of the instruction being run. */
+#define CACHE()         frame->mCode->mCaches[frame->mCode->mCacheSlots[pc - 1 - frame->mCode->mInstructions]]
+
+#define RA              R[GetA(i)]
+#define RB              R[GetB(i)]
+#define RC              R[GetC(i)]
+
+/* Integer and float fast paths of the arithmetic, everything else in Binary. */
+#define ARITHMETIC(op, overflow, operator)                                                      \
+    TARGET(op)                                                                                  \
+    {                                                                                           \
+        auto b = RB, c = RC;                                                                    \
+        std::int64_t r;                                                                         \
+        if (b.IsSmallInteger() && c.IsSmallInteger() && !overflow(b.AsSmallInteger(), c.AsSmallInteger(), &r) && Value::FitsInline(r)) \
+            RA = Value::Integer(r);                                                             \
+        else if (b.IsFloat() && c.IsFloat()) RA = Value::Float(b.AsFloat() operator c.AsFloat()); \
+        else if (b.IsFloat() && c.IsInteger()) RA = Value::Float(b.AsFloat() operator static_cast<double>(c.AsInteger())); \
+        else if (b.IsInteger() && c.IsFloat()) RA = Value::Float(static_cast<double>(b.AsInteger()) operator c.AsFloat()); \
+        else RA = Binary(OpCode::op, b, c);                                                     \
+        DISPATCH();                                                                             \
+    }
+
+#define SLOW_BINARY(op)                                                                         \
+    TARGET(op)                                                                                  \
+    {                                                                                           \
+        RA = Binary(OpCode::op, RB, RC);                                                        \
+        DISPATCH();                                                                             \
+    }
+
+#define COMPARISON(op, operator)                                                                \
+    TARGET(op)                                                                                  \
+    {                                                                                           \
+        auto b = RB, c = RC;                                                                    \
+        if (b.IsSmallInteger() && c.IsSmallInteger()) RA = Value::Bool(b.AsSmallInteger() operator c.AsSmallInteger()); \
+        else if (b.IsFloat() && c.IsFloat()) RA = Value::Bool(b.AsFloat() operator c.AsFloat()); \
+        else RA = Compare(OpCode::op, b, c);                                                    \
+        DISPATCH();                                                                             \
+    }
+
+#define SLOW_COMPARISON(op)                                                                     \
+    TARGET(op)                                                                                  \
+    {                                                                                           \
+        RA = Compare(OpCode::op, RB, RC);                                                       \
+        DISPATCH();                                                                             \
+    }
+
+static bool SubOverflow(std::int64_t a, std::int64_t b, std::int64_t *r) { return __builtin_sub_overflow(a, b, r); }
+static bool AddOverflow(std::int64_t a, std::int64_t b, std::int64_t *r) { return __builtin_add_overflow(a, b, r); }
+static bool MulOverflow(std::int64_t a, std::int64_t b, std::int64_t *r) { return __builtin_mul_overflow(a, b, r); }
+
+Value VirtualMachine::Execute(unsigned int entry)
+{
+    Frame *frame;
+    const Instruction *pc;
+    Value *R;
+    const Value *K;
+    const Value *N;
+    Instruction i;
+    Value result;
+
+    LOAD_FRAME();
+
+    try
+    {
+
+#ifdef PYTHONCORE_COMPUTED_GOTO
+        static void *labels[] =
+        {
+            &&LabelNop, &&LabelMove, &&LabelLoadConst, &&LabelLoadInt, &&LabelLoadNone, &&LabelLoadTrue, &&LabelLoadFalse,
+            &&LabelLoadGlobal, &&LabelStoreGlobal, &&LabelDeleteGlobal, &&LabelLoadName, &&LabelStoreName, &&LabelDeleteName,
+            &&LabelLoadCell, &&LabelStoreCell, &&LabelDeleteFast, &&LabelDeleteCell,
+            &&LabelGetAttr, &&LabelSetAttr, &&LabelDeleteAttr, &&LabelGetItem, &&LabelSetItem, &&LabelDeleteItem,
+            &&LabelBuildTuple, &&LabelBuildList, &&LabelBuildSet, &&LabelBuildDict, &&LabelBuildSlice,
+            &&LabelListAppend, &&LabelSetAdd,
+            &&LabelListExtend, &&LabelSetUpdate, &&LabelDictUpdate, &&LabelListToTuple, &&LabelUnpack,
+            &&LabelAdd, &&LabelSubtract, &&LabelMultiply, &&LabelMatrixMultiply, &&LabelTrueDivide, &&LabelFloorDivide,
+            &&LabelModulo, &&LabelPower, &&LabelShiftLeft, &&LabelShiftRight, &&LabelBitAnd, &&LabelBitOr, &&LabelBitXor,
+            &&LabelInPlaceAdd, &&LabelInPlaceSubtract, &&LabelInPlaceMultiply, &&LabelInPlaceMatrixMultiply,
+            &&LabelInPlaceTrueDivide, &&LabelInPlaceFloorDivide, &&LabelInPlaceModulo, &&LabelInPlacePower,
+            &&LabelInPlaceShiftLeft, &&LabelInPlaceShiftRight, &&LabelInPlaceBitAnd, &&LabelInPlaceBitOr, &&LabelInPlaceBitXor,
+            &&LabelNegative, &&LabelPositive, &&LabelInvert, &&LabelNot,
+            &&LabelLess, &&LabelLessEqual, &&LabelEqual, &&LabelNotEqual, &&LabelGreater, &&LabelGreaterEqual,
+            &&LabelIn, &&LabelNotIn, &&LabelIs, &&LabelIsNot,
+            &&LabelJump, &&LabelJumpIfTrue, &&LabelJumpIfFalse, &&LabelGetIter, &&LabelForIter,
+            &&LabelCall, &&LabelCallKw, &&LabelReturn, &&LabelReturnNone, &&LabelMakeFunction, &&LabelMakeClass, &&LabelRaise,
+            &&LabelMatchSequence, &&LabelMatchMapping, &&LabelGetLength, &&LabelGetKey, &&LabelMatchClass, &&LabelSliceList,
+            &&LabelCopyDictWithout
+        };
+
+        static_assert(sizeof(labels) / sizeof(labels[0]) == static_cast<std::size_t>(OpCode::Count), "Label every opcode!");
+
+        DISPATCH();
+#else
+    dispatch:
+        i = *pc++;
+
+        switch (GetOpCode(i))
+        {
+#endif
+
+        TARGET(Nop)
+            DISPATCH();
+
+        TARGET(Move)
+            if (RB.IsUndefined()) goto unbound;
+            RA = RB;
+            DISPATCH();
+
+        TARGET(LoadConst)
+            RA = K[GetBx(i)];
+            DISPATCH();
+
+        TARGET(LoadInt)
+            RA = Value::Integer(GetsBx(i));
+            DISPATCH();
+
+        TARGET(LoadNone)
+            RA = Value::None();
+            DISPATCH();
+
+        TARGET(LoadTrue)
+            RA = Value::Bool(true);
+            DISPATCH();
+
+        TARGET(LoadFalse)
+            RA = Value::Bool(false);
+            DISPATCH();
+
+        TARGET(LoadGlobal)
+        {
+            auto &cache = CACHE();
+
+            if (cache.mGlobalsVersion == mGlobals->mVersion && cache.mBuiltinsVersion == mBuiltins->mVersion)
+            {
+                cache.mHits++;
+                RA = *cache.mGlobal;
+                DISPATCH();
+            }
+
+            cache.mMisses++;
+
+            auto value = mGlobals->Find(N[GetBx(i)]);
+            if (value == nullptr) value = mBuiltins->Find(N[GetBx(i)]);
+            if (value == nullptr) Throw(L"NameError", L"name '" + Str(N[GetBx(i)]) + L"' is not defined");
+
+            /* Entries stay in place until a key comes or goes. */
+            cache.mGlobalsVersion = mGlobals->mVersion;
+            cache.mBuiltinsVersion = mBuiltins->mVersion;
+            cache.mGlobal = value;
+
+            RA = *value;
+            DISPATCH();
+        }
+
+        TARGET(StoreGlobal)
+            mGlobals->Insert(N[GetBx(i)], RA);
+            DISPATCH();
+
+        TARGET(DeleteGlobal)
+            if (!mGlobals->Erase(N[GetBx(i)])) Throw(L"NameError", L"name '" + Str(N[GetBx(i)]) + L"' is not defined");
+            DISPATCH();
+
+        TARGET(LoadName)
+        {
+            Value *value = frame->mNamespace == nullptr ? nullptr : frame->mNamespace->Find(N[GetBx(i)]);
+            if (value == nullptr) value = mGlobals->Find(N[GetBx(i)]);
+            if (value == nullptr) value = mBuiltins->Find(N[GetBx(i)]);
+            if (value == nullptr) Throw(L"NameError", L"name '" + Str(N[GetBx(i)]) + L"' is not defined");
+            RA = *value;
+            DISPATCH();
+        }
+
+        TARGET(StoreName)
+            (frame->mNamespace == nullptr ? mGlobals : frame->mNamespace)->Insert(N[GetBx(i)], RA);
+            DISPATCH();
+
+        TARGET(DeleteName)
+            if (!(frame->mNamespace == nullptr ? mGlobals : frame->mNamespace)->Erase(N[GetBx(i)]))
+                Throw(L"NameError", L"name '" + Str(N[GetBx(i)]) + L"' is not defined");
+            DISPATCH();
+
+        TARGET(LoadCell)
+        {
+            auto value = static_cast<CellObject *>(RB.AsObject())->mValue;
+            if (value.IsUndefined()) Throw(L"NameError", L"free variable referenced before assignment");
+            RA = value;
+            DISPATCH();
+        }
+
+        TARGET(StoreCell)
+            static_cast<CellObject *>(RA.AsObject())->mValue = RB;
+            DISPATCH();
+
+        TARGET(DeleteFast)
+            RA = Value();
+            DISPATCH();
+
+        TARGET(DeleteCell)
+            static_cast<CellObject *>(RA.AsObject())->mValue = Value();
+            DISPATCH();
+
+        TARGET(GetAttr)
+        {
+            auto &cache = CACHE();
+            RA = GetAttr(RB, N[*pc++], cache);
+            DISPATCH();
+        }
+
+        TARGET(SetAttr)
+        {
+            auto &cache = CACHE();
+            SetAttr(RA, N[*pc++], RB, cache);
+            DISPATCH();
+        }
+
+        TARGET(DeleteAttr)
+            DeleteAttr(RA, N[*pc++]);
+            DISPATCH();
+
+        TARGET(GetItem)
+        {
+            auto b = RB, c = RC;
+
+            if (b.IsObject() && b.AsObject()->mKind == ObjectKind::List && c.IsInteger())
+            {
+                auto &items = static_cast<ListObject *>(b.AsObject())->mItems;
+                auto index = c.AsInteger();
+
+                if (index >= 0 && static_cast<std::uint64_t>(index) < items.size())
+                {
+                    RA = items[static_cast<std::size_t>(index)];
+                    DISPATCH();
+                }
+            }
+
+            RA = GetItem(b, c);
+            DISPATCH();
+        }
+
+        TARGET(SetItem)
+        {
+            auto a = RA, b = RB;
+
+            if (a.IsObject() && a.AsObject()->mKind == ObjectKind::List && b.IsInteger())
+            {
+                auto &items = static_cast<ListObject *>(a.AsObject())->mItems;
+                auto index = b.AsInteger();
+
+                if (index >= 0 && static_cast<std::uint64_t>(index) < items.size())
+                {
+                    items[static_cast<std::size_t>(index)] = RC;
+                    DISPATCH();
+                }
+            }
+
+            SetItem(a, b, RC);
+            DISPATCH();
+        }
+
+        TARGET(DeleteItem)
+            DeleteItem(RA, RB);
+            DISPATCH();
+
+        TARGET(BuildTuple)
+            RA = Value::FromObject( New<TupleObject>( std::vector<Value>(R + GetB(i), R + GetB(i) + GetC(i)) ) );
+            DISPATCH();
+
+        TARGET(BuildList)
+            RA = Value::FromObject( New<ListObject>( std::vector<Value>(R + GetB(i), R + GetB(i) + GetC(i)) ) );
+            DISPATCH();
+
+        TARGET(BuildSet)
+        {
+            auto set = New<DictObject>(ObjectKind::Set);
+            for (unsigned int k = 0; k < GetC(i); k++) set->Insert(R[GetB(i) + k], Value::None());
+            RA = Value::FromObject(set);
+            DISPATCH();
+        }
+
+        TARGET(BuildDict)
+        {
+            auto dict = New<DictObject>();
+            for (unsigned int k = 0; k < GetC(i); k++) dict->Insert(R[GetB(i) + 2 * k], R[GetB(i) + 2 * k + 1]);
+            RA = Value::FromObject(dict);
+            DISPATCH();
+        }
+
+        TARGET(BuildSlice)
+            RA = Value::FromObject( New<SliceObject>(RB, R[GetB(i) + 1], GetC(i) == 3 ? R[GetB(i) + 2] : Value::None()) );
+            DISPATCH();
+
+        TARGET(ListAppend)
+            static_cast<ListObject *>(RA.AsObject())->mItems.push_back(RB);
+            DISPATCH();
+
+        TARGET(SetAdd)
+            static_cast<DictObject *>(RA.AsObject())->Insert(RB, Value::None());
+            DISPATCH();
+
+        TARGET(ListExtend)
+        {
+            auto &items = static_cast<ListObject *>(RA.AsObject())->mItems;
+            items.insert(items.end(), R + GetB(i), R + GetB(i) + GetC(i));
+            DISPATCH();
+        }
+
+        TARGET(SetUpdate)
+        {
+            auto set = static_cast<DictObject *>(RA.AsObject());
+            for (unsigned int k = 0; k < GetC(i); k++) set->Insert(R[GetB(i) + k], Value::None());
+            DISPATCH();
+        }
+
+        TARGET(DictUpdate)
+        {
+            auto dict = static_cast<DictObject *>(RA.AsObject());
+            for (unsigned int k = 0; k < GetC(i); k++) dict->Insert(R[GetB(i) + 2 * k], R[GetB(i) + 2 * k + 1]);
+            DISPATCH();
+        }
+
+        TARGET(ListToTuple)
+            RA = Value::FromObject( New<TupleObject>( static_cast<ListObject *>(RB.AsObject())->mItems ) );
+            DISPATCH();
+
+        TARGET(Unpack)
+        {
+            auto source = RB;
+            auto count = GetC(i);
+            const std::vector<Value> *items = nullptr;
+
+            if (source.IsObject() && source.AsObject()->mKind == ObjectKind::Tuple) items = &static_cast<TupleObject *>(source.AsObject())->mItems;
+            else if (source.IsObject() && source.AsObject()->mKind == ObjectKind::List) items = &static_cast<ListObject *>(source.AsObject())->mItems;
+
+            if (items != nullptr)
+            {
+                if (items->size() != count)
+                    Throw(L"ValueError", items->size() < count ?
+                            L"not enough values to unpack (expected " + std::to_wstring(count) + L", got " + std::to_wstring(items->size()) + L")" :
+                            L"too many values to unpack (expected " + std::to_wstring(count) + L")");
+
+                std::copy(items->begin(), items->end(), R + GetA(i));
+                DISPATCH();
+            }
+
+            auto iterator = GetIter(source);
+            unsigned int got = 0;
+            Value item;
+
+            while (Next(iterator, item))
+            {
+                if (got == count) Throw(L"ValueError", L"too many values to unpack (expected " + std::to_wstring(count) + L")");
+                R[GetA(i) + got++] = item;
+            }
+
+            if (got != count)
+                Throw(L"ValueError", L"not enough values to unpack (expected " + std::to_wstring(count) + L", got " + std::to_wstring(got) + L")");
+
+            DISPATCH();
+        }
+
+        ARITHMETIC(Add, AddOverflow, +)
+        ARITHMETIC(Subtract, SubOverflow, -)
+        ARITHMETIC(Multiply, MulOverflow, *)
+        SLOW_BINARY(MatrixMultiply)
+
+        TARGET(TrueDivide)
+        {
+            auto b = RB, c = RC;
+
+            if (b.IsFloat() && c.IsFloat() && c.AsFloat() != 0.0) RA = Value::Float(b.AsFloat() / c.AsFloat());
+            else RA = Binary(OpCode::TrueDivide, b, c);
+            DISPATCH();
+        }
+
+        SLOW_BINARY(FloorDivide)
+        SLOW_BINARY(Modulo)
+        SLOW_BINARY(Power)
+        SLOW_BINARY(ShiftLeft)
+        SLOW_BINARY(ShiftRight)
+        SLOW_BINARY(BitAnd)
+        SLOW_BINARY(BitOr)
+        SLOW_BINARY(BitXor)
+
+        ARITHMETIC(InPlaceAdd, AddOverflow, +)
+        ARITHMETIC(InPlaceSubtract, SubOverflow, -)
+        ARITHMETIC(InPlaceMultiply, MulOverflow, *)
+        SLOW_BINARY(InPlaceMatrixMultiply)
+        SLOW_BINARY(InPlaceTrueDivide)
+        SLOW_BINARY(InPlaceFloorDivide)
+        SLOW_BINARY(InPlaceModulo)
+        SLOW_BINARY(InPlacePower)
+        SLOW_BINARY(InPlaceShiftLeft)
+        SLOW_BINARY(InPlaceShiftRight)
+        SLOW_BINARY(InPlaceBitAnd)
+        SLOW_BINARY(InPlaceBitOr)
+        SLOW_BINARY(InPlaceBitXor)
+
+        TARGET(Negative)
+        {
+            auto b = RB;
+
+            if (b.IsFloat()) RA = Value::Float(-b.AsFloat());
+            else RA = Unary(OpCode::Negative, b);
+            DISPATCH();
+        }
+
+        TARGET(Positive)
+            RA = Unary(OpCode::Positive, RB);
+            DISPATCH();
+
+        TARGET(Invert)
+            RA = Unary(OpCode::Invert, RB);
+            DISPATCH();
+
+        TARGET(Not)
+        {
+            auto b = RB;
+            RA = Value::Bool( !(b.IsBool() ? b.AsBool() : IsTrue(b)) );
+            DISPATCH();
+        }
+
+        COMPARISON(Less, <)
+        COMPARISON(LessEqual, <=)
+        COMPARISON(Equal, ==)
+        COMPARISON(NotEqual, !=)
+        COMPARISON(Greater, >)
+        COMPARISON(GreaterEqual, >=)
+        SLOW_COMPARISON(In)
+        SLOW_COMPARISON(NotIn)
+        SLOW_COMPARISON(Is)
+        SLOW_COMPARISON(IsNot)
+
+        TARGET(Jump)
+        {
+            auto offset = GetsAx(i);
+            pc += offset;
+
+            /* Back edges are safe points. */
+            if (offset < 0) CollectIfNeeded();
+            DISPATCH();
+        }
+
+        TARGET(JumpIfTrue)
+        {
+            auto a = RA;
+            if (a.IsBool() ? a.AsBool() : IsTrue(a)) pc += GetsBx(i);
+            DISPATCH();
+        }
+
+        TARGET(JumpIfFalse)
+        {
+            auto a = RA;
+            if (!(a.IsBool() ? a.AsBool() : IsTrue(a))) pc += GetsBx(i);
+            DISPATCH();
+        }
+
+        TARGET(GetIter)
+            RA = GetIter(RB);
+            DISPATCH();
+
+        TARGET(ForIter)
+        {
+            auto b = RB;
+
+            if (b.IsObject() && b.AsObject()->mKind == ObjectKind::Iterator)
+            {
+                auto iterator = static_cast<IteratorObject *>(b.AsObject());
+
+                /* Ranges count in place without going through Next. */
+                if (iterator->mSource.IsNone())
+                {
+                    if (iterator->mStep > 0 ? iterator->mCurrent < iterator->mStop : iterator->mCurrent > iterator->mStop)
+                    {
+                        RA = NewInteger(iterator->mCurrent);
+                        iterator->mCurrent += iterator->mStep;
+                        pc++;
+                    }
+                    else pc += 1 + static_cast<std::int32_t>(*pc);
+
+                    DISPATCH();
+                }
+            }
+
+            Value item;
+
+            if (Next(b, item))
+            {
+                RA = item;
+                pc++;
+            }
+            else pc += 1 + static_cast<std::int32_t>(*pc);
+
+            DISPATCH();
+        }
+
+        TARGET(Call)
+        {
+            CollectIfNeeded();
+
+            auto base = &RA;
+            auto callee = base[0];
+
+            frame->mPc = pc;
+
+            if (callee.IsObject() && callee.AsObject()->mKind == ObjectKind::Function)
+            {
+                PushFrame(static_cast<FunctionObject *>(callee.AsObject()), base + 1, GetB(i), nullptr);
+                LOAD_FRAME();
+            }
+            else if (!CallOther(base, GetB(i), nullptr)) LOAD_FRAME();
+
+            DISPATCH();
+        }
+
+        TARGET(CallKw)
+        {
+            CollectIfNeeded();
+
+            auto base = &RA;
+            auto names = static_cast<TupleObject *>(K[*pc++].AsObject());
+
+            frame->mPc = pc;
+
+            if (!CallOther(base, GetB(i), names)) LOAD_FRAME();
+            DISPATCH();
+        }
+
+        TARGET(Return)
+            result = RA;
+            if (result.IsUndefined()) goto unbound;
+            goto finish;
+
+        TARGET(ReturnNone)
+            result = Value::None();
+            goto finish;
+
+        TARGET(MakeFunction)
+        {
+            auto unit = static_cast<CodeUnitObject *>(K[*pc++].AsObject());
+            auto function = New<FunctionObject>(unit);
+
+            function->mDefaults.assign(R + GetB(i), R + GetB(i) + GetC(i));
+            for (auto source : unit->mCode->GetFreeSources()) function->mFreeCells.push_back(R[source]);
+
+            RA = Value::FromObject(function);
+            DISPATCH();
+        }
+
+        TARGET(MakeClass)
+        {
+            auto name = N[*pc++];
+            frame->mPc = pc;
+            RA = MakeClass(Str(name), static_cast<FunctionObject *>(RB.AsObject()), R + GetB(i) + 1, GetC(i));
+            DISPATCH();
+        }
+
+        TARGET(Raise)
+            Raise(RA);
+
+        TARGET(MatchSequence)
+            RA = Value::Bool( RB.IsObject() && (RB.AsObject()->mKind == ObjectKind::List || RB.AsObject()->mKind == ObjectKind::Tuple) );
+            DISPATCH();
+
+        TARGET(MatchMapping)
+            RA = Value::Bool( RB.IsObject() && RB.AsObject()->mKind == ObjectKind::Dict );
+            DISPATCH();
+
+        TARGET(GetLength)
+            RA = Value::Integer( Length(RB) );
+            DISPATCH();
+
+        TARGET(GetKey)
+        {
+            auto value = static_cast<DictObject *>(RB.AsObject())->Find(RC);
+
+            if (value != nullptr)
+            {
+                RA = *value;
+                pc++;
+            }
+            else pc += 1 + static_cast<std::int32_t>(*pc);
+
+            DISPATCH();
+        }
+
+        TARGET(MatchClass)
+        {
+            auto names = static_cast<TupleObject *>(K[*pc++].AsObject());
+            RA = MatchClass(RA, RB, GetC(i), names);
+            DISPATCH();
+        }
+
+        TARGET(SliceList)
+        {
+            auto b = RB;
+            auto &items = b.AsObject()->mKind == ObjectKind::List ? static_cast<ListObject *>(b.AsObject())->mItems
+                                                                  : static_cast<TupleObject *>(b.AsObject())->mItems;
+
+            RA = Value::FromObject( New<ListObject>( std::vector<Value>(items.begin() + GetC(i), items.end() - *pc++) ) );
+            DISPATCH();
+        }
+
+        TARGET(CopyDictWithout)
+        {
+            auto source = static_cast<DictObject *>(RB.AsObject());
+            auto copy = New<DictObject>();
+
+            for (auto &entry : source->mEntries)
+                if (entry.mLive) copy->Insert(entry.mKey, entry.mValue);
+
+            for (auto &key : static_cast<TupleObject *>(RC.AsObject())->mItems) copy->Erase(key);
+
+            RA = Value::FromObject(copy);
+            DISPATCH();
+        }
+
+#ifndef PYTHONCORE_COMPUTED_GOTO
+            default:
+                Throw(L"SystemError", L"unknown opcode");
+        }
+#endif
+
+    unbound:
+        Throw(L"UnboundLocalError", L"local variable referenced before assignment");
+
+    finish:
+        if (frame->mInstance != nullptr) result = Value::FromObject(frame->mInstance);
+
+        if (--mFrameCount == entry) return result;
+
+        frame->mRegisters[-1] = result;
+        LOAD_FRAME();
+        DISPATCH();
+    }
+    catch (std::shared_ptr<ExecutionError> &error)
+    {
+        if (error->GetLine() == 0)
+        {
+            auto code = frame->mCode->mCode;
+            error->SetLine( code->GetLine(static_cast<unsigned int>(pc - 1 - frame->mCode->mInstructions)) );
+        }
+
+        mFrameCount = entry;
+        throw;
+    }
+}
@@ -0,0 +1,43 @@
+#include <catch2/catch.hpp>
+
+#include <vm/BigInteger.h>
+
+using namespace PythonCoreNative::RunTime::VM;
+
+
+TEST_CASE( "Big integer products and conversions", "[!benchmark]" )
+{
+    /* 7**n has n * 2.8 bits, the products run from schoolbook to deep Karatsuba. */
+    for (std::uint64_t exponent : { 1000, 10000, 50000 })
+    {
+        auto a = BigInteger::Power(BigInteger(7), exponent), b = BigInteger::Power(BigInteger(3), exponent * 2);
+        auto size = std::to_string(a.BitLength()) + " bits";
+
+        BENCHMARK( "multiply, " + size )
+        {
+            return (a * b).BitLength();
+        };
+
+        auto text = a.ToString();
+        auto hex = L"0x" + a.ToString(16);
+
+        BENCHMARK( "to decimal, " + size )
+        {
+            return a.ToString().size();
+        };
+
+        BENCHMARK( "from decimal, " + size )
+        {
+            BigInteger result;
+            BigInteger::Parse(text, 10, result);
+            return result.BitLength();
+        };
+
+        BENCHMARK( "from hex literal, " + size )
+        {
+            BigInteger result;
+            BigInteger::Parse(hex, 0, result);
+            return result.BitLength();
+        };
+    }
+}
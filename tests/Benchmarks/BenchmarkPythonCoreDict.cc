@@ -0,0 +1,83 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreVirtualMachine.h>
+
+#include <unordered_map>
+
+using namespace PythonCoreNative::RunTime::VM;
+
+
+using ValueMap = std::unordered_map<Value, Value, ValueHash, ValueEqual>;
+
+/* Looks every key up rounds times, half of them missing. */
+template <typename Table, typename Lookup>
+static std::int64_t LookUp(Table &table, const std::vector<Value> &keys, unsigned int rounds, Lookup lookup)
+{
+    std::int64_t sum = 0;
+
+    for (unsigned int round = 0; round < rounds; round++)
+        for (auto &key : keys) sum += lookup(table, key);
+
+    return sum;
+}
+
+TEST_CASE( "Dict lookups against unordered_map", "[!benchmark]" )
+{
+    VirtualMachine vm;
+    std::vector<Value> integers, names;
+
+    for (std::int64_t i = 0; i < 2000; i++)
+    {
+        integers.push_back( Value::Integer(i * 7) );
+        names.push_back( vm.Intern( L"attribute_" + std::to_wstring(i) ) );
+    }
+
+    for (auto keys : { &integers, &names })
+    {
+        DictObject dict;
+        ValueMap map;
+
+        for (std::size_t i = 0; i < keys->size(); i += 2)
+        {
+            dict.Insert( (*keys)[i], Value::Integer(1) );
+            map.emplace( (*keys)[i], Value::Integer(1) );
+        }
+
+        auto kind = keys == &integers ? std::string("integer") : std::string("interned string");
+
+        BENCHMARK( "DictObject, " + kind + " keys" )
+        {
+            return LookUp(dict, *keys, 50, [](DictObject &table, Value key) { return table.Find(key) != nullptr; });
+        };
+
+        BENCHMARK( "unordered_map, " + kind + " keys" )
+        {
+            return LookUp(map, *keys, 50, [](ValueMap &table, Value key) { return table.find(key) != table.end(); });
+        };
+    }
+
+    /* Instance dicts are small and built often. */
+    BENCHMARK( "DictObject, build 8 attributes" )
+    {
+        std::size_t size = 0;
+        for (unsigned int n = 0; n < 1000; n++)
+        {
+            DictObject dict;
+            for (unsigned int i = 0; i < 8; i++) dict.Insert(names[i], Value::Integer(i));
+            size += dict.Size();
+        }
+        return size;
+    };
+
+    BENCHMARK( "unordered_map, build 8 attributes" )
+    {
+        std::size_t size = 0;
+        for (unsigned int n = 0; n < 1000; n++)
+        {
+            ValueMap map;
+            for (unsigned int i = 0; i < 8; i++) map.emplace(names[i], Value::Integer(i));
+            size += map.size();
+        }
+        return size;
+    };
+}
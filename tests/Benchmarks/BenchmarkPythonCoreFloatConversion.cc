@@ -0,0 +1,75 @@
+#include <catch2/catch.hpp>
+
+#include <FloatConversion.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+TEST_CASE( "Float parsing and formatting against the C library", "[!benchmark]" )
+{
+    /* Uniform bit patterns give 17 digit texts, money like values a few short ones. */
+    std::mt19937_64 random(11);
+    std::vector<double> values;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        auto bits = random() & ~(std::uint64_t(0x7ff) << 52) | (std::uint64_t(900 + random() % 250) << 52);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        values.push_back(value);
+    }
+
+    for (int i = 0; i < 1000; i++) values.push_back(static_cast<double>(random() % 1000000) / 100.0);
+
+    std::vector<std::wstring> wide;
+    std::vector<std::string> narrow;
+
+    for (auto value : values)
+    {
+        wide.push_back(FloatConversion::Repr(value));
+        narrow.push_back(std::string(wide.back().begin(), wide.back().end()));
+    }
+
+    BENCHMARK( "FloatConversion::Parse" )
+    {
+        double sum = 0.0, result;
+        for (auto &text : wide) if (FloatConversion::Parse(text, result)) sum += result;
+        return sum;
+    };
+
+    BENCHMARK( "strtod" )
+    {
+        double sum = 0.0;
+        for (auto &text : narrow) sum += std::strtod(text.c_str(), nullptr);
+        return sum;
+    };
+
+    BENCHMARK( "FloatConversion::Shortest" )
+    {
+        char digits[17];
+        int exponent, total = 0;
+        for (auto value : values) total += static_cast<int>( FloatConversion::Shortest(value, digits, exponent) );
+        return total;
+    };
+
+    BENCHMARK( "FloatConversion::Repr" )
+    {
+        std::size_t total = 0;
+        for (auto value : values) total += FloatConversion::Repr(value).size();
+        return total;
+    };
+
+    BENCHMARK( "snprintf %.17g" )
+    {
+        char buffer[32];
+        std::size_t total = 0;
+        for (auto value : values) total += static_cast<std::size_t>( std::snprintf(buffer, sizeof(buffer), "%.17g", value) );
+        return total;
+    };
+}
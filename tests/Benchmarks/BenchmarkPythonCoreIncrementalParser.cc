@@ -0,0 +1,56 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreIncrementalParser.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+TEST_CASE( "Incremental reparse of a large file", "[!benchmark]" )
+{
+    /* 5000 functions of four lines, 20000 lines in all. */
+    std::wstring text;
+
+    for (unsigned int i = 0; i < 5000; i++)
+        text += L"def f" + std::to_wstring(i) + L"(a, b):\n    c = a + b * " + std::to_wstring(i) + L"\n    return c\n\n";
+
+    auto source = std::make_shared<std::wstring>(text);
+    auto start = static_cast<unsigned int>(text.find(L"c = a + b * 2500"));
+
+    auto replaced = std::make_shared<std::wstring>(text);
+    (*replaced)[start + 4] = L'b';
+
+    auto inserted = std::make_shared<std::wstring>(text);
+    inserted->insert(start + 4, L"x");
+
+    PythonCoreIncrementalParser parser;
+
+    BENCHMARK( "Full parse" ) { return parser.Parse(source); };
+
+    /* Reparse consumes the previous tree, so each run applies the edit or undoes it on the
+       tree returned by the run before. */
+    BENCHMARK_ADVANCED( "Reparse one character replaced" )(Catch::Benchmark::Chronometer meter)
+    {
+        auto current = parser.Parse(source);
+        auto edited = false;
+
+        meter.measure([&] {
+            current = parser.Reparse(current, { start + 4, 1, 1 }, edited ? source : replaced);
+            edited = !edited;
+            return current;
+        });
+    };
+
+    BENCHMARK_ADVANCED( "Reparse one character inserted" )(Catch::Benchmark::Chronometer meter)
+    {
+        auto current = parser.Parse(source);
+        auto edited = false;
+
+        meter.measure([&] {
+            current = edited ?
+                parser.Reparse(current, { start + 4, 1, 0 }, source) :
+                parser.Reparse(current, { start + 4, 0, 1 }, inserted);
+            edited = !edited;
+            return current;
+        });
+    };
+}
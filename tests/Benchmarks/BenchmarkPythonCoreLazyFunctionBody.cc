@@ -0,0 +1,44 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+/* Module of many functions with non trivial bodies, as imported but rarely called. */
+static std::wstring Module(unsigned int functions)
+{
+    std::wstring text;
+
+    for (unsigned int i = 0; i < functions; i++)
+    {
+        auto n = std::to_wstring(i);
+
+        text += L"def f" + n + L"(a, b, *args, key=None):\n";
+        text += L"    if a > b and key is not None:\n";
+        text += L"        return [x * " + n + L" for x in args if x % 2 == 0]\n";
+        text += L"    for k, v in {'a': a, 'b': b}.items():\n";
+        text += L"        a = a + v * (k == 'a') - b // 3\n";
+        text += L"    return a\n\n";
+    }
+
+    return text;
+}
+
+static std::shared_ptr<AST::StatementNode> ParseSource(const std::wstring &text, bool lazy)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+    parser->SetLazyFunctionBodies(lazy);
+
+    return parser->ParseFileInput();
+}
+
+TEST_CASE( "Module with lazy function bodies", "[!benchmark]" )
+{
+    auto text = Module(2000);
+
+    BENCHMARK( "2000 functions eager" ) { return ParseSource(text, false); };
+    BENCHMARK( "2000 functions lazy" ) { return ParseSource(text, true); };
+}
@@ -0,0 +1,57 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+#include <ast/MappedCompactTree.h>
+
+#include <filesystem>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::wstring Module(unsigned int functions)
+{
+    std::wstring text;
+
+    for (unsigned int i = 0; i < functions; i++)
+    {
+        auto n = std::to_wstring(i);
+
+        text += L"def f" + n + L"(a, b, key=None):\n";
+        text += L"    if a > b and key is not None:\n";
+        text += L"        return [x * " + n + L" for x in b if x % 2 == 0]\n";
+        text += L"    return a + b * 1.5\n\n";
+    }
+
+    return text;
+}
+
+static std::shared_ptr<AST::StatementNode> ParseSource(std::shared_ptr<std::wstring> source)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( source );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+
+    return parser->ParseFileInput();
+}
+
+TEST_CASE( "Load saved tree against reparse", "[!benchmark]" )
+{
+    auto source = std::make_shared<std::wstring>( Module(2000) );
+    auto tree = CompactTree::FromNode( ParseSource(source), source );
+    auto path = ( std::filesystem::temp_directory_path() / "PythonCoreMappedTreeBenchmark.ast" ).string();
+
+    MappedCompactTree::Write(*tree, path);
+
+    BENCHMARK( "Reparse 10000 lines" ) { return ParseSource(source); };
+    BENCHMARK( "Open saved tree" ) { return MappedCompactTree::Open(path); };
+    BENCHMARK( "Open saved tree and visit every node" )
+    {
+        auto mapped = MappedCompactTree::Open(path);
+        unsigned int sum = 0;
+        for (unsigned int i = 0; i < mapped->NodeCount(); i++) sum += mapped->GetEnd(i);
+        return sum;
+    };
+
+    std::filesystem::remove(path);
+}
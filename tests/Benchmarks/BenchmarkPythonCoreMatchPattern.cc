@@ -0,0 +1,38 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+/* Every '(' is first tried as a group pattern and re-parsed as a sequence pattern
+   when the trailing ',' is found, so without memo the work doubles per level. */
+static std::wstring NestedSequencePattern(unsigned int depth)
+{
+    std::wstring pattern = L"a";
+
+    for (unsigned int i = 0; i < depth; i++) pattern = L"(" + pattern + L",)";
+
+    return L"match x:\n    case " + pattern + L":\n        pass\n";
+}
+
+static std::shared_ptr<AST::StatementNode> ParseSource(std::wstring text, bool memo)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+    parser->SetPatternMemo(memo);
+
+    return parser->ParseFileInput();
+}
+
+TEST_CASE( "Nested match patterns", "[!benchmark]" )
+{
+    auto shallow = NestedSequencePattern(8);
+    auto deep = NestedSequencePattern(16);
+
+    BENCHMARK( "Depth 8 without memo" ) { return ParseSource(shallow, false); };
+    BENCHMARK( "Depth 8 with memo" ) { return ParseSource(shallow, true); };
+    BENCHMARK( "Depth 16 without memo" ) { return ParseSource(deep, false); };
+    BENCHMARK( "Depth 16 with memo" ) { return ParseSource(deep, true); };
+}
@@ -0,0 +1,47 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParseCache.h>
+
+#include <filesystem>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+static std::shared_ptr<std::wstring> Module(unsigned int functions)
+{
+    auto text = std::make_shared<std::wstring>();
+
+    for (unsigned int i = 0; i < functions; i++)
+    {
+        auto n = std::to_wstring(i);
+
+        *text += L"def f" + n + L"(a, b, key=None):\n";
+        *text += L"    if a > b and key is not None:\n";
+        *text += L"        return [x * " + n + L" for x in b if x % 2 == 0]\n";
+        *text += L"    return a + b * 1.5\n\n";
+    }
+
+    return text;
+}
+
+TEST_CASE( "Parse cache hits against parsing", "[!benchmark]" )
+{
+    auto source = Module(2000);
+    auto directory = ( std::filesystem::temp_directory_path() / "PythonCoreParseCacheBenchmark" ).string();
+
+    std::filesystem::remove_all(directory);
+
+    PythonCoreParseCache cache(directory);
+    cache.Parse(source);
+
+    BENCHMARK( "Parse 10000 lines" )
+    {
+        auto sourceBuffer = std::make_shared<SourceBuffer>( source );
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+        return std::make_shared<PythonCoreParser>(lexer)->ParseFileInput();
+    };
+
+    BENCHMARK( "Cache hit 10000 lines" ) { return cache.Parse(source); };
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,54 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParseFiles.h>
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+/* Mixed size corpus, a few large modules and many small ones. */
+static std::vector<std::string> WriteBenchmarkCorpus()
+{
+    auto root = std::filesystem::temp_directory_path() / "PythonCoreParseFilesBenchmark";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+
+    std::vector<std::string> paths;
+
+    for (unsigned int i = 0; i < 256; i++)
+    {
+        auto path = (root / ("module" + std::to_string(i) + ".py")).string();
+        std::ofstream file(path, std::ios::binary);
+        auto functions = i % 16 == 0 ? 400 : 10 + i % 40;
+
+        for (unsigned int j = 0; j < functions; j++)
+        {
+            file << "def function" << j << "(a, b, *args, key=None, **kwargs):\n";
+            file << "    if a < b and key is not None:\n";
+            file << "        return [x * 2 for x in args if x % 3 == 1]\n";
+            file << "    return {'a': a, 'b': b, 'sum': a + b * (j - 1)}\n\n";
+        }
+
+        paths.push_back(path);
+    }
+
+    return paths;
+}
+
+TEST_CASE( "Parse files", "[!benchmark]" )
+{
+    auto paths = WriteBenchmarkCorpus();
+    unsigned int count = 0;
+
+    ParseFilesOptions single;
+    single.mThreads = 1;
+
+    ParseFilesOptions all;
+    all.mThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    BENCHMARK( "One worker" ) { ParseFiles(paths, single, [&](ParseFileResult &result) { count++; }); return count; };
+    BENCHMARK( "One worker per hardware thread" ) { ParseFiles(paths, all, [&](ParseFileResult &result) { count++; }); return count; };
+}
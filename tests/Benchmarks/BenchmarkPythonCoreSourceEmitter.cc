@@ -0,0 +1,85 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+#include <ast/SourceEmitter.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<std::wstring> Module(unsigned int functions)
+{
+    auto text = std::make_shared<std::wstring>();
+
+    for (unsigned int i = 0; i < functions; i++)
+    {
+        auto n = std::to_wstring(i);
+
+        *text += L"# function " + n + L"\n";
+        *text += L"def f" + n + L"(a, b, *args, key=None):\n";
+        *text += L"    if a > b and key is not None:   # compare\n";
+        *text += L"        return [x * " + n + L" for x in args if x % 2 == 0]\n";
+        *text += L"    return {'a': a, 'b': b}.get(key, 'nothing')\n\n";
+    }
+
+    return text;
+}
+
+static std::shared_ptr<AST::StatementNode> ParseSource(std::shared_ptr<std::wstring> source)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( source );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+
+    return std::make_shared<PythonCoreParser>(lexer)->ParseFileInput();
+}
+
+TEST_CASE( "Emitting source from a tree", "[!benchmark]" )
+{
+    auto source = Module(5000);
+    auto root = ParseSource(source);
+    auto green = GreenNode::FromCompactTree( *CompactTree::FromNode(root, source) );
+
+    std::vector<wchar_t> buffer(1 << 16);
+    std::size_t total = 0;
+    auto sink = [&total](const wchar_t *text, std::size_t length) { total += text[length - 1] + length; };
+
+    /* Lower bound, the source copied through the same buffer. */
+    BENCHMARK( "Copying the source, 5000 functions" )
+    {
+        for (std::size_t i = 0; i < source->size(); i += buffer.size())
+        {
+            auto length = std::min(buffer.size(), source->size() - i);
+            std::memcpy(buffer.data(), source->data() + i, length * sizeof(wchar_t));
+            sink(buffer.data(), length);
+        }
+        return total;
+    };
+
+    BENCHMARK( "Emitting the tree, 5000 functions" )
+    {
+        SourceEmitter emitter(buffer.data(), buffer.size(), sink);
+        emitter.Emit(root, source);
+        return emitter.Flush();
+    };
+
+    auto file = std::static_pointer_cast<FileInputNode>(root);
+    auto last = std::make_shared<std::wstring>( L"def g(): pass\n" );
+
+    BENCHMARK( "Emitting the tree with one replacement, 5000 functions" )
+    {
+        SourceEmitter emitter(buffer.data(), buffer.size(), sink);
+        emitter.Replace(file->GetNodes()->back(), std::static_pointer_cast<FileInputNode>(ParseSource(last))->GetNodes()->front(), last);
+        emitter.Emit(root, source);
+        return emitter.Flush();
+    };
+
+    BENCHMARK( "Emitting the green tree, 5000 functions" )
+    {
+        SourceEmitter emitter(buffer.data(), buffer.size(), sink);
+        emitter.Emit(green);
+        return emitter.Flush();
+    };
+}
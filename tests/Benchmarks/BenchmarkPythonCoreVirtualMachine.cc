@@ -0,0 +1,355 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreVirtualMachine.h>
+#include <PythonCoreCompiler.h>
+
+using namespace PythonCoreNative::RunTime::VM;
+using namespace PythonCoreNative::RunTime::Compiler;
+
+
+/* Programs of the classic interpreter benchmarks, cut down to what the compiler
+   supports: no imports, square roots are powers. Each leaves its answer in result. */
+static const wchar_t *Fib = LR"(
+def fib(n):
+    if n < 2:
+        return n
+    return fib(n - 1) + fib(n - 2)
+
+result = fib(25)
+)";
+
+static const wchar_t *NBody = LR"(
+PI = 3.14159265358979323
+SOLAR_MASS = 4 * PI * PI
+DAYS_PER_YEAR = 365.24
+
+def body(x, y, z, vx, vy, vz, mass):
+    return [x, y, z, vx * DAYS_PER_YEAR, vy * DAYS_PER_YEAR, vz * DAYS_PER_YEAR, mass * SOLAR_MASS]
+
+bodies = [
+    body(0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0),
+    body(4.84143144246472090e+00, -1.16032004402742839e+00, -1.03622044471123109e-01,
+         1.66007664274403694e-03, 7.69901118419740425e-03, -6.90460016972063023e-05, 9.54791938424326609e-04),
+    body(8.34336671824457987e+00, 4.12479856412430479e+00, -4.03523417114321381e-01,
+         -2.76742510726862411e-03, 4.99852801234917238e-03, 2.30417297573763929e-05, 2.85885980666130812e-04),
+    body(1.28943695621391310e+01, -1.51111514016986312e+01, -2.23307578892655734e-01,
+         2.96460137564761618e-03, 2.37847173959480950e-03, -2.96589568540237556e-05, 4.36624404335156298e-05),
+    body(1.53796971148509165e+01, -2.59193146099879641e+01, 1.79258772950371181e-01,
+         2.68067772490389322e-03, 1.62824170038242295e-03, -9.51592254519715870e-05, 5.15138902046611451e-05)]
+
+def offset_momentum(bodies):
+    px = py = pz = 0.0
+    for b in bodies:
+        px += b[3] * b[6]
+        py += b[4] * b[6]
+        pz += b[5] * b[6]
+    sun = bodies[0]
+    sun[3] = -px / SOLAR_MASS
+    sun[4] = -py / SOLAR_MASS
+    sun[5] = -pz / SOLAR_MASS
+
+def energy(bodies):
+    e = 0.0
+    n = len(bodies)
+    for i in range(n):
+        b = bodies[i]
+        e += 0.5 * b[6] * (b[3] * b[3] + b[4] * b[4] + b[5] * b[5])
+        for j in range(i + 1, n):
+            c = bodies[j]
+            dx = b[0] - c[0]
+            dy = b[1] - c[1]
+            dz = b[2] - c[2]
+            e -= b[6] * c[6] / (dx * dx + dy * dy + dz * dz) ** 0.5
+    return e
+
+def advance(bodies, dt, steps):
+    n = len(bodies)
+    for step in range(steps):
+        for i in range(n):
+            b = bodies[i]
+            for j in range(i + 1, n):
+                c = bodies[j]
+                dx = b[0] - c[0]
+                dy = b[1] - c[1]
+                dz = b[2] - c[2]
+                d2 = dx * dx + dy * dy + dz * dz
+                mag = dt / (d2 * d2 ** 0.5)
+                bm = b[6] * mag
+                cm = c[6] * mag
+                b[3] -= dx * cm
+                b[4] -= dy * cm
+                b[5] -= dz * cm
+                c[3] += dx * bm
+                c[4] += dy * bm
+                c[5] += dz * bm
+        for b in bodies:
+            b[0] += dt * b[3]
+            b[1] += dt * b[4]
+            b[2] += dt * b[5]
+
+offset_momentum(bodies)
+before = energy(bodies)
+advance(bodies, 0.01, 1000)
+result = energy(bodies)
+)";
+
+static const wchar_t *SpectralNorm = LR"(
+def eval_a(i, j):
+    return 1.0 / ((i + j) * (i + j + 1) // 2 + i + 1)
+
+def times(u, transpose):
+    n = len(u)
+    result = []
+    for i in range(n):
+        s = 0.0
+        for j in range(n):
+            if transpose:
+                s += eval_a(j, i) * u[j]
+            else:
+                s += eval_a(i, j) * u[j]
+        result.append(s)
+    return result
+
+def times_transposed(u):
+    return times(times(u, False), True)
+
+def spectral_norm(n):
+    u = [1.0] * n
+    for i in range(10):
+        v = times_transposed(u)
+        u = times_transposed(v)
+    vbv = 0.0
+    vv = 0.0
+    for i in range(n):
+        vbv += u[i] * v[i]
+        vv += v[i] * v[i]
+    return (vbv / vv) ** 0.5
+
+result = spectral_norm(50)
+)";
+
+static const wchar_t *Richards = LR"(
+I_IDLE = 0
+I_WORK = 1
+I_HANDLERA = 2
+I_HANDLERB = 3
+I_DEVA = 4
+I_DEVB = 5
+K_DEV = 1000
+K_WORK = 1001
+BUFSIZE = 4
+
+class Packet:
+    def __init__(self, link, ident, kind):
+        self.link = link
+        self.ident = ident
+        self.kind = kind
+        self.datum = 0
+        self.data = [0] * BUFSIZE
+
+    def append_to(self, lst):
+        self.link = None
+        if lst is None:
+            return self
+        p = lst
+        while p.link is not None:
+            p = p.link
+        p.link = self
+        return lst
+
+class Task:
+    def __init__(self, scheduler, ident, priority, wkq, pending, waiting):
+        self.scheduler = scheduler
+        self.ident = ident
+        self.priority = priority
+        self.wkq = wkq
+        self.pending = pending
+        self.waiting = waiting
+        self.held = False
+        self.link = scheduler.tasks
+        scheduler.tasks = self
+        scheduler.table[ident] = self
+
+    def blocked(self):
+        return self.held or (not self.pending and self.waiting)
+
+    def add_packet(self, pkt, old):
+        if self.wkq is None:
+            self.wkq = pkt
+            self.pending = True
+            if self.priority > old.priority:
+                return self
+        else:
+            pkt.append_to(self.wkq)
+        return old
+
+    def step(self):
+        pkt = None
+        if self.pending and self.waiting and not self.held:
+            pkt = self.wkq
+            self.wkq = pkt.link
+            self.pending = self.wkq is not None
+            self.waiting = False
+        return self.run(pkt)
+
+    def wait(self):
+        self.waiting = True
+        return self
+
+    def release(self, ident):
+        t = self.scheduler.table[ident]
+        t.held = False
+        if t.priority > self.priority:
+            return t
+        return self
+
+    def hold(self):
+        self.scheduler.hold_count += 1
+        self.held = True
+        return self.link
+
+    def qpkt(self, pkt):
+        t = self.scheduler.table[pkt.ident]
+        self.scheduler.qpkt_count += 1
+        pkt.link = None
+        pkt.ident = self.ident
+        return t.add_packet(pkt, self)
+
+class IdleTask(Task):
+    def __init__(self, scheduler, ident, priority, count):
+        Task.__init__(self, scheduler, ident, priority, None, False, False)
+        self.control = 1
+        self.count = count
+
+    def run(self, pkt):
+        self.count -= 1
+        if self.count == 0:
+            return self.hold()
+        if self.control & 1 == 0:
+            self.control = self.control // 2
+            return self.release(I_DEVA)
+        self.control = self.control // 2 ^ 0xd008
+        return self.release(I_DEVB)
+
+class WorkTask(Task):
+    def __init__(self, scheduler, ident, priority, wkq):
+        Task.__init__(self, scheduler, ident, priority, wkq, True, True)
+        self.destination = I_HANDLERA
+        self.count = 0
+
+    def run(self, pkt):
+        if pkt is None:
+            return self.wait()
+        self.destination = I_HANDLERB if self.destination == I_HANDLERA else I_HANDLERA
+        pkt.ident = self.destination
+        pkt.datum = 0
+        for i in range(BUFSIZE):
+            self.count += 1
+            if self.count > 26:
+                self.count = 1
+            pkt.data[i] = 64 + self.count
+        return self.qpkt(pkt)
+
+class HandlerTask(Task):
+    def __init__(self, scheduler, ident, priority, wkq):
+        Task.__init__(self, scheduler, ident, priority, wkq, True, True)
+        self.work = None
+        self.device = None
+
+    def run(self, pkt):
+        if pkt is not None:
+            if pkt.kind == K_WORK:
+                self.work = pkt.append_to(self.work)
+            else:
+                self.device = pkt.append_to(self.device)
+        if self.work is not None:
+            work = self.work
+            count = work.datum
+            if count >= BUFSIZE:
+                self.work = work.link
+                return self.qpkt(work)
+            if self.device is not None:
+                dev = self.device
+                self.device = dev.link
+                dev.datum = work.data[count]
+                work.datum = count + 1
+                return self.qpkt(dev)
+        return self.wait()
+
+class DeviceTask(Task):
+    def __init__(self, scheduler, ident, priority):
+        Task.__init__(self, scheduler, ident, priority, None, False, True)
+        self.packet = None
+
+    def run(self, pkt):
+        if pkt is None:
+            if self.packet is None:
+                return self.wait()
+            pkt = self.packet
+            self.packet = None
+            return self.qpkt(pkt)
+        self.packet = pkt
+        return self.hold()
+
+class Scheduler:
+    def __init__(self):
+        self.tasks = None
+        self.table = [None] * 6
+        self.hold_count = 0
+        self.qpkt_count = 0
+
+    def schedule(self):
+        t = self.tasks
+        while t is not None:
+            if t.blocked():
+                t = t.link
+            else:
+                t = t.step()
+
+def richards(count):
+    s = Scheduler()
+    IdleTask(s, I_IDLE, 0, count)
+    wkq = Packet(None, 0, K_WORK)
+    wkq = Packet(wkq, 0, K_WORK)
+    WorkTask(s, I_WORK, 1000, wkq)
+    wkq = Packet(None, I_DEVA, K_DEV)
+    wkq = Packet(wkq, I_DEVA, K_DEV)
+    wkq = Packet(wkq, I_DEVA, K_DEV)
+    HandlerTask(s, I_HANDLERA, 2000, wkq)
+    wkq = Packet(None, I_DEVB, K_DEV)
+    wkq = Packet(wkq, I_DEVB, K_DEV)
+    wkq = Packet(wkq, I_DEVB, K_DEV)
+    HandlerTask(s, I_HANDLERB, 3000, wkq)
+    DeviceTask(s, I_DEVA, 4000)
+    DeviceTask(s, I_DEVB, 5000)
+    s.schedule()
+    return s.qpkt_count, s.hold_count
+
+result = richards(2000)
+)";
+
+/* Compiled once, every run starts with fresh globals. */
+static std::wstring RunProgram(std::shared_ptr<CodeObject> code)
+{
+    VirtualMachine vm;
+    vm.Run(code);
+    return vm.Repr( vm.GetGlobal(L"result") );
+}
+
+TEST_CASE( "Virtual machine programs", "[!benchmark]" )
+{
+    auto fib = PythonCoreCompiler::CompileSource( std::make_shared<std::wstring>(Fib) );
+    auto nbody = PythonCoreCompiler::CompileSource( std::make_shared<std::wstring>(NBody) );
+    auto spectralNorm = PythonCoreCompiler::CompileSource( std::make_shared<std::wstring>(SpectralNorm) );
+    auto richards = PythonCoreCompiler::CompileSource( std::make_shared<std::wstring>(Richards) );
+
+    REQUIRE( RunProgram(fib) == L"75025" );
+    REQUIRE( RunProgram(nbody) == L"-0.16908760523460614" );
+    REQUIRE( RunProgram(spectralNorm) == L"1.2741938369830932" );
+    REQUIRE( RunProgram(richards) == L"(4576, 1829)" );
+
+    BENCHMARK( "fib(25)" ) { return RunProgram(fib); };
+    BENCHMARK( "nbody 1000 steps" ) { return RunProgram(nbody); };
+    BENCHMARK( "spectral norm 50" ) { return RunProgram(spectralNorm); };
+    BENCHMARK( "richards 2000" ) { return RunProgram(richards); };
+}
@@ -0,0 +1,245 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreCompiler.h>
+
+#include <algorithm>
+
+using namespace PythonCoreNative::RunTime::Compiler;
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+static std::shared_ptr<CodeObject> Compile(std::wstring text)
+{
+    return PythonCoreCompiler::CompileSource( std::make_shared<std::wstring>( text ) );
+}
+
+/* First code object in the constant pool. */
+static std::shared_ptr<CodeObject> Inner(std::shared_ptr<CodeObject> code)
+{
+    for (auto &constant : code->GetConstants())
+        if (constant.mKind == ConstantKind::Code) return constant.mCode;
+
+    FAIL( "No code constant!" );
+    return nullptr;
+}
+
+static std::vector<OpCode> OpCodes(std::shared_ptr<CodeObject> code)
+{
+    std::vector<OpCode> ops;
+    auto &instructions = code->GetInstructions();
+
+    for (std::size_t pc = 0; pc < instructions.size(); pc++)
+    {
+        ops.push_back( GetOpCode(instructions[pc]) );
+        if (HasExtraWord(ops.back())) pc++;
+    }
+
+    return ops;
+}
+
+TEST_CASE( "Bytecode compiler", "Compiler" )
+{
+
+    SECTION( "Operands are read from the parameter registers" )
+    {
+        auto f = Inner( Compile( L"def f(a, b):\n    return a + b\n" ) );
+        auto &instructions = f->GetInstructions();
+
+        REQUIRE( f->GetArgCount() == 2 );
+        REQUIRE( f->GetRegisterCount() == 3 );
+        REQUIRE( OpCodes(f) == std::vector<OpCode> { OpCode::Add, OpCode::Return, OpCode::ReturnNone } );
+        REQUIRE( GetA(instructions[0]) == 2 );
+        REQUIRE( GetB(instructions[0]) == 0 );
+        REQUIRE( GetC(instructions[0]) == 1 );
+        REQUIRE( GetA(instructions[1]) == 2 );
+    }
+
+    SECTION( "Assignment to a local writes its register" )
+    {
+        auto f = Inner( Compile( L"def f(a):\n    b = a * 2\n    return b\n" ) );
+        auto &instructions = f->GetInstructions();
+
+        REQUIRE( OpCodes(f) == std::vector<OpCode> { OpCode::LoadInt, OpCode::Multiply, OpCode::Return, OpCode::ReturnNone } );
+        REQUIRE( GetA(instructions[1]) == 1 );
+        REQUIRE( GetA(instructions[2]) == 1 );
+    }
+
+    SECTION( "Constants and names are pooled once" )
+    {
+        auto code = Compile( L"x = 'a'\ny = 'a'\nz = y + 1.5 + 1.5 + 100000\nx = y\n" );
+
+        REQUIRE( code->GetConstants().size() == 3 );
+        REQUIRE( code->GetConstants()[0].mText == L"a" );
+        REQUIRE( code->GetConstants()[1].mReal == 1.5 );
+        REQUIRE( code->GetConstants()[2].mInteger == 100000 );
+        REQUIRE( code->GetNames() == std::vector<std::wstring> { L"x", L"y", L"z" } );
+    }
+
+    SECTION( "Literals are decoded" )
+    {
+        auto code = Compile( L"a = 'x\\ty' 'z'\nb = r'\\n'\nc = 0x_ff\nd = 99999999999999999999\ne = 2j\n" );
+        auto &constants = code->GetConstants();
+
+        REQUIRE( constants[0].mText == L"x\tyz" );
+        REQUIRE( constants[1].mText == L"\\n" );
+        REQUIRE( GetsBx(code->GetInstructions()[4]) == 255 );
+        REQUIRE( constants[2].mKind == ConstantKind::BigInteger );
+        REQUIRE( constants[2].mText == L"99999999999999999999" );
+        REQUIRE( constants[3].mKind == ConstantKind::Imaginary );
+        REQUIRE( constants[3].mReal == 2.0 );
+    }
+
+    SECTION( "Constant expressions are folded" )
+    {
+        auto f = Inner( Compile( L"def f(a):\n    b = 60 * 60 * 24\n    while not False:\n        return (b, 'x' * 2, -1)\n" ) );
+        auto &instructions = f->GetInstructions();
+
+        REQUIRE( OpCodes(f) == std::vector<OpCode> {
+            OpCode::LoadConst, OpCode::Move, OpCode::LoadConst, OpCode::LoadInt, OpCode::BuildTuple, OpCode::Return, OpCode::Jump, OpCode::ReturnNone } );
+        REQUIRE( f->GetConstants()[0].mInteger == 86400 );
+        REQUIRE( f->GetConstants()[1].mText == L"xx" );
+        REQUIRE( GetsBx(instructions[3]) == -1 );
+    }
+
+    SECTION( "Loops jump back and break past the else" )
+    {
+        auto f = Inner( Compile( L"def f(n):\n    while n:\n        if n == 3:\n            break\n        n -= 1\n    else:\n        n = 7\n    return n\n" ) );
+        auto &instructions = f->GetInstructions();
+
+        REQUIRE( OpCodes(f) == std::vector<OpCode> {
+            OpCode::JumpIfFalse, OpCode::LoadInt, OpCode::Equal, OpCode::JumpIfFalse, OpCode::Jump,
+            OpCode::LoadInt, OpCode::InPlaceSubtract, OpCode::Jump, OpCode::LoadInt, OpCode::Return, OpCode::ReturnNone } );
+
+        REQUIRE( 0 + 1 + GetsBx(instructions[0]) == 8 );
+        REQUIRE( 3 + 1 + GetsBx(instructions[3]) == 5 );
+        REQUIRE( 4 + 1 + GetsAx(instructions[4]) == 9 );
+        REQUIRE( 7 + 1 + GetsAx(instructions[7]) == 0 );
+    }
+
+    SECTION( "For loops bind a local target directly" )
+    {
+        auto f = Inner( Compile( L"def f(a):\n    for i in a:\n        pass\n" ) );
+        auto &instructions = f->GetInstructions();
+
+        REQUIRE( OpCodes(f) == std::vector<OpCode> { OpCode::GetIter, OpCode::ForIter, OpCode::Jump, OpCode::ReturnNone } );
+        REQUIRE( GetA(instructions[1]) == 1 );
+        REQUIRE( 1 + 2 + static_cast<std::int32_t>(instructions[2]) == 4 );
+    }
+
+    SECTION( "Closures capture cells of the creating frame" )
+    {
+        auto f = Inner( Compile( L"def f(x):\n    y = 1\n    def g():\n        return x + y\n    return g\n" ) );
+        auto g = Inner(f);
+
+        REQUIRE( f->GetCellSlots() == std::vector<unsigned int> { 0, 2 } );
+        REQUIRE( g->GetFreeSources() == std::vector<unsigned int> { 0, 2 } );
+        REQUIRE( g->GetFreeSlot() == 0 );
+        REQUIRE( OpCodes(g) == std::vector<OpCode> { OpCode::LoadCell, OpCode::LoadCell, OpCode::Add, OpCode::Return, OpCode::ReturnNone } );
+    }
+
+    SECTION( "Comprehensions get the iterator of their first iterable" )
+    {
+        auto code = Compile( L"x = [i * 2 for i in y]\n" );
+        auto comprehension = Inner(code);
+
+        REQUIRE( OpCodes(code) == std::vector<OpCode> {
+            OpCode::LoadGlobal, OpCode::GetIter, OpCode::MakeFunction, OpCode::Call, OpCode::StoreGlobal, OpCode::ReturnNone } );
+        REQUIRE( comprehension->GetArgCount() == 1 );
+        REQUIRE( OpCodes(comprehension) == std::vector<OpCode> {
+            OpCode::BuildList, OpCode::ForIter, OpCode::LoadInt, OpCode::Multiply, OpCode::ListAppend, OpCode::Jump, OpCode::Return } );
+    }
+
+    SECTION( "Class bodies use the namespace" )
+    {
+        auto code = Compile( L"class A(B):\n    x = 1\n    y = x\n" );
+        auto body = Inner(code);
+
+        REQUIRE( OpCodes(code) == std::vector<OpCode> {
+            OpCode::LoadGlobal, OpCode::MakeFunction, OpCode::MakeClass, OpCode::StoreGlobal, OpCode::ReturnNone } );
+        REQUIRE( OpCodes(body) == std::vector<OpCode> {
+            OpCode::LoadInt, OpCode::StoreName, OpCode::LoadName, OpCode::StoreName, OpCode::ReturnNone } );
+    }
+
+    SECTION( "Line table maps instructions to lines" )
+    {
+        auto f = Inner( Compile( L"def f(a):\n    b = a\n\n    # comment\n    c = b + 1\n    return c\n" ) );
+
+        REQUIRE( f->GetFirstLine() == 2 );
+        REQUIRE( f->GetLine(0) == 2 );
+        REQUIRE( f->GetLine(1) == 5 );
+        REQUIRE( f->GetLine(2) == 5 );
+        REQUIRE( f->GetLine(3) == 6 );
+    }
+
+    SECTION( "Match cases share their type and length tests" )
+    {
+        auto ops = OpCodes( Compile( L"match v:\n    case [1, x]:\n        pass\n    case [2, y] if y:\n        pass\n    case {'a': 1} | {'a': 2}:\n        pass\n" ) );
+
+        REQUIRE( std::count(ops.begin(), ops.end(), OpCode::MatchSequence) == 1 );
+        REQUIRE( std::count(ops.begin(), ops.end(), OpCode::GetLength) == 1 );
+        REQUIRE( std::count(ops.begin(), ops.end(), OpCode::MatchMapping) == 1 );
+        REQUIRE( std::count(ops.begin(), ops.end(), OpCode::GetKey) == 1 );
+
+        REQUIRE_THROWS_AS( Compile( L"match v:\n    case x:\n        pass\n    case 1:\n        pass\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( Compile( L"match v:\n    case [*a, *b]:\n        pass\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( Compile( L"match v:\n    case {1: _, 1: _}:\n        pass\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( Compile( L"match v:\n    case [a] | [1]:\n        pass\n" ), std::shared_ptr<SyntaxError> );
+    }
+
+    SECTION( "Long chains and displays need few registers" )
+    {
+        std::wstring chain = L"a", list, dict;
+
+        for (int i = 1; i < 1000; i++) chain += L" + a";
+
+        for (int i = 0; i < 1000; i++)
+        {
+            list += std::to_wstring(i) + L", ";
+            dict += std::to_wstring(i) + L": a, ";
+        }
+
+        auto f = Inner( Compile( L"def f(a):\n    return " + chain + L"\n" ) );
+        REQUIRE( f->GetRegisterCount() == 2 );
+        REQUIRE( Compile( chain + L"\n" )->GetRegisterCount() == 2 );
+
+        auto g = Inner( Compile( L"def g(a):\n    return [" + list + L"], (" + list + L"), {" + dict + L"}\n" ) );
+        REQUIRE( g->GetRegisterCount() <= 2 + DisplayChunk + 3 );
+
+        auto ops = OpCodes(g);
+        REQUIRE( std::count(ops.begin(), ops.end(), OpCode::ListExtend) == 2 * (1000 / DisplayChunk) );
+        REQUIRE( std::count(ops.begin(), ops.end(), OpCode::DictUpdate) == 1000 / (DisplayChunk / 2) );
+        REQUIRE( std::count(ops.begin(), ops.end(), OpCode::ListToTuple) == 1 );
+    }
+
+    SECTION( "Unsupported statements are syntax errors" )
+    {
+        REQUIRE_THROWS_AS( Compile( L"import os\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( Compile( L"try:\n    pass\nfinally:\n    pass\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( Compile( L"f(*a)\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( Compile( L"return 1\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( Compile( L"print(b'a' == 'a')\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( Compile( L"x = rb'\\xff' * 2\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( Compile( L"match v:\n    case b'a':\n        pass\n" ), std::shared_ptr<SyntaxError> );
+    }
+
+    SECTION( "Functions needing more than 256 registers are reported where they start" )
+    {
+        std::wstring text = L"x = 1\ndef f():\n";
+        for (int i = 0; i < 300; i++) text += L"    a" + std::to_wstring(i) + L" = " + std::to_wstring(i) + L"\n";
+
+        auto source = std::make_shared<std::wstring>( text );
+        auto parser = std::make_shared<PythonCoreParser>( std::make_shared<PythonCoreTokenizer>( 4, std::make_shared<SourceBuffer>( source ) ) );
+        auto def = std::static_pointer_cast<AST::FileInputNode>( parser->ParseFileInput() )->GetNodes()->back();
+
+        try
+        {
+            Compile( text );
+            FAIL( "Compiled!" );
+        }
+        catch (std::shared_ptr<SyntaxError> error)
+        {
+            REQUIRE( *error->GetMessage() == L"Too many registers needed in function!" );
+            REQUIRE( error->GetPosition() == def->GetStart() );
+        }
+    }
+}
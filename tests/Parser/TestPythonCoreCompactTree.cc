@@ -0,0 +1,96 @@
+
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+#include <ast/CompactTree.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<NameToken> MakeName(unsigned int start, unsigned int end, const wchar_t *text)
+{
+    return std::make_shared<NameToken>(start, end, std::make_shared<std::wstring>(text), std::make_shared<std::vector<std::shared_ptr<Trivia>>>());
+}
+
+static std::shared_ptr<CompactTree> CompactSource(std::shared_ptr<std::wstring> source)
+{
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, std::make_shared<SourceBuffer>(source));
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+
+    return CompactTree::FromNode( parser->ParseFileInput(), source );
+}
+
+TEST_CASE( "Compact tree", "CompactTree" )
+{
+
+    SECTION( "Convert 'a + b' into compact tree" )
+    {
+        auto source = std::make_shared<std::wstring>( L"a + b" );
+        auto left = std::make_shared<AtomNameNode>(0, 1, MakeName(0, 1, L"a"));
+        auto op = std::make_shared<Token>(2, 3, TokenKind::PyPlus, std::make_shared<std::vector<std::shared_ptr<Trivia>>>());
+        auto right = std::make_shared<AtomNameNode>(4, 5, MakeName(4, 5, L"b"));
+        auto root = std::make_shared<PlusNode>(0, 5, left, op, right);
+
+        auto tree = CompactTree::FromNode(root, source);
+
+        REQUIRE( tree->NodeCount() == 3 );
+        REQUIRE( tree->TokenCount() == 3 );
+        REQUIRE( tree->GetNode(tree->Root()).mKind == NodeKind::Plus );
+        REQUIRE( tree->GetChildCount(tree->Root()) == 2 );
+        REQUIRE( tree->GetStart(tree->Root()) == 0 );
+        REQUIRE( tree->GetEnd(tree->Root()) == 5 );
+
+        auto first = tree->GetFirstChild(tree->Root());
+        auto second = tree->GetNextSibling(first);
+        REQUIRE( tree->GetNode(first).mKind == NodeKind::AtomName );
+        REQUIRE( tree->GetNextSibling(second) == CompactTree::NoIndex );
+        REQUIRE( tree->GetTokenText(tree->GetNode(second).mFirstToken) == L"b" );
+        REQUIRE( tree->GetToken(1).mKind == TokenKind::PyPlus );
+        REQUIRE( tree->MemoryUsage() < tree->SourceMemoryUsage() );
+    }
+
+    SECTION( "Separators are interleaved with items" )
+    {
+        auto source = std::make_shared<std::wstring>( L"a, b" );
+        auto nodes = std::make_shared<std::vector<std::shared_ptr<ExpressionNode>>>();
+        auto separators = std::make_shared<std::vector<std::shared_ptr<Token>>>();
+        nodes->push_back(std::make_shared<AtomNameNode>(0, 1, MakeName(0, 1, L"a")));
+        nodes->push_back(std::make_shared<AtomNameNode>(3, 4, MakeName(3, 4, L"b")));
+        separators->push_back(std::make_shared<Token>(1, 2, TokenKind::PyComma, std::make_shared<std::vector<std::shared_ptr<Trivia>>>()));
+        auto root = std::make_shared<TestListNode>(0, 4, nodes, separators);
+
+        auto tree = CompactTree::FromNode(root, source);
+
+        REQUIRE( tree->TokenCount() == 3 );
+        REQUIRE( tree->GetToken(0).mKind == TokenKind::Name );
+        REQUIRE( tree->GetToken(1).mKind == TokenKind::PyComma );
+        REQUIRE( tree->GetToken(2).mKind == TokenKind::Name );
+    }
+
+    SECTION( "Parsed modules shrink at least fourfold" )
+    {
+        std::wstring text;
+        for (int i = 0; i < 200; i++)
+            text += L"def f" + std::to_wstring(i) + L"(a, b=1, *c):\n    if a > b and not c:\n        x = [a, b, 'text', 3.5]\n        return x[0] + f(a)\n    return {'k': a}\n";
+
+        auto small = CompactSource( std::make_shared<std::wstring>( L"def f(a, b):\n    return a + b * 2\nx = f(1, 2)\n" ) );
+        auto large = CompactSource( std::make_shared<std::wstring>( text ) );
+
+        /* Both sides count their token text, the pointer tree as copies and the
+           compact tree as the source it slices from. Both modules reach about 6x. */
+        REQUIRE( small->MemoryUsage() * 4 <= small->SourceMemoryUsage() );
+        REQUIRE( large->MemoryUsage() * 5 <= large->SourceMemoryUsage() );
+    }
+
+    SECTION( "Long chains convert without deep recursion" )
+    {
+        std::wstring text = L"x = a";
+        for (int i = 0; i < 100000; i++) text += L" + a";
+
+        auto tree = CompactSource( std::make_shared<std::wstring>( text + L"\n" ) );
+
+        REQUIRE( tree->TokenCount() == 200005 );
+        REQUIRE( tree->GetTokenText(200002) == L"a" );
+    }
+}
@@ -0,0 +1,109 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+#include <ast/ConstantFolder.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+/* Expression of the text with the folder of its tree. */
+static std::shared_ptr<ConstantFolder> FoldExpression(std::wstring text, std::shared_ptr<ExpressionNode> &node)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+
+    auto root = parser->ParseEvalInput();
+    node = std::static_pointer_cast<EvalInputNode>(root)->GetRight();
+    return ConstantFolder::Fold(root);
+}
+
+static const FoldedValue * Folded(std::wstring text)
+{
+    static std::shared_ptr<ConstantFolder> folder;
+    std::shared_ptr<ExpressionNode> node;
+
+    folder = FoldExpression(text, node);
+    return folder->GetValue(node.get());
+}
+
+TEST_CASE( "Constant folder", "Parser" )
+{
+
+    SECTION( "Arithmetic folds into a literal over the span of the expression" )
+    {
+        std::shared_ptr<ExpressionNode> node;
+        auto folder = FoldExpression( L"60 * 60 * 24\n", node );
+        auto literal = folder->Resolve(node);
+
+        REQUIRE( literal != node );
+        REQUIRE( literal->GetKind() == NodeKind::AtomNumber );
+        REQUIRE( *std::static_pointer_cast<AtomNumberNode>(literal)->GetNumberText()->GetText() == L"86400" );
+        REQUIRE( literal->GetStart() == node->GetStart() );
+        REQUIRE( literal->GetEnd() == node->GetEnd() );
+        REQUIRE( folder->GetFoldedCount() == 2 );
+    }
+
+    SECTION( "Python semantics of the operators" )
+    {
+        REQUIRE( Folded( L"-1\n" )->mInteger == -1 );
+        REQUIRE( Folded( L"2 ** 10\n" )->mInteger == 1024 );
+        REQUIRE( Folded( L"7 // -2\n" )->mInteger == -4 );
+        REQUIRE( Folded( L"7 % -3\n" )->mInteger == -2 );
+        REQUIRE( Folded( L"-7.5 // 2\n" )->mReal == -4.0 );
+        REQUIRE( Folded( L"1 / 4\n" )->mReal == 0.25 );
+        REQUIRE( Folded( L"2 ** -1\n" )->mReal == 0.5 );
+        REQUIRE( Folded( L"(1 + 2) * 0x10 - ~0\n" )->mInteger == 49 );
+        REQUIRE( Folded( L"True + True\n" )->mKind == FoldedKind::Integer );
+        REQUIRE( Folded( L"True & False\n" )->mKind == FoldedKind::Bool );
+        REQUIRE( Folded( L"not True\n" )->mKind == FoldedKind::Bool );
+        REQUIRE( Folded( L"not 0.0\n" )->mInteger == 1 );
+        REQUIRE( Folded( L"not ''\n" )->mInteger == 1 );
+    }
+
+    SECTION( "Strings concatenate their tokens" )
+    {
+        auto value = Folded( L"'a' 'b' + 'c' * 2\n" );
+
+        REQUIRE( value->mKind == FoldedKind::String );
+        REQUIRE( value->mTokens.size() == 4 );
+        REQUIRE( value->mLength == 4 );
+        REQUIRE( Folded( L"'x' * -1\n" )->mTokens.empty() );
+        REQUIRE( Folded( L"f'{x}' + 'y'\n" ) == nullptr );
+    }
+
+    SECTION( "Operations that raise or grow too large are left for run time" )
+    {
+        REQUIRE( Folded( L"1 / 0\n" ) == nullptr );
+        REQUIRE( Folded( L"1 % 0.0\n" ) == nullptr );
+        REQUIRE( Folded( L"1 << -1\n" ) == nullptr );
+        REQUIRE( Folded( L"2 ** 100\n" ) == nullptr );
+        REQUIRE( Folded( L"1 << 63\n" ) == nullptr );
+        REQUIRE( Folded( L"99999999999999999999 + 1\n" ) == nullptr );
+        REQUIRE( Folded( L"'a' * 10000\n" ) == nullptr );
+        REQUIRE( Folded( L"(-8) ** 0.5\n" ) == nullptr );
+        REQUIRE( Folded( L"2.0 ** 10000\n" ) == nullptr );
+        REQUIRE( Folded( L"1e308 * 10\n" ) == nullptr );
+        REQUIRE( Folded( L"-1e400\n" ) == nullptr );
+        REQUIRE( Folded( L"1j + 1\n" ) == nullptr );
+        REQUIRE( Folded( L"'a' - 'b'\n" ) == nullptr );
+    }
+
+    SECTION( "Constant conditions select an operand" )
+    {
+        std::shared_ptr<ExpressionNode> node;
+
+        auto folder = FoldExpression( L"1 and x\n", node );
+        REQUIRE( folder->Resolve(node)->GetKind() == NodeKind::AtomName );
+        REQUIRE( folder->GetValue(node.get()) == nullptr );
+
+        folder = FoldExpression( L"x if 0 else 2 * 3\n", node );
+        REQUIRE( folder->GetValue(node.get())->mInteger == 6 );
+        REQUIRE( folder->Resolve(node)->GetStart() == node->GetStart() );
+
+        REQUIRE( Folded( L"0 or '' or None\n" )->mKind == FoldedKind::None );
+        REQUIRE( Folded( L"x and 1\n" ) == nullptr );
+        REQUIRE( Folded( L"x or 1\n" ) == nullptr );
+    }
+}
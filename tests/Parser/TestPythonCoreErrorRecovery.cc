@@ -0,0 +1,104 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+#include <ast/NodeVisitor.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<FileInputNode> ParseSource(std::wstring text, std::shared_ptr<PythonCoreParser> &parser)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    parser = std::make_shared<PythonCoreParser>(lexer);
+    parser->SetErrorRecovery(true);
+
+    return std::static_pointer_cast<FileInputNode>( parser->ParseFileInput() );
+}
+
+static std::vector<NodeKind> StatementKinds(std::shared_ptr<FileInputNode> root)
+{
+    std::vector<NodeKind> kinds;
+    for (auto &node : *root->GetNodes()) kinds.push_back(node->GetKind());
+    return kinds;
+}
+
+TEST_CASE( "Error recovery", "Parser" )
+{
+    std::shared_ptr<PythonCoreParser> parser;
+
+    SECTION( "Valid source has no diagnostics" )
+    {
+        auto root = ParseSource( L"x = 1\ndef f():\n    return x\n", parser );
+
+        REQUIRE( parser->GetDiagnostics().empty() );
+        REQUIRE( StatementKinds(root) == std::vector<NodeKind> { NodeKind::SimpleStatement, NodeKind::FuncDefStatement } );
+    }
+
+    SECTION( "Every broken line is reported" )
+    {
+        auto root = ParseSource( L"x = = 1\ny = 2\nz = (1 +)\npass\n", parser );
+
+        REQUIRE( parser->GetDiagnostics().size() == 2 );
+        REQUIRE( StatementKinds(root) == std::vector<NodeKind> {
+                    NodeKind::ErrorStatement, NodeKind::SimpleStatement, NodeKind::ErrorStatement, NodeKind::SimpleStatement } );
+
+        auto error = std::static_pointer_cast<ErrorStatementNode>( root->GetNodes()->front() );
+        REQUIRE( error->GetNodes()->size() == 5 );
+        REQUIRE( error->GetNodes()->back()->GetSymbolKind() == TokenKind::Newline );
+    }
+
+    SECTION( "A broken from import is one error" )
+    {
+        auto root = ParseSource( L"from a import (\n", parser );
+
+        REQUIRE( parser->GetDiagnostics().size() == 1 );
+        REQUIRE( StatementKinds(root) == std::vector<NodeKind> { NodeKind::ErrorStatement } );
+
+        root = ParseSource( L"from . import x\nfrom ..a import\nimport b\n", parser );
+
+        REQUIRE( parser->GetDiagnostics().size() == 1 );
+        REQUIRE( StatementKinds(root) == std::vector<NodeKind> { NodeKind::SimpleStatement, NodeKind::ErrorStatement, NodeKind::SimpleStatement } );
+    }
+
+    SECTION( "Errors inside a block keep the enclosing statement" )
+    {
+        auto root = ParseSource( L"def f():\n    x = = 1\n    return 2\ny = 3\n", parser );
+
+        REQUIRE( parser->GetDiagnostics().size() == 1 );
+        REQUIRE( StatementKinds(root) == std::vector<NodeKind> { NodeKind::FuncDefStatement, NodeKind::SimpleStatement } );
+
+        auto body = std::static_pointer_cast<FuncBodySuiteStatementNode>( std::static_pointer_cast<FuncDefStatementNode>( root->GetNodes()->front() )->GetNext() );
+        REQUIRE( body->GetNodes()->size() == 2 );
+        REQUIRE( body->GetNodes()->front()->GetKind() == NodeKind::ErrorStatement );
+    }
+
+    SECTION( "A broken header skips its block" )
+    {
+        auto root = ParseSource( L"def f() -> :\n    return 1\n\nclass A:\n    pass\n", parser );
+
+        REQUIRE( parser->GetDiagnostics().size() == 1 );
+        REQUIRE( StatementKinds(root) == std::vector<NodeKind> { NodeKind::ErrorStatement, NodeKind::ClassStatement } );
+    }
+
+    SECTION( "Statement keywords resynchronize" )
+    {
+        auto root = ParseSource( L"x = (1,\ndef f(): pass\n", parser );
+
+        REQUIRE( parser->GetDiagnostics().size() >= 1 );
+        REQUIRE( root->GetNodes()->front()->GetKind() == NodeKind::ErrorStatement );
+        REQUIRE( std::static_pointer_cast<ErrorStatementNode>( root->GetNodes()->front() )->GetNodes()->back()->GetSymbolKind() == TokenKind::PyComma );
+    }
+
+    SECTION( "Lexical errors end the file" )
+    {
+        auto root = ParseSource( L"x = 1\ny = 0b12\nz = 3\n", parser );
+
+        REQUIRE( parser->GetDiagnostics().size() == 1 );
+        REQUIRE( parser->GetDiagnostics().front()->GetSymbol() == nullptr );
+        REQUIRE( root->GetNodes()->size() == 1 );
+        REQUIRE( root->GetEof()->GetSymbolKind() == TokenKind::EndOfFile );
+    }
+
+}
@@ -1,6 +1,314 @@
-
 #include <catch2/catch.hpp>
 
 #include <PythonCoreParser.h>
 
-using namespace PythonCoreNative::RunTime::Parser;
\ No newline at end of file
+#include <pthread.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<ExpressionNode> ParseExpression(std::wstring text, unsigned int maxDepth = PythonCoreParser::DefaultMaxDepth)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer, maxDepth);
+
+    auto root = std::static_pointer_cast<EvalInputNode>( parser->ParseEvalInput() );
+    return root->GetRight();
+}
+
+/* Parses the text with the default limit, for running on a thread of its own. */
+static void * ParseOnThread(void *argument)
+{
+    auto text = static_cast<std::pair<std::wstring, int> *>(argument);
+
+    try
+    {
+        ParseExpression(text->first);
+        text->second = 0;
+    }
+    catch (std::shared_ptr<SyntaxError> &)
+    {
+        text->second = 1;
+    }
+
+    return nullptr;
+}
+
+TEST_CASE( "Binary and unary operators", "Parser" )
+{
+
+    SECTION( "Term binds tighter than arith" )
+    {
+        auto node = ParseExpression( L"a + b * c\n" );
+
+        REQUIRE( node->GetKind() == NodeKind::Plus );
+        auto plus = std::static_pointer_cast<PlusNode>(node);
+        REQUIRE( plus->GetLeft()->GetKind() == NodeKind::AtomName );
+        REQUIRE( plus->GetRight()->GetKind() == NodeKind::Mul );
+        REQUIRE( plus->GetStart() == plus->GetLeft()->GetStart() );
+        REQUIRE( plus->GetEnd() == plus->GetRight()->GetEnd() );
+    }
+
+    SECTION( "Arith is left associative and keeps its operator" )
+    {
+        auto node = ParseExpression( L"a + b - c\n" );
+
+        REQUIRE( node->GetKind() == NodeKind::Minus );
+        auto minus = std::static_pointer_cast<MinusNode>(node);
+        REQUIRE( minus->GetLeft()->GetKind() == NodeKind::Plus );
+        REQUIRE( minus->GetRight()->GetKind() == NodeKind::AtomName );
+    }
+
+    SECTION( "Power is right associative" )
+    {
+        auto node = ParseExpression( L"a ** b ** c\n" );
+
+        REQUIRE( node->GetKind() == NodeKind::Power );
+        auto power = std::static_pointer_cast<PowerNode>(node);
+        REQUIRE( power->GetLeft()->GetKind() == NodeKind::AtomName );
+        REQUIRE( power->GetRight()->GetKind() == NodeKind::Power );
+    }
+
+    SECTION( "Unary minus applies to power" )
+    {
+        auto node = ParseExpression( L"-a ** -b\n" );
+
+        REQUIRE( node->GetKind() == NodeKind::UnaryMinus );
+        auto minus = std::static_pointer_cast<UnaryMinusNode>(node);
+        REQUIRE( minus->GetRight()->GetKind() == NodeKind::Power );
+        auto power = std::static_pointer_cast<PowerNode>(minus->GetRight());
+        REQUIRE( power->GetRight()->GetKind() == NodeKind::UnaryMinus );
+    }
+
+    SECTION( "Not binds looser than comparison and tighter than and" )
+    {
+        auto node = ParseExpression( L"not a < b and c or d\n" );
+
+        REQUIRE( node->GetKind() == NodeKind::OrTest );
+        auto orTest = std::static_pointer_cast<OrTestNode>(node);
+        REQUIRE( orTest->GetLeft()->GetKind() == NodeKind::AndTest );
+        auto andTest = std::static_pointer_cast<AndTestNode>(orTest->GetLeft());
+        REQUIRE( andTest->GetLeftNode()->GetKind() == NodeKind::NotTest );
+        auto notTest = std::static_pointer_cast<NotTestNode>(andTest->GetLeftNode());
+        REQUIRE( notTest->GetRight()->GetKind() == NodeKind::CompareLess );
+    }
+
+    SECTION( "Two token comparison operators" )
+    {
+        auto node = ParseExpression( L"a not in b is not c\n" );
+
+        REQUIRE( node->GetKind() == NodeKind::CompareIsNot );
+        auto isNot = std::static_pointer_cast<CompareIsNotNode>(node);
+        REQUIRE( isNot->GetLeft()->GetKind() == NodeKind::CompareNotIn );
+    }
+
+    SECTION( "Bitwise operators" )
+    {
+        auto node = ParseExpression( L"a | b ^ c & d << e\n" );
+
+        REQUIRE( node->GetKind() == NodeKind::BitOr );
+        auto bitOr = std::static_pointer_cast<BitOrNode>(node);
+        REQUIRE( bitOr->GetRight()->GetKind() == NodeKind::BitXor );
+        auto bitXor = std::static_pointer_cast<BitXorNode>(bitOr->GetRight());
+        REQUIRE( bitXor->GetRight()->GetKind() == NodeKind::BitAnd );
+        auto bitAnd = std::static_pointer_cast<BitAndNode>(bitXor->GetRight());
+        REQUIRE( bitAnd->GetRight()->GetKind() == NodeKind::ShiftLeft );
+    }
+
+    SECTION( "Missing 'in' after 'not'" )
+    {
+        REQUIRE_THROWS_AS( ParseExpression( L"a not b\n" ), std::shared_ptr<SyntaxError> );
+    }
+}
+
+TEST_CASE( "Nesting limits", "Parser" )
+{
+
+    SECTION( "Long unary and power chains do not exhaust the native stack" )
+    {
+        std::wstring text;
+        for (int i = 0; i < 5000; i++) text += L"-a ** ";
+        text += L"b\n";
+
+        auto node = ParseExpression( text, 20000 );
+        REQUIRE( node->GetKind() == NodeKind::UnaryMinus );
+    }
+
+    SECTION( "Conditional expression chain" )
+    {
+        auto node = ParseExpression( L"a if b else c if d else e\n" );
+
+        REQUIRE( node->GetKind() == NodeKind::Test );
+        auto test = std::static_pointer_cast<TestNode>(node);
+        REQUIRE( test->GetNext()->GetKind() == NodeKind::Test );
+    }
+
+    SECTION( "Nested brackets beyond the limit raise SyntaxError" )
+    {
+        std::wstring text = std::wstring(50, L'(') + L"a" + std::wstring(50, L')') + L"\n";
+
+        REQUIRE( ParseExpression( text, 50 * PythonCoreParser::DeepLevel + 1 )->GetKind() == NodeKind::AtomTuple );
+        REQUIRE_THROWS_AS( ParseExpression( text, 20 ), std::shared_ptr<SyntaxError> );
+    }
+
+    SECTION( "Nesting fails cleanly on a 256 KB thread stack" )
+    {
+        std::vector<std::pair<std::wstring, int>> texts;
+
+        std::vector<std::pair<std::wstring, std::wstring>> brackets { { L"(", L")" }, { L"[", L"]" }, { L"{1: ", L"}" },
+                                                                     { L"f(", L")" }, { L"a[", L"]" }, { L"(lambda: [", L"])" } };
+
+        for (auto &bracket : brackets)
+        {
+            std::wstring text;
+
+            for (int i = 0; i < 400; i++) text += bracket.first;
+            text += L"a";
+            for (int i = 0; i < 400; i++) text += bracket.second;
+
+            texts.push_back( { text + L"\n", -1 } );
+        }
+
+        for (auto &text : texts)
+        {
+            pthread_attr_t attributes;
+            pthread_t thread;
+
+            pthread_attr_init(&attributes);
+            pthread_attr_setstacksize(&attributes, 256 * 1024);
+            REQUIRE( pthread_create(&thread, &attributes, ParseOnThread, &text) == 0 );
+            pthread_join(thread, nullptr);
+            pthread_attr_destroy(&attributes);
+
+            REQUIRE( text.second == 1 );
+        }
+    }
+
+    SECTION( "Unary chain beyond the limit raises SyntaxError" )
+    {
+        REQUIRE_THROWS_AS( ParseExpression( std::wstring(500, L'-') + L"a\n" ), std::shared_ptr<SyntaxError> );
+    }
+}
+
+TEST_CASE( "Operator node classes", "Parser" )
+{
+
+    SECTION( "Arith and shift nodes follow their own operator" )
+    {
+        auto node = ParseExpression( L"a - b + c\n" );
+
+        REQUIRE( node->GetKind() == NodeKind::Plus );
+        REQUIRE( std::static_pointer_cast<PlusNode>(node)->GetLeft()->GetKind() == NodeKind::Minus );
+
+        node = ParseExpression( L"a >> b << c\n" );
+
+        REQUIRE( node->GetKind() == NodeKind::ShiftLeft );
+        auto left = std::static_pointer_cast<ShiftLeftNode>(node);
+        REQUIRE( left->GetLeft()->GetKind() == NodeKind::ShiftRight );
+        REQUIRE( left->GetOperator()->GetSymbolKind() == TokenKind::PyShiftLeft );
+
+        node = ParseExpression( L"a << b >> (c)\n" );
+
+        REQUIRE( node->GetKind() == NodeKind::ShiftRight );
+        REQUIRE( std::static_pointer_cast<ShiftRightNode>(node)->GetLeft()->GetKind() == NodeKind::ShiftLeft );
+    }
+
+    SECTION( "Star expressions take their '*'" )
+    {
+        auto node = ParseExpression( L"[*a, b]\n" );
+
+        REQUIRE( node->GetKind() == NodeKind::AtomList );
+        auto list = std::static_pointer_cast<TestListCompNode>( std::static_pointer_cast<AtomListNode>(node)->GetRight() );
+        REQUIRE( list->GetNodes()->size() == 2 );
+        REQUIRE( list->GetNodes()->front()->GetKind() == NodeKind::StarExpr );
+
+        auto star = std::static_pointer_cast<StarExprNode>( list->GetNodes()->front() );
+        REQUIRE( star->GetOperator()->GetSymbolKind() == TokenKind::PyMul );
+        REQUIRE( star->GetRight()->GetKind() == NodeKind::AtomName );
+    }
+
+    SECTION( "A dotted trailer needs a name" )
+    {
+        REQUIRE( ParseExpression( L"a.b.c\n" )->GetKind() == NodeKind::AtomExpr );
+        REQUIRE_THROWS_AS( ParseExpression( L"a.(b)\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( ParseExpression( L"a.\n" ), std::shared_ptr<SyntaxError> );
+    }
+}
+
+TEST_CASE( "Displays, calls and slices", "Parser" )
+{
+
+    SECTION( "Displays keep every item after a comma" )
+    {
+        auto list = std::static_pointer_cast<TestListCompNode>( std::static_pointer_cast<AtomListNode>( ParseExpression( L"[1,\n  2, 3,]\n" ) )->GetRight() );
+
+        REQUIRE( list->GetNodes()->size() == 3 );
+        REQUIRE( list->GetSeparators()->size() == 3 );
+
+        auto tuple = std::static_pointer_cast<TestListCompNode>( std::static_pointer_cast<AtomTupleNode>( ParseExpression( L"(a, *b, c)\n" ) )->GetRight() );
+
+        REQUIRE( tuple->GetNodes()->size() == 3 );
+        REQUIRE( tuple->GetNodes()->at(1)->GetKind() == NodeKind::StarExpr );
+    }
+
+    SECTION( "Calls take arguments, not parameters" )
+    {
+        auto expr = std::static_pointer_cast<AtomExprNode>( ParseExpression( L"f(1, *a, k=3, **kw)\n" ) );
+        auto call = std::static_pointer_cast<CallNode>( expr->GetRight()->front() );
+
+        REQUIRE( call->GetKind() == NodeKind::Call );
+        REQUIRE( call->GetRight()->GetKind() == NodeKind::ArgsList );
+
+        auto arguments = std::static_pointer_cast<ArgsListNode>( call->GetRight() )->GetNodes();
+
+        REQUIRE( arguments->size() == 4 );
+        REQUIRE( arguments->at(0)->GetKind() == NodeKind::AtomNumber );
+        REQUIRE( arguments->at(1)->GetKind() == NodeKind::Argument );
+        REQUIRE( arguments->at(2)->GetKind() == NodeKind::Argument );
+        REQUIRE( arguments->at(3)->GetKind() == NodeKind::Argument );
+
+        auto keyword = std::static_pointer_cast<ArgumentNode>( arguments->at(2) );
+        REQUIRE( keyword->GetOperator()->GetSymbolKind() == TokenKind::PyAssign );
+        REQUIRE( keyword->GetRight()->GetKind() == NodeKind::AtomNumber );
+
+        REQUIRE( ParseExpression( L"f(x for x in y)\n" )->GetKind() == NodeKind::AtomExpr );
+        REQUIRE( ParseExpression( L"f(g(a)[0], b.c)\n" )->GetKind() == NodeKind::AtomExpr );
+    }
+
+    SECTION( "Slices may omit any bound" )
+    {
+        auto slice = []( const wchar_t *text )
+        {
+            auto expr = std::static_pointer_cast<AtomExprNode>( ParseExpression( text ) );
+            auto index = std::static_pointer_cast<IndexNode>( expr->GetRight()->front() );
+            return std::static_pointer_cast<SubscriptNode>( index->GetRight() );
+        };
+
+        auto from = slice( L"a[1:]\n" );
+        REQUIRE( from->GetLeft() != nullptr );
+        REQUIRE( from->GetOperator1() != nullptr );
+        REQUIRE( from->GetRight() == nullptr );
+        REQUIRE( from->GetOperator2() == nullptr );
+
+        auto step = slice( L"a[::2]\n" );
+        REQUIRE( step->GetLeft() == nullptr );
+        REQUIRE( step->GetRight() == nullptr );
+        REQUIRE( step->GetOperator2() != nullptr );
+        REQUIRE( step->GetNext()->GetKind() == NodeKind::AtomNumber );
+
+        auto upto = slice( L"a[:3]\n" );
+        REQUIRE( upto->GetLeft() == nullptr );
+        REQUIRE( upto->GetRight()->GetKind() == NodeKind::AtomNumber );
+
+        auto all = slice( L"a[:]\n" );
+        REQUIRE( all->GetLeft() == nullptr );
+        REQUIRE( all->GetOperator1() != nullptr );
+        REQUIRE( all->GetRight() == nullptr );
+
+        auto expr = std::static_pointer_cast<AtomExprNode>( ParseExpression( L"a[1:, ::2]\n" ) );
+        auto index = std::static_pointer_cast<IndexNode>( expr->GetRight()->front() );
+        REQUIRE( index->GetRight()->GetKind() == NodeKind::SubscriptList );
+    }
+}
@@ -0,0 +1,96 @@
+#include <catch2/catch.hpp>
+
+#include <FloatConversion.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+static double Parse(const wchar_t *text)
+{
+    double result;
+    REQUIRE( FloatConversion::Parse(text, result) );
+    return result;
+}
+
+TEST_CASE( "Float conversion", "FloatConversion" )
+{
+
+    SECTION( "Repr as Python writes it" )
+    {
+        REQUIRE( FloatConversion::Repr(0.1 + 0.2) == L"0.30000000000000004" );
+        REQUIRE( FloatConversion::Repr(1e16) == L"1e+16" );
+        REQUIRE( FloatConversion::Repr(123456789012345680.0) == L"1.2345678901234568e+17" );
+        REQUIRE( FloatConversion::Repr(9999999999999998.0) == L"9999999999999998.0" );
+        REQUIRE( FloatConversion::Repr(0.0001) == L"0.0001" );
+        REQUIRE( FloatConversion::Repr(1e-5) == L"1e-05" );
+        REQUIRE( FloatConversion::Repr(-2.5) == L"-2.5" );
+        REQUIRE( FloatConversion::Repr(-0.0) == L"-0.0" );
+        REQUIRE( FloatConversion::Repr(5e-324) == L"5e-324" );
+        REQUIRE( FloatConversion::Repr(2.2250738585072014e-308) == L"2.2250738585072014e-308" );
+        REQUIRE( FloatConversion::Repr(1.7976931348623157e308) == L"1.7976931348623157e+308" );
+        REQUIRE( FloatConversion::Repr(-HUGE_VAL) == L"-inf" );
+        REQUIRE( FloatConversion::Repr(std::nan("")) == L"nan" );
+    }
+
+    SECTION( "Literals and float() text" )
+    {
+        REQUIRE( Parse(L"1_000.000_5") == 1000.0005 );
+        REQUIRE( Parse(L".5e-3") == 0.0005 );
+        REQUIRE( Parse(L"5.") == 5.0 );
+        REQUIRE( Parse(L"-1E1_0") == -1e10 );
+        REQUIRE( Parse(L"1e400") == HUGE_VAL );
+        REQUIRE( Parse(L"1e-400") == 0.0 );
+        REQUIRE( std::signbit(Parse(L"-0.0")) );
+        REQUIRE( Parse(L"-Infinity") == -HUGE_VAL );
+        REQUIRE( std::isnan(Parse(L"NaN")) );
+
+        double result;
+        REQUIRE( !FloatConversion::Parse(L"", result) );
+        REQUIRE( !FloatConversion::Parse(L".", result) );
+        REQUIRE( !FloatConversion::Parse(L"1e", result) );
+        REQUIRE( !FloatConversion::Parse(L"1__0", result) );
+        REQUIRE( !FloatConversion::Parse(L"_1", result) );
+        REQUIRE( !FloatConversion::Parse(L"1_.0", result) );
+        REQUIRE( !FloatConversion::Parse(L"1.0x", result) );
+    }
+
+    SECTION( "Halfway cases and long digits" )
+    {
+        /* 2**53 + 1 is halfway and goes to even, any digit further down rounds up. */
+        REQUIRE( Parse(L"9007199254740993") == 9007199254740992.0 );
+        REQUIRE( Parse(L"9007199254740993.0000000000000000001") == 9007199254740994.0 );
+        REQUIRE( Parse(L"9007199254740993.0000000000000000000") == 9007199254740992.0 );
+
+        REQUIRE( Parse(L"2.2250738585072011e-308") == 2.2250738585072011e-308 );
+        REQUIRE( Parse(L"4.9406564584124654e-324") == 5e-324 );
+        REQUIRE( Parse(L"2.4703282292062328e-324") == 5e-324 );
+        REQUIRE( Parse(L"2.4703282292062327e-324") == 0.0 );
+        REQUIRE( Parse(L"1.7976931348623158e308") == 1.7976931348623157e308 );
+        REQUIRE( Parse(L"1.7976931348623159e308") == HUGE_VAL );
+        REQUIRE( Parse(L"0.000000000000000000000000000000000000000000001234567890123456789012345") == 1.234567890123456789012345e-45 );
+    }
+
+    SECTION( "Round trips agree with strtod" )
+    {
+        std::mt19937_64 random(7);
+
+        for (int i = 0; i < 100000; i++)
+        {
+            auto bits = random();
+            double value, back;
+            std::memcpy(&value, &bits, sizeof(value));
+
+            if (std::isnan(value)) continue;
+
+            auto text = FloatConversion::Repr(value);
+            REQUIRE( FloatConversion::Parse(text, back) );
+            REQUIRE( std::memcmp(&value, &back, sizeof(value)) == 0 );
+            REQUIRE( std::strtod(std::string(text.begin(), text.end()).c_str(), nullptr) == value );
+        }
+    }
+}
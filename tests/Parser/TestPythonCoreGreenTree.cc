@@ -0,0 +1,121 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+#include <ast/GreenTree.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<const GreenNode> ParseGreen(std::wstring text)
+{
+    auto source = std::make_shared<std::wstring>( text );
+    auto sourceBuffer = std::make_shared<SourceBuffer>( source );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+
+    return GreenNode::FromCompactTree( *CompactTree::FromNode( parser->ParseFileInput(), source ) );
+}
+
+static std::wstring Text(std::shared_ptr<const GreenNode> green)
+{
+    std::wstring text;
+    green->WriteTo(text);
+    return text;
+}
+
+TEST_CASE( "Green and red trees", "Parser" )
+{
+
+    SECTION( "Green tree holds the full text" )
+    {
+        std::wstring sources[] = {
+            L"x = 1\n",
+            L"# head\n\nx  =  f(a, b)   # tail\n\n",
+            L"def f(a, b):\n    if a:\n\n        return b\n    return [1,\n  2]\n",
+            L"class A(B):\n\tpass\n",
+            L"x = 1 + \\\n    2\n# end",
+            L"y = 'text' if a else b[1:2]\n"
+        };
+
+        for (auto &source : sources)
+        {
+            auto green = ParseGreen(source);
+
+            REQUIRE( Text(green) == source );
+            REQUIRE( green->GetWidth() == source.size() );
+        }
+    }
+
+    SECTION( "Long chains build without deep recursion" )
+    {
+        std::wstring source = L"x = a";
+        for (int i = 0; i < 100000; i++) source += L" + a";
+        source += L"\n";
+
+        auto green = ParseGreen(source);
+
+        REQUIRE( green->GetWidth() == source.size() );
+        REQUIRE( RedNode::CreateRoot(green)->FindToken(200000).GetText() == L"a" );
+    }
+
+    SECTION( "Nodes without children have no token to find" )
+    {
+        auto empty = std::make_shared<const GreenNode>(NodeKind::FileInput, std::vector<GreenChild>());
+        auto outer = std::make_shared<const GreenNode>(NodeKind::FileInput, std::vector<GreenChild> { { empty, nullptr } });
+
+        REQUIRE( RedNode::CreateRoot(empty)->FindToken(0).IsMissing() );
+
+        auto token = RedNode::CreateRoot(outer)->FindToken(3);
+
+        REQUIRE( token.IsMissing() );
+        REQUIRE( token.GetParent()->GetGreen() == empty );
+        REQUIRE_FALSE( RedNode::CreateRoot( ParseGreen( L"x = 1\n" ) )->FindToken(0).IsMissing() );
+    }
+
+    SECTION( "Red nodes give positions and parents" )
+    {
+        std::wstring source = L"a = 1\nbb = 22\n";
+        auto root = RedNode::CreateRoot( ParseGreen(source) );
+
+        auto token = root->FindToken(12);
+
+        REQUIRE( token.GetKind() == TokenKind::Number );
+        REQUIRE( token.GetText() == L"22" );
+        REQUIRE( token.GetStart() == 11 );
+        REQUIRE( token.GetEnd() == 13 );
+        REQUIRE( token.GetFullStart() == 10 );
+
+        auto node = token.GetParent();
+        while (node->GetParent() != nullptr) node = node->GetParent();
+
+        REQUIRE( node->GetKind() == NodeKind::FileInput );
+        REQUIRE( node->GetFullEnd() == source.size() );
+        REQUIRE( root->FindToken(0).GetText() == L"a" );
+    }
+
+    SECTION( "Replacing a node shares the rest" )
+    {
+        auto green = ParseGreen( L"a = 1\nb = 2\n" );
+        auto root = RedNode::CreateRoot(green);
+        auto one = root->FindToken(4).GetParent();
+
+        REQUIRE( one->GetGreen()->GetWidth() == 2 );
+
+        auto replacement = ParseGreen( L"x = (3)\n" );
+        auto three = RedNode::CreateRoot(replacement)->FindToken(4).GetParent();
+
+        auto edited = one->ReplaceWith( three->GetGreen() );
+
+        REQUIRE( Text(edited->GetGreen()) == L"a = (3)\nb = 2\n" );
+        REQUIRE( Text(green) == L"a = 1\nb = 2\n" );
+        REQUIRE( edited->FindToken(8).GetText() == L"b" );
+
+        unsigned int shared = 0;
+        for (unsigned int i = 0; i < green->GetChildCount(); i++)
+            if (green->GetChild(i).mNode != nullptr && green->GetChild(i).mNode == edited->GetGreen()->GetChild(i).mNode) shared++;
+
+        REQUIRE( shared > 0 );
+    }
+
+}
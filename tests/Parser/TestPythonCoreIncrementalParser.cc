@@ -0,0 +1,136 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreIncrementalParser.h>
+#include <ast/NodeVisitor.h>
+
+#include <tuple>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+/* Kind and span of every node and token, in walk order. */
+class SpanList : public NodeWalker<SpanList>
+{
+    public:
+        bool Enter(std::shared_ptr<Node> node)
+        {
+            mSpans.emplace_back( static_cast<int>(node->GetKind()), node->GetStart(), node->GetEnd() );
+            return true;
+        }
+
+        void VisitToken(std::shared_ptr<Token> token)
+        {
+            mSpans.emplace_back( -1 - static_cast<int>(token->GetSymbolKind()), token->GetTokenStartPosition(), token->GetTokenEndPosition() );
+        }
+
+        std::vector<std::tuple<int, unsigned int, unsigned int>> mSpans;
+};
+
+static std::vector<std::tuple<int, unsigned int, unsigned int>> Spans(std::shared_ptr<ParsedFile> file)
+{
+    SpanList list;
+    list.Walk(file->GetRoot());
+    return list.mSpans;
+}
+
+static std::wstring Functions(unsigned int count)
+{
+    std::wstring text;
+
+    for (unsigned int i = 0; i < count; i++)
+        text += L"def f" + std::to_wstring(i) + L"(a, b):\n    return a + b * " + std::to_wstring(i) + L"\n\n";
+
+    return text;
+}
+
+/* Applies the edit both ways and requires the same tree. */
+static std::shared_ptr<ParsedFile> CheckEdit(std::wstring text, unsigned int start, unsigned int length, std::wstring replacement)
+{
+    PythonCoreIncrementalParser parser;
+
+    auto previous = parser.Parse( std::make_shared<std::wstring>( text ) );
+    auto edited = std::make_shared<std::wstring>( text.substr(0, start) + replacement + text.substr(start + length) );
+
+    auto incremental = parser.Reparse( previous, { start, length, static_cast<unsigned int>(replacement.size()) }, edited );
+    auto full = parser.Parse( edited );
+
+    REQUIRE( Spans(incremental) == Spans(full) );
+    REQUIRE( incremental->GetBoundaries() == full->GetBoundaries() );
+
+    return incremental;
+}
+
+TEST_CASE( "Incremental reparse", "Parser" )
+{
+    auto text = Functions(20);
+    auto middle = static_cast<unsigned int>(text.find(L"return a + b * 10"));
+
+    SECTION( "Same length edit reuses all but three statements" )
+    {
+        auto file = CheckEdit(text, middle + 7, 1, L"c");
+        REQUIRE( file->GetReusedStatements() == 17 );
+    }
+
+    SECTION( "Insert and delete shift the statements after the edit" )
+    {
+        REQUIRE( CheckEdit(text, middle + 7, 0, L"xyz")->GetReusedStatements() == 17 );
+        REQUIRE( CheckEdit(text, middle + 7, 5, L"")->GetReusedStatements() == 17 );
+    }
+
+    SECTION( "Edits at either end of the file" )
+    {
+        REQUIRE( CheckEdit(text, 4, 2, L"g")->GetReusedStatements() == 18 );
+        REQUIRE( CheckEdit(text, static_cast<unsigned int>(text.size()), 0, L"x = 1\n")->GetReusedStatements() == 19 );
+    }
+
+    SECTION( "New and removed statements" )
+    {
+        auto next = static_cast<unsigned int>(text.find(L"def f11"));
+
+        REQUIRE( CheckEdit(text, next, 0, L"import os\nx = 1\n")->GetRoot()->GetNodes()->size() == 22 );
+        REQUIRE( CheckEdit(text, next, static_cast<unsigned int>(text.find(L"def f12") - next), L"")->GetRoot()->GetNodes()->size() == 19 );
+    }
+
+    SECTION( "Reused statements move when asked for" )
+    {
+        PythonCoreIncrementalParser parser;
+
+        auto previous = parser.Parse( std::make_shared<std::wstring>( text ) );
+        auto once = std::make_shared<std::wstring>( text );
+        once->insert(middle + 7, L"xyz");
+        auto twice = std::make_shared<std::wstring>( *once );
+        twice->erase(5, 1);
+
+        auto first = parser.Reparse( previous, { middle + 7, 0, 3 }, once );
+        REQUIRE( previous->GetRoot() == nullptr );
+
+        auto start = parser.Parse( once )->GetStatement(15)->GetStart();
+        REQUIRE( first->GetStatement(15)->GetStart() == start );
+
+        auto second = parser.Reparse( first, { 5, 1, 0 }, twice );
+        auto full = parser.Parse( twice );
+
+        REQUIRE( second->GetStatement(15)->GetStart() == start - 1 );
+        REQUIRE( Spans(second) == Spans(full) );
+    }
+
+    SECTION( "An indented line joins the function before it" )
+    {
+        auto source = std::wstring(L"def f():\n    a = 1\nb = 2\nc = 3\n");
+        auto file = CheckEdit(source, static_cast<unsigned int>(source.find(L"b = 2")), 0, L"    ");
+        REQUIRE( file->GetRoot()->GetNodes()->size() == 2 );
+    }
+
+    SECTION( "Syntax errors are reported as by a full parse" )
+    {
+        PythonCoreIncrementalParser parser;
+
+        auto previous = parser.Parse( std::make_shared<std::wstring>( text ) );
+        auto edited = std::make_shared<std::wstring>( text );
+        edited->insert(middle, L"(");
+
+        REQUIRE_THROWS_AS( parser.Reparse( previous, { middle, 0, 1 }, edited ), std::shared_ptr<SyntaxError> );
+    }
+
+}
@@ -0,0 +1,155 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+#include <ast/NodeVisitor.h>
+
+#include <thread>
+#include <tuple>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+/* Kind and span of every node and token, in walk order. Walking forces lazy bodies. */
+class LazySpanList : public NodeWalker<LazySpanList>
+{
+    public:
+        bool Enter(std::shared_ptr<Node> node)
+        {
+            mSpans.emplace_back( static_cast<int>(node->GetKind()), node->GetStart(), node->GetEnd() );
+            return true;
+        }
+
+        void VisitToken(std::shared_ptr<Token> token)
+        {
+            mSpans.emplace_back( -1 - static_cast<int>(token->GetSymbolKind()), token->GetTokenStartPosition(), token->GetTokenEndPosition() );
+        }
+
+        std::vector<std::tuple<int, unsigned int, unsigned int>> mSpans;
+};
+
+/* Tokens met without parsing lazy bodies. */
+class SkimmingList : public NodeWalker<SkimmingList>
+{
+    public:
+        bool ForcesBodies() { return false; }
+        void VisitToken(std::shared_ptr<Token> token) { mTokens++; }
+
+        unsigned int mTokens = 0;
+};
+
+static std::shared_ptr<FileInputNode> ParseSource(std::wstring text, bool lazy)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+    parser->SetLazyFunctionBodies(lazy);
+
+    return std::static_pointer_cast<FileInputNode>( parser->ParseFileInput() );
+}
+
+static void CheckSameTree(std::wstring text)
+{
+    LazySpanList eager, lazy;
+    eager.Walk( ParseSource(text, false) );
+    lazy.Walk( ParseSource(text, true) );
+
+    REQUIRE( lazy.mSpans == eager.mSpans );
+}
+
+TEST_CASE( "Lazy function bodies", "Parser" )
+{
+
+    SECTION( "Same tree as eager parsing" )
+    {
+        CheckSameTree( L"def f(a, b):\n    return a + b\n" );
+        CheckSameTree( L"def f():\n    x = [1,\n  2]\n\n    # comment\n    return x\ny = 1\n" );
+        CheckSameTree( L"def f():\n    def g():\n        if x:\n            return 1\n    return g\n" );
+        CheckSameTree( L"class A:\n    @dec\n    def f(self):\n        pass\n    async def g(self):\n        await h()\n" );
+        CheckSameTree( L"def f(x):\n    match x:\n        case (1, 2):\n            return 0\n" );
+        CheckSameTree( L"def f(): return 1\n" );
+    }
+
+    SECTION( "Body is parsed on first access" )
+    {
+        auto root = ParseSource( L"def f():\n    x = = 1\ny = 2\n", true );
+        auto func = std::static_pointer_cast<FuncDefStatementNode>( root->GetNodes()->front() );
+
+        REQUIRE( root->GetNodes()->size() == 2 );
+        REQUIRE( func->IsNextParsed() == false );
+        REQUIRE_THROWS_AS( func->GetNext(), std::shared_ptr<SyntaxError> );
+
+        func = std::static_pointer_cast<FuncDefStatementNode>( ParseSource( L"def f():\n    return 1\n", true )->GetNodes()->front() );
+
+        REQUIRE( func->GetNext()->GetKind() == NodeKind::FuncBodySuiteStatement );
+        REQUIRE( func->IsNextParsed() );
+        REQUIRE( func->GetNext() == func->GetNext() );
+    }
+
+    SECTION( "Walkers may leave bodies unparsed" )
+    {
+        auto root = ParseSource( L"def f():\n    return 1\n", true );
+        auto func = std::static_pointer_cast<FuncDefStatementNode>( root->GetNodes()->front() );
+
+        SkimmingList skim;
+        skim.Walk( root );
+
+        REQUIRE( skim.mTokens == 6 );
+        REQUIRE( func->IsNextParsed() == false );
+
+        func->GetNext();
+        skim.mTokens = 0;
+        skim.Walk( root );
+
+        REQUIRE( skim.mTokens == 12 );
+    }
+
+    SECTION( "Bodies keep only their own tokens" )
+    {
+        auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"def f():\n    return 1\ny = 2\n" ) );
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+        auto parser = std::make_shared<PythonCoreParser>(lexer);
+        parser->SetLazyFunctionBodies(true);
+
+        auto root = std::static_pointer_cast<FileInputNode>( parser->ParseFileInput() );
+        std::weak_ptr<PythonCoreTokenizer> weak = lexer;
+        parser = nullptr;
+        lexer = nullptr;
+
+        REQUIRE( weak.expired() );
+
+        auto body = std::static_pointer_cast<FuncDefStatementNode>( root->GetNodes()->front() )->GetNext();
+
+        REQUIRE( body->GetKind() == NodeKind::FuncBodySuiteStatement );
+        REQUIRE( body->GetEnd() == 23 );
+    }
+
+    SECTION( "Threads forcing one body parse it once" )
+    {
+        auto root = ParseSource( L"def f(a):\n    x = [a for a in range(10)]\n    return x\n", true );
+        auto func = std::static_pointer_cast<FuncDefStatementNode>( root->GetNodes()->front() );
+
+        std::vector<std::shared_ptr<StatementNode>> bodies(8);
+        std::vector<std::thread> threads;
+
+        for (auto &body : bodies) threads.emplace_back( [&body, func]() { body = func->GetNext(); } );
+        for (auto &thread : threads) thread.join();
+
+        for (auto &body : bodies) REQUIRE( body == bodies.front() );
+        REQUIRE( bodies.front() != nullptr );
+    }
+
+    SECTION( "Skimming still reports token errors" )
+    {
+        REQUIRE_THROWS_AS( ParseSource( L"def f():\n    x = (1]\n", true ), std::shared_ptr<LexicalError> );
+        REQUIRE_THROWS_AS( ParseSource( L"def f():\n    x = 0b12\n", true ), std::shared_ptr<LexicalError> );
+        REQUIRE_THROWS_AS( ParseSource( L"def f():\npass\n", true ), std::shared_ptr<SyntaxError> );
+    }
+
+    SECTION( "Loops do not reach into function bodies" )
+    {
+        REQUIRE_THROWS( ParseSource( L"while x:\n    def f():\n        break\n", false ) );
+        REQUIRE_NOTHROW( ParseSource( L"def f():\n    while x:\n        break\n", false ) );
+    }
+
+}
@@ -0,0 +1,155 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+#include <ast/MappedCompactTree.h>
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<CompactTree> CompactSource(std::wstring text)
+{
+    auto source = std::make_shared<std::wstring>( text );
+    auto sourceBuffer = std::make_shared<SourceBuffer>( source );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+
+    return CompactTree::FromNode( parser->ParseFileInput(), source );
+}
+
+/* The image with the index at offset in the first copy of the record set to value. */
+template <typename T>
+static std::string Patch(std::string image, const T &record, std::size_t offset, std::uint32_t value)
+{
+    auto at = image.find( std::string(reinterpret_cast<const char *>(&record), sizeof(T)) );
+    REQUIRE( at != std::string::npos );
+
+    std::memcpy(&image[at + offset], &value, sizeof(value));
+    return image;
+}
+
+static std::string TemporaryPath(const char *name)
+{
+    return ( std::filesystem::temp_directory_path() / name ).string();
+}
+
+TEST_CASE( "Mapped compact tree", "CompactTree" )
+{
+
+    SECTION( "Round trip keeps nodes, tokens and source" )
+    {
+        auto tree = CompactSource( L"def f(a, b):\n    return a + b * 2\nx = f(1, 2)\n" );
+        auto path = TemporaryPath("PythonCoreMappedTree1.ast");
+
+        REQUIRE( MappedCompactTree::Write(*tree, path) );
+
+        auto mapped = MappedCompactTree::Open(path);
+
+        REQUIRE( mapped != nullptr );
+        REQUIRE( mapped->NodeCount() == tree->NodeCount() );
+        REQUIRE( mapped->TokenCount() == tree->TokenCount() );
+
+        for (unsigned int i = 0; i < tree->NodeCount(); i++)
+        {
+            REQUIRE( mapped->GetNode(i).mKind == tree->GetNode(i).mKind );
+            REQUIRE( mapped->GetFirstChild(i) == tree->GetFirstChild(i) );
+            REQUIRE( mapped->GetNextSibling(i) == tree->GetNextSibling(i) );
+            REQUIRE( mapped->GetStart(i) == tree->GetStart(i) );
+            REQUIRE( mapped->GetEnd(i) == tree->GetEnd(i) );
+        }
+
+        for (unsigned int i = 0; i < tree->TokenCount(); i++)
+        {
+            REQUIRE( mapped->GetToken(i).mKind == tree->GetToken(i).mKind );
+            REQUIRE( std::wstring(mapped->GetTokenText(i)) == tree->GetTokenText(i) );
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION( "Names are interned and numbers decoded" )
+    {
+        auto tree = CompactSource( L"a = b + a * 0x1f + 1_000 + 2.5 + 3j + 99999999999999999999999\n" );
+        auto path = TemporaryPath("PythonCoreMappedTree2.ast");
+
+        REQUIRE( MappedCompactTree::Write(*tree, path) );
+
+        auto mapped = MappedCompactTree::Open(path);
+        std::vector<CompactLiteral> literals;
+
+        REQUIRE( mapped->NameCount() == 2 );
+        REQUIRE( mapped->GetName(0) == L"a" );
+        REQUIRE( mapped->GetName(1) == L"b" );
+        REQUIRE( mapped->GetTokenName(0) == 0 );
+        REQUIRE( mapped->GetTokenLiteral(0) == nullptr );
+
+        for (unsigned int i = 0; i < mapped->TokenCount(); i++)
+            if (mapped->GetTokenLiteral(i) != nullptr) literals.push_back( *mapped->GetTokenLiteral(i) );
+
+        REQUIRE( literals.size() == 5 );
+        REQUIRE( literals[0].mKind == CompactLiteralKind::Integer );
+        REQUIRE( literals[0].mInteger == 31 );
+        REQUIRE( literals[1].mInteger == 1000 );
+        REQUIRE( literals[2].mKind == CompactLiteralKind::Real );
+        REQUIRE( literals[2].mReal == 2.5 );
+        REQUIRE( literals[3].mKind == CompactLiteralKind::Imaginary );
+        REQUIRE( literals[3].mReal == 3.0 );
+        REQUIRE( literals[4].mKind == CompactLiteralKind::Text );
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION( "Damaged files are rejected" )
+    {
+        auto tree = CompactSource( L"x = 1\n" );
+        auto path = TemporaryPath("PythonCoreMappedTree3.ast");
+
+        REQUIRE( MappedCompactTree::Open(path + ".missing") == nullptr );
+        REQUIRE( MappedCompactTree::Write(*tree, path) );
+
+        auto size = std::filesystem::file_size(path);
+        std::filesystem::resize_file(path, size - 1);
+        REQUIRE( MappedCompactTree::Open(path) == nullptr );
+
+        REQUIRE( MappedCompactTree::Write(*tree, path) );
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(8);
+            file.put(static_cast<char>(MappedCompactTree::Version + 1));
+        }
+        REQUIRE( MappedCompactTree::Open(path) == nullptr );
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION( "Indexes out of their sections are rejected" )
+    {
+        auto tree = CompactSource( L"x = 1\ny = x\n" );
+        auto image = MappedCompactTree::Serialize(*tree);
+
+        REQUIRE( MappedCompactTree::FromBytes(image) != nullptr );
+
+        auto &root = tree->GetNode(tree->Root());
+        auto &child = tree->GetNode(root.mFirstChild);
+        auto &token = tree->GetToken(0);
+
+        REQUIRE( MappedCompactTree::FromBytes( Patch(image, root, offsetof(CompactNode, mFirstChild), tree->NodeCount()) ) == nullptr );
+        REQUIRE( MappedCompactTree::FromBytes( Patch(image, child, offsetof(CompactNode, mNextSibling), 0) ) == nullptr );
+        REQUIRE( MappedCompactTree::FromBytes( Patch(image, root, offsetof(CompactNode, mLastToken), tree->TokenCount()) ) == nullptr );
+        REQUIRE( MappedCompactTree::FromBytes( Patch(image, token, offsetof(CompactToken, mEnd), 1000) ) == nullptr );
+
+        /* Values of x, =, 1 and the newline: name 0, none, literal 0, none. */
+        REQUIRE( tree->GetToken(0).mKind == TokenKind::Name );
+        REQUIRE( tree->GetToken(2).mKind == TokenKind::Number );
+
+        std::uint32_t values[] = { 0, CompactTree::NoIndex, 0, CompactTree::NoIndex };
+
+        REQUIRE( MappedCompactTree::FromBytes( Patch(image, values, 0, 5) ) == nullptr );
+        REQUIRE( MappedCompactTree::FromBytes( Patch(image, values, 8, 1) ) == nullptr );
+    }
+}
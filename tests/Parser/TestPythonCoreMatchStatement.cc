@@ -1,6 +1,92 @@
-
 #include <catch2/catch.hpp>
 
 #include <PythonCoreParser.h>
+#include <ast/NodeVisitor.h>
 
 using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<StatementNode> ParseFile(std::wstring text, bool memo = true)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+    parser->SetPatternMemo(memo);
+
+    return parser->ParseFileInput();
+}
+
+static std::shared_ptr<StatementNode> FirstCasePattern(std::wstring pattern, bool memo = true)
+{
+    auto root = std::static_pointer_cast<FileInputNode>( ParseFile( L"match x:\n    case " + pattern + L":\n        pass\n", memo ) );
+    auto match = std::static_pointer_cast<MatchStatementNode>( root->GetNodes()->front() );
+    auto block = std::static_pointer_cast<CaseStatementNode>( match->GetNodes()->front() );
+
+    return block->GetLeft();
+}
+
+class KindList : public NodeWalker<KindList>
+{
+    public:
+        bool Enter(std::shared_ptr<Node> node) { mKinds.push_back(node->GetKind()); return true; }
+
+        std::vector<NodeKind> mKinds;
+};
+
+static std::vector<NodeKind> Kinds(std::shared_ptr<Node> node)
+{
+    KindList list;
+    list.Walk(node);
+    return list.mKinds;
+}
+
+TEST_CASE( "Match statement patterns", "Parser" )
+{
+
+    SECTION( "Capture, wildcard and open sequence" )
+    {
+        REQUIRE( FirstCasePattern( L"a" )->GetKind() == NodeKind::CapturePattern );
+        REQUIRE( FirstCasePattern( L"_" )->GetKind() == NodeKind::WildCardPattern );
+        REQUIRE( FirstCasePattern( L"a, *rest" )->GetKind() == NodeKind::OpenSequencePattern );
+    }
+
+    SECTION( "Group pattern versus parenthesized sequence" )
+    {
+        REQUIRE( FirstCasePattern( L"(a)" )->GetKind() == NodeKind::GroupPattern );
+        REQUIRE( FirstCasePattern( L"(a,)" )->GetKind() == NodeKind::SequencePattern );
+        REQUIRE( FirstCasePattern( L"()" )->GetKind() == NodeKind::SequencePattern );
+    }
+
+    SECTION( "Sequence, class, mapping, value and or patterns" )
+    {
+        REQUIRE( FirstCasePattern( L"[a, (b, c), *_]" )->GetKind() == NodeKind::SequencePattern );
+        REQUIRE( FirstCasePattern( L"a.b.c" )->GetKind() == NodeKind::ValuePattern );
+        REQUIRE( FirstCasePattern( L"1 | -2 | 3 + 4j" )->GetKind() == NodeKind::OrPattern );
+
+        auto node = std::static_pointer_cast<ClassPatternNode>( FirstCasePattern( L"Point(x, 0, y=[z], w=_,)" ) );
+        REQUIRE( node->GetKind() == NodeKind::ClassPattern );
+        REQUIRE( node->GetPositionals()->GetKind() == NodeKind::PositionalPatterns );
+        REQUIRE( node->GetKeywords()->GetKind() == NodeKind::KeywordPatterns );
+        REQUIRE( node->GetSecondComma() != nullptr );
+
+        auto mapping = std::static_pointer_cast<MappingPatternNode>( FirstCasePattern( L"{'a': 1, b.c: d, **rest}" ) );
+        REQUIRE( mapping->GetKind() == NodeKind::MappingPattern );
+        REQUIRE( mapping->GetItems()->GetKind() == NodeKind::ItemsPattern );
+        REQUIRE( mapping->GetDoubleStar()->GetKind() == NodeKind::DoubleStarPattern );
+    }
+
+    SECTION( "Memoized and plain parsing give the same tree" )
+    {
+        std::wstring pattern = L"[((a, b),), Point(((c),), y=((d,),)), ((e | f),)] as g";
+
+        REQUIRE( Kinds( FirstCasePattern( pattern, true ) ) == Kinds( FirstCasePattern( pattern, false ) ) );
+    }
+
+    SECTION( "'match' used as a name" )
+    {
+        auto root = std::static_pointer_cast<FileInputNode>( ParseFile( L"match = 1\n" ) );
+
+        REQUIRE( root->GetNodes()->front()->GetKind() == NodeKind::SimpleStatement );
+    }
+}
@@ -0,0 +1,60 @@
+
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+#include <ast/NodeVisitor.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<Node> ParseEval(const wchar_t *text)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+
+    return std::static_pointer_cast<EvalInputNode>( parser->ParseEvalInput() )->GetRight();
+}
+
+class KindRecorder : public NodeWalker<KindRecorder>
+{
+    public:
+        bool Enter(std::shared_ptr<Node> node) { mPreOrder.push_back(node->GetKind()); return true; }
+        void Leave(std::shared_ptr<Node> node) { mPostOrder.push_back(node->GetKind()); }
+        void VisitToken(std::shared_ptr<Token> token) { mTokens++; }
+
+        std::vector<NodeKind> mPreOrder;
+        std::vector<NodeKind> mPostOrder;
+        int mTokens = 0;
+};
+
+class NameCounter : public NodeVisitor<NameCounter, int>
+{
+    public:
+        int VisitAtomName(std::shared_ptr<AtomNameNode> node) { return 1; }
+        int VisitMul(std::shared_ptr<MulNode> node) { return Visit(node->GetLeft()) + Visit(node->GetRight()); }
+        int VisitPlus(std::shared_ptr<PlusNode> node) { return Visit(node->GetLeft()) + Visit(node->GetRight()); }
+};
+
+TEST_CASE( "Node visitor and walker", "Visitor" )
+{
+
+    SECTION( "Pre-order and post-order walk of 'a + b * c'" )
+    {
+        KindRecorder recorder;
+        recorder.Walk( ParseEval( L"a + b * c\n" ) );
+
+        REQUIRE( recorder.mPreOrder == std::vector<NodeKind> { NodeKind::Plus, NodeKind::AtomName, NodeKind::Mul, NodeKind::AtomName, NodeKind::AtomName } );
+        REQUIRE( recorder.mPostOrder == std::vector<NodeKind> { NodeKind::AtomName, NodeKind::AtomName, NodeKind::AtomName, NodeKind::Mul, NodeKind::Plus } );
+        REQUIRE( recorder.mTokens == 5 );
+    }
+
+    SECTION( "Visitor dispatches on node kind" )
+    {
+        NameCounter counter;
+
+        REQUIRE( counter.Visit( ParseEval( L"a + b * c\n" ) ) == 3 );
+        REQUIRE( counter.Visit( ParseEval( L"a - b\n" ) ) == 0 );
+    }
+}
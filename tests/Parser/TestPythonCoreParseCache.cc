@@ -0,0 +1,136 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParseCache.h>
+
+#include <filesystem>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::string CacheDirectory(const char *name)
+{
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(path);
+    return path.string();
+}
+
+static std::uint64_t DirectorySize(const std::string &directory)
+{
+    std::uint64_t total = 0;
+    for (auto &entry : std::filesystem::directory_iterator(directory)) total += entry.file_size();
+    return total;
+}
+
+static std::shared_ptr<std::wstring> Module(unsigned int index)
+{
+    return std::make_shared<std::wstring>( L"def f" + std::to_wstring(index) + L"(a):\n    return a * " + std::to_wstring(index) + L"\n" );
+}
+
+TEST_CASE( "Parse cache", "Parser" )
+{
+
+    SECTION( "Second parse of the same source is a hit" )
+    {
+        auto directory = CacheDirectory("PythonCoreParseCache1");
+        PythonCoreParseCache cache(directory);
+
+        auto first = cache.Parse( Module(1) );
+        auto second = cache.Parse( Module(1) );
+
+        REQUIRE( cache.GetMisses() == 1 );
+        REQUIRE( cache.GetHits() == 1 );
+        REQUIRE( first->NodeCount() == second->NodeCount() );
+        REQUIRE( second->GetSource() == *Module(1) );
+
+        PythonCoreParseCache other(directory);
+        other.Parse( Module(1) );
+
+        REQUIRE( other.GetHits() == 1 );
+
+        std::filesystem::remove_all(directory);
+    }
+
+    SECTION( "Options are part of the key" )
+    {
+        auto directory = CacheDirectory("PythonCoreParseCache2");
+        ParseCacheOptions options;
+        options.mTabSize = 8;
+
+        PythonCoreParseCache cache(directory);
+        PythonCoreParseCache wide(directory, options);
+
+        REQUIRE( cache.GetEntryPath(*Module(1)) != wide.GetEntryPath(*Module(1)) );
+        REQUIRE( cache.GetEntryPath(*Module(1)) != cache.GetEntryPath(*Module(2)) );
+
+        std::filesystem::remove_all(directory);
+    }
+
+    SECTION( "An entry holding other source is not used" )
+    {
+        auto directory = CacheDirectory("PythonCoreParseCache3");
+        PythonCoreParseCache cache(directory);
+
+        cache.Parse( Module(2) );
+        std::filesystem::rename( cache.GetEntryPath(*Module(2)), cache.GetEntryPath(*Module(1)) );
+
+        auto tree = cache.Parse( Module(1) );
+
+        REQUIRE( cache.GetHits() == 0 );
+        REQUIRE( tree->GetSource() == *Module(1) );
+
+        std::filesystem::remove_all(directory);
+    }
+
+    SECTION( "A replaced entry is counted once" )
+    {
+        auto directory = CacheDirectory("PythonCoreParseCache6");
+        PythonCoreParseCache cache(directory);
+
+        cache.Parse( Module(2) );
+        std::filesystem::rename( cache.GetEntryPath(*Module(2)), cache.GetEntryPath(*Module(1)) );
+        cache.Parse( Module(1) );
+
+        REQUIRE( cache.GetBytes() == DirectorySize(directory) );
+
+        std::filesystem::remove_all(directory);
+    }
+
+    SECTION( "Parse errors are thrown and not stored" )
+    {
+        auto directory = CacheDirectory("PythonCoreParseCache4");
+        PythonCoreParseCache cache(directory);
+
+        REQUIRE_THROWS_AS( cache.Parse( std::make_shared<std::wstring>( L"x = = 1\n" ) ), std::shared_ptr<SyntaxError> );
+        REQUIRE( DirectorySize(directory) == 0 );
+
+        std::filesystem::remove_all(directory);
+    }
+
+    SECTION( "Least recently used entries are evicted" )
+    {
+        auto directory = CacheDirectory("PythonCoreParseCache5");
+        ParseCacheOptions options;
+
+        {
+            PythonCoreParseCache probe(directory);
+            probe.Parse( Module(1000) );
+            options.mMaxBytes = DirectorySize(directory) * 4;
+            std::filesystem::remove_all(directory);
+        }
+
+        PythonCoreParseCache cache(directory, options);
+
+        for (unsigned int i = 1000; i < 1010; i++)
+        {
+            cache.Parse( Module(i) );
+            REQUIRE( DirectorySize(directory) <= options.mMaxBytes );
+        }
+
+        REQUIRE( std::filesystem::exists( cache.GetEntryPath(*Module(1009)) ) );
+        REQUIRE_FALSE( std::filesystem::exists( cache.GetEntryPath(*Module(1000)) ) );
+
+        std::filesystem::remove_all(directory);
+    }
+
+}
@@ -0,0 +1,149 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParseFiles.h>
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <thread>
+#include <type_traits>
+
+using namespace PythonCoreNative::RunTime::Parser;
+
+
+static std::vector<std::string> WriteCorpus(std::string directory, unsigned int count)
+{
+    auto root = std::filesystem::temp_directory_path() / directory;
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+
+    std::vector<std::string> paths;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        auto path = (root / ("file" + std::to_string(i) + ".py")).string();
+        std::ofstream file(path, std::ios::binary);
+
+        file << "from . import sibling\nfrom ..package import name\n";
+        for (unsigned int j = 0; j <= i; j++) file << "value" << j << " = name + " << j << "\n";
+
+        paths.push_back(path);
+    }
+
+    return paths;
+}
+
+TEST_CASE( "Parse files on a work stealing pool", "Parser" )
+{
+
+    SECTION( "Every file is reported once" )
+    {
+        auto paths = WriteCorpus("PythonCoreParseFiles", 24);
+        paths.push_back(paths.front() + ".missing");
+
+        ParseFilesOptions options;
+        options.mThreads = 4;
+
+        std::multiset<std::string> seen;
+        unsigned int parsed = 0, failed = 0;
+
+        ParseFiles(paths, options, [&](ParseFileResult &result) {
+            seen.insert(result.mPath);
+            if (result.mRoot != nullptr) parsed++;
+            if (result.mError != nullptr) failed++;
+        });
+
+        REQUIRE( seen.size() == paths.size() );
+        REQUIRE( std::set<std::string>(seen.begin(), seen.end()).size() == paths.size() );
+        REQUIRE( parsed == 24 );
+        REQUIRE( failed == 1 );
+    }
+
+    SECTION( "Syntax errors are returned with the file" )
+    {
+        auto paths = WriteCorpus("PythonCoreParseFilesError", 2);
+        std::ofstream(paths[1], std::ios::binary) << "a = (1,\n";
+
+        ParseFilesOptions options;
+        options.mThreads = 2;
+
+        std::shared_ptr<std::wstring> error;
+
+        ParseFiles(paths, options, [&](ParseFileResult &result) {
+            if (result.mPath == paths[1]) error = result.mError;
+        });
+
+        REQUIRE( error != nullptr );
+    }
+
+    SECTION( "Callback exception stops the pool" )
+    {
+        auto paths = WriteCorpus("PythonCoreParseFilesStop", 8);
+        unsigned int calls = 0;
+
+        ParseFilesOptions options;
+        options.mThreads = 2;
+
+        REQUIRE_THROWS_AS( ParseFiles(paths, options, [&](ParseFileResult &result) { calls++; throw std::runtime_error("stop"); }), std::runtime_error );
+        REQUIRE( calls == 1 );
+    }
+
+    SECTION( "UTF-8 decoding" )
+    {
+        std::wstring text;
+
+        DecodeUtf8("\xef\xbb\xbf" "a\xc3\xa6\xe2\x82\xac\xf0\x9f\x98\x80", text);
+        REQUIRE( text == std::wstring({ L'a', 0xe6, 0x20ac, 0x1f600 }) );
+
+        DecodeUtf8("\xc0\xaf\xed\xa0\x80", text);
+        REQUIRE( text == std::wstring({ 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd }) );
+    }
+
+    SECTION( "Trees from an arena outlive it" )
+    {
+        std::wstring text;
+        for (int i = 0; i < 2000; i++) text += L"def f" + std::to_wstring(i) + L"(a, b):\n    return [a + b, b * a]\n";
+
+        auto arena = std::make_shared<NodeArena>();
+        auto parser = std::make_shared<PythonCoreParser>( std::make_shared<PythonCoreTokenizer>( 4, std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) ) ) );
+        parser->SetArena(arena);
+
+        auto root = std::static_pointer_cast<AST::FileInputNode>( parser->ParseFileInput() );
+
+        REQUIRE( arena->ChunkCount() > 1 );
+
+        parser = nullptr;
+        arena = nullptr;
+
+        REQUIRE( root->GetNodes()->size() == 2000 );
+
+        /* Nodes may be released on other threads. */
+        auto nodes = root->GetNodes();
+        root = nullptr;
+        std::thread other([nodes]() mutable { nodes->resize(1000); });
+        other.join();
+
+        auto func = std::static_pointer_cast<AST::FuncDefStatementNode>( nodes->back() );
+        REQUIRE( *std::static_pointer_cast<NameToken>( func->GetOperator2() )->GetText() == L"f999" );
+    }
+
+    SECTION( "Names share text through the interner" )
+    {
+        auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"abc abc " ) );
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+        auto interner = std::make_shared<NameInterner>();
+        lexer->SetInterner(interner);
+
+        lexer->Advance();
+        auto first = std::static_pointer_cast<NameToken>(lexer->CurSymbol())->GetText();
+        lexer->Advance();
+        auto second = std::static_pointer_cast<NameToken>(lexer->CurSymbol())->GetText();
+
+        REQUIRE( first == second );
+        REQUIRE( interner->Count() == 1 );
+
+        /* Shared texts can not be changed through one of the tokens. */
+        static_assert( std::is_same_v<decltype(first), std::shared_ptr<const std::wstring>> );
+    }
+
+}
@@ -0,0 +1,137 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+#include <ast/SourceEmitter.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<FileInputNode> ParseSource(std::shared_ptr<std::wstring> source)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( source );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+
+    return std::static_pointer_cast<FileInputNode>( parser->ParseFileInput() );
+}
+
+/* Emits through a small buffer so text is split across many sink calls. */
+class Output
+{
+    public:
+        Output(std::size_t capacity) : mBuffer(capacity), mEmitter(mBuffer.data(), capacity, [this](const wchar_t *text, std::size_t length) { mText.append(text, length); mCalls++; }) {}
+
+        std::wstring Text()
+        {
+            auto length = mEmitter.Flush();
+            REQUIRE( length == mText.size() );
+            return mText;
+        }
+
+        std::vector<wchar_t> mBuffer;
+        SourceEmitter mEmitter;
+        std::wstring mText;
+        unsigned int mCalls = 0;
+};
+
+TEST_CASE( "Source emitter", "Parser" )
+{
+
+    SECTION( "Unmodified tree gives its source" )
+    {
+        std::wstring sources[] = {
+            L"x = 1\n",
+            L"\n  # head\n\nx  =  f(a,\tb)   # tail\n\n# end",
+            L"def f(a, b):\n    if a:\n\n        return b\n\treturn [1,\n  2]\n",
+            L"class A(B):\r\n    pass\r\n",
+            L"x = 1 + \\\n    2 \v+ 3\n",
+            L"y = r'a\\'b' if a else b\"\"\"c\n\"\"\"[1:2]\n",
+            L"@dec\nasync def f(*a, **k) -> int:\n    return await g(x for x in a)\n",
+            L""
+        };
+
+        for (auto &text : sources)
+        {
+            auto source = std::make_shared<std::wstring>( text );
+
+            for (std::size_t capacity : { 1, 3, 4096 })
+            {
+                Output output(capacity);
+                output.mEmitter.Emit( ParseSource(source), source );
+
+                REQUIRE( output.Text() == text );
+            }
+        }
+
+        auto source = std::make_shared<std::wstring>( L"x = 1\nif x:  # test\n    y = [1,\n\t2]\n\n    z = 3\n" );
+        Output output(2);
+        output.mEmitter.Emit( ParseSource(source)->GetNodes()->back(), source );
+
+        REQUIRE( output.Text() == L"if x:  # test\n    y = [1,\n\t2]\n\n    z = 3\n" );
+    }
+
+    SECTION( "Replaced nodes are written from their own source" )
+    {
+        auto source = std::make_shared<std::wstring>( L"a = 1  # one\nb = 2\n" );
+        auto root = ParseSource(source);
+        auto replacementSource = std::make_shared<std::wstring>( L"[\n  f(x)]\n" );
+        auto replacement = ParseSource(replacementSource)->GetNodes()->front();
+
+        Output output(8);
+        output.mEmitter.Replace( root->GetNodes()->front(), replacement, replacementSource );
+        output.mEmitter.Emit( root, source );
+
+        REQUIRE( output.Text() == L"[\n  f(x)]\nb = 2\n" );
+        REQUIRE( output.mCalls > 1 );
+
+        Output removed(64);
+        removed.mEmitter.Replace( root->GetNodes()->back(), nullptr, nullptr );
+        removed.mEmitter.Emit( root, source );
+
+        REQUIRE( removed.Text() == L"a = 1  # one\n" );
+    }
+
+    SECTION( "Replaced nodes are found by position" )
+    {
+        auto source = std::make_shared<std::wstring>( L"a = 1\nif a:\n    b = 2\n    c = 3\n" );
+        auto root = ParseSource(source);
+        auto replacementSource = std::make_shared<std::wstring>( L"pass\n" );
+        auto replacement = ParseSource(replacementSource)->GetNodes()->front();
+        auto outer = root->GetNodes()->back();
+
+        Output output(4);
+        output.mEmitter.Replace( root->GetNodes()->front(), nullptr, nullptr );
+        output.mEmitter.Emit( outer, source );
+
+        REQUIRE( output.Text() == L"if a:\n    b = 2\n    c = 3\n" );
+
+        /* Nodes inside a replaced one go with it. */
+        Output nested(4);
+        nested.mEmitter.Replace( root->GetNodes()->front(), nullptr, nullptr );
+        nested.mEmitter.Replace( root, replacement, replacementSource );
+        nested.mEmitter.Emit( root, source );
+
+        REQUIRE( nested.Text() == L"pass\n" );
+
+        nested.mEmitter.Replace( outer, replacement, replacementSource );
+        nested.mEmitter.Replace( root, root, source );
+        nested.mEmitter.Emit( root, source );
+
+        REQUIRE( nested.Text() == L"pass\na = 1\nif a:\n    b = 2\n    c = 3\n" );
+    }
+
+    SECTION( "Green trees after edits" )
+    {
+        auto source = std::make_shared<std::wstring>( L"a = 1\nb = 2\n" );
+        auto green = GreenNode::FromCompactTree( *CompactTree::FromNode( ParseSource(source), source ) );
+        auto one = RedNode::CreateRoot(green)->FindToken(4).GetParent();
+        auto two = RedNode::CreateRoot(green)->FindToken(10).GetParent();
+
+        Output output(5);
+        output.mEmitter.Emit( one->ReplaceWith( two->GetGreen() )->GetGreen() );
+
+        REQUIRE( output.Text() == L"a = 2\nb = 2\n" );
+    }
+
+}
@@ -4,3 +4,141 @@
 #include <PythonCoreParser.h>
 
 using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<StatementNode> FirstStatement(std::wstring text)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+    auto root = std::static_pointer_cast<FileInputNode>( parser->ParseFileInput() );
+
+    return root->GetNodes()->front();
+}
+
+/* The import of a one line statement. */
+static std::shared_ptr<ImportFromStatementNode> ImportFrom(std::wstring text)
+{
+    auto simple = std::static_pointer_cast<SimpleStatementNode>( FirstStatement(text) );
+    REQUIRE( simple->GetNodes()->front()->GetKind() == NodeKind::ImportFromStatement );
+    return std::static_pointer_cast<ImportFromStatementNode>( simple->GetNodes()->front() );
+}
+
+static std::wstring ErrorOf(std::wstring text)
+{
+    try
+    {
+        FirstStatement( text );
+    }
+    catch (std::shared_ptr<SyntaxError> error)
+    {
+        return *error->GetMessage();
+    }
+
+    return L"";
+}
+
+static std::shared_ptr<TypedArgsListStatementNode> Parameters(std::wstring text)
+{
+    auto func = std::static_pointer_cast<FuncDefStatementNode>( FirstStatement( text ) );
+    auto parameters = std::static_pointer_cast<ParameterStatementNode>( func->GetLeft() );
+
+    return std::static_pointer_cast<TypedArgsListStatementNode>( parameters->GetRight() );
+}
+
+TEST_CASE( "Compound statements", "Parser" )
+{
+
+    SECTION( "Function definitions" )
+    {
+        REQUIRE( FirstStatement( L"def f():\n    pass\n" )->GetKind() == NodeKind::FuncDefStatement );
+        REQUIRE( FirstStatement( L"def f(a, *args, key=None, **kw):\n    return a\n" )->GetKind() == NodeKind::FuncDefStatement );
+        REQUIRE( FirstStatement( L"def f(a=1, /, b=2, *, c) -> int:\n    pass\n" )->GetKind() == NodeKind::FuncDefStatement );
+        REQUIRE_THROWS( FirstStatement( L"def f(**kw, a):\n    pass\n" ) );
+    }
+
+    SECTION( "Loops, try and with" )
+    {
+        REQUIRE( FirstStatement( L"while x:\n    y = 1\nelse:\n    pass\n" )->GetKind() == NodeKind::WhileStatement );
+        REQUIRE( FirstStatement( L"try:\n    a\nexcept E as e:\n    b\nfinally:\n    c\n" )->GetKind() == NodeKind::TryStatement );
+        REQUIRE( FirstStatement( L"with a as b, c:\n    pass\n" )->GetKind() == NodeKind::WithStatement );
+        REQUIRE( FirstStatement( L"with (a as b, c,):\n    pass\n" )->GetKind() == NodeKind::WithStatement );
+        REQUIRE( FirstStatement( L"with (a) as b:\n    pass\n" )->GetKind() == NodeKind::WithStatement );
+    }
+
+    SECTION( "Relative imports" )
+    {
+        auto from = ImportFrom( L"from . import x\n" );
+        REQUIRE( from->GetDots()->size() == 1 );
+        REQUIRE( from->GetLeft() == nullptr );
+
+        from = ImportFrom( L"from ..a import b\n" );
+        REQUIRE( from->GetDots()->size() == 2 );
+        REQUIRE( from->GetLeft() != nullptr );
+
+        from = ImportFrom( L"from .... import (c, d)\n" );
+        REQUIRE( from->GetDots()->size() == 2 );
+
+        REQUIRE( ImportFrom( L"from a import *\n" )->GetDots()->empty() );
+        REQUIRE_THROWS( FirstStatement( L"from import x\n" ) );
+    }
+
+    SECTION( "Comments, displays, calls and slices" )
+    {
+        REQUIRE( FirstStatement( L"# comment\n\ndef f():\n    # comment\n    pass\n" )->GetKind() == NodeKind::FuncDefStatement );
+        REQUIRE_NOTHROW( FirstStatement( L"x = [1,\n  2, 3,]\n" ) );
+        REQUIRE_NOTHROW( FirstStatement( L"f(1, *a, k=3, **kw)\n" ) );
+        REQUIRE_NOTHROW( FirstStatement( L"x = a[1:, ::2, :3]\n" ) );
+    }
+
+    SECTION( "Typed argument lists" )
+    {
+        auto list = Parameters( L"def f(a, b=1, /, c=2, *args, d, e=3, **kw):\n    pass\n" );
+
+        REQUIRE( list->GetNodes()->size() == 5 );
+        REQUIRE( list->GetSlash() != nullptr );
+        REQUIRE( list->GetMulNode() != nullptr );
+        REQUIRE( list->GetPowerNode() != nullptr );
+
+        list = Parameters( L"def f(a, *, b,):\n    pass\n" );
+
+        REQUIRE( list->GetMul() != nullptr );
+        REQUIRE( list->GetMulNode() == nullptr );
+        REQUIRE( list->GetSeparators()->size() == 3 );
+
+        REQUIRE( ErrorOf( L"def f(/, a):\n    pass\n" ) == L"Unexpected '/' in argument list!" );
+        REQUIRE( ErrorOf( L"def f(*a, *b):\n    pass\n" ) == L"Only one '*' allowed in argument list!" );
+        REQUIRE( ErrorOf( L"def f(**):\n    pass\n" ) == L"Missing Name literal after '**' in argument list!" );
+        REQUIRE( ErrorOf( L"def f(**kw, a):\n    pass\n" ) == L"Unexpected argument after '**' argument!" );
+        REQUIRE( ErrorOf( L"def f:\n    pass\n" ) == L"Missing '(' in function declaration!" );
+    }
+
+    SECTION( "Function bodies with and without a type comment" )
+    {
+        auto func = std::static_pointer_cast<FuncDefStatementNode>( FirstStatement( L"def f():\n    a\n    b\n" ) );
+        auto body = std::static_pointer_cast<FuncBodySuiteStatementNode>( func->GetNext() );
+
+        REQUIRE( body->GetNodes()->size() == 2 );
+
+        REQUIRE( ErrorOf( L"def f():\npass\n" ) == L"Missing Indent in suite!" );
+    }
+
+    SECTION( "Missing colons are reported per statement" )
+    {
+        REQUIRE( ErrorOf( L"while x\n    pass\n" ) == L"Missing ':' in 'while' statement!" );
+        REQUIRE( ErrorOf( L"while x:\n    pass\nelse\n    pass\n" ) == L"Missing ':' in 'else' statement!" );
+        REQUIRE( ErrorOf( L"try\n    pass\nfinally:\n    pass\n" ) == L"Missing ':' in 'try' statement!" );
+        REQUIRE( ErrorOf( L"try:\n    pass\nexcept E\n    pass\n" ) == L"Missing ':' in 'except' statement!" );
+        REQUIRE( ErrorOf( L"try:\n    pass\nfinally\n    pass\n" ) == L"Missing ':' in 'finally' statement!" );
+        REQUIRE( ErrorOf( L"try:\n    pass\nexcept E as:\n    pass\n" ) == L"Missing Name after 'as' in 'except' statement!" );
+        REQUIRE( ErrorOf( L"def f()\n    pass\n" ) == L"Missing ':' in function declaration!" );
+    }
+
+    SECTION( "With statements without parentheses" )
+    {
+        REQUIRE( FirstStatement( L"with a:\n    pass\n" )->GetKind() == NodeKind::WithStatement );
+        REQUIRE( ErrorOf( L"with a\n    pass\n" ) == L"Missing ':' in 'with' statement!" );
+    }
+
+}
@@ -0,0 +1,108 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+#include <ast/StructuralHash.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<FileInputNode> ParseSource(std::wstring text)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+
+    return std::static_pointer_cast<FileInputNode>( parser->ParseFileInput() );
+}
+
+TEST_CASE( "Structural hash", "Parser" )
+{
+
+    SECTION( "Positions are ignored, names and literals are not" )
+    {
+        StructuralHasher hasher;
+
+        auto a = hasher.Hash( ParseSource( L"x = f(a, 1)\n" ) );
+        auto b = hasher.Hash( ParseSource( L"\n\nx   =   f(a,1)\n" ) );
+        auto c = hasher.Hash( ParseSource( L"x = f(b, 1)\n" ) );
+        auto d = hasher.Hash( ParseSource( L"x = f(a, 2)\n" ) );
+
+        REQUIRE( a != c );
+        REQUIRE( a != d );
+        REQUIRE( hasher.Hash( ParseSource( L"x = f(a, 1)\n" )->GetNodes()->front() ) == hasher.Hash( ParseSource( L"\n\nx   =   f(a,1)\n" )->GetNodes()->front() ) );
+        REQUIRE( b != 0 );
+    }
+
+    SECTION( "String prefixes are part of the hash" )
+    {
+        StructuralHasher hasher;
+        HashConsStore store;
+
+        const wchar_t *sources[] = { L"x = '\\n'\n", L"x = r'\\n'\n", L"x = '{y}'\n", L"x = f'{y}'\n", L"x = 'a'\n", L"x = b'a'\n" };
+
+        for (unsigned int i = 0; i < 6; i += 2)
+        {
+            auto plain = ParseSource(sources[i]), prefixed = ParseSource(sources[i + 1]);
+
+            REQUIRE( hasher.Hash(plain) != hasher.Hash(prefixed) );
+            REQUIRE( store.Intern(plain) != store.Intern(prefixed) );
+        }
+
+        REQUIRE( store.Intern( ParseSource( L"y = b'a'\n" ) ) != store.Intern( ParseSource( L"y = 'a'\n" ) ) );
+        REQUIRE( store.Intern( ParseSource( L"x = rb'a'\n" ) ) == store.Intern( ParseSource( L"x = Br'a'\n" ) ) );
+    }
+
+    SECTION( "Trivia is hashed on request" )
+    {
+        StructuralHasher plain, exact(true);
+
+        auto first = ParseSource( L"x = 1 # one\n" )->GetNodes()->front();
+        auto second = ParseSource( L"x = 1 # two\n" )->GetNodes()->front();
+
+        REQUIRE( plain.Hash(first) == plain.Hash(second) );
+        REQUIRE( exact.Hash(first) != exact.Hash(second) );
+        REQUIRE( exact.GetHash(first.get()) != 0 );
+        REQUIRE( exact.GetHash(nullptr) == 0 );
+    }
+
+}
+
+TEST_CASE( "Hash consing", "Parser" )
+{
+
+    SECTION( "Equal subtrees across files share one entry" )
+    {
+        HashConsStore store;
+        std::unordered_map<Node *, unsigned int> ids;
+
+        auto first = ParseSource( L"@decorate(1, 2)\ndef f():\n    return [a, b]\n" );
+        auto second = ParseSource( L"x = 1\n\n@decorate(1,  2)\ndef f():\n    return [a, b]\n" );
+
+        store.Intern(first, &ids);
+        auto count = store.NodeCount();
+
+        store.Intern(second, &ids);
+
+        REQUIRE( ids[first->GetNodes()->front().get()] == ids[second->GetNodes()->back().get()] );
+        REQUIRE( ids[first.get()] != ids[second.get()] );
+        REQUIRE( store.NodeCount() < 2 * count );
+
+        store.Intern(first);
+        REQUIRE( store.Intern( ParseSource( L"@decorate(1, 2)\ndef f():\n    return [a, b]\n" ) ) == ids[first.get()] );
+        REQUIRE( store.Intern( ParseSource( L"@decorate(1, 2)\ndef f():\n    return [a, c]\n" ) ) != ids[first.get()] );
+    }
+
+    SECTION( "Entries keep kinds, tokens and texts" )
+    {
+        HashConsStore store;
+
+        auto root = store.Intern( ParseSource( L"a + a\n" ) );
+
+        REQUIRE( store.GetNode(root).mKind == NodeKind::FileInput );
+        REQUIRE( store.TextCount() == 1 );
+        REQUIRE( store.GetText(0) == L"a" );
+        REQUIRE( store.MemoryUsage() > 0 );
+    }
+
+}
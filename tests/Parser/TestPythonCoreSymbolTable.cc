@@ -0,0 +1,154 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreParser.h>
+#include <ast/SymbolTable.h>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::Parser::AST;
+
+
+static std::shared_ptr<SymbolTable> BuildTable(std::wstring text)
+{
+    auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) );
+    auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+    auto parser = std::make_shared<PythonCoreParser>(lexer);
+
+    return SymbolTable::Build( std::static_pointer_cast<FileInputNode>( parser->ParseFileInput() ) );
+}
+
+/* Child scopes in source order, index by index. */
+static Scope * Child(Scope *scope, unsigned int index)
+{
+    REQUIRE( index < scope->GetChildren().size() );
+    return scope->GetChildren()[index];
+}
+
+static Symbol & Get(Scope *scope, const wchar_t *name)
+{
+    auto index = scope->Find(name);
+    REQUIRE( index != Symbol::NoSlot );
+    return scope->GetSymbol(index);
+}
+
+TEST_CASE( "Symbol table", "Parser" )
+{
+
+    SECTION( "Local, cell, free and global" )
+    {
+        auto table = BuildTable( L"x = 1\ndef f(a):\n    b = a\n    def g():\n        return a + b + x + len\n    return g\n" );
+        auto module = table->GetModule();
+        auto f = Child(module, 0);
+        auto g = Child(f, 0);
+
+        REQUIRE( module->GetKind() == ScopeKind::Module );
+        REQUIRE( f->GetKind() == ScopeKind::Function );
+        REQUIRE( Get(module, L"x").mKind == SymbolKind::Global );
+        REQUIRE( Get(module, L"f").mKind == SymbolKind::Global );
+        REQUIRE( Get(f, L"a").mKind == SymbolKind::Cell );
+        REQUIRE( Get(f, L"b").mKind == SymbolKind::Cell );
+        REQUIRE( Get(f, L"g").mKind == SymbolKind::Local );
+        REQUIRE( Get(g, L"a").mKind == SymbolKind::Free );
+        REQUIRE( Get(g, L"b").mKind == SymbolKind::Free );
+        REQUIRE( Get(g, L"x").mKind == SymbolKind::Global );
+        REQUIRE( Get(g, L"len").mKind == SymbolKind::Global );
+        REQUIRE( Get(g, L"x").mSlot == Get(module, L"x").mSlot );
+        REQUIRE( table->GetGlobalName( Get(g, L"len").mSlot ) == L"len" );
+    }
+
+    SECTION( "Slots are dense, parameters first, star parameters last" )
+    {
+        auto table = BuildTable( L"def f(a, b=1, *c, d, **e):\n    y = 1\n    z = a\n    def g():\n        return z\n" );
+        auto f = Child(table->GetModule(), 0);
+
+        REQUIRE( f->ParameterCount() == 5 );
+        REQUIRE( Get(f, L"a").mSlot == 0 );
+        REQUIRE( Get(f, L"b").mSlot == 1 );
+        REQUIRE( Get(f, L"d").mSlot == 2 );
+        REQUIRE( Get(f, L"c").mSlot == 3 );
+        REQUIRE( Get(f, L"e").mSlot == 4 );
+        REQUIRE( Get(f, L"y").mSlot == 5 );
+        REQUIRE( Get(f, L"g").mSlot == 6 );
+        REQUIRE( Get(f, L"z").mKind == SymbolKind::Cell );
+        REQUIRE( Get(f, L"z").mSlot == 7 );
+        REQUIRE( f->SlotCount() == 8 );
+        REQUIRE( Get(Child(f, 0), L"z").mSlot == 0 );
+    }
+
+    SECTION( "Class bodies are skipped by nested functions" )
+    {
+        auto table = BuildTable( L"def f():\n    x = 1\n    class A:\n        x = 2\n        y = x\n        def m(self):\n            return x\n" );
+        auto f = Child(table->GetModule(), 0);
+        auto a = Child(f, 0);
+        auto m = Child(a, 0);
+
+        REQUIRE( a->GetKind() == ScopeKind::Class );
+        REQUIRE( Get(f, L"x").mKind == SymbolKind::Cell );
+        REQUIRE( Get(a, L"x").mKind == SymbolKind::Local );
+        REQUIRE( (Get(a, L"x").mFlags & Symbol::FreeInClass) != 0 );
+        REQUIRE( Get(a, L"y").mSlot == Symbol::NoSlot );
+        REQUIRE( Get(m, L"x").mKind == SymbolKind::Free );
+        REQUIRE( Get(m, L"self").mKind == SymbolKind::Local );
+    }
+
+    SECTION( "Global and nonlocal declarations" )
+    {
+        auto table = BuildTable( L"def f():\n    global g\n    g = 1\n    n = 0\n    def h():\n        nonlocal n\n        n += 1\n        g\n" );
+        auto f = Child(table->GetModule(), 0);
+        auto h = Child(f, 0);
+
+        REQUIRE( Get(f, L"g").mKind == SymbolKind::Global );
+        REQUIRE( Get(f, L"n").mKind == SymbolKind::Cell );
+        REQUIRE( Get(h, L"n").mKind == SymbolKind::Free );
+        REQUIRE( Get(h, L"g").mKind == SymbolKind::Global );
+
+        table = BuildTable( L"def f():\n    i += 1\n" );
+        REQUIRE( Get(Child(table->GetModule(), 0), L"i").mKind == SymbolKind::Local );
+
+        REQUIRE_THROWS_AS( BuildTable( L"nonlocal x\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( BuildTable( L"def f():\n    nonlocal x\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( BuildTable( L"def f(x):\n    global x\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE_THROWS_AS( BuildTable( L"def f():\n    x = 1\n    def g():\n        global x\n        nonlocal x\n" ), std::shared_ptr<SyntaxError> );
+    }
+
+    SECTION( "Comprehensions and lambdas" )
+    {
+        auto table = BuildTable( L"def f(xs):\n    k = 2\n    return [x * k for x in xs if x], lambda y=k: y\n" );
+        auto f = Child(table->GetModule(), 0);
+        auto comp = Child(f, 0);
+        auto lambda = Child(f, 1);
+
+        REQUIRE( comp->GetKind() == ScopeKind::Comprehension );
+        REQUIRE( Get(comp, L"x").mKind == SymbolKind::Local );
+        REQUIRE( Get(comp, L"k").mKind == SymbolKind::Free );
+        REQUIRE( comp->Find(L"xs") == Symbol::NoSlot );
+        REQUIRE( Get(f, L"xs").mKind == SymbolKind::Local );
+        REQUIRE( Get(f, L"k").mKind == SymbolKind::Cell );
+        REQUIRE( lambda->GetKind() == ScopeKind::Lambda );
+        REQUIRE( Get(lambda, L"y").mKind == SymbolKind::Local );
+        REQUIRE( lambda->Find(L"k") == Symbol::NoSlot );
+    }
+
+    SECTION( "Assignment expressions bind outside the comprehension" )
+    {
+        auto table = BuildTable( L"def f(xs):\n    return [last := x for x in xs], last\n" );
+        auto f = Child(table->GetModule(), 0);
+        auto comp = Child(f, 0);
+
+        REQUIRE( Get(f, L"last").mKind == SymbolKind::Cell );
+        REQUIRE( Get(comp, L"last").mKind == SymbolKind::Free );
+
+        table = BuildTable( L"[y := 1 for x in z]\n" );
+        REQUIRE( Get(Child(table->GetModule(), 0), L"y").mKind == SymbolKind::Global );
+    }
+
+    SECTION( "Keyword names and attributes are not variables" )
+    {
+        auto table = BuildTable( L"def f():\n    a = 1\n    return g(key=a).attr\n" );
+        auto f = Child(table->GetModule(), 0);
+
+        REQUIRE( f->Find(L"key") == Symbol::NoSlot );
+        REQUIRE( f->Find(L"attr") == Symbol::NoSlot );
+        REQUIRE( Get(f, L"g").mKind == SymbolKind::Global );
+    }
+
+}
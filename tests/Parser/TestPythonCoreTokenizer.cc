@@ -360,7 +360,7 @@ TEST_CASE( "Operators and Delimitors", "Tokenizer" )
         lexer->Advance();
 
         REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::PyNotEqual );
-        REQUIRE( sourceBuffer->BufferPosition() == 3);
+        REQUIRE( sourceBuffer->BufferPosition() == 2);
 
     }
 
@@ -411,7 +411,7 @@ TEST_CASE( "Operators and Delimitors", "Tokenizer" )
 
         lexer->Advance();
 
-        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::PyModulo );
+        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::PyMatrice );
         REQUIRE( sourceBuffer->BufferPosition() == 1);
 
     }
@@ -533,6 +533,24 @@ TEST_CASE( "Operators and Delimitors", "Tokenizer" )
 
     }
 
+    SECTION( "Operator or delimiter '..' in Lexer!" )
+    {
+
+        auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"..a " ) );
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+
+        lexer->Advance();
+
+        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::PyDot );
+        REQUIRE( sourceBuffer->BufferPosition() == 1);
+
+        lexer->Advance();
+
+        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::PyDot );
+        REQUIRE( sourceBuffer->BufferPosition() == 2);
+
+    }
+
     SECTION( "Operator or delimiter ':' in Lexer!" )
     {
 
@@ -1194,4 +1212,423 @@ TEST_CASE( "Reserved keywords", "Tokenizer" )
     
     }
 
-}
\ No newline at end of file
+    SECTION( "Imaginary number in lexer!" )
+    {
+
+        auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"4j " ) );
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+
+        lexer->Advance();
+
+        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::Number );
+        REQUIRE( std::static_pointer_cast<NumberToken>(lexer->CurSymbol())->IsImaginaryNumber() );
+        REQUIRE( lexer->CurSymbol()->GetTokenEndPosition() == 2);
+    
+    }
+
+    SECTION( "Zero and octal number in lexer!" )
+    {
+
+        auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"0 0o17 " ) );
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+
+        lexer->Advance();
+
+        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::Number );
+        REQUIRE( sourceBuffer->BufferPosition() == 1);
+
+        lexer->Advance();
+
+        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::Number );
+        REQUIRE( *std::static_pointer_cast<NumberToken>(lexer->CurSymbol())->GetText() == L"0o17" );
+    
+    }
+
+    SECTION( "Single quoted string in lexer!" )
+    {
+
+        auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"'a' " ) );
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+
+        lexer->Advance();
+
+        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::String );
+        REQUIRE( sourceBuffer->BufferPosition() == 3);
+    
+    }
+
+    SECTION( "Escaped quote in string in lexer!" )
+    {
+
+        auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"'a\\'b\\\\' " ) );
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+
+        lexer->Advance();
+
+        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::String );
+        REQUIRE( sourceBuffer->BufferPosition() == 8);
+    
+    }
+
+    SECTION( "String prefixes in lexer!" )
+    {
+
+        auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"r'a' u'b' Rb'c' f'd' 'e' " ) );
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+
+        lexer->Advance();
+        auto raw = std::static_pointer_cast<StringToken>(lexer->CurSymbol());
+        REQUIRE( raw->IsRaw() );
+        REQUIRE_FALSE( raw->IsUnicode() );
+
+        lexer->Advance();
+        REQUIRE( std::static_pointer_cast<StringToken>(lexer->CurSymbol())->IsUnicode() );
+
+        lexer->Advance();
+        REQUIRE( std::static_pointer_cast<StringToken>(lexer->CurSymbol())->IsRaw() );
+        REQUIRE( std::static_pointer_cast<StringToken>(lexer->CurSymbol())->IsBytes() );
+
+        lexer->Advance();
+        REQUIRE( std::static_pointer_cast<StringToken>(lexer->CurSymbol())->IsFormated() );
+
+        lexer->Advance();
+        auto plain = std::static_pointer_cast<StringToken>(lexer->CurSymbol());
+        REQUIRE_FALSE( plain->IsRaw() );
+        REQUIRE_FALSE( plain->IsFormated() );
+        REQUIRE_FALSE( plain->IsBytes() );
+
+        auto illegal = std::make_shared<PythonCoreTokenizer>(4, std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"uf'a' " ) ));
+        REQUIRE_THROWS_AS( illegal->Advance(), std::shared_ptr<LexicalError> );
+    
+    }
+
+}
+
+
+TEST_CASE( "Number tokens", "Tokenizer" )
+{
+
+    SECTION( "Positions and kind flags are kept apart" )
+    {
+
+        auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"12 1.5 3j 2.5e3j " ) );
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+
+        struct Expected { unsigned int mStart; unsigned int mEnd; bool mReal; bool mImaginary; const wchar_t *mText; };
+        Expected expected[] = { { 0, 2, false, false, L"12" }, { 3, 6, true, false, L"1.5" }, { 7, 9, false, true, L"3j" }, { 10, 16, true, true, L"2.5e3j" } };
+
+        for (auto &number : expected)
+        {
+            lexer->Advance();
+            auto token = std::static_pointer_cast<NumberToken>(lexer->CurSymbol());
+
+            REQUIRE( token->GetSymbolKind() == TokenKind::Number );
+            REQUIRE( token->GetTokenStartPosition() == number.mStart );
+            REQUIRE( token->GetTokenEndPosition() == number.mEnd );
+            REQUIRE( token->IsRealNumber() == number.mReal );
+            REQUIRE( token->IsImaginaryNumber() == number.mImaginary );
+            REQUIRE( *token->GetText() == number.mText );
+        }
+
+    }
+
+    SECTION( "Radix prefixes in either case" )
+    {
+
+        auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"0x1F 0XaB 0o17 0O7 0b101 0B1_0 0 " ) );
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+
+        for (auto text : { L"0x1F", L"0XaB", L"0o17", L"0O7", L"0b101", L"0B1_0", L"0" })
+        {
+            lexer->Advance();
+
+            REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::Number );
+            REQUIRE( *std::static_pointer_cast<NumberToken>(lexer->CurSymbol())->GetText() == text );
+        }
+
+    }
+
+    SECTION( "Digits outside the radix are errors" )
+    {
+
+        for (auto text : { L"0o8 ", L"0o17_9 ", L"0b2 ", L"0b12 ", L"0B1_3 " })
+        {
+            auto lexer = std::make_shared<PythonCoreTokenizer>(4, std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) ));
+
+            REQUIRE_THROWS_AS( lexer->Advance(), std::shared_ptr<LexicalError> );
+        }
+
+    }
+
+}
+
+
+TEST_CASE( "String quotes", "Tokenizer" )
+{
+
+    SECTION( "A string ends at its closing quote" )
+    {
+
+        struct Expected { const wchar_t *mSource; unsigned int mEnd; };
+        Expected expected[] = {
+            { L"'a' ", 3 },
+            { L"\"b\" ", 3 },
+            { L"'' ", 2 },
+            { L"'x\"y' ", 5 },
+            { L"'it\\'s' ", 7 },
+            { L"'''a'b''' ", 9 },
+            { L"\"\"\"a\"\"\" ", 7 },
+            { L"r'a\\'' ", 6 }
+        };
+
+        for (auto &string : expected)
+        {
+            auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( string.mSource ) );
+            auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+
+            lexer->Advance();
+
+            REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::String );
+            REQUIRE( lexer->CurSymbol()->GetTokenEndPosition() == string.mEnd );
+
+            lexer->Advance();
+
+            REQUIRE( lexer->CurSymbol()->GetSymbolKind() != TokenKind::String );
+        }
+
+    }
+
+    SECTION( "Unterminated strings are errors" )
+    {
+
+        for (auto text : { L"'a", L"\"a\n\" ", L"'''a'' " })
+        {
+            auto lexer = std::make_shared<PythonCoreTokenizer>(4, std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) ));
+
+            REQUIRE_THROWS_AS( lexer->Advance(), std::shared_ptr<LexicalError> );
+        }
+
+    }
+
+}
+
+
+/* Exposes how many tokens the tokenizer holds. */
+class BufferedTokenizer : public PythonCoreTokenizer
+{
+    public:
+        using PythonCoreTokenizer::PythonCoreTokenizer;
+
+        std::size_t Buffered() { return mTokens.size(); }
+};
+
+TEST_CASE( "Token buffer", "Tokenizer" )
+{
+
+    SECTION( "Released tokens keep their indexes" )
+    {
+
+        auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"a b c d e " ) );
+        auto lexer = std::make_shared<BufferedTokenizer>(4, sourceBuffer);
+
+        for (int i = 0; i < 4; i++) lexer->Advance();
+        lexer->Release(2);
+
+        REQUIRE( lexer->Buffered() == 2 );
+        REQUIRE( lexer->TokenIndex() == 3 );
+        REQUIRE( lexer->Position() == 7 );
+
+        lexer->Rewind(2);
+
+        REQUIRE( *std::static_pointer_cast<NameToken>(lexer->CurSymbol())->GetText() == L"c" );
+        REQUIRE( lexer->Position() == 5 );
+
+        lexer->Advance();
+        lexer->Advance();
+
+        REQUIRE( *std::static_pointer_cast<NameToken>(lexer->CurSymbol())->GetText() == L"e" );
+        REQUIRE( lexer->TokenIndex() == 4 );
+
+        /* The current token is never dropped. */
+        lexer->Release(10);
+
+        REQUIRE( lexer->Buffered() == 1 );
+        REQUIRE( lexer->CurSymbol()->GetTokenStartPosition() == 8 );
+
+    }
+
+    SECTION( "The parser holds one statement's tokens" )
+    {
+
+        std::wstring text;
+        for (int i = 0; i < 1000; i++) text += L"x = [1, 2, 3]\nmatch x:\n    case [a, (b, c)]:\n        pass\n";
+
+        auto lexer = std::make_shared<BufferedTokenizer>(4, std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) ));
+        auto parser = std::make_shared<PythonCoreParser>(lexer);
+        auto root = std::static_pointer_cast<AST::FileInputNode>( parser->ParseFileInput() );
+
+        REQUIRE( root->GetNodes()->size() == 2000 );
+        REQUIRE( lexer->Buffered() < 40 );
+
+    }
+
+}
+
+
+TEST_CASE( "Operator spans", "Tokenizer" )
+{
+
+    SECTION( "Two character operators end after their second character" )
+    {
+
+        auto sourceBuffer = std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"a!=b@c @= d " ) );
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, sourceBuffer);
+
+        struct Expected { TokenKind mKind; unsigned int mStart; unsigned int mEnd; };
+        Expected expected[] = {
+            { TokenKind::Name, 0, 1 },
+            { TokenKind::PyNotEqual, 1, 3 },
+            { TokenKind::Name, 3, 4 },
+            { TokenKind::PyMatrice, 4, 5 },
+            { TokenKind::Name, 5, 6 },
+            { TokenKind::PyMatriceAssign, 7, 9 },
+            { TokenKind::Name, 10, 11 }
+        };
+
+        for (auto &token : expected)
+        {
+            lexer->Advance();
+
+            REQUIRE( lexer->CurSymbol()->GetSymbolKind() == token.mKind );
+            REQUIRE( lexer->CurSymbol()->GetTokenStartPosition() == token.mStart );
+            REQUIRE( lexer->CurSymbol()->GetTokenEndPosition() == token.mEnd );
+        }
+
+        REQUIRE_THROWS_AS( PythonCoreTokenizer(4, std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"! " ) )).Advance(), std::shared_ptr<LexicalError> );
+
+    }
+
+}
+
+
+TEST_CASE( "Indentation", "Tokenizer" )
+{
+
+    SECTION( "Tabs advance to the tab size given" )
+    {
+
+        auto kinds = [](unsigned int tabSize)
+        {
+            auto lexer = std::make_shared<PythonCoreTokenizer>(tabSize, std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"if a:\n    b\n\tc\n" ) ));
+            std::vector<TokenKind> result;
+
+            do
+            {
+                lexer->Advance();
+                result.push_back( lexer->CurSymbol()->GetSymbolKind() );
+            } while (result.back() != TokenKind::EndOfFile);
+
+            return result;
+        };
+
+        REQUIRE( kinds(4) == std::vector<TokenKind> {
+            TokenKind::PyIf, TokenKind::Name, TokenKind::PyColon, TokenKind::Newline,
+            TokenKind::Indent, TokenKind::Name, TokenKind::Newline,
+            TokenKind::Name, TokenKind::Newline,
+            TokenKind::Dedent, TokenKind::EndOfFile } );
+
+        REQUIRE( kinds(8) == std::vector<TokenKind> {
+            TokenKind::PyIf, TokenKind::Name, TokenKind::PyColon, TokenKind::Newline,
+            TokenKind::Indent, TokenKind::Name, TokenKind::Newline,
+            TokenKind::Indent, TokenKind::Name, TokenKind::Newline,
+            TokenKind::Dedent, TokenKind::Dedent, TokenKind::EndOfFile } );
+
+    }
+
+    SECTION( "A fresh tokenizer starts at column zero" )
+    {
+
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"a\n" ) ));
+
+        lexer->Advance();
+        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::Name );
+        lexer->Advance();
+        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::Newline );
+        lexer->Advance();
+        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::EndOfFile );
+
+    }
+
+}
+
+
+TEST_CASE( "Soft keywords", "Tokenizer" )
+{
+
+    SECTION( "Only the whole name is a soft keyword" )
+    {
+
+        auto name = [](const wchar_t *text)
+        {
+            return std::make_shared<NameToken>(0, 0, std::make_shared<std::wstring>( text ), std::make_shared<std::vector<std::shared_ptr<Trivia>>>());
+        };
+
+        REQUIRE( name(L"match")->IsMatchSoftKeyword() );
+        REQUIRE( name(L"case")->IsCaseSoftKeyword() );
+        REQUIRE( name(L"_")->IsWildCardPattern() );
+
+        REQUIRE_FALSE( name(L"matches")->IsMatchSoftKeyword() );
+        REQUIRE_FALSE( name(L"mat")->IsMatchSoftKeyword() );
+        REQUIRE_FALSE( name(L"cases")->IsCaseSoftKeyword() );
+        REQUIRE_FALSE( name(L"_x")->IsWildCardPattern() );
+
+    }
+
+}
+
+
+TEST_CASE( "Comments", "Tokenizer" )
+{
+
+    SECTION( "A comment ends at the end of its line" )
+    {
+
+        for (auto text : { L"a # note\nb\n", L"a # note\r\nb\n", L"a #\nb\n" })
+        {
+            auto lexer = std::make_shared<PythonCoreTokenizer>(4, std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) ));
+
+            lexer->Advance();
+            REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::Name );
+            lexer->Advance();
+            REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::Newline );
+            lexer->Advance();
+            REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::Name );
+        }
+
+    }
+
+    SECTION( "Only '# type: ' starts a type comment" )
+    {
+
+        auto lexer = std::make_shared<PythonCoreTokenizer>(4, std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( L"a # type: int\n" ) ));
+
+        lexer->Advance();
+        lexer->Advance();
+
+        REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::TypeComment );
+        REQUIRE( lexer->CurSymbol()->GetTokenStartPosition() == 2 );
+        REQUIRE( lexer->CurSymbol()->GetTokenEndPosition() == 13 );
+
+        for (auto text : { L"a # types: int\n", L"a # typo\n", L"a #type: int\n" })
+        {
+            lexer = std::make_shared<PythonCoreTokenizer>(4, std::make_shared<SourceBuffer>( std::make_shared<std::wstring>( text ) ));
+
+            lexer->Advance();
+            lexer->Advance();
+
+            REQUIRE( lexer->CurSymbol()->GetSymbolKind() == TokenKind::Newline );
+        }
+
+    }
+
+}
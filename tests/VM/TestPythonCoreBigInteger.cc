@@ -0,0 +1,110 @@
+#include <catch2/catch.hpp>
+
+#include <vm/BigInteger.h>
+
+using namespace PythonCoreNative::RunTime::VM;
+
+
+static BigInteger Parse(const wchar_t *text, unsigned int base = 0)
+{
+    BigInteger result;
+    REQUIRE( BigInteger::Parse(text, base, result) );
+    return result;
+}
+
+TEST_CASE( "Big integers", "BigInteger" )
+{
+
+    SECTION( "Literals in every base" )
+    {
+        REQUIRE( Parse(L"0xFFFF_FFFF_FFFF_FFFF_FFFF").ToString() == L"1208925819614629174706175" );
+        REQUIRE( Parse(L"-0o7777777777777777777777777").ToString(8) == L"-7777777777777777777777777" );
+        REQUIRE( Parse(L"0b1" L"0000000000000000000000000000000000000000000000000000000000000000").ToString(16) == L"10000000000000000" );
+        REQUIRE( Parse(L"123456789012345678901234567890", 10).ToString() == L"123456789012345678901234567890" );
+        REQUIRE( Parse(L"zz", 36).ToString() == L"1295" );
+
+        BigInteger result;
+        REQUIRE( !BigInteger::Parse(L"12a", 10, result) );
+        REQUIRE( !BigInteger::Parse(L"1__2", 10, result) );
+        REQUIRE( !BigInteger::Parse(L"_1", 10, result) );
+        REQUIRE( !BigInteger::Parse(L"0x", 0, result) );
+    }
+
+    SECTION( "Arithmetic follows Python" )
+    {
+        auto big = BigInteger::Power(BigInteger(10), 40);
+        BigInteger quotient, remainder;
+
+        BigInteger::DivMod(-big, BigInteger(7), quotient, remainder);
+        REQUIRE( quotient.ToString() == L"-1428571428571428571428571428571428571429" );
+        REQUIRE( remainder.ToString() == L"3" );
+
+        auto mask = BigInteger::Power(BigInteger(2), 100) - BigInteger(1);
+        REQUIRE( (mask & -BigInteger::Power(BigInteger(2), 70)).ToString() == L"1267650599047637780779291901952" );
+        REQUIRE( (-BigInteger::Power(BigInteger(2), 100) >> 3).ToString() == L"-158456325028528675187087900672" );
+        REQUIRE( ((BigInteger(-7) >> 1)).ToString() == L"-4" );
+        REQUIRE( (~BigInteger::Power(BigInteger(2), 80) | BigInteger(5)).ToString() == L"-1208925819614629174706177" );
+        REQUIRE( (BigInteger(1) << 200).ToString() == L"1606938044258990275541962092341162602522202993782792835301376" );
+
+        REQUIRE( BigInteger(INT64_MIN).FitsInt64() );
+        REQUIRE( !(-BigInteger(INT64_MIN)).FitsInt64() );
+        REQUIRE( (BigInteger(INT64_MAX) + BigInteger(1) - BigInteger(1)).ToInt64() == INT64_MAX );
+    }
+
+    SECTION( "Karatsuba products and subquadratic conversion" )
+    {
+        auto three = BigInteger::Power(BigInteger(3), 20000);
+        auto text = three.ToString();
+
+        REQUIRE( text.size() == 9543 );
+        REQUIRE( text.substr(0, 20) == L"26613034272174197919" );
+        REQUIRE( text.substr(text.size() - 20) == L"08807535253104400001" );
+        REQUIRE( Parse(text.c_str(), 10).Compare(three) == 0 );
+
+        auto seven = BigInteger::Power(BigInteger(7), 50000);
+        text = seven.ToString();
+        REQUIRE( text.size() == 42255 );
+        REQUIRE( text.substr(0, 20) == L"79799599708020962519" );
+        REQUIRE( text.substr(text.size() - 20) == L"82682427564030000001" );
+
+        auto five = BigInteger::Power(BigInteger(5), 30000);
+        auto hex = five.ToString(16);
+        REQUIRE( hex.size() == 17415 );
+        REQUIRE( hex.substr(0, 20) == L"39650dae70e05db2e000" );
+        REQUIRE( Parse((L"0x" + hex).c_str()).Compare(five) == 0 );
+
+        /* Unbalanced and balanced products divide back exactly. */
+        BigInteger quotient, remainder;
+
+        BigInteger::DivMod(seven * five + BigInteger(12345), five, quotient, remainder);
+        REQUIRE( quotient.Compare(seven) == 0 );
+        REQUIRE( remainder.ToString() == L"12345" );
+
+        BigInteger::DivMod(three * -three, three, quotient, remainder);
+        REQUIRE( quotient.Compare(-three) == 0 );
+        REQUIRE( remainder.IsZero() );
+    }
+
+    SECTION( "Doubles" )
+    {
+        double real;
+
+        REQUIRE( BigInteger::Power(BigInteger(2), 1000).ToDouble(real) );
+        REQUIRE( real == 0x1p1000 );
+        REQUIRE( !BigInteger::Power(BigInteger(2), 1024).ToDouble(real) );
+
+        /* 2**53 + 1 rounds to even, one more bit further down rounds up. */
+        REQUIRE( (BigInteger::Power(BigInteger(2), 80) + BigInteger::Power(BigInteger(2), 27)).ToDouble(real) );
+        REQUIRE( real == 0x1p80 );
+        REQUIRE( (BigInteger::Power(BigInteger(2), 80) + BigInteger::Power(BigInteger(2), 27) + BigInteger(1)).ToDouble(real) );
+        REQUIRE( real == 0x1p80 + 0x1p28 );
+
+        REQUIRE( BigInteger::FromDouble(-0x1.8p70).ToString() == L"-1770887431076116955136" );
+        REQUIRE( BigInteger::Power(BigInteger(2), 64).Compare(0x1p64) == 0 );
+        REQUIRE( BigInteger::Power(BigInteger(2), 64).Compare(0x1p64 + 4096.0) < 0 );
+        REQUIRE( BigInteger::Power(BigInteger(2), 64).Hash() == std::hash<double>()(0x1p64) );
+
+        REQUIRE( BigInteger::TrueDivide(BigInteger::Power(BigInteger(2), 100), BigInteger::Power(BigInteger(3), 50), real) );
+        REQUIRE( real == 1765780.963259017 );
+    }
+}
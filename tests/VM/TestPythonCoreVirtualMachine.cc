@@ -0,0 +1,338 @@
+#include <catch2/catch.hpp>
+
+#include <PythonCoreVirtualMachine.h>
+#include <SyntaxError.h>
+
+#include <sstream>
+
+using namespace PythonCoreNative::RunTime::Parser;
+using namespace PythonCoreNative::RunTime::VM;
+
+
+/* Printed output of a program. */
+static std::wstring Output(std::wstring text)
+{
+    std::wostringstream output;
+    VirtualMachine vm;
+
+    vm.SetOutput(&output);
+    vm.RunSource( std::make_shared<std::wstring>(text) );
+    return output.str();
+}
+
+static std::shared_ptr<ExecutionError> Error(std::wstring text)
+{
+    std::wostringstream output;
+    VirtualMachine vm;
+
+    vm.SetOutput(&output);
+
+    try
+    {
+        vm.RunSource( std::make_shared<std::wstring>(text) );
+    }
+    catch (std::shared_ptr<ExecutionError> &error)
+    {
+        return error;
+    }
+
+    FAIL( "No execution error!" );
+    return nullptr;
+}
+
+TEST_CASE( "Virtual machine", "VM" )
+{
+
+    SECTION( "Integer and float arithmetic" )
+    {
+        REQUIRE( Output( L"print(1 + 2 * 3, 7 // -2, 7 % -3, 2 ** 10, 1 / 4)\n" ) == L"7 -4 -2 1024 0.25\n" );
+        REQUIRE( Output( L"print(0.1 + 0.2, 1e16, 2.5 * 2, -7.5 // 2, 3 << 2, 6 & 3 | 8)\n" ) == L"0.30000000000000004 1e+16 5.0 -4.0 12 10\n" );
+    }
+
+    SECTION( "Integers beyond 48 bits are boxed" )
+    {
+        REQUIRE( Output( L"a = 2 ** 47\nprint(a - 1, -a - 1, a * 4 // a, a == 2 ** 47, {a: 1}[2 ** 47])\n" ) == L"140737488355327 -140737488355329 4 True 1\n" );
+        REQUIRE( Output( L"x = 9223372036854775807\nprint(x, -x - 1, x >> 40, ~x, list(range(x - 1, x)))\n" ) ==
+                 L"9223372036854775807 -9223372036854775808 8388607 -9223372036854775808 [9223372036854775806]\n" );
+        REQUIRE( Output( L"print(9223372036854775807 + 1, -9223372036854775807 - 2, abs(-2 ** 63))\n" ) == L"9223372036854775808 -9223372036854775809 9223372036854775808\n" );
+    }
+
+    SECTION( "Integers beyond 64 bits" )
+    {
+        REQUIRE( Output( L"f = 1\nfor i in range(1, 51):\n    f *= i\nprint(f, f // 10 ** 60, f % 1000003, -f >> 200)\n" ) ==
+                 L"30414093201713378043612608166064768844377641568960512000000000000 30414 850717 -18927\n" );
+        REQUIRE( Output( L"x = 0xFFFF_FFFF_FFFF_FFFF_FFFF\nprint(x, x - x, x // x, x == 2 ** 80 - 1, x < 2.0 ** 80, int('-123456789012345678901234567890'))\n" ) ==
+                 L"1208925819614629174706175 0 1 True True -123456789012345678901234567890\n" );
+        REQUIRE( Output( L"print(2 ** 64 == 2.0 ** 64, {2 ** 64: 'x'}[2.0 ** 64], 10 ** 30 // 10 ** 28, 2 ** 100 / 3 ** 50, float(2 ** 1000), int(1e20))\n" ) ==
+                 L"True x 100 1765780.963259017 1.0715086071862673e+301 100000000000000000000\n" );
+        REQUIRE( *Error( L"print(float(2 ** 1024))\n" )->GetType() == L"OverflowError" );
+        REQUIRE( *Error( L"print(2.0 ** 10000)\n" )->GetType() == L"OverflowError" );
+        REQUIRE( *Error( L"x = 10\nprint(x ** 400.5)\n" )->GetType() == L"OverflowError" );
+        REQUIRE( Output( L"x = 1e308\nprint(x * 10, -1e400, 2.0 ** -10000)\n" ) == L"inf -inf 0.0\n" );
+    }
+
+    SECTION( "Numeric loops do not allocate" )
+    {
+        std::wostringstream output;
+        VirtualMachine vm;
+
+        vm.SetOutput(&output);
+        vm.RunSource( std::make_shared<std::wstring>( L"s = 0.0\nn = 0\nfor i in range(200000):\n    s = s + i * 0.5\n    n = n + i\nprint(s, n)\n" ) );
+
+        REQUIRE( output.str() == L"9999950000.0 19999900000\n" );
+        REQUIRE( vm.GetCollectionCount() == 0 );
+        REQUIRE( vm.GetObjectCount() < 1000 );
+    }
+
+    SECTION( "Recursive calls" )
+    {
+        REQUIRE( Output( L"def fib(n):\n    if n < 2:\n        return n\n    return fib(n - 1) + fib(n - 2)\nprint(fib(20))\n" ) == L"6765\n" );
+    }
+
+    SECTION( "Defaults, keyword and star arguments" )
+    {
+        auto text =
+            L"def f(a, b=2, *rest, c, d=4, **kw):\n"
+            L"    return [a, b, rest, c, d, kw]\n"
+            L"print(f(1, c=3))\n"
+            L"print(f(1, 5, 6, 7, c=3, e=8))\n";
+
+        REQUIRE( Output(text) == L"[1, 2, (), 3, 4, {}]\n[1, 5, (6, 7), 3, 4, {'e': 8}]\n" );
+        REQUIRE( *Error( L"def f(a):\n    pass\nf(1, a=2)\n" )->GetType() == L"TypeError" );
+        REQUIRE( *Error( L"def f(a):\n    pass\nf()\n" )->GetType() == L"TypeError" );
+    }
+
+    SECTION( "Closures share their cells" )
+    {
+        auto text =
+            L"def counter():\n"
+            L"    n = 0\n"
+            L"    def step():\n"
+            L"        nonlocal n\n"
+            L"        n += 1\n"
+            L"        return n\n"
+            L"    return step\n"
+            L"c = counter()\n"
+            L"c()\n"
+            L"print(c(), c())\n";
+
+        REQUIRE( Output(text) == L"2 3\n" );
+    }
+
+    SECTION( "Classes, methods and inheritance" )
+    {
+        auto text =
+            L"class A:\n"
+            L"    scale = 10\n"
+            L"    def __init__(self, v):\n"
+            L"        self.v = v\n"
+            L"    def get(self):\n"
+            L"        return self.v * self.scale\n"
+            L"class B(A):\n"
+            L"    def get(self):\n"
+            L"        return A.get(self) + 1\n"
+            L"b = B(4)\n"
+            L"print(b.get(), isinstance(b, A), isinstance(A(1), B))\n";
+
+        REQUIRE( Output(text) == L"41 True False\n" );
+    }
+
+    SECTION( "Inline caches follow class and global changes" )
+    {
+        auto text =
+            L"class A:\n"
+            L"    k = 1\n"
+            L"    def f(self):\n"
+            L"        return 'A'\n"
+            L"class B(A):\n"
+            L"    pass\n"
+            L"def use(o):\n"
+            L"    return [o.k, o.f()]\n"
+            L"b = B()\n"
+            L"r = [use(b), use(b)]\n"
+            L"A.k = 2\n"
+            L"r.append(use(b))\n"
+            L"B.f = lambda self: 'B'\n"
+            L"r.append(use(b))\n"
+            L"b.k = 7\n"
+            L"r.append(use(b))\n"
+            L"del b.k\n"
+            L"r.append(use(b))\n"
+            L"def g():\n"
+            L"    return len('abc')\n"
+            L"r.append(g())\n"
+            L"len = lambda s: 0\n"
+            L"r.append(g())\n"
+            L"print(r)\n";
+
+        REQUIRE( Output(text) == L"[[1, 'A'], [1, 'A'], [2, 'A'], [2, 'B'], [7, 'B'], [2, 'B'], 3, 0]\n" );
+
+        std::wostringstream output;
+        VirtualMachine vm;
+
+        vm.SetOutput(&output);
+        vm.RunSource( std::make_shared<std::wstring>(
+            L"class P:\n    def __init__(self, x):\n        self.x = x\n"
+            L"def total(items):\n    t = 0\n    for p in items:\n        t = t + p.x\n    return t\n"
+            L"print(total([P(i) for i in range(100)]))\n" ) );
+
+        REQUIRE( output.str() == L"4950\n" );
+
+        bool found = false;
+        for (auto &site : vm.GetCacheStatistics())
+            if (site.mFunction == L"total" && site.mName == L"x")
+            {
+                found = true;
+                REQUIRE( site.mOp == PythonCoreNative::RunTime::Compiler::OpCode::GetAttr );
+                REQUIRE( site.mLine == 7 );
+                REQUIRE( site.mHits == 99 );
+                REQUIRE( site.mMisses == 1 );
+            }
+
+        REQUIRE( found );
+    }
+
+    SECTION( "Comprehensions and containers" )
+    {
+        REQUIRE( Output( L"print([x * x for x in range(5) if x % 2 == 0])\n" ) == L"[0, 4, 16]\n" );
+        REQUIRE( Output( L"print({k: len(k) for k in ['a', 'bb']}, {x % 3 for x in range(9)})\n" ) == L"{'a': 1, 'bb': 2} {0, 1, 2}\n" );
+        REQUIRE( Output( L"a = [3, 1, 2]\na.sort()\nprint(a, a[::-1], a[1:], (1,), ','.join(['x', 'y']))\n" ) == L"[1, 2, 3] [3, 2, 1] [2, 3] (1,) x,y\n" );
+        REQUIRE( Output( L"a, (b, c) = 1, [2, 3]\nprint(a + b + c)\n" ) == L"6\n" );
+
+        auto dicts =
+            L"d = {}\n"
+            L"for i in range(100):\n"
+            L"    d[i] = i\n"
+            L"for i in range(0, 100, 3):\n"
+            L"    del d[i]\n"
+            L"d[0] = 'z'\n"
+            L"d[1.0] = 'one'\n"
+            L"print(len(d), list(d)[:4], d[1], list(d)[-1], 3 in d, 4 in d)\n";
+
+        REQUIRE( Output(dicts) == L"67 [1, 2, 4, 5] one 0 False True\n" );
+        REQUIRE( Output( L"a = []\na.append(a)\nd = {}\nd['k'] = d\nt = (a, [a])\nprint(a, d, t)\n" ) == L"[[...]] {'k': {...}} ([[...]], [[[...]]])\n" );
+        REQUIRE( Output( L"n = 2 ** 62\nprint([] * n, () * n, [1, 2] * 2, (1,) * 3, [0] * -1)\n" ) == L"[] () [1, 2, 1, 2] (1, 1, 1) []\n" );
+        REQUIRE( *Error( L"n = 2 ** 62\nprint(len([1] * n))\n" )->GetType() == L"MemoryError" );
+        REQUIRE( *Error( L"n = 10 ** 17\nprint(len((1, 2) * n))\n" )->GetType() == L"MemoryError" );
+        REQUIRE( *Error( L"a = []\nfor i in range(100000):\n    a = [a]\nprint(a)\n" )->GetType() == L"RecursionError" );
+        REQUIRE( Output( L"a = []\nfor i in range(500):\n    a = [a]\nprint(len(repr(a)))\n" ) == L"1002\n" );
+    }
+
+    SECTION( "Long chains and displays" )
+    {
+        std::wstring chain = L"a", list, dict;
+
+        for (int i = 1; i < 1000; i++) chain += L" + a";
+
+        for (int i = 0; i < 1000; i++)
+        {
+            list += std::to_wstring(i) + L", ";
+            dict += std::to_wstring(i) + L": x, ";
+        }
+
+        REQUIRE( Output( L"a = 3\nprint(" + chain + L")\ndef f(a):\n    return " + chain + L"\nprint(f(2))\n" ) == L"3000\n2000\n" );
+        REQUIRE( Output( L"l = [" + list + L"]\nt = (" + list + L")\nprint(len(l), l[999], sum(l), len(t), t[500])\n" ) == L"1000 999 499500 1000 500\n" );
+        REQUIRE( Output( L"def f(x):\n    x = {" + dict + L"}\n    return len(x), x[999]\nprint(f('v'))\n" ) == L"(1000, 'v')\n" );
+        REQUIRE( Output( L"def f(x):\n    x = [x, " + list + L"x]\n    return len(x), x[-1]\nprint(f(7))\n" ) == L"(1002, 7)\n" );
+    }
+
+    SECTION( "Strings of mixed widths" )
+    {
+        REQUIRE( Output( L"a = 'caf\u00e9'\nb = a + '\u20ac'\nprint(len(b), b[3], b[-1], b.find('\u20ac'), b[1:4] == 'af\u00e9', 'x' * 3)\n" ) == L"5 \u00e9 \u20ac 4 True xxx\n" );
+        REQUIRE( Output( L"s = '-'.join(['a', '\u00e9', '\u4e2d'])\nprint(s, s.split('-'), s.replace('\u00e9', 'e'), 'a\u4e2d'.upper())\n" ) ==
+                 L"a-\u00e9-\u4e2d ['a', '\u00e9', '\u4e2d'] a-e-\u4e2d A\u4e2d\n" );
+        REQUIRE( Output( L"s = '  ab cd  '\nprint(s.strip(), s.split(), 'ab' < 'a\u00e9', '\u20ac' in 'x\u20ac', {'\u00e9': 1}['\u00e9'], s.startswith('  a'), 'a\u00e9'.endswith('\u00e9'))\n" ) ==
+                 L"ab cd ['ab', 'cd'] True True 1 True True\n" );
+        REQUIRE( Output( L"print('h\u00e9llo'.upper(), 'stra\u00dfe'.upper(), '\u03a3\u0391\u03a3 \u03a3'.lower(), '\u041c\u0418\u0420'.lower(), '\u0101\u0180\u1e9e'.upper())\n" ) ==
+                 L"H\u00c9LLO STRASSE \u03c3\u03b1\u03c2 \u03c3 \u043c\u0438\u0440 \u0100\u0243\u1e9e\n" );
+        REQUIRE( Output( L"n = 10 ** 12\ne = ''\nprint(len(e * n), len('ab\u20ac' * 3), ('ab\u20ac' * 5)[-4:], 'x' * -1 == '')\n" ) == L"0 9 \u20acab\u20ac True\n" );
+        REQUIRE( *Error( L"n = 10 ** 18\nprint(len('ab' * n))\n" )->GetType() == L"MemoryError" );
+        REQUIRE( *Error( L"n = 2 ** 62\nprint(len('ab\u20ac' * n))\n" )->GetType() == L"OverflowError" );
+        REQUIRE( Output( L"s = 'x\u20ac' * 40 + 'ab\u20acc'\nprint(s.find('ab\u20acc'), s.find('\u20acx\u20acy'), s.split('ab')[1], len(s.replace('x', '')), ('ab' * 20 + 'abc').find('abc'))\n" ) ==
+                 L"80 -1 \u20acc 44 40\n" );
+        REQUIRE_THROWS_AS( Output( L"print(b'a' == 'a')\n" ), std::shared_ptr<SyntaxError> );
+        REQUIRE( *Error( L"print('a'.encode())\n" )->GetType() == L"AttributeError" );
+    }
+
+    SECTION( "Match statements" )
+    {
+        auto text =
+            L"class Point:\n"
+            L"    __match_args__ = ('x', 'y')\n"
+            L"    def __init__(self, x, y):\n"
+            L"        self.x = x\n"
+            L"        self.y = y\n"
+            L"def f(v):\n"
+            L"    match v:\n"
+            L"        case 0 | -1 | 'zero':\n"
+            L"            return 'z'\n"
+            L"        case None:\n"
+            L"            return 'none'\n"
+            L"        case [1, *rest, 9]:\n"
+            L"            return rest\n"
+            L"        case [a, b] if a > b:\n"
+            L"            return 'desc'\n"
+            L"        case (a, _):\n"
+            L"            return a\n"
+            L"        case {'k': 1, **others}:\n"
+            L"            return others\n"
+            L"        case Point(0, y=y):\n"
+            L"            return y\n"
+            L"        case int(n) | float(n):\n"
+            L"            return n * 2\n"
+            L"        case _:\n"
+            L"            return 'other'\n"
+            L"print([f(v) for v in [0, -1, 'zero', None, [1, 9], (1, 2, 3, 9), [3, 2], [2, 3], {'k': 1, 'j': 2}, {'k': 2}]])\n"
+            L"print([f(v) for v in [Point(0, 5), Point(1, 5), 4, 1.5, 'x']])\n";
+
+        REQUIRE( Output(text) == L"['z', 'z', 'z', 'none', [], [2, 3], 'desc', 2, {'j': 2}, 'other']\n[5, 'other', 8, 3.0, 'other']\n" );
+
+        /* A false guard moves on to the next case, not to another alternative of its own. */
+        auto guards =
+            L"def g(v):\n"
+            L"    match v:\n"
+            L"        case (x, 1) | (1, x) if x > 5:\n"
+            L"            return 'big'\n"
+            L"        case (x, _):\n"
+            L"            return x\n"
+            L"print(g((1, 10)), g((10, 1)), g((1, 2)), g((2, 1)), g((1, 1)))\n";
+
+        REQUIRE( Output(guards) == L"big big 1 2 1\n" );
+        REQUIRE( *Error( L"class A:\n    pass\nmatch A():\n    case A(1):\n        pass\n" )->GetType() == L"TypeError" );
+    }
+
+    SECTION( "Errors carry their type and line" )
+    {
+        auto error = Error( L"x = 1\ny = [1, 2]\nz = y[x + 5]\n" );
+
+        REQUIRE( *error->GetType() == L"IndexError" );
+        REQUIRE( error->GetLine() == 3 );
+
+        error = Error( L"class E(ValueError):\n    pass\ndef f():\n    raise E('bad')\nf()\n" );
+
+        REQUIRE( *error->GetType() == L"E" );
+        REQUIRE( *error->GetMessage() == L"bad" );
+        REQUIRE( error->GetLine() == 4 );
+
+        REQUIRE( *Error( L"print(1 // 0)\n" )->GetType() == L"ZeroDivisionError" );
+        REQUIRE( *Error( L"print(5 // 0.0)\n" )->GetMessage() == L"float floor division by zero" );
+        REQUIRE( *Error( L"print(5 % 0.0)\n" )->GetMessage() == L"float modulo" );
+        REQUIRE( *Error( L"print(undefined)\n" )->GetType() == L"NameError" );
+        REQUIRE( *Error( L"def f():\n    print(x)\n    x = 1\nf()\n" )->GetType() == L"UnboundLocalError" );
+        REQUIRE( *Error( L"def f(n):\n    return f(n + 1)\nf(0)\n" )->GetType() == L"RecursionError" );
+        REQUIRE( *Error( L"assert 1 == 2, 'no'\n" )->GetType() == L"AssertionError" );
+    }
+
+    SECTION( "Garbage is collected at loop back edges" )
+    {
+        std::wostringstream output;
+        VirtualMachine vm;
+
+        vm.SetOutput(&output);
+        vm.RunSource( std::make_shared<std::wstring>( L"keep = [[0]]\nfor i in range(300000):\n    t = [i]\nprint(keep, t)\n" ) );
+
+        REQUIRE( output.str() == L"[[0]] [299999]\n" );
+        REQUIRE( vm.GetCollectionCount() > 0 );
+        REQUIRE( vm.GetObjectCount() < 200000 );
+    }
+}